@@ -37,6 +37,7 @@
 #include "cdb/cdbappendonlystorageread.h"
 #include "cdb/cdbappendonlystoragewrite.h"
 #include "cdb/cdbvars.h"
+#include "executor/execBatch.h"
 #include "executor/executor.h"
 #include "commands/defrem.h"
 #include "fmgr.h"
@@ -93,6 +94,330 @@ open_datumstreamread_segfile(
 							  fileSegNo, segInfo->formatversion);
 }
 
+/*
+ * Derive the zone map filters from the scan keys. A column gets a filter if
+ * its type has zone maps and at least one key restricts it.
+ */
+static void
+aocs_zonemap_init(AOCSScanDesc scan)
+{
+	TupleDesc	tupdesc = scan->columnScanInfo.relationTupleDesc;
+	ScanKey		keys = scan->rs_base.rs_key;
+	int			nkeys = scan->rs_base.rs_nkeys;
+	AOCSZoneMapFilter *filters;
+	int			nfilters = 0;
+
+	filters = palloc0(nkeys * sizeof(AOCSZoneMapFilter));
+	for (int i = 0; i < nkeys; i++)
+	{
+		ScanKey		key = &keys[i];
+		AttrNumber	attno = key->sk_attno - 1;
+		AOCSZoneMapFilter *filter = NULL;
+		Oid			typid;
+		Oid			argtypid;
+		int64		value;
+
+		if (attno < 0 || attno >= tupdesc->natts)
+			continue;
+		typid = TupleDescAttr(tupdesc, attno)->atttypid;
+		if (!zonemap_type_supported(typid))
+			continue;
+
+		/* only columns the scan reads can be checked block by block */
+		for (AttrNumber j = 0; j < scan->columnScanInfo.num_proj_atts; j++)
+		{
+			if (scan->columnScanInfo.proj_atts[j] == attno)
+			{
+				for (int k = 0; k < nfilters; k++)
+				{
+					if (filters[k].attno == attno)
+						filter = &filters[k];
+				}
+				if (filter == NULL)
+				{
+					filter = &filters[nfilters++];
+					filter->attno = attno;
+					filter->lo = PG_INT64_MIN;
+					filter->hi = PG_INT64_MAX;
+				}
+				break;
+			}
+		}
+		if (filter == NULL)
+			continue;
+
+		if (key->sk_flags & SK_ISNULL)
+		{
+			if (key->sk_flags & SK_SEARCHNULL)
+				filter->needNulls = true;
+			else if (key->sk_flags & SK_SEARCHNOTNULL)
+				filter->needValues = true;
+			continue;
+		}
+
+		/*
+		 * Integer columns can be compared with constants of any integer
+		 * width, the other types only with constants of their own.
+		 */
+		argtypid = OidIsValid(key->sk_subtype) ? key->sk_subtype : typid;
+		if (argtypid != typid &&
+			!((typid == INT2OID || typid == INT4OID || typid == INT8OID) &&
+			  (argtypid == INT2OID || argtypid == INT4OID || argtypid == INT8OID)))
+			continue;
+
+		value = zonemap_datum_value(argtypid, key->sk_argument);
+		switch (key->sk_strategy)
+		{
+			case BTLessStrategyNumber:
+				if (value == PG_INT64_MIN)
+					filter->lo = PG_INT64_MAX;
+				else
+					filter->hi = Min(filter->hi, value - 1);
+				break;
+			case BTLessEqualStrategyNumber:
+				filter->hi = Min(filter->hi, value);
+				break;
+			case BTEqualStrategyNumber:
+				filter->lo = Max(filter->lo, value);
+				filter->hi = Min(filter->hi, value);
+				break;
+			case BTGreaterEqualStrategyNumber:
+				filter->lo = Max(filter->lo, value);
+				break;
+			case BTGreaterStrategyNumber:
+				if (value == PG_INT64_MAX)
+					filter->hi = PG_INT64_MIN;
+				else
+					filter->lo = Max(filter->lo, value + 1);
+				break;
+			default:
+				continue;
+		}
+		filter->needValues = true;
+	}
+
+	if (nfilters == 0)
+	{
+		pfree(filters);
+		filters = NULL;
+	}
+
+	scan->zonemapFilters = filters;
+	scan->numZoneMapFilters = nfilters;
+}
+
+/*
+ * Load the zone maps of the segment file about to be scanned. Block skipping
+ * is left off when the scan builds the block directory itself, doesn't read
+ * the segment file from its start, or looks at invisible rows too.
+ */
+static void
+aocs_zonemap_open_seg(AOCSScanDesc scan, AOCSFileSegInfo *segInfo)
+{
+	MemoryContext oldCtx;
+
+	scan->zonemapSkipping = false;
+	if (scan->numZoneMapFilters == 0 ||
+		scan->blockDirectory != NULL ||
+		scan->partialScan ||
+		scan->rs_base.rs_snapshot == SnapshotAny ||
+		(scan->rs_base.rs_flags & (SO_TYPE_ANALYZE | SO_TYPE_SAMPLESCAN)) != 0)
+		return;
+
+	oldCtx = MemoryContextSwitchTo(scan->columnScanInfo.scanCtx);
+	for (int i = 0; i < scan->numZoneMapFilters; i++)
+	{
+		AOCSZoneMapFilter *filter = &scan->zonemapFilters[i];
+
+		filter->active = false;
+		filter->next = 0;
+
+		/* rows with a missing value have no varblocks, nor zone maps */
+		if (scan->columnScanInfo.attnum_to_rownum &&
+			scan->columnScanInfo.attnum_to_rownum[filter->attno * MAX_AOREL_CONCURRENCY +
+												  segInfo->segno] > 0)
+			continue;
+
+		filter->entries = AppendOnlyBlockDirectory_GetZoneMaps(scan->rs_base.rs_rd,
+															   scan->appendOnlyMetaDataSnapshot,
+															   segInfo->segno,
+															   filter->attno,
+															   &filter->nentries);
+		filter->active = (filter->nentries > 0);
+		scan->zonemapSkipping |= filter->active;
+	}
+	MemoryContextSwitchTo(oldCtx);
+}
+
+static void
+aocs_zonemap_close_seg(AOCSScanDesc scan)
+{
+	for (int i = 0; i < scan->numZoneMapFilters; i++)
+	{
+		AOCSZoneMapFilter *filter = &scan->zonemapFilters[i];
+
+		if (filter->entries)
+			pfree(filter->entries);
+		filter->entries = NULL;
+		filter->nentries = 0;
+		filter->active = false;
+	}
+	scan->zonemapSkipping = false;
+}
+
+/*
+ * Can the varblock holding rows [firstRowNum, firstRowNum + rowCount) of the
+ * filter's column have rows that satisfy the scan keys? Varblocks are asked
+ * about in row number order, which is also the order of the entries.
+ */
+static bool
+aocs_zonemap_block_matches(AOCSZoneMapFilter *filter, int64 firstRowNum, int64 rowCount)
+{
+	AOBlkDirZoneMapEntry *entry;
+
+	while (filter->next < filter->nentries &&
+		   filter->entries[filter->next].firstRowNum < firstRowNum)
+		filter->next++;
+
+	if (filter->next >= filter->nentries)
+		return true;
+	entry = &filter->entries[filter->next];
+	if (entry->firstRowNum != firstRowNum || entry->rowCount != rowCount)
+		return true;
+
+	if (filter->needNulls)
+		return !filter->needValues && entry->zonemap.nullCount > 0;
+	if (filter->needValues)
+	{
+		if ((entry->zonemap.flags & MINIPAGE_ZONEMAP_HASVALUES) == 0)
+			return false;
+		return entry->zonemap.maxValue >= filter->lo &&
+			entry->zonemap.minValue <= filter->hi;
+	}
+	return true;
+}
+
+/*
+ * Position the datum stream of column 'attno' after row *skipUntil, skipping
+ * whole varblocks without decompressing them where possible. For a column
+ * with a zone map filter, a varblock starting after *skipUntil that cannot
+ * match is skipped as well, and *skipUntil moves on to its last row.
+ */
+static void
+aocs_zonemap_position_column(AOCSScanDesc scan, AttrNumber attno,
+							 AOCSZoneMapFilter *filter, int64 *skipUntil)
+{
+	DatumStreamRead *ds = scan->columnScanInfo.ds[attno];
+
+	for (;;)
+	{
+		int64		lastRowNum;
+
+		if (datumstreamread_remaining(ds) > 0)
+		{
+			int64		nextRowNum;
+
+			if (ds->largeObjectState == DatumStreamLargeObjectState_HaveAoContent)
+				nextRowNum = ds->blockFirstRowNum;
+			else
+				nextRowNum = ds->blockFirstRowNum + datumstreamread_nth(ds) + 1;
+
+			while (nextRowNum <= *skipUntil && datumstreamread_remaining(ds) > 0)
+			{
+				datumstreamread_advance(ds);
+				nextRowNum++;
+			}
+			if (datumstreamread_remaining(ds) > 0)
+				return;
+		}
+
+		/* end of the segment file, the caller finds out by itself */
+		if (!datumstreamread_block_info(ds))
+			return;
+
+		if (ds->blockFirstRowNum == InvalidAORowNum)
+			lastRowNum = InvalidAORowNum;
+		else
+			lastRowNum = ds->blockFirstRowNum + ds->blockRowCount - 1;
+
+		if (lastRowNum != InvalidAORowNum && lastRowNum <= *skipUntil)
+		{
+			datumstreamread_skip_block(ds);
+			continue;
+		}
+
+		if (filter != NULL &&
+			lastRowNum != InvalidAORowNum &&
+			ds->blockFirstRowNum > *skipUntil &&
+			!aocs_zonemap_block_matches(filter, ds->blockFirstRowNum, ds->blockRowCount))
+		{
+			elogif(Debug_appendonly_print_scan, LOG,
+				   "Append-only Column-Oriented scan skipping varblock of column %d, "
+				   "rows " INT64_FORMAT " to " INT64_FORMAT " (%s)",
+				   attno,
+				   ds->blockFirstRowNum,
+				   lastRowNum,
+				   RelationGetRelationName(scan->rs_base.rs_rd));
+
+			datumstreamread_skip_block(ds);
+			*skipUntil = lastRowNum;
+			continue;
+		}
+
+		datumstreamread_block_content(ds);
+		AOCSScanDesc_UpdateTotalBytesRead(scan, attno);
+		pgstat_count_buffer_read_ao(scan->rs_base.rs_rd,
+									RelationGuessNumberOfBlocksFromSize(scan->totalBytesRead));
+	}
+}
+
+/*
+ * Called before the next row or batch is read, with the datum streams of all
+ * projected columns positioned on the same row. Once a filtered column has
+ * used up its varblock, skip the rows covered by the varblocks up next whose
+ * zone maps rule them out, in every projected column. The rows that remain
+ * are still checked against the qual by the caller.
+ */
+static void
+aocs_zonemap_skip(AOCSScanDesc scan)
+{
+	AttrNumber *proj_atts = scan->columnScanInfo.proj_atts;
+	AttrNumber	num_proj_atts = scan->columnScanInfo.num_proj_atts;
+	bool		atBoundary = false;
+	int64		skipUntil = InvalidAORowNum;
+	int64		prevSkipUntil;
+
+	for (int i = 0; i < scan->numZoneMapFilters; i++)
+	{
+		AOCSZoneMapFilter *filter = &scan->zonemapFilters[i];
+
+		if (filter->active &&
+			datumstreamread_remaining(scan->columnScanInfo.ds[filter->attno]) <= 0)
+			atBoundary = true;
+	}
+	if (!atBoundary)
+		return;
+
+	/* repeat until no column extends the range of rows to skip */
+	do
+	{
+		prevSkipUntil = skipUntil;
+		for (AttrNumber i = 0; i < num_proj_atts; i++)
+		{
+			AOCSZoneMapFilter *filter = NULL;
+
+			for (int j = 0; j < scan->numZoneMapFilters; j++)
+			{
+				if (scan->zonemapFilters[j].active &&
+					scan->zonemapFilters[j].attno == proj_atts[i])
+					filter = &scan->zonemapFilters[j];
+			}
+
+			aocs_zonemap_position_column(scan, proj_atts[i], filter, &skipUntil);
+		}
+	} while (skipUntil != prevSkipUntil);
+}
+
 /*
  * Open all segment files associted with the datum stream.
  *
@@ -119,10 +444,14 @@ open_all_datumstreamread_segfiles(AOCSScanDesc scan, AOCSFileSegInfo *segInfo)
 
 		open_datumstreamread_segfile(basepath, rel, segInfo, ds[attno], attno);
 
-		/* skip reading block for ANALYZE/SampleScan/partial scan */
+		/*
+		 * skip reading block for ANALYZE/SampleScan/partial scan, and when the
+		 * first blocks may be skipped using the zone maps
+		 */
 		if ((scan->rs_base.rs_flags & SO_TYPE_ANALYZE) != 0 ||
 			(scan->rs_base.rs_flags & SO_TYPE_SAMPLESCAN) != 0 ||
-			scan->partialScan)
+			scan->partialScan ||
+			scan->zonemapSkipping)
 			continue;
 
 		datumstreamread_block(ds[attno], blockDirectory, attno);
@@ -413,6 +742,9 @@ initscan_with_colinfo(AOCSScanDesc scan)
 				 scan->columnScanInfo.proj_atts, scan->columnScanInfo.num_proj_atts,
 				 scan->checksum);
 
+	if (scan->zonemapFilters == NULL && scan->rs_base.rs_nkeys > 0)
+		aocs_zonemap_init(scan);
+
 	MemoryContextSwitchTo(oldCtx);
 
 	pgstat_count_heap_scan(scan->rs_base.rs_rd);
@@ -476,6 +808,7 @@ open_next_scan_seg(AOCSScanDesc scan)
 															true);
 				}
 
+				aocs_zonemap_open_seg(scan, curSegInfo);
 				open_all_datumstreamread_segfiles(scan, curSegInfo);
 
 				return scan->cur_seg;
@@ -529,6 +862,8 @@ close_cur_scan_seg(AOCSScanDesc scan)
 
 	if (scan->blockDirectory)
 		AppendOnlyBlockDirectory_End_forInsert(scan->blockDirectory);
+
+	aocs_zonemap_close_seg(scan);
 }
 
 static void
@@ -881,6 +1216,11 @@ aocs_endscan(AOCSScanDesc scan)
 	if (scan->blkdirscan != NULL)
 		aocs_blkdirscan_finish(scan);
 
+	if (scan->zonemapFilters)
+		pfree(scan->zonemapFilters);
+	if (scan->rs_base.rs_key)
+		pfree(scan->rs_base.rs_key);
+
 	RelationDecrementReferenceCount(scan->rs_base.rs_rd);
 
 	pfree(scan);
@@ -1471,6 +1811,9 @@ ReadNext:
 		Assert(scan->cur_seg >= 0);
 		curseginfo = scan->seginfo[scan->cur_seg];
 
+		if (scan->zonemapSkipping)
+			aocs_zonemap_skip(scan);
+
 		/* Read from cur_seg */
 		for (AttrNumber i = 0; i < scan->columnScanInfo.num_proj_atts; i++)
 		{
@@ -1577,6 +1920,223 @@ ReadNext:
 	return false;
 }
 
+/*
+ * Make sure the datum stream of column 'attno' is positioned on a varblock
+ * that still has rows to return, reading the next varblock if needed.
+ * Returns false at the end of the current segment file.
+ */
+static bool
+aocs_batch_position_column(AOCSScanDesc scan, AttrNumber attno)
+{
+	DatumStreamRead *ds = scan->columnScanInfo.ds[attno];
+
+	while (datumstreamread_remaining(ds) <= 0)
+	{
+		if (datumstreamread_block(ds, scan->blockDirectory, attno) < 0)
+			return false;
+
+		AOCSScanDesc_UpdateTotalBytesRead(scan, attno);
+		pgstat_count_buffer_read_ao(scan->rs_base.rs_rd,
+									RelationGuessNumberOfBlocksFromSize(scan->totalBytesRead));
+	}
+
+	return true;
+}
+
+/*
+ * Batch-at-a-time counterpart of aocs_getnext().
+ *
+ * Reads up to batch->maxrows consecutive rows of every projected column
+ * into the column vectors of 'batch', and lists the visible ones in its
+ * selection vector.  A batch never crosses a varblock boundary of any of
+ * the columns, so the values are copied straight out of the datum stream
+ * buffers and pass-by-reference datums stay valid until the next call.
+ *
+ * Returns false at the end of the scan.
+ */
+bool
+aocs_getnextbatch(AOCSScanDesc scan, TupleBatch batch)
+{
+	bool		isSnapshotAny = (scan->rs_base.rs_snapshot == SnapshotAny);
+	AttrNumber *proj_atts;
+	AttrNumber	num_proj_atts;
+	bool		segDone;
+
+	/* should not be in ANALYZE/SampleScan - we use a different API */
+	Assert((scan->rs_base.rs_flags & SO_TYPE_ANALYZE) == 0);
+	Assert((scan->rs_base.rs_flags & SO_TYPE_SAMPLESCAN) == 0);
+
+	if (scan->columnScanInfo.relationTupleDesc == NULL)
+	{
+		scan->columnScanInfo.relationTupleDesc = batch->tupdesc;
+		/* Pin it! ... and of course release it upon destruction / rescan */
+		PinTupleDesc(scan->columnScanInfo.relationTupleDesc);
+		initscan_with_colinfo(scan);
+	}
+
+	proj_atts = scan->columnScanInfo.proj_atts;
+	num_proj_atts = scan->columnScanInfo.num_proj_atts;
+
+	/* Bail out early if we do not have any column in the projection. */
+	if (num_proj_atts == 0)
+		return false;
+
+	for (AttrNumber i = 0; i < num_proj_atts; i++)
+		ExecBatchEnsureColumn(batch, proj_atts[i]);
+
+	segDone = (scan->cur_seg < 0);
+	while (1)
+	{
+		AOCSFileSegInfo *curseginfo;
+		DatumStreamRead *anchor;
+		int64		firstRowNum;
+		int			nrows;
+		int			nsel;
+
+		/* If necessary, open next seg */
+		if (segDone)
+		{
+			if (open_next_scan_seg(scan) < 0)
+			{
+				/* No more seg, we are at the end */
+				scan->cur_seg = -1;
+				return false;
+			}
+			scan->segrowsprocessed = 0;
+			segDone = false;
+		}
+
+		curseginfo = scan->seginfo[scan->cur_seg];
+
+		if (scan->zonemapSkipping)
+			aocs_zonemap_skip(scan);
+
+		/*
+		 * The anchor column determines the row numbers, which are consecutive
+		 * within one of its varblocks.
+		 */
+		if (!aocs_batch_position_column(scan, proj_atts[ANCHOR_COL_IN_PROJ]))
+		{
+			close_cur_scan_seg(scan);
+			segDone = true;
+			continue;
+		}
+		anchor = scan->columnScanInfo.ds[proj_atts[ANCHOR_COL_IN_PROJ]];
+
+		if (anchor->blockFirstRowNum != InvalidAORowNum)
+			firstRowNum = anchor->blockFirstRowNum + datumstreamread_nth(anchor) + 1;
+		else
+			firstRowNum = scan->segrowsprocessed + 1;
+
+		nrows = Min(batch->maxrows, datumstreamread_remaining(anchor));
+
+		/*
+		 * Shrink the batch so that it ends within the current varblock of
+		 * every other column, and so that each column's values are either
+		 * all missing or all stored.  Missing values always form a prefix of
+		 * the segment's row numbers.
+		 */
+		for (AttrNumber i = ANCHOR_COL_IN_PROJ + 1; i < num_proj_atts; i++)
+		{
+			AttrNumber	attno = proj_atts[i];
+
+			if (AO_ATTR_VAL_IS_MISSING(firstRowNum,
+									   attno,
+									   curseginfo->segno,
+									   scan->columnScanInfo.attnum_to_rownum))
+			{
+				int64		lastMissing;
+
+				lastMissing = scan->columnScanInfo.attnum_to_rownum[attno * MAX_AOREL_CONCURRENCY +
+																	 curseginfo->segno];
+				nrows = Min(nrows, lastMissing - firstRowNum + 1);
+			}
+			else
+			{
+				if (!aocs_batch_position_column(scan, attno))
+				{
+					/*
+					 * Ha, cannot read next block, we need to go to next seg
+					 */
+					close_cur_scan_seg(scan);
+					segDone = true;
+					break;
+				}
+				nrows = Min(nrows, datumstreamread_remaining(scan->columnScanInfo.ds[attno]));
+			}
+		}
+		if (segDone)
+			continue;
+
+		Assert(nrows > 0);
+
+		/* Copy the column values, one column at a time */
+		for (AttrNumber i = 0; i < num_proj_atts; i++)
+		{
+			AttrNumber	attno = proj_atts[i];
+			DatumStreamRead *ds = scan->columnScanInfo.ds[attno];
+			Datum	   *values = batch->values[attno];
+			bool	   *isnull = batch->isnull[attno];
+
+			if (i != ANCHOR_COL_IN_PROJ &&
+				AO_ATTR_VAL_IS_MISSING(firstRowNum,
+									   attno,
+									   curseginfo->segno,
+									   scan->columnScanInfo.attnum_to_rownum))
+			{
+				bool		missingIsNull;
+				Datum		missing;
+
+				missing = getmissingattr(batch->tupdesc, attno + 1, &missingIsNull);
+				for (int r = 0; r < nrows; r++)
+				{
+					values[r] = missing;
+					isnull[r] = missingIsNull;
+				}
+				continue;
+			}
+
+			for (int r = 0; r < nrows; r++)
+			{
+				int			err PG_USED_FOR_ASSERTS_ONLY;
+
+				err = datumstreamread_advance(ds);
+				Assert(err > 0);
+				datumstreamread_get(ds, &values[r], &isnull[r]);
+			}
+		}
+
+		/* Select the visible rows */
+		nsel = 0;
+		for (int r = 0; r < nrows; r++)
+		{
+			AOTupleId	aoTupleId;
+
+			AOTupleIdInit(&aoTupleId, curseginfo->segno, firstRowNum + r);
+
+			if (!isSnapshotAny && !AppendOnlyVisimap_IsVisible(&scan->visibilityMap, &aoTupleId))
+				continue;
+
+			batch->tids[r] = *((ItemPointer) &aoTupleId);
+			batch->sel[nsel++] = r;
+		}
+		scan->segrowsprocessed += nrows;
+
+		batch->nrows = nrows;
+		batch->nsel = nsel;
+		batch->next = 0;
+
+		if (nsel > 0)
+		{
+			scan->cdb_fake_ctid = batch->tids[batch->sel[nsel - 1]];
+			return true;
+		}
+	}
+
+	Assert(!"Never here");
+	return false;
+}
+
 
 /* Open next file segment for write.  See SetCurrentFileSegForWrite */
 /* XXX Right now, we put each column to different files */
@@ -26,14 +26,17 @@
 #include "catalog/heap.h"
 #include "catalog/index.h"
 #include "catalog/pg_appendonly.h"
+#include "catalog/pg_am.h"
 #include "catalog/pg_attribute_encoding.h"
 #include "catalog/storage.h"
 #include "catalog/storage_xlog.h"
 #include "cdb/cdbappendonlyam.h"
 #include "cdb/cdbaocsam.h"
 #include "cdb/cdbvars.h"
+#include "commands/defrem.h"
 #include "commands/progress.h"
 #include "commands/vacuum.h"
+#include "executor/execBatch.h"
 #include "executor/executor.h"
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
@@ -538,6 +541,112 @@ extractcolumns_from_node(Node *expr, bool *cols, AttrNumber natts)
 	return  ecCtx.found;
 }
 
+/*
+ * Turn the "column <op> constant" and "column IS [NOT] NULL" conjuncts of a
+ * scan's qual into scan keys, so that the scan can skip the varblocks whose
+ * zone maps rule them out. The qual itself is still evaluated on every row
+ * that is returned, the keys only serve for skipping.
+ */
+static ScanKey
+aoco_zonemap_scankeys(Relation rel, List *qual, int *nkeys)
+{
+	TupleDesc	tupdesc = RelationGetDescr(rel);
+	ScanKey		keys;
+	ListCell   *lc;
+	int			n = 0;
+
+	*nkeys = 0;
+	if (qual == NIL)
+		return NULL;
+
+	keys = palloc0(list_length(qual) * sizeof(ScanKeyData));
+	foreach(lc, qual)
+	{
+		Node	   *clause = (Node *) lfirst(lc);
+		OpExpr	   *opexpr;
+		Var		   *var;
+		Const	   *con;
+		Oid			opno;
+		Oid			opclass;
+		Oid			opfamily;
+		int			strategy;
+
+		if (IsA(clause, NullTest))
+		{
+			NullTest   *ntest = (NullTest *) clause;
+
+			if (!IsA(ntest->arg, Var) || ntest->argisrow)
+				continue;
+			var = (Var *) ntest->arg;
+			if (IS_SPECIAL_VARNO(var->varno) || var->varlevelsup != 0 ||
+				var->varattno <= 0 || var->varattno > tupdesc->natts)
+				continue;
+
+			ScanKeyEntryInitialize(&keys[n++],
+								   SK_ISNULL | (ntest->nulltesttype == IS_NULL ?
+												SK_SEARCHNULL : SK_SEARCHNOTNULL),
+								   var->varattno,
+								   InvalidStrategy,
+								   InvalidOid,
+								   InvalidOid,
+								   InvalidOid,
+								   (Datum) 0);
+			continue;
+		}
+
+		if (!IsA(clause, OpExpr) || list_length(((OpExpr *) clause)->args) != 2)
+			continue;
+
+		opexpr = (OpExpr *) clause;
+		opno = opexpr->opno;
+		if (IsA(linitial(opexpr->args), Var) && IsA(lsecond(opexpr->args), Const))
+		{
+			var = (Var *) linitial(opexpr->args);
+			con = (Const *) lsecond(opexpr->args);
+		}
+		else if (IsA(linitial(opexpr->args), Const) && IsA(lsecond(opexpr->args), Var))
+		{
+			con = (Const *) linitial(opexpr->args);
+			var = (Var *) lsecond(opexpr->args);
+			opno = get_commutator(opno);
+			if (!OidIsValid(opno))
+				continue;
+		}
+		else
+			continue;
+
+		if (IS_SPECIAL_VARNO(var->varno) || var->varlevelsup != 0 ||
+			var->varattno <= 0 || var->varattno > tupdesc->natts)
+			continue;
+
+		opclass = GetDefaultOpClass(var->vartype, BTREE_AM_OID);
+		if (!OidIsValid(opclass))
+			continue;
+		opfamily = get_opclass_family(opclass);
+		strategy = get_op_opfamily_strategy(opno, opfamily);
+		if (strategy == InvalidStrategy)
+			continue;
+
+		ScanKeyEntryInitialize(&keys[n++],
+							   con->constisnull ? SK_ISNULL : 0,
+							   var->varattno,
+							   strategy,
+							   con->consttype,
+							   InvalidOid,
+							   get_opcode(opno),
+							   con->constvalue);
+	}
+
+	if (n == 0)
+	{
+		pfree(keys);
+		return NULL;
+	}
+
+	*nkeys = n;
+	return keys;
+}
+
 static TableScanDesc
 aoco_beginscan_extractcolumns(Relation rel, Snapshot snapshot,
 							  List *targetlist, List *qual, bool *proj,
@@ -578,6 +687,10 @@ aoco_beginscan_extractcolumns(Relation rel, Snapshot snapshot,
 							projKind,
 							flags);
 
+	if (gp_enable_aocs_block_skipping)
+		aoscan->rs_base.rs_key = aoco_zonemap_scankeys(rel, qual,
+													   &aoscan->rs_base.rs_nkeys);
+
 	if (needFree)
 		pfree(proj);
 	return (TableScanDesc)aoscan;
@@ -726,6 +839,24 @@ aoco_getnextslot(TableScanDesc scan, ScanDirection direction, TupleTableSlot *sl
 	return false;
 }
 
+static bool
+aoco_getnextbatch(TableScanDesc scan, TupleBatch batch)
+{
+	AOCSScanDesc  aoscan = (AOCSScanDesc)scan;
+
+	if (aocs_getnextbatch(aoscan, batch))
+	{
+		Relation	rel = aoscan->rs_base.rs_rd;
+
+		if (rel->pgstat_info != NULL)
+			rel->pgstat_info->t_counts.t_tuples_returned += batch->nsel;
+
+		return true;
+	}
+
+	return false;
+}
+
 static Size
 aoco_parallelscan_estimate(Relation rel)
 {
@@ -2798,6 +2929,7 @@ static const TableAmRoutine ao_column_methods = {
 	.scan_end = aoco_endscan,
 	.scan_rescan = aoco_rescan,
 	.scan_getnextslot = aoco_getnextslot,
+	.scan_getnextbatch = aoco_getnextbatch,
 
 	.parallelscan_estimate = aoco_parallelscan_estimate,
 	.parallelscan_initialize = aoco_parallelscan_initialize,
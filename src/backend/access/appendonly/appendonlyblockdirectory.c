@@ -58,7 +58,8 @@ insert_new_entry(AppendOnlyBlockDirectory *blockDirectory,
 				 int columnGroupNo,
 				 int64 firstRowNum,
 				 int64 fileOffset,
-				 int64 rowCount);
+				 int64 rowCount,
+				 const MinipageZoneMap *zonemap);
 static void clear_minipage(MinipagePerColumnGroup *minipagePerColumnGroup);
 
 static int findFileSegInfo(AppendOnlyBlockDirectory *blockDirectory,
@@ -121,6 +122,8 @@ init_internal(AppendOnlyBlockDirectory *blockDirectory)
 	heapTupleDesc = RelationGetDescr(blockDirectory->blkdirRel);
 	blockDirectory->values = palloc0(sizeof(Datum) * heapTupleDesc->natts);
 	blockDirectory->nulls = palloc0(sizeof(bool) * heapTupleDesc->natts);
+	blockDirectory->hasZoneMaps =
+		(heapTupleDesc->natts >= Anum_pg_aoblkdir_zonemap);
 	blockDirectory->numScanKeys = 3;
 	numScanKeys = blockDirectory->numScanKeys;
 	blockDirectory->scanKeys = palloc0(numScanKeys * sizeof(ScanKeyData));
@@ -147,6 +150,9 @@ init_internal(AppendOnlyBlockDirectory *blockDirectory)
 
 		minipageInfo->minipage =
 			palloc0(minipage_size(NUM_MINIPAGE_ENTRIES));
+		if (blockDirectory->hasZoneMaps)
+			minipageInfo->zonemaps =
+				palloc0(zonemaps_size(NUM_MINIPAGE_ENTRIES));
 		minipageInfo->numMinipageEntries = 0;
 		ItemPointerSetInvalid(&minipageInfo->tupleTid);
 		minipageInfo->cached_entry_no = InvalidEntryNum;
@@ -1249,7 +1255,145 @@ AppendOnlyBlockDirectory_InsertEntry(AppendOnlyBlockDirectory *blockDirectory,
 									 int64 rowCount)
 {
 	return insert_new_entry(blockDirectory, columnGroupNo, firstRowNum,
-							fileOffset, rowCount);
+							fileOffset, rowCount, NULL);
+}
+
+/*
+ * AppendOnlyBlockDirectory_InsertEntryWithZoneMap
+ *
+ * Like AppendOnlyBlockDirectory_InsertEntry(), but also record the zone map
+ * of the varblock, if the block directory keeps zone maps.  'zonemap' may be
+ * NULL if the writer didn't collect one.
+ */
+bool
+AppendOnlyBlockDirectory_InsertEntryWithZoneMap(AppendOnlyBlockDirectory *blockDirectory,
+												int columnGroupNo,
+												int64 firstRowNum,
+												int64 fileOffset,
+												int64 rowCount,
+												const MinipageZoneMap *zonemap)
+{
+	return insert_new_entry(blockDirectory, columnGroupNo, firstRowNum,
+							fileOffset, rowCount, zonemap);
+}
+
+/*
+ * AppendOnlyBlockDirectory_GetZoneMaps
+ *
+ * Return the zone maps of all the varblocks of the given column group in
+ * segment file 'segno', in row number order, together with the row range
+ * each of them covers.  Varblocks without a zone map are left out.
+ *
+ * Returns NULL, and sets *nentries to 0, if the relation has no block
+ * directory or its block directory doesn't keep zone maps.  The result is
+ * allocated in the current memory context.
+ */
+AOBlkDirZoneMapEntry *
+AppendOnlyBlockDirectory_GetZoneMaps(Relation aoRel,
+									 Snapshot appendOnlyMetaDataSnapshot,
+									 int segno,
+									 int columnGroupNo,
+									 int *nentries)
+{
+	Oid			blkdirrelid;
+	Oid			blkdiridxid;
+	Relation	blkdirRel;
+	Relation	blkdirIdx;
+	TupleDesc	heapTupleDesc;
+	ScanKeyData scanKey[2];
+	SysScanDesc indexScan;
+	HeapTuple	tuple;
+	Datum		values[Natts_pg_aoblkdir_zonemap];
+	bool		nulls[Natts_pg_aoblkdir_zonemap];
+	AOBlkDirZoneMapEntry *entries = NULL;
+	int			maxentries = 0;
+	int			n = 0;
+
+	*nentries = 0;
+
+	GetAppendOnlyEntryAuxOids(aoRel, NULL, &blkdirrelid, NULL);
+	if (!OidIsValid(blkdirrelid))
+		return NULL;
+
+	blkdirRel = table_open(blkdirrelid, AccessShareLock);
+	heapTupleDesc = RelationGetDescr(blkdirRel);
+	if (heapTupleDesc->natts < Anum_pg_aoblkdir_zonemap)
+	{
+		table_close(blkdirRel, AccessShareLock);
+		return NULL;
+	}
+
+	blkdiridxid = AppendonlyGetAuxIndex(blkdirRel);
+	Assert(OidIsValid(blkdiridxid));
+	blkdirIdx = index_open(blkdiridxid, AccessShareLock);
+
+	ScanKeyInit(&scanKey[0],
+				Anum_pg_aoblkdir_segno,				/* segno */
+				BTEqualStrategyNumber,
+				F_INT4EQ,
+				Int32GetDatum(segno));
+	ScanKeyInit(&scanKey[1],
+				Anum_pg_aoblkdir_columngroupno,/* columnGroupNo */
+				BTEqualStrategyNumber,
+				F_INT4EQ,
+				Int32GetDatum(columnGroupNo));
+
+	indexScan = systable_beginscan_ordered(blkdirRel,
+										   blkdirIdx,
+										   appendOnlyMetaDataSnapshot,
+										   2 /* nkeys */,
+										   scanKey);
+
+	while ((tuple = systable_getnext_ordered(indexScan, ForwardScanDirection)) != NULL)
+	{
+		Minipage   *minipage;
+		MinipageZoneMaps *zonemaps;
+
+		heap_deform_tuple(tuple, heapTupleDesc, values, nulls);
+		if (nulls[Anum_pg_aoblkdir_minipage - 1] ||
+			nulls[Anum_pg_aoblkdir_zonemap - 1])
+			continue;
+
+		minipage = (Minipage *)
+			pg_detoast_datum((struct varlena *) DatumGetPointer(values[Anum_pg_aoblkdir_minipage - 1]));
+		zonemaps = (MinipageZoneMaps *)
+			pg_detoast_datum((struct varlena *) DatumGetPointer(values[Anum_pg_aoblkdir_zonemap - 1]));
+
+		if (zonemaps->nEntry == minipage->nEntry)
+		{
+			for (uint32 i = 0; i < minipage->nEntry; i++)
+			{
+				if ((zonemaps->entry[i].flags & MINIPAGE_ZONEMAP_VALID) == 0)
+					continue;
+
+				if (n == maxentries)
+				{
+					maxentries = Max(maxentries * 2, NUM_MINIPAGE_ENTRIES);
+					if (entries == NULL)
+						entries = palloc(maxentries * sizeof(AOBlkDirZoneMapEntry));
+					else
+						entries = repalloc(entries, maxentries * sizeof(AOBlkDirZoneMapEntry));
+				}
+
+				entries[n].firstRowNum = minipage->entry[i].firstRowNum;
+				entries[n].rowCount = minipage->entry[i].rowCount;
+				entries[n].zonemap = zonemaps->entry[i];
+				n++;
+			}
+		}
+
+		if ((Pointer) minipage != DatumGetPointer(values[Anum_pg_aoblkdir_minipage - 1]))
+			pfree(minipage);
+		if ((Pointer) zonemaps != DatumGetPointer(values[Anum_pg_aoblkdir_zonemap - 1]))
+			pfree(zonemaps);
+	}
+
+	systable_endscan_ordered(indexScan);
+	index_close(blkdirIdx, AccessShareLock);
+	table_close(blkdirRel, AccessShareLock);
+
+	*nentries = n;
+	return entries;
 }
 
 /*
@@ -1314,7 +1458,8 @@ insert_new_entry(AppendOnlyBlockDirectory *blockDirectory,
 				 int columnGroupNo,
 				 int64 firstRowNum,
 				 int64 fileOffset,
-				 int64 rowCount)
+				 int64 rowCount,
+				 const MinipageZoneMap *zonemap)
 {
 	MinipageEntry *entry = NULL;
 	MinipagePerColumnGroup *minipageInfo;
@@ -1350,6 +1495,15 @@ insert_new_entry(AppendOnlyBlockDirectory *blockDirectory,
 	entry->fileOffset = fileOffset;
 	entry->rowCount = rowCount;
 
+	if (minipageInfo->zonemaps != NULL)
+	{
+		if (zonemap != NULL)
+			minipageInfo->zonemaps->entry[minipageInfo->numMinipageEntries] = *zonemap;
+		else
+			MemSet(&minipageInfo->zonemaps->entry[minipageInfo->numMinipageEntries],
+				   0, sizeof(MinipageZoneMap));
+	}
+
 	minipageInfo->numMinipageEntries++;
 
 	ereportif(Debug_appendonly_print_blockdirectory, LOG,
@@ -1506,6 +1660,10 @@ extract_minipage(AppendOnlyBlockDirectory *blockDirectory,
 	copy_out_minipage(minipageInfo,
 					  values[Anum_pg_aoblkdir_minipage - 1],
 					  nulls[Anum_pg_aoblkdir_minipage - 1]);
+	if (minipageInfo->zonemaps != NULL)
+		copy_out_zonemaps(minipageInfo,
+						  values[Anum_pg_aoblkdir_zonemap - 1],
+						  nulls[Anum_pg_aoblkdir_zonemap - 1]);
 
 	ItemPointerCopy(&tuple->t_self, &minipageInfo->tupleTid);
 }
@@ -1697,6 +1855,21 @@ write_minipage(AppendOnlyBlockDirectory *blockDirectory,
 		PointerGetDatum(minipageInfo->minipage);
 	nulls[Anum_pg_aoblkdir_minipage - 1] = false;
 
+	if (blockDirectory->hasZoneMaps)
+	{
+		if (minipageInfo->zonemaps != NULL)
+		{
+			SET_VARSIZE(minipageInfo->zonemaps,
+						zonemaps_size(minipageInfo->numMinipageEntries));
+			minipageInfo->zonemaps->nEntry = minipageInfo->numMinipageEntries;
+			values[Anum_pg_aoblkdir_zonemap - 1] =
+				PointerGetDatum(minipageInfo->zonemaps);
+			nulls[Anum_pg_aoblkdir_zonemap - 1] = false;
+		}
+		else
+			nulls[Anum_pg_aoblkdir_zonemap - 1] = true;
+	}
+
 	tuple = heaptuple_form_to(heapTupleDesc,
 							  values,
 							  nulls,
@@ -1747,6 +1920,9 @@ clear_minipage(MinipagePerColumnGroup *minipagePerColumnGroup)
 {
 	MemSet(minipagePerColumnGroup->minipage->entry, 0,
 		   minipagePerColumnGroup->numMinipageEntries * sizeof(MinipageEntry));
+	if (minipagePerColumnGroup->zonemaps != NULL)
+		MemSet(minipagePerColumnGroup->zonemaps->entry, 0,
+			   minipagePerColumnGroup->numMinipageEntries * sizeof(MinipageZoneMap));
 	minipagePerColumnGroup->numMinipageEntries = 0;
 	ItemPointerSetInvalid(&minipagePerColumnGroup->tupleTid);
 	minipagePerColumnGroup->cached_entry_no = InvalidEntryNum;
@@ -1811,7 +1987,7 @@ AppendOnlyBlockDirectory_InsertPlaceholder(AppendOnlyBlockDirectory *blockDirect
 
 	/* insert placeholder entry with a max row count */
 	insert_new_entry(blockDirectory, columnGroupNo, firstRowNum, fileOffset,
-					 AOTupleId_MaxRowNum);
+					 AOTupleId_MaxRowNum, NULL);
 	/* insert placeholder row containing placeholder entry */
 	write_minipage(blockDirectory, columnGroupNo, minipagePerColumnGroup);
 	/*
@@ -38,6 +38,7 @@ AlterTableCreateAoBlkdirTable(Oid relOid)
 	int16		coloptions[3];
 	List	   *indexColNames;
 	bool	   isAO;
+	bool	   isAOCO;
 
 	SIMPLE_FAULT_INJECTOR("before_acquire_lock_during_create_ao_blkdir_table");
 
@@ -46,6 +47,7 @@ AlterTableCreateAoBlkdirTable(Oid relOid)
 	 */
 	rel = table_open(relOid, NoLock);
 	isAO = RelationStorageIsAO(rel);
+	isAOCO = RelationIsAoCols(rel);
 	table_close(rel, NoLock);
 	if (!isAO)
 		return;
@@ -65,7 +67,8 @@ AlterTableCreateAoBlkdirTable(Oid relOid)
 	rel = table_open(relOid, ShareRowExclusiveLock);
 
 	/* Create a tuple descriptor */
-	tupdesc = CreateTemplateTupleDesc(4);
+	tupdesc = CreateTemplateTupleDesc(isAOCO ? Natts_pg_aoblkdir_zonemap :
+									  Natts_pg_aoblkdir);
 	TupleDescInitEntry(tupdesc, (AttrNumber) 1,
 					   "segno",
 					   INT4OID,
@@ -84,6 +87,15 @@ AlterTableCreateAoBlkdirTable(Oid relOid)
 					   -1, 0);
 	/* don't toast 'minipage' */
 	tupdesc->attrs[3].attstorage = 'p';
+	if (isAOCO)
+	{
+		TupleDescInitEntry(tupdesc, (AttrNumber) 5,
+						   "zonemap",
+						   BYTEAOID,
+						   -1, 0);
+		/* nor 'zonemap', it is kept as small as the minipage */
+		tupdesc->attrs[4].attstorage = 'p';
+	}
 
 	/*
 	 * Create index on segno, columngroup_no and first_row_no.
@@ -623,6 +623,20 @@ plan_tree_mutator(Node *node,
 			}
 			break;
 
+		case T_Memoize:
+			{
+				Memoize    *memoize = (Memoize *) node;
+				Memoize    *newmemoize;
+
+				FLATCOPY(newmemoize, memoize, Memoize);
+				PLANMUTATE(newmemoize, memoize);
+				COPYARRAY(newmemoize, memoize, numKeys, hashOperators);
+				COPYARRAY(newmemoize, memoize, numKeys, collations);
+				MUTATE(newmemoize->param_exprs, memoize->param_exprs, List *);
+				return (Node *) newmemoize;
+			}
+			break;
+
 		case T_Sort:
 			{
 				Sort	   *sort = (Sort *) node;
@@ -637,6 +651,21 @@ plan_tree_mutator(Node *node,
 			}
 			break;
 
+		case T_IncrementalSort:
+			{
+				IncrementalSort *sort = (IncrementalSort *) node;
+				IncrementalSort *newsort;
+
+				FLATCOPY(newsort, sort, IncrementalSort);
+				PLANMUTATE(newsort, sort);
+				COPYARRAY(&newsort->sort, &sort->sort, numCols, sortColIdx);
+				COPYARRAY(&newsort->sort, &sort->sort, numCols, sortOperators);
+				COPYARRAY(&newsort->sort, &sort->sort, numCols, collations);
+				COPYARRAY(&newsort->sort, &sort->sort, numCols, nullsFirst);
+				return (Node *) newsort;
+			}
+			break;
+
 		case T_Agg:
 			{
 				Agg		   *agg = (Agg *) node;
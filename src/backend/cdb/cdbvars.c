@@ -218,6 +218,13 @@ bool		gp_interconnect_aggressive_retry = true;	/* fast-track app-level
 
 bool		gp_interconnect_full_crc = false;	/* sanity check UDP data. */
 
+bool		gp_interconnect_batch_io = false;	/* sendmmsg/recvmmsg in UDP IC */
+
+bool		gp_motion_columnar_batch = false;	/* columnar batches in Motions */
+bool		gp_motion_compression = false;	/* compress tuples in Motions */
+int			gp_motion_compression_min_width = 256;
+int			gp_motion_compression_throughput_threshold = 65536;	/* kB/s */
+
 bool		gp_interconnect_log_stats = false;	/* emit stats at log-level */
 
 bool		gp_interconnect_cache_future_packets = true;
@@ -269,6 +276,9 @@ double		gp_selectivity_damping_factor = 1;
 bool		gp_selectivity_damping_sigsort = true;
 
 int			gp_hashjoin_tuples_per_bucket = 5;
+bool		gp_enable_runtime_filter = false;
+bool		gp_enable_aocs_batch_scan = false;
+bool		gp_enable_aocs_block_skipping = true;
 
 /* Analyzing aid */
 int			gp_motion_slice_noop = 0;
@@ -21,6 +21,7 @@
 #include "libpq-int.h"
 #include "cdb/cdbconn.h"
 #include "cdb/cdbmotion.h"
+#include "cdb/cdbutil.h"
 #include "cdb/cdbvars.h"
 #include "cdb/htupfifo.h"
 #include "cdb/ml_ipc.h"
@@ -35,6 +36,40 @@
  */
 int			Gp_max_tuple_chunk_size;
 
+/*
+ * Adaptive tuple compression: one in every MOTION_COMPRESS_PROBE_INTERVAL
+ * sends is timed while compression is off, and the decision is revisited
+ * every MOTION_COMPRESS_WINDOW sends.  Compression is given up for good if it
+ * saves less than MOTION_COMPRESS_MIN_SAVING of the bytes it is applied to.
+ */
+#define MOTION_COMPRESS_PROBE_INTERVAL	8
+#define MOTION_COMPRESS_WINDOW			4096
+#define MOTION_COMPRESS_MIN_SAVING		0.1
+
+/*
+ * With the columnar batch format, a batch is sent when it holds this many
+ * tuples, or its share of bytes of tuple data.
+ *
+ * A sender keeps one batch per route, in motion_layer_mctx, which is not
+ * charged to the query's memory accounting.  So that the tuples held back by
+ * a motion node stay bounded as the cluster grows, the routes split
+ * MOTION_BATCH_TOTAL_BYTES between them: each gets at most
+ * MOTION_BATCH_MAX_BYTES, and at least MOTION_BATCH_MIN_BYTES on clusters
+ * with more segments than the total covers.
+ */
+#define MOTION_BATCH_MAX_TUPLES			256
+#define MOTION_BATCH_MAX_BYTES			(64 * 1024)
+#define MOTION_BATCH_MIN_BYTES			(8 * 1024)
+#define MOTION_BATCH_TOTAL_BYTES		(1024 * 1024)
+
+/* Tuples collected for one route, in the columnar batch format */
+typedef struct MotionSendBatch
+{
+	int			ntuples;
+	int			nbytes;
+	MinimalTuple tuples[MOTION_BATCH_MAX_TUPLES];
+} MotionSendBatch;
+
 /*
  * STATIC STATE VARS
  *
@@ -71,11 +106,25 @@ static void processIncomingChunks(MotionLayerState *mlStates,
 static inline void reconstructTuple(MotionNodeEntry *pMNEntry, ChunkSorterEntry *pCSEntry, TupleRemapper *remapper);
 
 /* Stats-function declarations. */
-static void statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList);
+static void statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList, int ntuples);
 static void statSendEOS(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry);
 static void statChunksProcessed(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, int chunksProcessed, int chunkBytes, int tupleBytes);
 static void statNewTupleArrived(MotionNodeEntry *pMNEntry, ChunkSorterEntry *pCSEntry);
 static void statRecvTuple(MotionNodeEntry *pMNEntry, ChunkSorterEntry *pCSEntry);
+static SendReturnCode sendSerialized(MotionLayerState *mlStates,
+									 ChunkTransportState *transportStates,
+									 MotionNodeEntry *pMNEntry,
+									 int16 targetRoute,
+									 TupleTableSlot *slot,
+									 MotionSendBatch *batch);
+static MotionSendBatch *getSendBatch(MotionLayerState *mlStates,
+									 MotionNodeEntry *pMNEntry,
+									 int16 targetRoute);
+static void flushSendBatches(MotionLayerState *mlStates,
+							 ChunkTransportState *transportStates,
+							 MotionNodeEntry *pMNEntry);
+static void adaptMotionCompression(MotionNodeEntry *pMNEntry, instr_time *elapsed,
+								   int bytes, int ntuples);
 static bool ShouldSendRecordCache(MotionConn *conn, SerTupInfo *pSerInfo);
 static void UpdateSentRecordCache(MotionConn *conn);
 
@@ -92,6 +141,28 @@ reconstructTuple(MotionNodeEntry *pMNEntry, ChunkSorterEntry *pCSEntry, TupleRem
 	MinimalTuple tup;
 	SerTupInfo *pSerInfo = &pMNEntry->ser_tup_info;
 
+	/*
+	 * A columnar batch is rebuilt into tuples all at once.  The batch format
+	 * is only used for types that need no remapping.
+	 */
+	if (pMNEntry->batch_format)
+	{
+		MinimalTuple *tups;
+		int			ntups;
+
+		ntups = CvtChunksToTupBatch(&pCSEntry->chunk_list, pSerInfo, &tups);
+
+		clearTCList(NULL, &pCSEntry->chunk_list);
+
+		for (int i = 0; i < ntups; i++)
+		{
+			htfifo_addtuple(pCSEntry->ready_tuples, tups[i]);
+			statNewTupleArrived(pMNEntry, pCSEntry);
+		}
+		pfree(tups);
+		return;
+	}
+
 	/*
 	 * Convert the list of chunks into a tuple, then stow it away.
 	 */
@@ -244,10 +315,19 @@ createMotionLayerState(int maxMotNodeID)
  * Initialize a single motion node.  This is called by the executor when a
  * motion node in the plan tree is being initialized.
  *
+ * Tuples are sent in the columnar batch format if gp_motion_columnar_batch
+ * is on and the tuple descriptor allows it, and one at a time otherwise.
+ *
+ * If 'compress' is true, tuples sent through the node start out compressed.
+ * With gp_motion_compression on, the sender may also switch compression on
+ * when the link turns out to be slow, and off when the data does not
+ * compress.
+ *
  * This function is called from:  ExecInitMotion()
  */
 void
-UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserveOrder, TupleDesc tupDesc)
+UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserveOrder,
+					  TupleDesc tupDesc, bool compress)
 {
 	MemoryContext oldCtxt;
 	MotionNodeEntry *pEntry;
@@ -273,6 +353,26 @@ UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserve
 	pEntry->preserve_order = preserveOrder;
 	pEntry->tuple_desc = CreateTupleDescCopy(tupDesc);
 	InitSerTupInfo(pEntry->tuple_desc, &pEntry->ser_tup_info);
+	pEntry->ser_tup_info.compress = compress;
+
+	/*
+	 * The sender and the receivers make the same decision from the same plan
+	 * and settings, so no handshake is needed to agree on the format.
+	 */
+	pEntry->batch_format = gp_motion_columnar_batch &&
+		CandidateForSerializeBatch(&pEntry->ser_tup_info);
+	pEntry->send_batches = NULL;
+	pEntry->num_send_batches = 0;
+	pEntry->batch_max_bytes = MOTION_BATCH_TOTAL_BYTES / Max(getgpsegmentCount(), 1);
+	pEntry->batch_max_bytes = Max(Min(pEntry->batch_max_bytes, MOTION_BATCH_MAX_BYTES),
+								  MOTION_BATCH_MIN_BYTES);
+
+	pEntry->compress_adaptive = gp_motion_compression;
+	pEntry->compress_window_sends = 0;
+	pEntry->compress_window_bytes = 0;
+	INSTR_TIME_SET_ZERO(pEntry->compress_window_time);
+	pEntry->compress_window_raw = 0;
+	pEntry->compress_window_wire = 0;
 
 	if (!preserveOrder)
 	{
@@ -421,7 +521,7 @@ CheckAndSendRecordCache(MotionLayerState *mlStates,
 	else
 	{
 		/* update stats */
-		statSendTuple(mlStates, pMNEntry, &tcList);
+		statSendTuple(mlStates, pMNEntry, &tcList, 1);
 	}
 
 	/* cleanup */
@@ -432,6 +532,9 @@ CheckAndSendRecordCache(MotionLayerState *mlStates,
 
 /*
  * Function:  SendTuple - Sends a portion or whole tuple to the AMS layer.
+ *
+ * If the motion node uses the columnar batch format, the tuple is only added
+ * to the batch of its route, and the batch is sent when it is full.
  */
 SendReturnCode
 SendTuple(MotionLayerState *mlStates,
@@ -441,9 +544,6 @@ SendTuple(MotionLayerState *mlStates,
 		  int16 targetRoute)
 {
 	MotionNodeEntry *pMNEntry;
-	TupleChunkListData tcList;
-	MemoryContext oldCtxt;
-	SendReturnCode rc;
 
 	AssertArg(!TupIsNull(slot));
 
@@ -460,22 +560,109 @@ SendTuple(MotionLayerState *mlStates,
 	 */
 	pMNEntry = getMotionNodeEntry(mlStates, motNodeID);
 
+	if (pMNEntry->batch_format)
+	{
+		MotionSendBatch *batch;
+		MemoryContext oldCtxt;
+		MinimalTuple tup;
+
+		if (pMNEntry->stopped)
+			return STOP_SENDING;
+
+		batch = getSendBatch(mlStates, pMNEntry, targetRoute);
+
+		oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
+		tup = ExecCopySlotMinimalTuple(slot);
+		MemoryContextSwitchTo(oldCtxt);
+
+		batch->tuples[batch->ntuples++] = tup;
+		batch->nbytes += tup->t_len;
+
+		if (batch->ntuples < MOTION_BATCH_MAX_TUPLES &&
+			batch->nbytes < pMNEntry->batch_max_bytes)
+			return SEND_COMPLETE;
+
+		return sendSerialized(mlStates, transportStates, pMNEntry, targetRoute,
+							  NULL, batch);
+	}
+
+	return sendSerialized(mlStates, transportStates, pMNEntry, targetRoute,
+						  slot, NULL);
+}
+
+/*
+ * Serialize and send either a single tuple, or the tuples collected in a
+ * batch, which is emptied.
+ */
+static SendReturnCode
+sendSerialized(MotionLayerState *mlStates,
+			   ChunkTransportState *transportStates,
+			   MotionNodeEntry *pMNEntry,
+			   int16 targetRoute,
+			   TupleTableSlot *slot,
+			   MotionSendBatch *batch)
+{
+	int16		motNodeID = pMNEntry->motion_node_id;
+	TupleChunkListData tcList;
+	MemoryContext oldCtxt;
+	SendReturnCode rc;
+	int			ntuples = batch ? batch->ntuples : 1;
+	bool		probe;
+	instr_time	starttime;
+	instr_time	endtime;
+	instr_time	elapsed;
+
 #ifdef AMS_VERBOSE_LOGGING
 	elog(DEBUG5, "Serializing HeapTuple for sending.");
 #endif
 
+	/*
+	 * While deciding whether to compress, time the transport calls of a
+	 * sample of the sends, leaving out the serialization itself.  Batches
+	 * are few enough to time them all.
+	 */
+	probe = pMNEntry->compress_adaptive && !pMNEntry->ser_tup_info.compress &&
+		(batch != NULL ||
+		 (pMNEntry->stat_total_sends % MOTION_COMPRESS_PROBE_INTERVAL) == 0);
+	INSTR_TIME_SET_ZERO(elapsed);
+
 	struct directTransportBuffer b;
 	if (targetRoute != BROADCAST_SEGIDX)
+	{
+		if (probe)
+			INSTR_TIME_SET_CURRENT(starttime);
 		getTransportDirectBuffer(transportStates, motNodeID, targetRoute, &b);
+		if (probe)
+		{
+			INSTR_TIME_SET_CURRENT(endtime);
+			INSTR_TIME_ACCUM_DIFF(elapsed, endtime, starttime);
+		}
+	}
 
 	int			sent = 0;
 
 	/* Create and store the serialized form, and some stats about it. */
 	oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
 
-	sent = SerializeTuple(slot, &pMNEntry->ser_tup_info, &b, &tcList, targetRoute);
+	if (batch)
+	{
+		sent = SerializeTupleBatch(&pMNEntry->ser_tup_info,
+								   batch->tuples, batch->ntuples,
+								   &b, &tcList, targetRoute);
+
+		for (int i = 0; i < batch->ntuples; i++)
+			pfree(batch->tuples[i]);
+		batch->ntuples = 0;
+		batch->nbytes = 0;
+	}
+	else
+		sent = SerializeTuple(slot, &pMNEntry->ser_tup_info, &b, &tcList, targetRoute);
 
 	MemoryContextSwitchTo(oldCtxt);
+
+	if (probe)
+		INSTR_TIME_SET_CURRENT(starttime);
+
 	if (sent > 0)
 	{
 		putTransportDirectBuffer(transportStates, motNodeID, targetRoute, sent);
@@ -485,7 +672,18 @@ SendTuple(MotionLayerState *mlStates,
 		tcList.serialized_data_length = sent;
 
 		/* update stats */
-		statSendTuple(mlStates, pMNEntry, &tcList);
+		statSendTuple(mlStates, pMNEntry, &tcList, ntuples);
+
+		if (pMNEntry->compress_adaptive)
+		{
+			if (probe)
+			{
+				INSTR_TIME_SET_CURRENT(endtime);
+				INSTR_TIME_ACCUM_DIFF(elapsed, endtime, starttime);
+			}
+			adaptMotionCompression(pMNEntry, probe ? &elapsed : NULL, sent,
+								   ntuples);
+		}
 
 		return SEND_COMPLETE;
 	}
@@ -510,7 +708,18 @@ SendTuple(MotionLayerState *mlStates,
 	else
 	{
 		/* update stats */
-		statSendTuple(mlStates, pMNEntry, &tcList);
+		statSendTuple(mlStates, pMNEntry, &tcList, ntuples);
+
+		if (pMNEntry->compress_adaptive)
+		{
+			if (probe)
+			{
+				INSTR_TIME_SET_CURRENT(endtime);
+				INSTR_TIME_ACCUM_DIFF(elapsed, endtime, starttime);
+			}
+			adaptMotionCompression(pMNEntry, probe ? &elapsed : NULL,
+								   tcList.serialized_data_length, ntuples);
+		}
 
 		rc = SEND_COMPLETE;
 	}
@@ -521,6 +730,125 @@ SendTuple(MotionLayerState *mlStates,
 	return rc;
 }
 
+/*
+ * Get the batch that collects the tuples for a route, creating it if needed.
+ * The broadcast route has slot 0 in the array of batches.
+ */
+static MotionSendBatch *
+getSendBatch(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, int16 targetRoute)
+{
+	int			slot = (targetRoute == BROADCAST_SEGIDX) ? 0 : targetRoute + 1;
+
+	Assert(slot >= 0);
+
+	if (slot >= pMNEntry->num_send_batches)
+	{
+		int			newsize = Max(slot + 1, pMNEntry->num_send_batches * 2);
+
+		if (pMNEntry->send_batches == NULL)
+			pMNEntry->send_batches = (MotionSendBatch **)
+				MemoryContextAllocZero(mlStates->motion_layer_mctx,
+									   newsize * sizeof(MotionSendBatch *));
+		else
+		{
+			pMNEntry->send_batches = (MotionSendBatch **)
+				repalloc(pMNEntry->send_batches,
+						 newsize * sizeof(MotionSendBatch *));
+			memset(pMNEntry->send_batches + pMNEntry->num_send_batches, 0,
+				   (newsize - pMNEntry->num_send_batches) * sizeof(MotionSendBatch *));
+		}
+		pMNEntry->num_send_batches = newsize;
+	}
+
+	if (pMNEntry->send_batches[slot] == NULL)
+		pMNEntry->send_batches[slot] = (MotionSendBatch *)
+			MemoryContextAllocZero(mlStates->motion_layer_mctx,
+								   sizeof(MotionSendBatch));
+
+	return pMNEntry->send_batches[slot];
+}
+
+/*
+ * Send the partially filled batches of a motion node, before end-of-stream.
+ */
+static void
+flushSendBatches(MotionLayerState *mlStates,
+				 ChunkTransportState *transportStates,
+				 MotionNodeEntry *pMNEntry)
+{
+	for (int slot = 0; slot < pMNEntry->num_send_batches; slot++)
+	{
+		MotionSendBatch *batch = pMNEntry->send_batches[slot];
+
+		if (batch == NULL || batch->ntuples == 0 || pMNEntry->stopped)
+			continue;
+
+		sendSerialized(mlStates, transportStates, pMNEntry,
+					   slot == 0 ? BROADCAST_SEGIDX : slot - 1,
+					   NULL, batch);
+	}
+}
+
+/*
+ * Revisit the compression decision of a sending motion node at the end of
+ * each window of sends.
+ *
+ * 'elapsed' is the time the transport took for this send of 'ntuples' tuples
+ * if it was timed, or NULL.  Compression is switched on when the throughput measured over the
+ * timed sends falls below gp_motion_compression_throughput_threshold, and
+ * switched off for the rest of the query when it does not pay off.
+ */
+static void
+adaptMotionCompression(MotionNodeEntry *pMNEntry, instr_time *elapsed,
+					   int bytes, int ntuples)
+{
+	SerTupInfo *pSerInfo = &pMNEntry->ser_tup_info;
+
+	if (elapsed)
+	{
+		INSTR_TIME_ADD(pMNEntry->compress_window_time, *elapsed);
+		pMNEntry->compress_window_bytes += bytes;
+	}
+
+	pMNEntry->compress_window_sends += ntuples;
+	if (pMNEntry->compress_window_sends < MOTION_COMPRESS_WINDOW)
+		return;
+
+	if (pSerInfo->compress)
+	{
+		uint64		raw = pSerInfo->compress_raw_bytes - pMNEntry->compress_window_raw;
+		uint64		wire = pSerInfo->compress_wire_bytes - pMNEntry->compress_window_wire;
+
+		if (raw > 0 && wire > raw * (1.0 - MOTION_COMPRESS_MIN_SAVING))
+		{
+			elog(DEBUG1, "motion node %d: tuples do not compress, sending them uncompressed",
+				 pMNEntry->motion_node_id);
+			pSerInfo->compress = false;
+			pMNEntry->compress_adaptive = false;
+		}
+	}
+	else if (gp_motion_compression_throughput_threshold > 0)
+	{
+		double		secs = INSTR_TIME_GET_DOUBLE(pMNEntry->compress_window_time);
+
+		if (secs > 0 &&
+			pMNEntry->compress_window_bytes / 1024.0 / secs <
+			gp_motion_compression_throughput_threshold)
+		{
+			elog(DEBUG1, "motion node %d: link throughput %.0f kB/s, compressing tuples",
+				 pMNEntry->motion_node_id,
+				 pMNEntry->compress_window_bytes / 1024.0 / secs);
+			pSerInfo->compress = true;
+		}
+	}
+
+	pMNEntry->compress_window_sends = 0;
+	pMNEntry->compress_window_bytes = 0;
+	INSTR_TIME_SET_ZERO(pMNEntry->compress_window_time);
+	pMNEntry->compress_window_raw = pSerInfo->compress_raw_bytes;
+	pMNEntry->compress_window_wire = pSerInfo->compress_wire_bytes;
+}
+
 /*
  * Sends a token to all peer Motion Nodes, indicating that this motion
  * node has no more tuples to send out.
@@ -539,6 +867,10 @@ SendEndOfStream(MotionLayerState *mlStates,
 	 */
 	pMNEntry = getMotionNodeEntry(mlStates, motNodeID);
 
+	/* Tuples still waiting in batches must go out before end-of-stream. */
+	if (pMNEntry->batch_format)
+		flushSendBatches(mlStates, transportStates, pMNEntry);
+
 	transportStates->SendEos(transportStates, motNodeID, s_eos_chunk_data);
 
 	/*
@@ -719,6 +1051,27 @@ processIncomingChunks(MotionLayerState *mlStates,
 	MemoryContextSwitchTo(oldCtxt);
 }
 
+/*
+ * Returns the number of bytes that tuple compression has saved on the wire
+ * for a motion node, as seen by this process.  Both the sender and the
+ * receivers of a motion node keep count.
+ */
+uint64
+GetMotionLayerNodeBytesSaved(MotionLayerState *mlStates, int16 motNodeID)
+{
+	MotionNodeEntry *pMNEntry;
+
+	if (mlStates == NULL || motNodeID < 1 || motNodeID > mlStates->mneCount)
+		return 0;
+
+	pMNEntry = &mlStates->mnEntries[motNodeID - 1];
+	if (!pMNEntry->valid)
+		return 0;
+
+	return pMNEntry->ser_tup_info.compress_raw_bytes -
+		pMNEntry->ser_tup_info.compress_wire_bytes;
+}
+
 void
 EndMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool flushCommLayer)
 {
@@ -835,7 +1188,33 @@ EndMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool flushCommLa
 				 pMNEntry->stat_total_chunks_recvd
 				);
 		}
+		if (pMNEntry->ser_tup_info.compress_raw_bytes > 0)
+		{
+			elog(LOG, "Interconnect seg%d slice%d motion%d compressed " UINT64_FORMAT
+				 " tuple bytes into " UINT64_FORMAT " bytes.",
+				 GpIdentity.segindex,
+				 currentSliceId,
+				 motNodeID,
+				 pMNEntry->ser_tup_info.compress_raw_bytes,
+				 pMNEntry->ser_tup_info.compress_wire_bytes
+				);
+		}
+	}
+
+	for (i = 0; i < pMNEntry->num_send_batches; i++)
+	{
+		MotionSendBatch *batch = pMNEntry->send_batches[i];
+
+		if (batch == NULL)
+			continue;
+		for (int j = 0; j < batch->ntuples; j++)
+			pfree(batch->tuples[j]);
+		pfree(batch);
 	}
+	if (pMNEntry->send_batches)
+		pfree(pMNEntry->send_batches);
+	pMNEntry->send_batches = NULL;
+	pMNEntry->num_send_batches = 0;
 
 	CleanupSerTupInfo(&pMNEntry->ser_tup_info);
 	FreeTupleDesc(pMNEntry->tuple_desc);
@@ -1144,7 +1523,7 @@ addChunkToSorter(ChunkTransportState *transportStates,
  * SerializeTupleDirect() only fills those fields out.
  */
 static void
-statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList)
+statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList, int ntuples)
 {
 	int			headerOverhead;
 
@@ -1153,7 +1532,7 @@ statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkL
 	headerOverhead = TUPLE_CHUNK_HEADER_SIZE * tcList->num_chunks;
 
 	/* per motion-node stats. */
-	pMNEntry->stat_total_sends++;
+	pMNEntry->stat_total_sends += ntuples;
 	pMNEntry->stat_total_chunks_sent += tcList->num_chunks;
 	pMNEntry->stat_total_bytes_sent += tcList->serialized_data_length + headerOverhead;
 	pMNEntry->stat_tuple_bytes_sent += tcList->serialized_data_length;
@@ -138,6 +138,19 @@ int
 /* 1/4 sec in msec */
 #define RX_THREAD_POLL_TIMEOUT (250)
 
+/*
+ * Batched socket I/O, used when gp_interconnect_batch_io is on and the
+ * platform has sendmmsg() and recvmmsg(): the sender passes the packets it
+ * releases from a send queue to the kernel in one call, and the rx thread
+ * drains up to IC_RX_BATCH_SIZE packets from the socket per call.
+ */
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#define IC_HAVE_MMSG
+#endif
+
+#define IC_SEND_BATCH_SIZE (64)
+#define IC_RX_BATCH_SIZE (32)
+
 /*
  * Flags definitions for flag-field of UDP-messages
  *
@@ -320,6 +333,29 @@ struct RxBufferPool
  */
 static RxBufferPool rx_buffer_pool = {1, 0, NULL};
 
+#ifdef IC_HAVE_MMSG
+/*
+ * Packets the rx thread received with one recvmmsg() call.
+ *
+ * The rx thread takes the buffers of the batch from rx_buffer_pool the first
+ * time it receives in batches, raising maxCount by one for each, and keeps
+ * them until it shuts down. Packets are handed out by swapping buffers with
+ * the one the rx thread works on.
+ */
+typedef struct RxBatch
+{
+	icpkthdr   *pkts[IC_RX_BATCH_SIZE];
+	struct sockaddr_storage peers[IC_RX_BATCH_SIZE];
+	struct iovec iovs[IC_RX_BATCH_SIZE];
+	struct mmsghdr msgs[IC_RX_BATCH_SIZE];
+
+	int			count;			/* number of packets received */
+	int			next;			/* next packet to hand out */
+} RxBatch;
+
+static RxBatch rx_batch;
+#endif
+
 /*
  * SendBufferPool
  *
@@ -758,6 +794,11 @@ static inline void addCRC(icpkthdr *pkt);
 static inline bool checkCRC(icpkthdr *pkt);
 static void sendBuffers(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry, MotionConn *conn);
 static void sendOnce(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry, ICBuffer *buf, MotionConn *conn);
+#ifdef IC_HAVE_MMSG
+static void sendBatch(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry, ICBuffer **bufs, int nbufs, MotionConn *conn);
+#endif
+static ssize_t receivePacket(icpkthdr **pkt, struct sockaddr_storage *peer, socklen_t *peerlen);
+static void releaseRxBatch(void);
 static inline uint64 computeExpirationPeriod(MotionConn *conn, uint32 retry);
 
 static ICBuffer *getSndBuffer(MotionConn *conn);
@@ -4690,6 +4731,78 @@ sendOnce(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry,
 	return;
 }
 
+#ifdef IC_HAVE_MMSG
+/*
+ * sendBatch
+ * 		Send the packets of a set of buffers, all bound for the peer of conn,
+ * 		with as few sendmmsg() calls as possible.
+ *
+ * A packet the kernel refuses is passed on to sendOnce(), which knows the
+ * errors to ignore and the ones to report.
+ */
+static void
+sendBatch(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry,
+		  ICBuffer **bufs, int nbufs, MotionConn *conn)
+{
+	struct mmsghdr msgs[IC_SEND_BATCH_SIZE];
+	struct iovec iovs[IC_SEND_BATCH_SIZE];
+	int			nmsgs = 0;
+	int			sent = 0;
+
+	Assert(nbufs <= IC_SEND_BATCH_SIZE);
+
+	for (int i = 0; i < nbufs; i++)
+	{
+#ifdef USE_ASSERT_CHECKING
+		if (testmode_inject_fault(gp_udpic_dropxmit_percent))
+		{
+#ifdef AMS_VERBOSE_LOGGING
+			write_log("THROW PKT with seq %d srcpid %d despid %d", bufs[i]->pkt->seq, bufs[i]->pkt->srcPid, bufs[i]->pkt->dstPid);
+#endif
+			continue;
+		}
+#endif
+		bufs[nmsgs] = bufs[i];
+
+		iovs[nmsgs].iov_base = bufs[nmsgs]->pkt;
+		iovs[nmsgs].iov_len = bufs[nmsgs]->pkt->len;
+
+		memset(&msgs[nmsgs], 0, sizeof(struct mmsghdr));
+		msgs[nmsgs].msg_hdr.msg_name = (void *) &conn->peer;
+		msgs[nmsgs].msg_hdr.msg_namelen = conn->peer_len;
+		msgs[nmsgs].msg_hdr.msg_iov = &iovs[nmsgs];
+		msgs[nmsgs].msg_hdr.msg_iovlen = 1;
+		nmsgs++;
+	}
+
+	while (sent < nmsgs)
+	{
+		int			n;
+
+		n = sendmmsg(pEntry->txfd, &msgs[sent], nmsgs - sent, 0);
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			sendOnce(transportStates, pEntry, bufs[sent], conn);
+			sent++;
+			continue;
+		}
+
+		for (int i = sent; i < sent + n; i++)
+		{
+			if (msgs[i].msg_len != bufs[i]->pkt->len && DEBUG1 >= log_min_messages)
+				write_log("Interconnect error writing an outgoing packet [seq %d]: short transmit (given %d sent %d) during sendmmsg() call."
+						  "For Remote Connection: contentId=%d at %s", bufs[i]->pkt->seq, bufs[i]->pkt->len, msgs[i].msg_len,
+						  conn->remoteContentId,
+						  conn->remoteHostAndPort);
+		}
+		sent += n;
+	}
+}
+#endif
+
 
 /*
  * handleStopMsgs
@@ -4799,6 +4912,11 @@ handleStopMsgs(ChunkTransportState *transportStates, ChunkTransportStateEntry *p
 static void
 sendBuffers(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry, MotionConn *conn)
 {
+#ifdef IC_HAVE_MMSG
+	ICBuffer   *batch[IC_SEND_BATCH_SIZE];
+	int			nbatch = 0;
+#endif
+
 	while (conn->capacity > 0 && icBufferListLength(&conn->sndQueue) > 0)
 	{
 		ICBuffer   *buf = NULL;
@@ -4848,7 +4966,20 @@ sendBuffers(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEnt
 		updateStats(TPE_DATA_PKT_SEND, conn, buf->pkt);
 #endif
 
-		sendOnce(transportStates, pEntry, buf, conn);
+#ifdef IC_HAVE_MMSG
+		if (gp_interconnect_batch_io)
+		{
+			/* the buffers stay in the unack queue until they're acked */
+			batch[nbatch++] = buf;
+			if (nbatch == IC_SEND_BATCH_SIZE)
+			{
+				sendBatch(transportStates, pEntry, batch, nbatch, conn);
+				nbatch = 0;
+			}
+		}
+		else
+#endif
+			sendOnce(transportStates, pEntry, buf, conn);
 		ic_statistics.sndPktNum++;
 
 #ifdef AMS_VERBOSE_LOGGING
@@ -4857,6 +4988,11 @@ sendBuffers(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEnt
 
 		buf->conn->sentSeq = buf->pkt->seq;
 	}
+
+#ifdef IC_HAVE_MMSG
+	if (nbatch > 0)
+		sendBatch(transportStates, pEntry, batch, nbatch, conn);
+#endif
 }
 
 /*
@@ -6288,9 +6424,7 @@ rxThreadFunc(void *arg)
 			struct sockaddr_storage peer;
 			socklen_t	peerlen;
 
-			peerlen = sizeof(peer);
-			read_count = recvfrom(UDP_listenerFd, (char *) pkt, Gp_max_packet_size, 0,
-								  (struct sockaddr *) &peer, &peerlen);
+			read_count = receivePacket(&pkt, &peer, &peerlen);
 
 			if (pg_atomic_read_u32(&ic_control_info.shutdown) == 1)
 			{
@@ -6442,11 +6576,116 @@ rxThreadFunc(void *arg)
 		pkt = NULL;
 		pthread_mutex_unlock(&ic_control_info.lock);
 	}
+	releaseRxBatch();
 
 	/* nothing to return */
 	return NULL;
 }
 
+/*
+ * receivePacket
+ * 		Receive the next packet from the listener socket into *pkt.
+ *
+ * With batched I/O, one recvmmsg() call fills the buffers of rx_batch, and
+ * the following calls hand the packets out one by one, swapping buffers with
+ * *pkt. Returns the length of the packet, or -1 with errno set.
+ *
+ * Called by the rx thread only, without ic_control_info.lock held.
+ */
+static ssize_t
+receivePacket(icpkthdr **pkt, struct sockaddr_storage *peer, socklen_t *peerlen)
+{
+#ifdef IC_HAVE_MMSG
+	RxBatch    *batch = &rx_batch;
+
+	if (batch->next >= batch->count && gp_interconnect_batch_io)
+	{
+		int			nslots;
+		int			n;
+
+		pthread_mutex_lock(&ic_control_info.lock);
+		for (nslots = 0; nslots < IC_RX_BATCH_SIZE; nslots++)
+		{
+			if (batch->pkts[nslots] != NULL)
+				continue;
+
+			rx_buffer_pool.maxCount++;
+			batch->pkts[nslots] = getRxBuffer(&rx_buffer_pool);
+			if (batch->pkts[nslots] == NULL)
+			{
+				rx_buffer_pool.maxCount--;
+				break;
+			}
+		}
+		pthread_mutex_unlock(&ic_control_info.lock);
+
+		if (nslots > 0)
+		{
+			for (int i = 0; i < nslots; i++)
+			{
+				batch->iovs[i].iov_base = batch->pkts[i];
+				batch->iovs[i].iov_len = Gp_max_packet_size;
+
+				memset(&batch->msgs[i], 0, sizeof(struct mmsghdr));
+				batch->msgs[i].msg_hdr.msg_name = &batch->peers[i];
+				batch->msgs[i].msg_hdr.msg_namelen = sizeof(batch->peers[i]);
+				batch->msgs[i].msg_hdr.msg_iov = &batch->iovs[i];
+				batch->msgs[i].msg_hdr.msg_iovlen = 1;
+			}
+
+			n = recvmmsg(UDP_listenerFd, batch->msgs, nslots, MSG_DONTWAIT, NULL);
+			if (n < 0)
+				return -1;
+
+			batch->count = n;
+			batch->next = 0;
+		}
+	}
+
+	if (batch->next < batch->count)
+	{
+		int			i = batch->next++;
+		icpkthdr   *spare = *pkt;
+
+		*pkt = batch->pkts[i];
+		batch->pkts[i] = spare;
+
+		*peerlen = batch->msgs[i].msg_hdr.msg_namelen;
+		memcpy(peer, &batch->peers[i], *peerlen);
+
+		return batch->msgs[i].msg_len;
+	}
+#endif
+
+	*peerlen = sizeof(*peer);
+	return recvfrom(UDP_listenerFd, (char *) *pkt, Gp_max_packet_size, 0,
+					(struct sockaddr *) peer, peerlen);
+}
+
+/*
+ * releaseRxBatch
+ * 		Return the buffers of rx_batch to the pool when the rx thread exits.
+ */
+static void
+releaseRxBatch(void)
+{
+#ifdef IC_HAVE_MMSG
+	pthread_mutex_lock(&ic_control_info.lock);
+	for (int i = 0; i < IC_RX_BATCH_SIZE; i++)
+	{
+		if (rx_batch.pkts[i] == NULL)
+			continue;
+
+		freeRxBuffer(&rx_buffer_pool, rx_batch.pkts[i]);
+		rx_buffer_pool.maxCount--;
+		rx_batch.pkts[i] = NULL;
+	}
+	rx_batch.count = 0;
+	rx_batch.next = 0;
+	pthread_mutex_unlock(&ic_control_info.lock);
+#endif
+}
+
 /*
  * handleMismatch
  * 		If the mismatched packet is from an old connection, we may need to
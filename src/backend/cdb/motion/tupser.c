@@ -23,6 +23,7 @@
 #include "cdb/cdbsrlz.h"
 #include "cdb/tupser.h"
 #include "cdb/cdbvars.h"
+#include "common/pg_lzcompress.h"
 #include "libpq/pqformat.h"
 #include "storage/smgr.h"
 #include "utils/acl.h"
@@ -33,13 +34,44 @@
 #include "utils/syscache.h"
 #include "utils/typcache.h"
 
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
 /*
  * Transient record types table is sent to upsteam via a specially constructed
  * chunk, with a special "tuple length".
  */
 #define RECORD_CACHE_MAGIC_TUPLEN	-1
 
+/*
+ * A compressed tuple body is sent with one of these in place of the tuple
+ * length, followed by the uncompressed length and the compressed bytes.
+ */
+#define PGLZ_TUPLE_MAGIC_TUPLEN		-2
+#define ZSTD_TUPLE_MAGIC_TUPLEN		-3
+
+/* Tuple bodies shorter than this are never worth compressing */
+#define MIN_COMPRESS_TUPLEN			64
+
+#define TUPLE_ZSTD_COMPRESSION_LEVEL 1
+
+/*
+ * A batch of tuples in the columnar format starts with this in place of the
+ * tuple length, followed by the number of tuples, the compression method (0,
+ * or one of the magic tuple lengths above) and the uncompressed length of the
+ * body.
+ *
+ * The body holds, for each attribute in turn, a bitmap of the tuples that are
+ * not null in it, then the values of those tuples, each aligned like in a
+ * heap tuple relative to the start of the body.
+ */
+#define BATCH_MAGIC_TUPLEN			-4
+#define BATCH_HEADER_LEN			(4 * sizeof(int32))
+
 static void addByteStringToChunkList(TupleChunkList tcList, char *data, int datalen, TupleChunkListCache *cache);
+static int	compressTupleBody(SerTupInfo *pSerInfo, const char *src, int srclen, int32 *magic);
+static void decompressTupleBody(int32 magic, const char *src, int srclen, char *dest, int rawlen);
 
 #define addCharToChunkList(tcList, x, c)							\
 	do															\
@@ -170,6 +202,15 @@ CleanupSerTupInfo(SerTupInfo *pSerInfo)
 
 	pSerInfo->tupdesc = NULL;
 
+	if (pSerInfo->compressbuf != NULL)
+		pfree(pSerInfo->compressbuf);
+	pSerInfo->compressbuf = NULL;
+	pSerInfo->compressbuflen = 0;
+
+	if (pSerInfo->batchbuf.data != NULL)
+		pfree(pSerInfo->batchbuf.data);
+	pSerInfo->batchbuf.data = NULL;
+
 	while (pSerInfo->chunkCache.items != NULL)
 	{
 		TupleChunkListItem item;
@@ -327,12 +368,185 @@ SerializeRecordCacheIntoChunks(SerTupInfo *pSerInfo,
 	return;
 }
 
+/*
+ * Compress a tuple body into pSerInfo->compressbuf.
+ *
+ * Returns the compressed length and sets *magic to the tuple length that
+ * identifies the method on the wire, or returns -1 if the data does not
+ * compress.  The buffer is allocated in the caller's memory context, which is
+ * the Motion layer's.
+ */
+static int
+compressTupleBody(SerTupInfo *pSerInfo, const char *src, int srclen, int32 *magic)
+{
+	int			bound;
+
+#ifdef USE_ZSTD
+	static ZSTD_CCtx *cxt = NULL;	/* ZSTD compression context */
+	size_t		complen;
+
+	bound = ZSTD_compressBound(srclen);
+#else
+	bound = PGLZ_MAX_OUTPUT(srclen);
+#endif
+
+	if (pSerInfo->compressbuflen < bound)
+	{
+		if (pSerInfo->compressbuf != NULL)
+			pfree(pSerInfo->compressbuf);
+		pSerInfo->compressbuflen = Max(bound, BLCKSZ);
+		pSerInfo->compressbuf = palloc(pSerInfo->compressbuflen);
+	}
+
+#ifdef USE_ZSTD
+	if (!cxt)
+	{
+		cxt = ZSTD_createCCtx();
+		if (!cxt)
+			elog(ERROR, "out of memory");
+	}
+
+	complen = ZSTD_compressCCtx(cxt,
+								pSerInfo->compressbuf, pSerInfo->compressbuflen,
+								src, srclen,
+								TUPLE_ZSTD_COMPRESSION_LEVEL);
+	if (ZSTD_isError(complen))
+		elog(ERROR, "tuple compression failed: %s", ZSTD_getErrorName(complen));
+
+	*magic = ZSTD_TUPLE_MAGIC_TUPLEN;
+	return (int) complen;
+#else
+	*magic = PGLZ_TUPLE_MAGIC_TUPLEN;
+	return pglz_compress(src, srclen, pSerInfo->compressbuf,
+						 PGLZ_strategy_default);
+#endif
+}
+
+/*
+ * Decompress a tuple body sent by compressTupleBody() into 'dest', which has
+ * room for exactly 'rawlen' bytes.
+ */
+static void
+decompressTupleBody(int32 magic, const char *src, int srclen, char *dest, int rawlen)
+{
+	if (magic == ZSTD_TUPLE_MAGIC_TUPLEN)
+	{
+#ifdef USE_ZSTD
+		static ZSTD_DCtx *cxt = NULL;	/* ZSTD decompression context */
+		size_t		len;
+
+		if (!cxt)
+		{
+			cxt = ZSTD_createDCtx();
+			if (!cxt)
+				elog(ERROR, "out of memory");
+		}
+
+		len = ZSTD_decompressDCtx(cxt, dest, rawlen, src, srclen);
+		if (ZSTD_isError(len) || len != rawlen)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROTOCOL_VIOLATION),
+					 errmsg("compressed tuple is corrupt")));
+#else
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("received a zstd-compressed tuple, but this build does not support zstd")));
+#endif
+	}
+	else
+	{
+		if (pglz_decompress(src, srclen, dest, rawlen, true) != rawlen)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROTOCOL_VIOLATION),
+					 errmsg("compressed tuple is corrupt")));
+	}
+}
+
 static bool
 CandidateForSerializeDirect(int16 targetRoute, struct directTransportBuffer *b)
 {
 	return targetRoute != BROADCAST_SEGIDX && b->pri != NULL && b->prilen > TUPLE_CHUNK_HEADER_SIZE;
 }
 
+/*
+ * Put a serialized payload, made of a header and a body, on the wire.
+ *
+ * The payload is written directly into the transport buffer if it fits,
+ * and the number of bytes used there is returned.  Otherwise it is copied
+ * into a list of chunks in 'tcList', and 0 is returned.
+ */
+static int
+serializePayload(SerTupInfo *pSerInfo, struct directTransportBuffer *b,
+				 TupleChunkList tcList, int16 targetRoute,
+				 char *hdr, int hdrlen, char *body, unsigned int bodylen)
+{
+	TupleChunkListItem tcItem;
+	unsigned int payloadlen = hdrlen + bodylen;
+
+	tcList->p_first = NULL;
+	tcList->p_last = NULL;
+	tcList->num_chunks = 0;
+	tcList->serialized_data_length = 0;
+	tcList->max_chunk_length = Gp_max_tuple_chunk_size;
+
+	if (CandidateForSerializeDirect(targetRoute, b) &&
+		payloadlen + TUPLE_CHUNK_HEADER_SIZE <= b->prilen)
+	{
+		/*
+		 * The payload fits in the direct transport buffer.
+		 */
+		memcpy(b->pri + TUPLE_CHUNK_HEADER_SIZE, hdr, hdrlen);
+		memcpy(b->pri + TUPLE_CHUNK_HEADER_SIZE + hdrlen, body, bodylen);
+
+		SetChunkType(b->pri, TC_WHOLE);
+		SetChunkDataSize(b->pri, payloadlen);
+
+		return TUPLE_CHUNK_HEADER_SIZE + payloadlen;
+	}
+
+	/*
+	 * If direct in-line serialization failed then we fallback to chunked
+	 * out-of-line serialization.
+	 */
+	tcItem = getChunkFromCache(&pSerInfo->chunkCache);
+	SetChunkType(tcItem->chunk_data, TC_WHOLE);
+	tcItem->chunk_length = TUPLE_CHUNK_HEADER_SIZE;
+	appendChunkToTCList(tcList, tcItem);
+
+	addByteStringToChunkList(tcList, hdr, hdrlen, &pSerInfo->chunkCache);
+	addByteStringToChunkList(tcList, body, bodylen, &pSerInfo->chunkCache);
+
+	/*
+	 * if we have more than 1 chunk we have to set the chunk types on our
+	 * first chunk and last chunk
+	 */
+	if (tcList->num_chunks > 1)
+	{
+		TupleChunkListItem first,
+					last;
+
+		first = tcList->p_first;
+		last = tcList->p_last;
+
+		Assert(first != NULL);
+		Assert(first != last);
+		Assert(last != NULL);
+
+		SetChunkType(first->chunk_data, TC_PARTIAL_START);
+		SetChunkType(last->chunk_data, TC_PARTIAL_END);
+
+		/*
+		 * any intervening chunks are already set to TC_PARTIAL_MID when
+		 * allocated
+		 */
+	}
+
+	/*
+	 * performed "out-of-line" serialization
+	 */
+	return 0;
+}
+
 /*
  *
  * First try to serialize a tuple directly into a buffer.
@@ -348,15 +562,17 @@ int
 SerializeTuple(TupleTableSlot *slot, SerTupInfo *pSerInfo, struct directTransportBuffer *b, TupleChunkList tcList, int16 targetRoute)
 {
 	int                natts;
-	int                dataSize = TUPLE_CHUNK_HEADER_SIZE;
 	TupleDesc          tupdesc;
-	TupleChunkListItem tcItem = NULL;
 	MinimalTuple       mintuple;
 	bool               shouldFreeTuple;
 	char               *tupbody;
 	unsigned int       tupbodylen;
-	unsigned int       tuplen;
 	bool               hasExternalAttr = false;
+	int                sent;
+	int32              wirehdr[2];
+	int                wirehdrlen;
+	char               *wirebody;
+	unsigned int       wirebodylen;
 
 	AssertArg(pSerInfo != NULL);
 	AssertArg(b != NULL);
@@ -373,12 +589,6 @@ SerializeTuple(TupleTableSlot *slot, SerTupInfo *pSerInfo, struct directTranspor
 		return TUPLE_CHUNK_HEADER_SIZE;
 	}
 
-	tcList->p_first = NULL;
-	tcList->p_last = NULL;
-	tcList->num_chunks = 0;
-	tcList->serialized_data_length = 0;
-	tcList->max_chunk_length = Gp_max_tuple_chunk_size;
-
 	/* Check if the slot has external attribute */
 	for (int i = 0; i < natts; i++)
 	{
@@ -438,91 +648,57 @@ SerializeTuple(TupleTableSlot *slot, SerTupInfo *pSerInfo, struct directTranspor
 	tupbody = (char *) mintuple + MINIMAL_TUPLE_DATA_OFFSET;
 	tupbodylen = mintuple->t_len - MINIMAL_TUPLE_DATA_OFFSET;
 
-	/* total on-wire footprint: */
-	tuplen = tupbodylen + sizeof(int);
-
-	if (CandidateForSerializeDirect(targetRoute, b) &&
-		tuplen + TUPLE_CHUNK_HEADER_SIZE <= b->prilen)
-	{
-		/*
-		 * The tuple fits in the direct transport buffer.
-		 */
-		memcpy(b->pri + TUPLE_CHUNK_HEADER_SIZE, &tupbodylen, sizeof(tupbodylen));
-		memcpy(b->pri + TUPLE_CHUNK_HEADER_SIZE + sizeof(int), tupbody, tupbodylen);
-
-		dataSize += tuplen;
-
-		SetChunkType(b->pri, TC_WHOLE);
-		SetChunkDataSize(b->pri, dataSize - TUPLE_CHUNK_HEADER_SIZE);
-
-		if (shouldFreeTuple)
-			pfree(mintuple);
-		return dataSize;
-	}
+	wirehdr[0] = tupbodylen;
+	wirehdrlen = sizeof(int32);
+	wirebody = tupbody;
+	wirebodylen = tupbodylen;
 
 	/*
-	 * If direct in-line serialization failed then we fallback to chunked
-	 * out-of-line serialization.
-	 */
-	tcItem = getChunkFromCache(&pSerInfo->chunkCache);
-	SetChunkType(tcItem->chunk_data, TC_WHOLE);
-	tcItem->chunk_length = TUPLE_CHUNK_HEADER_SIZE;
-	appendChunkToTCList(tcList, tcItem);
-
-	addByteStringToChunkList(tcList, (char *) &tupbodylen, sizeof(tupbodylen), &pSerInfo->chunkCache);
-	addByteStringToChunkList(tcList, tupbody, tupbodylen, &pSerInfo->chunkCache);
-
-	/*
-	 * if we have more than 1 chunk we have to set the chunk types on our
-	 * first chunk and last chunk
+	 * Compress the tuple body if the Motion layer asked for it, and send the
+	 * compressed form if it is smaller, including the extra length word.
 	 */
-	if (tcList->num_chunks > 1)
+	if (pSerInfo->compress && tupbodylen >= MIN_COMPRESS_TUPLEN)
 	{
-		TupleChunkListItem first,
-					last;
-
-		first = tcList->p_first;
-		last = tcList->p_last;
-
-		Assert(first != NULL);
-		Assert(first != last);
-		Assert(last != NULL);
+		int32		magic;
+		int			complen;
 
-		SetChunkType(first->chunk_data, TC_PARTIAL_START);
-		SetChunkType(last->chunk_data, TC_PARTIAL_END);
-
-		/*
-		 * any intervening chunks are already set to TC_PARTIAL_MID when
-		 * allocated
-		 */
+		complen = compressTupleBody(pSerInfo, tupbody, tupbodylen, &magic);
+		if (complen >= 0 && complen + sizeof(int32) < tupbodylen)
+		{
+			wirehdr[0] = magic;
+			wirehdr[1] = tupbodylen;
+			wirehdrlen = 2 * sizeof(int32);
+			wirebody = pSerInfo->compressbuf;
+			wirebodylen = complen;
+		}
+		pSerInfo->compress_raw_bytes += tupbodylen + sizeof(int32);
+		pSerInfo->compress_wire_bytes += wirebodylen + wirehdrlen;
 	}
 
+	sent = serializePayload(pSerInfo, b, tcList, targetRoute,
+							(char *) wirehdr, wirehdrlen, wirebody, wirebodylen);
+
 	if (shouldFreeTuple)
 		pfree(mintuple);
 
-	/*
-	 * performed "out-of-line" serialization
-	 */
-	return 0;
+	return sent;
 }
 
 /*
- * Reassemble and deserialize a list of tuple chunks, into a tuple.
+ * Reassemble the payload of a list of tuple chunks into 'serData'.
+ *
+ * Returns true if the data was copied into a palloc'd buffer, which the
+ * caller must free, or false if 'serData' points directly into the single
+ * incoming chunk.
  */
-MinimalTuple
-CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remapper)
+static bool
+reassembleChunks(TupleChunkList tcList, StringInfo serData)
 {
-	StringInfoData serData;
-	bool		serDataMustFree;
+	bool		mustFree;
 	TupleChunkListItem tcItem;
 	TupleChunkListItem firstTcItem;
-	MinimalTuple tup;
 	TupleChunkType tcType;
 
-	AssertArg(tcList != NULL);
-	AssertArg(tcList->p_first != NULL);
-	AssertArg(pSerInfo != NULL);
-
 	/*
 	 * Parse the first chunk, and reassemble the chunks if needed.
 	 */
@@ -542,18 +718,10 @@ CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remap
 		 *
 		 * NB: We mustn't modify the string buffer!
 		 */
-		serData.data = (char *) GetChunkDataPtr(firstTcItem) + TUPLE_CHUNK_HEADER_SIZE;
-		serData.len = serData.maxlen = firstTcItem->chunk_length - TUPLE_CHUNK_HEADER_SIZE;
-		serData.cursor = 0;
-		serDataMustFree = false;
-	}
-	else if (tcType == TC_EMPTY)
-	{
-		/*
-		 * the sender is indicating that there was a row with no
-		 * attributes: return a NULL tuple
-		 */
-		return heap_form_minimal_tuple(pSerInfo->tupdesc, pSerInfo->values, pSerInfo->nulls);
+		serData->data = (char *) GetChunkDataPtr(firstTcItem) + TUPLE_CHUNK_HEADER_SIZE;
+		serData->len = serData->maxlen = firstTcItem->chunk_length - TUPLE_CHUNK_HEADER_SIZE;
+		serData->cursor = 0;
+		mustFree = false;
 	}
 	else if (tcType == TC_PARTIAL_START)
 	{
@@ -599,13 +767,13 @@ CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remap
 			tcItem = tcItem->p_next;
 		}
 
-		serData.data = palloc(total_len);
-		serData.len = serData.maxlen = total_len;
-		serData.cursor = 0;
-		serDataMustFree = true;
+		serData->data = palloc(total_len);
+		serData->len = serData->maxlen = total_len;
+		serData->cursor = 0;
+		mustFree = true;
 
 		/* Copy the data from each chunk into the buffer.  Don't include the headers! */
-		pos = serData.data;
+		pos = serData->data;
 		tcItem = firstTcItem;
 		while (tcItem != NULL)
 		{
@@ -633,6 +801,37 @@ CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remap
 				 errmsg("unexpected tuple chunk type %d at beginning of chunk list", tcType)));
 	}
 
+	return mustFree;
+}
+
+/*
+ * Reassemble and deserialize a list of tuple chunks, into a tuple.
+ */
+MinimalTuple
+CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remapper)
+{
+	StringInfoData serData;
+	bool		serDataMustFree;
+	MinimalTuple tup;
+	TupleChunkType tcType;
+
+	AssertArg(tcList != NULL);
+	AssertArg(tcList->p_first != NULL);
+	AssertArg(pSerInfo != NULL);
+
+	GetChunkType(tcList->p_first, &tcType);
+
+	if (tcType == TC_EMPTY)
+	{
+		/*
+		 * the sender is indicating that there was a row with no
+		 * attributes: return a NULL tuple
+		 */
+		return heap_form_minimal_tuple(pSerInfo->tupdesc, pSerInfo->values, pSerInfo->nulls);
+	}
+
+	serDataMustFree = reassembleChunks(tcList, &serData);
+
 	/* We now have the reassembled data in 'serData'. Deserialize it back to a tuple. */
 	{
 		char	   *pos = serData.data;
@@ -662,6 +861,36 @@ CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remap
 
 			return NULL;
 		}
+		else if (tupbodylen == PGLZ_TUPLE_MAGIC_TUPLEN ||
+				 tupbodylen == ZSTD_TUPLE_MAGIC_TUPLEN)
+		{
+			/* A MinimalTuple with a compressed body */
+			int			rawlen;
+			int			complen;
+
+			if (serData.len < 2 * sizeof(int32))
+				ereport(ERROR,
+						(errcode(ERRCODE_PROTOCOL_VIOLATION),
+						 errmsg("compressed tuple is too short")));
+
+			memcpy(&rawlen, pos, sizeof(rawlen));
+			pos += sizeof(rawlen);
+			complen = serData.len - 2 * sizeof(int32);
+
+			if (rawlen < 0 || rawlen > MaxAllocSize - MINIMAL_TUPLE_DATA_OFFSET)
+				ereport(ERROR,
+						(errcode(ERRCODE_PROTOCOL_VIOLATION),
+						 errmsg("invalid length %d of compressed tuple", rawlen)));
+
+			tup = palloc(rawlen + MINIMAL_TUPLE_DATA_OFFSET);
+			tup->t_len = rawlen + MINIMAL_TUPLE_DATA_OFFSET;
+
+			decompressTupleBody(tupbodylen, pos, complen,
+								(char *) tup + MINIMAL_TUPLE_DATA_OFFSET, rawlen);
+
+			pSerInfo->compress_raw_bytes += rawlen + sizeof(int32);
+			pSerInfo->compress_wire_bytes += serData.len;
+		}
 		else
 		{
 			/* A normal MinimalTuple */
@@ -682,3 +911,309 @@ CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remap
 
 	return tup;
 }
+
+
+/*
+ * Can tuples of this descriptor be sent in the columnar batch format?
+ *
+ * Types that might need to be remapped on the receiving side are left to the
+ * tuple-at-a-time format, which supports the record cache and the
+ * TupleRemapper.
+ */
+bool
+CandidateForSerializeBatch(SerTupInfo *pSerInfo)
+{
+	return pSerInfo->tupdesc->natts > 0 && !pSerInfo->has_record_types;
+}
+
+/* Append zero bytes to 'buf' up to offset 'len' */
+static inline void
+padStringInfo(StringInfo buf, int len)
+{
+	if (len > buf->len)
+	{
+		enlargeStringInfo(buf, len - buf->len);
+		memset(buf->data + buf->len, 0, len - buf->len);
+		buf->len = len;
+		buf->data[len] = '\0';
+	}
+}
+
+/*
+ * Serialize a batch of tuples in the columnar format, directly into a
+ * transport buffer if it fits, or else into a list of chunks.
+ *
+ * Returns like SerializeTuple().
+ */
+int
+SerializeTupleBatch(SerTupInfo *pSerInfo, MinimalTuple *tuples, int ntuples,
+					struct directTransportBuffer *b, TupleChunkList tcList,
+					int16 targetRoute)
+{
+	TupleDesc	tupdesc = pSerInfo->tupdesc;
+	int			natts = tupdesc->natts;
+	int			bitmaplen = (ntuples + 7) / 8;
+	StringInfo	buf = &pSerInfo->batchbuf;
+	Datum	   *values;
+	bool	   *isnull;
+	List	   *detoasted = NIL;
+	int32		hdr[4];
+	char	   *wirebody;
+	int			wirebodylen;
+
+	AssertArg(ntuples > 0);
+	Assert(CandidateForSerializeBatch(pSerInfo));
+
+	if (buf->data == NULL)
+		initStringInfo(buf);
+	else
+		resetStringInfo(buf);
+
+	/* Deform all of the tuples, tuple by tuple. */
+	values = (Datum *) palloc(ntuples * natts * sizeof(Datum));
+	isnull = (bool *) palloc(ntuples * natts * sizeof(bool));
+
+	for (int i = 0; i < ntuples; i++)
+	{
+		HeapTupleData htup;
+
+		htup.t_len = tuples[i]->t_len + MINIMAL_TUPLE_OFFSET;
+		htup.t_data = (HeapTupleHeader) ((char *) tuples[i] - MINIMAL_TUPLE_OFFSET);
+		heap_deform_tuple(&htup, tupdesc, values + i * natts, isnull + i * natts);
+	}
+
+	/* And lay them out attribute by attribute. */
+	for (int attno = 0; attno < natts; attno++)
+	{
+		Form_pg_attribute attr = TupleDescAttr(tupdesc, attno);
+		int			bitmapoff = buf->len;
+
+		padStringInfo(buf, bitmapoff + bitmaplen);
+
+		for (int i = 0; i < ntuples; i++)
+		{
+			Datum		val = values[i * natts + attno];
+			int			off;
+			int			len;
+
+			if (attr->attisdropped || isnull[i * natts + attno])
+				continue;
+
+			buf->data[bitmapoff + i / 8] |= 1 << (i % 8);
+
+			if (attr->attlen > 0)
+			{
+				off = att_align_nominal(buf->len, attr->attalign);
+				len = attr->attlen;
+				padStringInfo(buf, off + len);
+				if (attr->attbyval)
+					store_att_byval(buf->data + off, val, len);
+				else
+					memcpy(buf->data + off, DatumGetPointer(val), len);
+			}
+			else if (attr->attlen == -1)
+			{
+				struct varlena *ptr = (struct varlena *) DatumGetPointer(val);
+
+				/* Fetch toasted values, like SerializeTuple() does. */
+				if (VARATT_IS_EXTERNAL(ptr))
+				{
+					ptr = heap_tuple_fetch_attr(ptr);
+					detoasted = lappend(detoasted, ptr);
+				}
+
+				/* Short varlenas are not aligned, like in heap tuples. */
+				if (VARATT_IS_SHORT(ptr))
+					off = buf->len;
+				else
+					off = att_align_nominal(buf->len, attr->attalign);
+				len = VARSIZE_ANY(ptr);
+				padStringInfo(buf, off);
+				appendBinaryStringInfo(buf, (char *) ptr, len);
+			}
+			else
+			{
+				Assert(attr->attlen == -2);
+				off = buf->len;
+				len = strlen(DatumGetCString(val)) + 1;
+				appendBinaryStringInfo(buf, DatumGetCString(val), len);
+			}
+		}
+	}
+
+	list_free_deep(detoasted);
+	pfree(values);
+	pfree(isnull);
+
+	hdr[0] = BATCH_MAGIC_TUPLEN;
+	hdr[1] = ntuples;
+	hdr[2] = 0;
+	hdr[3] = buf->len;
+	wirebody = buf->data;
+	wirebodylen = buf->len;
+
+	if (pSerInfo->compress && buf->len >= MIN_COMPRESS_TUPLEN)
+	{
+		int32		magic;
+		int			complen;
+
+		complen = compressTupleBody(pSerInfo, buf->data, buf->len, &magic);
+		if (complen >= 0 && complen < buf->len)
+		{
+			hdr[2] = magic;
+			wirebody = pSerInfo->compressbuf;
+			wirebodylen = complen;
+		}
+		pSerInfo->compress_raw_bytes += buf->len + BATCH_HEADER_LEN;
+		pSerInfo->compress_wire_bytes += wirebodylen + BATCH_HEADER_LEN;
+	}
+
+	return serializePayload(pSerInfo, b, tcList, targetRoute,
+							(char *) hdr, BATCH_HEADER_LEN,
+							wirebody, wirebodylen);
+}
+
+#define CHECK_BATCH_BOUNDS(off, len, bodylen) \
+	do { \
+		if ((off) < 0 || (len) < 0 || (off) + (len) > (bodylen)) \
+			ereport(ERROR, \
+					(errcode(ERRCODE_PROTOCOL_VIOLATION), \
+					 errmsg("columnar tuple batch is corrupt"))); \
+	} while (0)
+
+/*
+ * Reassemble and deserialize a list of tuple chunks holding a batch of tuples
+ * in the columnar format.
+ *
+ * Returns the number of tuples, and a palloc'd array of them in *tuples.
+ */
+int
+CvtChunksToTupBatch(TupleChunkList tcList, SerTupInfo *pSerInfo, MinimalTuple **tuples)
+{
+	TupleDesc	tupdesc = pSerInfo->tupdesc;
+	int			natts = tupdesc->natts;
+	StringInfoData serData;
+	bool		serDataMustFree;
+	int32		hdr[4];
+	int			ntuples;
+	int			bodylen;
+	int			bitmaplen;
+	char	   *body;
+	int			off;
+	Datum	   *values;
+	bool	   *isnull;
+	MinimalTuple *result;
+
+	AssertArg(tcList != NULL);
+	AssertArg(tcList->p_first != NULL);
+	AssertArg(pSerInfo != NULL);
+
+	serDataMustFree = reassembleChunks(tcList, &serData);
+
+	if (serData.len < BATCH_HEADER_LEN)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("columnar tuple batch is too short")));
+	memcpy(hdr, serData.data, BATCH_HEADER_LEN);
+
+	ntuples = hdr[1];
+	bodylen = hdr[3];
+	if (hdr[0] != BATCH_MAGIC_TUPLEN || ntuples <= 0 ||
+		ntuples > MaxAllocSize / (natts * sizeof(Datum)) ||
+		bodylen < 0 || bodylen >= MaxAllocSize)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("invalid columnar tuple batch header")));
+
+	/*
+	 * Copy or decompress the body into a buffer of our own, so that the
+	 * values in it are aligned.
+	 */
+	body = palloc(bodylen + 1);
+	if (hdr[2] == 0)
+	{
+		if (serData.len - BATCH_HEADER_LEN != bodylen)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROTOCOL_VIOLATION),
+					 errmsg("columnar tuple batch is corrupt")));
+		memcpy(body, serData.data + BATCH_HEADER_LEN, bodylen);
+	}
+	else
+	{
+		decompressTupleBody(hdr[2], serData.data + BATCH_HEADER_LEN,
+							serData.len - BATCH_HEADER_LEN, body, bodylen);
+		pSerInfo->compress_raw_bytes += bodylen + BATCH_HEADER_LEN;
+		pSerInfo->compress_wire_bytes += serData.len;
+	}
+	body[bodylen] = '\0';
+
+	if (serDataMustFree)
+		pfree(serData.data);
+
+	/* Read the values back, attribute by attribute. */
+	values = (Datum *) palloc(ntuples * natts * sizeof(Datum));
+	isnull = (bool *) palloc(ntuples * natts * sizeof(bool));
+	bitmaplen = (ntuples + 7) / 8;
+	off = 0;
+
+	for (int attno = 0; attno < natts; attno++)
+	{
+		Form_pg_attribute attr = TupleDescAttr(tupdesc, attno);
+		char	   *bitmap = body + off;
+
+		CHECK_BATCH_BOUNDS(off, bitmaplen, bodylen);
+		off += bitmaplen;
+
+		for (int i = 0; i < ntuples; i++)
+		{
+			int			len;
+
+			if (!(bitmap[i / 8] & (1 << (i % 8))))
+			{
+				values[i * natts + attno] = (Datum) 0;
+				isnull[i * natts + attno] = true;
+				continue;
+			}
+			isnull[i * natts + attno] = false;
+
+			if (attr->attlen > 0)
+			{
+				off = att_align_nominal(off, attr->attalign);
+				len = attr->attlen;
+				CHECK_BATCH_BOUNDS(off, len, bodylen);
+				values[i * natts + attno] = fetch_att(body + off, attr->attbyval, len);
+			}
+			else if (attr->attlen == -1)
+			{
+				CHECK_BATCH_BOUNDS(off, 1, bodylen);
+				off = att_align_pointer(off, attr->attalign, -1, body + off);
+				CHECK_BATCH_BOUNDS(off, VARHDRSZ_SHORT, bodylen);
+				if (!VARATT_IS_SHORT(body + off))
+					CHECK_BATCH_BOUNDS(off, VARHDRSZ, bodylen);
+				len = VARSIZE_ANY(body + off);
+				CHECK_BATCH_BOUNDS(off, len, bodylen);
+				values[i * natts + attno] = PointerGetDatum(body + off);
+			}
+			else
+			{
+				len = strnlen(body + off, bodylen - off) + 1;
+				CHECK_BATCH_BOUNDS(off, len, bodylen);
+				values[i * natts + attno] = CStringGetDatum(body + off);
+			}
+			off += len;
+		}
+	}
+
+	/* Form the tuples. */
+	result = (MinimalTuple *) palloc(ntuples * sizeof(MinimalTuple));
+	for (int i = 0; i < ntuples; i++)
+		result[i] = heap_form_minimal_tuple(tupdesc, values + i * natts,
+											isnull + i * natts);
+
+	pfree(values);
+	pfree(isnull);
+	pfree(body);
+
+	*tuples = result;
+	return ntuples;
+}
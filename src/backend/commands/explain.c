@@ -84,6 +84,7 @@ static void report_triggers(ResultRelInfo *rInfo, bool show_relname,
 static void ExplainDXL(Query *query, ExplainState *es,
 							const char *queryString,
 							ParamListInfo params);
+static void ExplainPrintOptimizerProfile(ExplainState *es);
 #endif
 
 static double elapsed_time(instr_time *starttime);
@@ -93,6 +94,8 @@ static void ExplainNode(PlanState *planstate, List *ancestors,
 						ExplainState *es);
 static void show_plan_tlist(PlanState *planstate, List *ancestors,
 							ExplainState *es);
+static void show_memoize_keys(MemoizeState *mstate, List *ancestors,
+							  ExplainState *es);
 static void show_expression(Node *node, const char *qlabel,
 							PlanState *planstate, List *ancestors,
 							bool useprefix, ExplainState *es);
@@ -107,6 +110,8 @@ static void show_upper_qual(List *qual, const char *qlabel,
 							ExplainState *es);
 static void show_sort_keys(SortState *sortstate, List *ancestors,
 						   ExplainState *es);
+static void show_incremental_sort_keys(IncrementalSortState *incrsortstate,
+									   List *ancestors, ExplainState *es);
 static void show_merge_append_keys(MergeAppendState *mstate, List *ancestors,
 								   ExplainState *es);
 static void show_agg_keys(AggState *astate, List *ancestors,
@@ -235,6 +240,8 @@ ExplainQuery(ParseState *pstate, ExplainStmt *stmt, const char *queryString,
 			es->dxl = defGetBoolean(opt);
 		else if (strcmp(opt->defname, "slicetable") == 0)
 			es->slicetable = defGetBoolean(opt);
+		else if (strcmp(opt->defname, "optimizer_profile") == 0)
+			es->optimizer_profile = defGetBoolean(opt);
 		else
 			ereport(ERROR,
 					(errcode(ERRCODE_SYNTAX_ERROR),
@@ -510,6 +517,15 @@ ExplainOneQuery(Query *query, int cursorOptions,
 		INSTR_TIME_SET_CURRENT(planduration);
 		INSTR_TIME_SUBTRACT(planduration, planstart);
 
+#ifdef USE_ORCA
+		/*
+		 * Take the optimization profile now; executing the plan under
+		 * EXPLAIN ANALYZE may optimize other queries, replacing it.
+		 */
+		if (es->optimizer_profile && plan->planGen == PLANGEN_OPTIMIZER)
+			es->optimizer_profile_entries = GetOptimizerProfile(false);
+#endif
+
 		/*
 		 * GPDB_92_MERGE_FIXME: it really should be an optimizer's responsibility
 		 * to correctly set the into-clause and into-policy of the PlannedStmt.
@@ -751,6 +767,13 @@ ExplainOnePlan(PlannedStmt *plannedstmt, IntoClause *into, ExplainState *es,
 	if (es->slicetable)
 		ExplainPrintSliceTable(es, queryDesc);
 
+#ifdef USE_ORCA
+	/* Print time spent per xform and job type by GPORCA */
+	if (es->optimizer_profile &&
+		queryDesc->plannedstmt->planGen == PLANGEN_OPTIMIZER)
+		ExplainPrintOptimizerProfile(es);
+#endif
+
 	/* Print info about runtime of triggers */
 	if (es->analyze)
 		ExplainPrintTriggers(es, queryDesc);
@@ -981,17 +1004,100 @@ ExplainPrintPlan(ExplainState *es, QueryDesc *queryDesc)
 	 * If requested, include information about GUC parameters with values that
 	 * don't match the built-in defaults.
 	 */
-	if (queryDesc->plannedstmt->planGen == PLANGEN_PLANNER)
+	if (queryDesc->plannedstmt->planGen == PLANGEN_PLANNER &&
+		queryDesc->plannedstmt->optimizerFastPath)
+		ExplainPropertyStringInfo("Optimizer", es, "Postgres-based planner (GPORCA fast path)");
+	else if (queryDesc->plannedstmt->planGen == PLANGEN_PLANNER)
 		ExplainPropertyStringInfo("Optimizer", es, "Postgres-based planner");
 #ifdef USE_ORCA
 	else
+	{
 		ExplainPropertyStringInfo("Optimizer", es, "GPORCA");
+
+		/* report the search stage cut off by optimizer_search_time_budget */
+		if (queryDesc->plannedstmt->optimizerCutoffStage > 0)
+			ExplainPropertyInteger("Optimizer Time Budget Exhausted In Stage",
+								   NULL,
+								   queryDesc->plannedstmt->optimizerCutoffStage,
+								   es);
+
+		/* report plans served by the cache of optimizer_plan_cache_size */
+		if (queryDesc->plannedstmt->optimizerPlanCacheHit)
+			ExplainPropertyText("Optimizer Plan Cache", "hit", es);
+	}
 #endif
 
 	ExplainPrintSettings(es);
 }
 
 
+#ifdef USE_ORCA
+/*
+ * ExplainPrintOptimizerProfile -
+ *	  print the time spent, alternatives generated and memo insertions per
+ *	  xform, and the time spent per job type, by GPORCA when planning the
+ *	  query; xforms are listed most expensive first
+ */
+static void
+ExplainPrintOptimizerProfile(ExplainState *es)
+{
+	ListCell   *lc;
+
+	ExplainOpenGroup("Optimizer Profile", "Optimizer Profile", false, es);
+
+	/* for higher density, open code the text output format */
+	if (es->format == EXPLAIN_FORMAT_TEXT)
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfoString(es->str, "Optimizer Profile:\n");
+		es->indent += 1;
+
+		foreach(lc, es->optimizer_profile_entries)
+		{
+			OptimizerProfileEntry *entry = (OptimizerProfileEntry *) lfirst(lc);
+
+			appendStringInfoSpaces(es->str, es->indent * 2);
+			if (strcmp(entry->kind, "xform") == 0)
+				appendStringInfo(es->str,
+								 "Xform %s: calls=" INT64_FORMAT " time=%.3f ms alternatives=" INT64_FORMAT " memo_inserts=" INT64_FORMAT "\n",
+								 entry->name, entry->calls, entry->time_ms,
+								 entry->alternatives, entry->memo_inserts);
+			else
+				appendStringInfo(es->str,
+								 "Job %s: executions=" INT64_FORMAT " time=%.3f ms\n",
+								 entry->name, entry->calls, entry->time_ms);
+		}
+
+		es->indent -= 1;
+	}
+	else
+	{
+		foreach(lc, es->optimizer_profile_entries)
+		{
+			OptimizerProfileEntry *entry = (OptimizerProfileEntry *) lfirst(lc);
+			bool		is_xform = strcmp(entry->kind, "xform") == 0;
+
+			ExplainOpenGroup("Entry", NULL, true, es);
+			ExplainPropertyText("Kind", entry->kind, es);
+			ExplainPropertyText("Name", entry->name, es);
+			ExplainPropertyInteger(is_xform ? "Calls" : "Executions", NULL,
+								   entry->calls, es);
+			ExplainPropertyFloat("Time", "ms", entry->time_ms, 3, es);
+			if (is_xform)
+			{
+				ExplainPropertyInteger("Alternatives", NULL,
+									   entry->alternatives, es);
+				ExplainPropertyInteger("Memo Inserts", NULL,
+									   entry->memo_inserts, es);
+			}
+			ExplainCloseGroup("Entry", NULL, true, es);
+		}
+	}
+
+	ExplainCloseGroup("Optimizer Profile", "Optimizer Profile", false, es);
+}
+#endif
+
 /*
  * ExplainPrintSliceTable -
  *	  convert the MPP slice table text and append it to es->str
@@ -1715,9 +1821,15 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Material:
 			pname = sname = "Materialize";
 			break;
+		case T_Memoize:
+			pname = sname = "Memoize";
+			break;
 		case T_Sort:
 			pname = sname = "Sort";
 			break;
+		case T_IncrementalSort:
+			pname = sname = "Incremental Sort";
+			break;
 		case T_TupleSplit:
 			pname = "TupleSplit";
 			break;
@@ -2625,6 +2737,14 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			show_sort_keys(castNode(SortState, planstate), ancestors, es);
 			show_sort_info(castNode(SortState, planstate), es);
 			break;
+		case T_IncrementalSort:
+			show_incremental_sort_keys(castNode(IncrementalSortState, planstate),
+									   ancestors, es);
+			break;
+		case T_Memoize:
+			show_memoize_keys(castNode(MemoizeState, planstate), ancestors,
+							  es);
+			break;
 		case T_MergeAppend:
 			show_merge_append_keys(castNode(MergeAppendState, planstate),
 								   ancestors, es);
@@ -2664,6 +2784,13 @@ ExplainNode(PlanState *planstate, List *ancestors,
 									 "Hash Module: %d\n",
 									 pMotion->numHashSegments);
 				}
+				if (pMotion->skewMode != MOTIONSKEW_NONE)
+					ExplainPropertyText("Skew Handling",
+										psprintf("%s (%d hot keys)",
+												 pMotion->skewMode == MOTIONSKEW_SPREAD ?
+												 "spread" : "broadcast",
+												 list_length(pMotion->skewHotKeys)),
+										es);
 			}
 			break;
 		case T_AssertOp:
@@ -2946,6 +3073,44 @@ show_plan_tlist(PlanState *planstate, List *ancestors, ExplainState *es)
 	ExplainPropertyList("Output", result, es);
 }
 
+/*
+ * Show the cache key of a Memoize node
+ */
+static void
+show_memoize_keys(MemoizeState *mstate, List *ancestors, ExplainState *es)
+{
+	Memoize    *plan = (Memoize *) mstate->ss.ps.plan;
+	List	   *context;
+	StringInfoData keystr;
+	char	   *separator = "";
+	bool		useprefix;
+	ListCell   *lc;
+
+	initStringInfo(&keystr);
+
+	useprefix = list_length(es->rtable) > 1 || es->verbose;
+
+	/* Set up deparsing context */
+	context = set_deparse_context_planstate(es->deparse_cxt,
+											(Node *) mstate,
+											ancestors);
+
+	foreach(lc, plan->param_exprs)
+	{
+		Node	   *expr = (Node *) lfirst(lc);
+
+		appendStringInfoString(&keystr, separator);
+
+		appendStringInfoString(&keystr, deparse_expression(expr, context,
+														   useprefix, false));
+		separator = ", ";
+	}
+
+	ExplainPropertyText("Cache Key", keystr.data, es);
+
+	pfree(keystr.data);
+}
+
 /*
  * Show a generic expression
  */
@@ -3036,6 +3201,27 @@ show_sort_keys(SortState *sortstate, List *ancestors, ExplainState *es)
 						 ancestors, es);
 }
 
+/*
+ * Show the sort keys of an IncrementalSort node, and the leading ones its
+ * input is already sorted on.
+ */
+static void
+show_incremental_sort_keys(IncrementalSortState *incrsortstate,
+						   List *ancestors, ExplainState *es)
+{
+	IncrementalSort *plan = (IncrementalSort *) incrsortstate->ss.ps.plan;
+
+	show_sort_group_keys((PlanState *) incrsortstate, "Sort Key",
+						 plan->sort.numCols, plan->sort.sortColIdx,
+						 plan->sort.sortOperators, plan->sort.collations,
+						 plan->sort.nullsFirst,
+						 ancestors, es);
+	show_sort_group_keys((PlanState *) incrsortstate, "Presorted Key",
+						 plan->nPresortedCols, plan->sort.sortColIdx,
+						 NULL, NULL, NULL,
+						 ancestors, es);
+}
+
 static void
 show_windowagg_keys(WindowAggState *waggstate, List *ancestors, ExplainState *es)
 {
@@ -32,11 +32,13 @@
 #include "executor/nodeGatherMerge.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "executor/nodeIncrementalSort.h"
 #include "executor/nodeIndexonlyscan.h"
 #include "executor/nodeIndexscan.h"
 #include "executor/nodeLimit.h"
 #include "executor/nodeLockRows.h"
 #include "executor/nodeMaterial.h"
+#include "executor/nodeMemoize.h"
 #include "executor/nodeMergeAppend.h"
 #include "executor/nodeMergejoin.h"
 #include "executor/nodeModifyTable.h"
@@ -313,10 +315,18 @@ ExecReScan(PlanState *node)
 			ExecReScanMaterial((MaterialState *) node);
 			break;
 
+		case T_MemoizeState:
+			ExecReScanMemoize((MemoizeState *) node);
+			break;
+
 		case T_SortState:
 			ExecReScanSort((SortState *) node);
 			break;
 
+		case T_IncrementalSortState:
+			ExecReScanIncrementalSort((IncrementalSortState *) node);
+			break;
+
 		case T_AggState:
 			ExecReScanAgg((AggState *) node);
 			break;
@@ -826,10 +836,18 @@ ExecSquelchNode(PlanState *node)
 			ExecSquelchMaterial((MaterialState*) node);
 			break;
 
+		case T_MemoizeState:
+			ExecSquelchMemoize((MemoizeState *) node);
+			break;
+
 		case T_SortState:
 			ExecSquelchSort((SortState *) node);
 			break;
 
+		case T_IncrementalSortState:
+			ExecSquelchIncrementalSort((IncrementalSortState *) node);
+			break;
+
 		case T_AggState:
 			ExecSquelchAgg((AggState*) node);
 			break;
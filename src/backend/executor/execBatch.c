@@ -0,0 +1,702 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.c
+ *	  Batch-at-a-time execution support for column-oriented scans.
+ *
+ * Table AMs that store data column by column (AOCS) can hand out rows a
+ * varblock slice at a time, as one vector of datums per projected column.
+ * This file provides the TupleBatch container, evaluation of simple
+ * "column <op> constant" quals over a whole batch, and advancing the most
+ * common aggregate transition functions over a batch.
+ *
+ * The loops here are written to be branch-free over plain arrays, so that
+ * the compiler can auto-vectorize them.  Anything that is not recognized is
+ * left to the regular tuple-at-a-time expression machinery.
+ *
+ * Portions Copyright (c) 2012-Present VMware, Inc. or its affiliates.
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/execBatch.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/stratnum.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_type.h"
+#include "commands/defrem.h"
+#include "common/int.h"
+#include "executor/execBatch.h"
+#include "nodes/primnodes.h"
+#include "utils/float.h"
+#include "utils/fmgroids.h"
+#include "utils/lsyscache.h"
+
+static bool batch_value_type(Oid typid, BatchValueType *type);
+static bool batch_qual_var(Node *node, Index scanrelid);
+static bool batch_qual_from_clause(Expr *clause, Index scanrelid,
+								   BatchQual *bqual);
+
+/*
+ * Create an empty batch for rows of 'tupdesc'.  The column vectors are
+ * allocated on demand by the table AM, see ExecBatchEnsureColumn().
+ */
+TupleBatch
+ExecBatchCreate(TupleDesc tupdesc, int maxrows)
+{
+	TupleBatch	batch = palloc0(sizeof(TupleBatchData));
+
+	batch->tupdesc = tupdesc;
+	batch->maxrows = maxrows;
+	batch->values = palloc0(tupdesc->natts * sizeof(Datum *));
+	batch->isnull = palloc0(tupdesc->natts * sizeof(bool *));
+	batch->cols = palloc(tupdesc->natts * sizeof(AttrNumber));
+	batch->tids = palloc(maxrows * sizeof(ItemPointerData));
+	batch->sel = palloc(maxrows * sizeof(int));
+	batch->ibuf = palloc(maxrows * sizeof(int64));
+	batch->fbuf = palloc(maxrows * sizeof(float8));
+	batch->mcxt = CurrentMemoryContext;
+
+	return batch;
+}
+
+/*
+ * Make sure the batch has vectors for zero-based attribute 'attno'.
+ */
+void
+ExecBatchEnsureColumn(TupleBatch batch, AttrNumber attno)
+{
+	Assert(attno >= 0 && attno < batch->tupdesc->natts);
+
+	if (batch->values[attno] != NULL)
+		return;
+
+	batch->values[attno] = MemoryContextAlloc(batch->mcxt,
+											  batch->maxrows * sizeof(Datum));
+	batch->isnull[attno] = MemoryContextAlloc(batch->mcxt,
+											  batch->maxrows * sizeof(bool));
+	batch->cols[batch->ncols++] = attno;
+}
+
+/*
+ * Store the next selected row of the batch into a virtual slot.
+ *
+ * Returns false once every selected row has been handed out.
+ */
+bool
+ExecBatchStoreNext(TupleBatch batch, TupleTableSlot *slot)
+{
+	int			row;
+	int			i;
+
+	if (batch->next >= batch->nsel)
+		return false;
+
+	row = batch->sel[batch->next++];
+
+	ExecClearTuple(slot);
+	for (i = 0; i < batch->ncols; i++)
+	{
+		AttrNumber	attno = batch->cols[i];
+
+		slot->tts_values[attno] = batch->values[attno][row];
+		slot->tts_isnull[attno] = batch->isnull[attno][row];
+	}
+	ExecStoreVirtualTuple(slot);
+	slot->tts_tid = batch->tids[row];
+
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *		Vectorized quals
+ * ----------------------------------------------------------------
+ */
+
+static bool
+batch_value_type(Oid typid, BatchValueType *type)
+{
+	switch (typid)
+	{
+		case INT2OID:
+			*type = BATCH_TYPE_INT2;
+			return true;
+		case INT4OID:
+		case DATEOID:
+			*type = BATCH_TYPE_INT4;
+			return true;
+		case INT8OID:
+			if (!FLOAT8PASSBYVAL)
+				return false;
+			*type = BATCH_TYPE_INT8;
+			return true;
+		case FLOAT8OID:
+			if (!FLOAT8PASSBYVAL)
+				return false;
+			*type = BATCH_TYPE_FLOAT8;
+			return true;
+		default:
+			return false;
+	}
+}
+
+/* Is 'node' a plain user column of the scanned relation? */
+static bool
+batch_qual_var(Node *node, Index scanrelid)
+{
+	Var		   *var = (Var *) node;
+
+	return IsA(node, Var) &&
+		var->varno == scanrelid &&
+		var->varlevelsup == 0 &&
+		var->varattno > 0;
+}
+
+/*
+ * Try to turn one conjunct of a scan qual into a BatchQual.
+ */
+static bool
+batch_qual_from_clause(Expr *clause, Index scanrelid, BatchQual *bqual)
+{
+	if (IsA(clause, NullTest))
+	{
+		NullTest   *ntest = (NullTest *) clause;
+
+		if (ntest->argisrow || !batch_qual_var((Node *) ntest->arg, scanrelid))
+			return false;
+
+		bqual->kind = (ntest->nulltesttype == IS_NULL) ?
+			BATCH_QUAL_ISNULL : BATCH_QUAL_ISNOTNULL;
+		bqual->type = BATCH_TYPE_INT4;	/* values are not looked at */
+		bqual->attno = ((Var *) ntest->arg)->varattno - 1;
+		bqual->constval = (Datum) 0;
+		return true;
+	}
+
+	if (IsA(clause, OpExpr))
+	{
+		OpExpr	   *opexpr = (OpExpr *) clause;
+		Oid			opno = opexpr->opno;
+		Node	   *leftop;
+		Node	   *rightop;
+		Var		   *var;
+		Const	   *con;
+		Oid			lefttype;
+		Oid			righttype;
+		Oid			opfamily;
+		int			strategy;
+
+		if (list_length(opexpr->args) != 2)
+			return false;
+		leftop = linitial(opexpr->args);
+		rightop = lsecond(opexpr->args);
+
+		if (batch_qual_var(leftop, scanrelid) && IsA(rightop, Const))
+		{
+			var = (Var *) leftop;
+			con = (Const *) rightop;
+		}
+		else if (IsA(leftop, Const) && batch_qual_var(rightop, scanrelid))
+		{
+			/* "const <op> column": flip it around */
+			opno = get_commutator(opno);
+			if (!OidIsValid(opno))
+				return false;
+			var = (Var *) rightop;
+			con = (Const *) leftop;
+		}
+		else
+			return false;
+
+		/* A NULL constant never matches; let the strict operator say so */
+		if (con->constisnull)
+			return false;
+
+		if (!batch_value_type(var->vartype, &bqual->type))
+			return false;
+
+		/* Only same-type operators; cross-type ones are left to the executor */
+		op_input_types(opno, &lefttype, &righttype);
+		if (lefttype != var->vartype || righttype != var->vartype ||
+			con->consttype != var->vartype)
+			return false;
+
+		/* Recognize the operator through the type's default btree opfamily */
+		opfamily = get_opclass_family(GetDefaultOpClass(var->vartype,
+														BTREE_AM_OID));
+		strategy = get_op_opfamily_strategy(opno, opfamily);
+		switch (strategy)
+		{
+			case BTLessStrategyNumber:
+				bqual->kind = BATCH_QUAL_LT;
+				break;
+			case BTLessEqualStrategyNumber:
+				bqual->kind = BATCH_QUAL_LE;
+				break;
+			case BTEqualStrategyNumber:
+				bqual->kind = BATCH_QUAL_EQ;
+				break;
+			case BTGreaterEqualStrategyNumber:
+				bqual->kind = BATCH_QUAL_GE;
+				break;
+			case BTGreaterStrategyNumber:
+				bqual->kind = BATCH_QUAL_GT;
+				break;
+			default:
+				{
+					Oid			negator = get_negator(opno);
+
+					if (!OidIsValid(negator) ||
+						get_op_opfamily_strategy(negator, opfamily) != BTEqualStrategyNumber)
+						return false;
+					bqual->kind = BATCH_QUAL_NE;
+				}
+				break;
+		}
+
+		bqual->attno = var->varattno - 1;
+		bqual->constval = con->constvalue;
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * Split an implicitly-ANDed scan qual into the conjuncts that can be
+ * evaluated over a batch, returned in *bquals, and the rest, which is
+ * returned as a list to be evaluated per tuple.
+ */
+List *
+ExecBatchSplitQual(List *qual, Index scanrelid,
+				   BatchQual **bquals, int *nbquals)
+{
+	List	   *residual = NIL;
+	ListCell   *lc;
+	int			n = 0;
+
+	*bquals = palloc(Max(list_length(qual), 1) * sizeof(BatchQual));
+
+	foreach(lc, qual)
+	{
+		Expr	   *clause = (Expr *) lfirst(lc);
+
+		if (batch_qual_from_clause(clause, scanrelid, &(*bquals)[n]))
+			n++;
+		else
+			residual = lappend(residual, clause);
+	}
+
+	*nbquals = n;
+	return residual;
+}
+
+#define BATCH_CMP_LT(a, b)	((a) < (b))
+#define BATCH_CMP_LE(a, b)	((a) <= (b))
+#define BATCH_CMP_EQ(a, b)	((a) == (b))
+#define BATCH_CMP_NE(a, b)	((a) != (b))
+#define BATCH_CMP_GE(a, b)	((a) >= (b))
+#define BATCH_CMP_GT(a, b)	((a) > (b))
+
+/*
+ * Compact the selection vector down to the rows for which 'cmp' holds.  The
+ * row is always written and the output position only advanced on a match,
+ * which keeps the loop free of branches.
+ */
+#define BATCH_FILTER(getter, cmp) \
+	for (i = 0; i < nsel; i++) \
+	{ \
+		int			row = sel[i]; \
+		\
+		sel[n] = row; \
+		n += (!isnull[row]) & (cmp(getter(values[row]), c)); \
+	}
+
+#define DEFINE_BATCH_FILTER(name, ctype, getter, lt, le, eq, ne, ge, gt) \
+static int \
+name(BatchQualKind kind, Datum *values, bool *isnull, int *sel, int nsel, \
+	 Datum constval) \
+{ \
+	ctype		c = getter(constval); \
+	int			n = 0; \
+	int			i; \
+	\
+	switch (kind) \
+	{ \
+		case BATCH_QUAL_LT: BATCH_FILTER(getter, lt); break; \
+		case BATCH_QUAL_LE: BATCH_FILTER(getter, le); break; \
+		case BATCH_QUAL_EQ: BATCH_FILTER(getter, eq); break; \
+		case BATCH_QUAL_NE: BATCH_FILTER(getter, ne); break; \
+		case BATCH_QUAL_GE: BATCH_FILTER(getter, ge); break; \
+		case BATCH_QUAL_GT: BATCH_FILTER(getter, gt); break; \
+		default: \
+			elog(ERROR, "unrecognized batch qual kind: %d", (int) kind); \
+	} \
+	return n; \
+}
+
+DEFINE_BATCH_FILTER(batch_filter_int2, int16, DatumGetInt16,
+					BATCH_CMP_LT, BATCH_CMP_LE, BATCH_CMP_EQ,
+					BATCH_CMP_NE, BATCH_CMP_GE, BATCH_CMP_GT)
+DEFINE_BATCH_FILTER(batch_filter_int4, int32, DatumGetInt32,
+					BATCH_CMP_LT, BATCH_CMP_LE, BATCH_CMP_EQ,
+					BATCH_CMP_NE, BATCH_CMP_GE, BATCH_CMP_GT)
+DEFINE_BATCH_FILTER(batch_filter_int8, int64, DatumGetInt64,
+					BATCH_CMP_LT, BATCH_CMP_LE, BATCH_CMP_EQ,
+					BATCH_CMP_NE, BATCH_CMP_GE, BATCH_CMP_GT)
+/* float8 comparisons follow float8_cmp_internal(), NaN sorting last */
+DEFINE_BATCH_FILTER(batch_filter_float8, float8, DatumGetFloat8,
+					float8_lt, float8_le, float8_eq,
+					float8_ne, float8_ge, float8_gt)
+
+/*
+ * Apply the vectorized quals to the selected rows of a batch, narrowing
+ * down its selection vector.
+ */
+void
+ExecBatchQual(TupleBatch batch, BatchQual *bquals, int nbquals)
+{
+	int			q;
+
+	for (q = 0; q < nbquals && batch->nsel > 0; q++)
+	{
+		BatchQual  *bqual = &bquals[q];
+		Datum	   *values = batch->values[bqual->attno];
+		bool	   *isnull = batch->isnull[bqual->attno];
+		int		   *sel = batch->sel;
+		int			nsel = batch->nsel;
+		int			n = 0;
+		int			i;
+
+		Assert(values != NULL);
+
+		if (bqual->kind == BATCH_QUAL_ISNULL)
+		{
+			for (i = 0; i < nsel; i++)
+			{
+				sel[n] = sel[i];
+				n += isnull[sel[i]];
+			}
+		}
+		else if (bqual->kind == BATCH_QUAL_ISNOTNULL)
+		{
+			for (i = 0; i < nsel; i++)
+			{
+				sel[n] = sel[i];
+				n += !isnull[sel[i]];
+			}
+		}
+		else
+		{
+			switch (bqual->type)
+			{
+				case BATCH_TYPE_INT2:
+					n = batch_filter_int2(bqual->kind, values, isnull,
+										  sel, nsel, bqual->constval);
+					break;
+				case BATCH_TYPE_INT4:
+					n = batch_filter_int4(bqual->kind, values, isnull,
+										  sel, nsel, bqual->constval);
+					break;
+				case BATCH_TYPE_INT8:
+					n = batch_filter_int8(bqual->kind, values, isnull,
+										  sel, nsel, bqual->constval);
+					break;
+				case BATCH_TYPE_FLOAT8:
+					n = batch_filter_float8(bqual->kind, values, isnull,
+											sel, nsel, bqual->constval);
+					break;
+			}
+		}
+
+		batch->nsel = n;
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		Vectorized aggregation
+ * ----------------------------------------------------------------
+ */
+
+/*
+ * Can the transition function 'transfn_oid' be advanced over a whole batch?
+ * If so, fill in the kind and value type of *btrans; the caller sets the
+ * input attribute.
+ */
+bool
+ExecBatchAggSupported(Oid transfn_oid, BatchAggTrans *btrans)
+{
+	btrans->type = BATCH_TYPE_INT8;
+
+	switch (transfn_oid)
+	{
+		case F_INT8INC:
+			btrans->kind = BATCH_AGG_COUNT_STAR;
+			break;
+		case F_INT8INC_ANY:
+			btrans->kind = BATCH_AGG_COUNT;
+			break;
+		case F_INT2_SUM:
+			btrans->kind = BATCH_AGG_SUM;
+			btrans->type = BATCH_TYPE_INT2;
+			break;
+		case F_INT4_SUM:
+			btrans->kind = BATCH_AGG_SUM;
+			btrans->type = BATCH_TYPE_INT4;
+			break;
+		case F_FLOAT8PL:
+			btrans->kind = BATCH_AGG_SUM_FLOAT8;
+			btrans->type = BATCH_TYPE_FLOAT8;
+			break;
+		case F_INT2SMALLER:
+		case F_INT2LARGER:
+			btrans->kind = (transfn_oid == F_INT2LARGER) ? BATCH_AGG_MAX : BATCH_AGG_MIN;
+			btrans->type = BATCH_TYPE_INT2;
+			break;
+		case F_INT4SMALLER:
+		case F_INT4LARGER:
+		case F_DATE_SMALLER:
+		case F_DATE_LARGER:
+			btrans->kind = (transfn_oid == F_INT4LARGER ||
+							transfn_oid == F_DATE_LARGER) ? BATCH_AGG_MAX : BATCH_AGG_MIN;
+			btrans->type = BATCH_TYPE_INT4;
+			break;
+		case F_INT8SMALLER:
+		case F_INT8LARGER:
+			btrans->kind = (transfn_oid == F_INT8LARGER) ? BATCH_AGG_MAX : BATCH_AGG_MIN;
+			btrans->type = BATCH_TYPE_INT8;
+			break;
+		case F_FLOAT8SMALLER:
+		case F_FLOAT8LARGER:
+			btrans->kind = (transfn_oid == F_FLOAT8LARGER) ? BATCH_AGG_MAX : BATCH_AGG_MIN;
+			btrans->type = BATCH_TYPE_FLOAT8;
+			break;
+		default:
+			btrans->kind = BATCH_AGG_NONE;
+			return false;
+	}
+
+	/* int8 and float8 transition states are only cheap when passed by value */
+	return FLOAT8PASSBYVAL;
+}
+
+/*
+ * Gather the non-null selected values of the input column into the batch's
+ * scratch vector, widened to int64 or float8.  Returns how many there are.
+ */
+static int
+batch_gather(TupleBatch batch, BatchAggTrans *btrans)
+{
+	Datum	   *values = batch->values[btrans->attno];
+	bool	   *isnull = batch->isnull[btrans->attno];
+	int		   *sel = batch->sel;
+	int			nsel = batch->nsel;
+	int64	   *ibuf = batch->ibuf;
+	float8	   *fbuf = batch->fbuf;
+	int			n = 0;
+	int			i;
+
+	switch (btrans->type)
+	{
+		case BATCH_TYPE_INT2:
+			for (i = 0; i < nsel; i++)
+			{
+				ibuf[n] = DatumGetInt16(values[sel[i]]);
+				n += !isnull[sel[i]];
+			}
+			break;
+		case BATCH_TYPE_INT4:
+			for (i = 0; i < nsel; i++)
+			{
+				ibuf[n] = DatumGetInt32(values[sel[i]]);
+				n += !isnull[sel[i]];
+			}
+			break;
+		case BATCH_TYPE_INT8:
+			for (i = 0; i < nsel; i++)
+			{
+				ibuf[n] = DatumGetInt64(values[sel[i]]);
+				n += !isnull[sel[i]];
+			}
+			break;
+		case BATCH_TYPE_FLOAT8:
+			for (i = 0; i < nsel; i++)
+			{
+				fbuf[n] = DatumGetFloat8(values[sel[i]]);
+				n += !isnull[sel[i]];
+			}
+			break;
+	}
+
+	return n;
+}
+
+static inline int64
+batch_int_from_datum(BatchValueType type, Datum d)
+{
+	switch (type)
+	{
+		case BATCH_TYPE_INT2:
+			return DatumGetInt16(d);
+		case BATCH_TYPE_INT4:
+			return DatumGetInt32(d);
+		default:
+			return DatumGetInt64(d);
+	}
+}
+
+static inline Datum
+batch_int_to_datum(BatchValueType type, int64 v)
+{
+	switch (type)
+	{
+		case BATCH_TYPE_INT2:
+			return Int16GetDatum((int16) v);
+		case BATCH_TYPE_INT4:
+			return Int32GetDatum((int32) v);
+		default:
+			return Int64GetDatum(v);
+	}
+}
+
+/*
+ * Advance one aggregate's transition state over the selected rows of a
+ * batch, with the same result as calling its transition function once per
+ * row.  The state fields are those of AggStatePerGroupData.
+ */
+void
+ExecBatchAdvanceAgg(TupleBatch batch, BatchAggTrans *btrans,
+					Datum *transValue, bool *transValueIsNull,
+					bool *noTransValue)
+{
+	int64		count;
+	int64		result;
+	int			n;
+	int			start;
+	int			i;
+
+	if (batch->nsel == 0)
+		return;
+
+	switch (btrans->kind)
+	{
+		case BATCH_AGG_COUNT_STAR:
+		case BATCH_AGG_COUNT:
+			if (btrans->kind == BATCH_AGG_COUNT_STAR)
+				count = batch->nsel;
+			else
+			{
+				bool	   *isnull = batch->isnull[btrans->attno];
+
+				count = 0;
+				for (i = 0; i < batch->nsel; i++)
+					count += !isnull[batch->sel[i]];
+			}
+			if (unlikely(pg_add_s64_overflow(DatumGetInt64(*transValue),
+											 count, &result)))
+				ereport(ERROR,
+						(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+						 errmsg("bigint out of range")));
+			*transValue = Int64GetDatum(result);
+			return;
+
+		case BATCH_AGG_SUM:
+			{
+				int64	   *ibuf = batch->ibuf;
+				int64		sum = 0;
+
+				n = batch_gather(batch, btrans);
+				if (n == 0)
+					return;
+
+				for (i = 0; i < n; i++)
+					sum += ibuf[i];
+
+				/* int2_sum()/int4_sum() are not strict; a NULL state starts over */
+				if (*transValueIsNull)
+					*transValue = Int64GetDatum(sum);
+				else
+					*transValue = Int64GetDatum(DatumGetInt64(*transValue) + sum);
+				*transValueIsNull = false;
+			}
+			return;
+
+		default:
+			break;
+	}
+
+	/* The remaining transition functions are strict */
+	n = batch_gather(batch, btrans);
+	if (n == 0)
+		return;
+
+	if (*noTransValue)
+	{
+		/* the first non-null input becomes the initial state */
+		if (btrans->type == BATCH_TYPE_FLOAT8)
+			*transValue = Float8GetDatum(batch->fbuf[0]);
+		else
+			*transValue = batch_int_to_datum(btrans->type, batch->ibuf[0]);
+		*transValueIsNull = false;
+		*noTransValue = false;
+		start = 1;
+	}
+	else if (*transValueIsNull)
+		return;
+	else
+		start = 0;
+
+	if (btrans->type == BATCH_TYPE_FLOAT8)
+	{
+		float8	   *fbuf = batch->fbuf;
+		float8		acc = DatumGetFloat8(*transValue);
+
+		/*
+		 * Summation stays sequential so that the result is bit-for-bit the
+		 * same as the per-tuple path; float8_pl() also raises the overflow
+		 * error float8pl() would.
+		 */
+		switch (btrans->kind)
+		{
+			case BATCH_AGG_SUM_FLOAT8:
+				for (i = start; i < n; i++)
+					acc = float8_pl(acc, fbuf[i]);
+				break;
+			case BATCH_AGG_MIN:
+				for (i = start; i < n; i++)
+					acc = float8_lt(acc, fbuf[i]) ? acc : fbuf[i];
+				break;
+			case BATCH_AGG_MAX:
+				for (i = start; i < n; i++)
+					acc = float8_gt(acc, fbuf[i]) ? acc : fbuf[i];
+				break;
+			default:
+				elog(ERROR, "unrecognized batch aggregate kind: %d",
+					 (int) btrans->kind);
+		}
+		*transValue = Float8GetDatum(acc);
+	}
+	else
+	{
+		int64	   *ibuf = batch->ibuf;
+		int64		acc = batch_int_from_datum(btrans->type, *transValue);
+
+		switch (btrans->kind)
+		{
+			case BATCH_AGG_MIN:
+				for (i = start; i < n; i++)
+					acc = (ibuf[i] < acc) ? ibuf[i] : acc;
+				break;
+			case BATCH_AGG_MAX:
+				for (i = start; i < n; i++)
+					acc = (ibuf[i] > acc) ? ibuf[i] : acc;
+				break;
+			default:
+				elog(ERROR, "unrecognized batch aggregate kind: %d",
+					 (int) btrans->kind);
+		}
+		*transValue = batch_int_to_datum(btrans->type, acc);
+	}
+}
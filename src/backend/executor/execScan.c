@@ -19,6 +19,7 @@
 #include "postgres.h"
 
 #include "executor/executor.h"
+#include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
 #include "utils/faultinjector.h"
 #include "utils/memutils.h"
@@ -167,6 +168,7 @@ ExecScan(ScanState *node,
 	ExprContext *econtext;
 	ExprState  *qual;
 	ProjectionInfo *projInfo;
+	RuntimeFilterState *runtimeFilter;
 
 	SIMPLE_FAULT_INJECTOR("before_exec_scan");
 
@@ -176,6 +178,7 @@ ExecScan(ScanState *node,
 	qual = node->ps.qual;
 	projInfo = node->ps.ps_ProjInfo;
 	econtext = node->ps.ps_ExprContext;
+	runtimeFilter = node->ss_runtimeFilter;
 
 	/* interrupt checks are in ExecScanFetch */
 
@@ -183,7 +186,7 @@ ExecScan(ScanState *node,
 	 * If we have neither a qual to check nor a projection to do, just skip
 	 * all the overhead and return the raw scan tuple.
 	 */
-	if (!qual && !projInfo)
+	if (!qual && !projInfo && !runtimeFilter)
 	{
 		ResetExprContext(econtext);
 		return ExecScanFetch(node, accessMtd, recheckMtd);
@@ -233,6 +236,8 @@ ExecScan(ScanState *node,
 		 */
 		if (qual == NULL || ExecQual(qual, econtext))
 		{
+			TupleTableSlot *result;
+
 			/*
 			 * Found a satisfactory scan tuple.
 			 */
@@ -242,15 +247,24 @@ ExecScan(ScanState *node,
 				 * Form a projection tuple, store it in the result tuple slot
 				 * and return it.
 				 */
-				return ExecProject(projInfo);
+				result = ExecProject(projInfo);
 			}
 			else
 			{
 				/*
 				 * Here, we aren't projecting, so just return scan tuple.
 				 */
-				return slot;
+				result = slot;
 			}
+
+			/*
+			 * GPDB: drop the tuple if the hash join above us certainly won't
+			 * find a match for it.  The join's hash keys are computed from
+			 * our output, so this has to come after the projection.
+			 */
+			if (runtimeFilter == NULL ||
+				ExecHashJoinRuntimeFilter(runtimeFilter, result))
+				return result;
 		}
 		else
 			InstrCountFiltered1(node, 1);
@@ -251,9 +251,11 @@
 #include "catalog/pg_proc.h"
 #include "catalog/pg_type.h"
 #include "common/hashfn.h"
+#include "executor/execBatch.h"
 #include "executor/execExpr.h"
 #include "executor/executor.h"
 #include "executor/nodeAgg.h"
+#include "executor/nodeSeqscan.h"
 #include "lib/hyperloglog.h"
 #include "miscadmin.h"
 #include "nodes/makefuncs.h"
@@ -261,6 +263,7 @@
 #include "optimizer/optimizer.h"
 #include "parser/parse_agg.h"
 #include "parser/parse_coerce.h"
+#include "parser/parsetree.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/datum.h"
@@ -275,6 +278,7 @@
 #include "utils/datum.h"
 
 #include "cdb/cdbexplain.h"
+#include "cdb/cdbvars.h"
 #include "lib/stringinfo.h"             /* StringInfo */
 #include "optimizer/walkers.h"
 
@@ -444,6 +448,8 @@ static void initialize_hash_entry(AggState *aggstate,
 								  TupleHashEntry entry);
 static void lookup_hash_entries(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
+static void agg_init_batch(AggState *aggstate, Agg *node);
+static TupleTableSlot *agg_retrieve_batch(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
 static bool agg_refill_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
@@ -2331,6 +2337,12 @@ ExecAgg(PlanState *pstate)
 				result = agg_retrieve_hash_table(node);
 				break;
 			case AGG_PLAIN:
+				if (node->batch_input)
+				{
+					result = agg_retrieve_batch(node);
+					break;
+				}
+				/* FALLTHROUGH */
 			case AGG_SORTED:
 				result = agg_retrieve_direct(node);
 				break;
@@ -2696,6 +2708,52 @@ agg_retrieve_direct(AggState *aggstate)
 	return NULL;
 }
 
+/*
+ * GPDB: ExecAgg for a plain aggregate computed over the column vectors of a
+ * batch mode scan, see agg_init_batch().
+ */
+static TupleTableSlot *
+agg_retrieve_batch(AggState *aggstate)
+{
+	ExprContext *econtext = aggstate->ss.ps.ps_ExprContext;
+	AggStatePerGroup pergroup = aggstate->pergroups[0];
+	TupleBatch	batch;
+	int			transno;
+
+	ReScanExprContext(econtext);
+	ReScanExprContext(aggstate->aggcontexts[0]);
+
+	initialize_aggregates(aggstate, aggstate->pergroups, 1);
+
+	while ((batch = ExecSeqScanNextBatch(aggstate->batch_input)) != NULL)
+	{
+		for (transno = 0; transno < aggstate->numtrans; transno++)
+		{
+			AggStatePerGroup pergroupstate = &pergroup[transno];
+
+			ExecBatchAdvanceAgg(batch, &aggstate->batch_trans[transno],
+								&pergroupstate->transValue,
+								&pergroupstate->transValueIsNull,
+								&pergroupstate->noTransValue);
+		}
+	}
+
+	aggstate->input_done = true;
+	aggstate->agg_done = true;
+
+	/*
+	 * Nothing but the aggregates refers to the input, so the empty scan slot
+	 * will do as the representative input tuple.
+	 */
+	econtext->ecxt_outertuple = aggstate->ss.ss_ScanTupleSlot;
+
+	select_current_set(aggstate, 0, false);
+
+	finalize_aggregates(aggstate, aggstate->peragg, pergroup);
+
+	return project_aggregates(aggstate);
+}
+
 /*
  * ExecAgg for hashed case: read input and build hash table
  */
@@ -4358,9 +4416,104 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		phase->evaltrans_cache[0][0] = phase->evaltrans;
 	}
 
+	/* GPDB: aggregate whole batches at a time, if the input allows it */
+	if (gp_enable_aocs_batch_scan)
+		agg_init_batch(aggstate, node);
+
 	return aggstate;
 }
 
+/*
+ * GPDB: Decide whether a plain aggregate can be computed directly over the
+ * column vectors of a batch mode scan below it.
+ *
+ * That takes a non-combining aggregate without grouping sets right on top of
+ * the scan, a scan with no per-tuple qual left, and aggregates that are plain
+ * count/sum/min/max of scan columns, which execBatch.c can advance over a
+ * whole batch. Otherwise the Agg keeps pulling tuples from the scan, which
+ * still evaluates its quals batch-at-a-time.
+ */
+static void
+agg_init_batch(AggState *aggstate, Agg *node)
+{
+	PlanState  *outerstate = outerPlanState(aggstate);
+	SeqScanState *scanstate;
+	List	   *scantlist;
+	List	   *vars;
+	ListCell   *lc;
+	BatchAggTrans *btrans;
+	int			transno;
+
+	if (node->aggstrategy != AGG_PLAIN || node->groupingSets != NIL ||
+		DO_AGGSPLIT_COMBINE(aggstate->aggsplit) || aggstate->numtrans == 0)
+		return;
+
+	if (!IsA(outerstate, SeqScanState))
+		return;
+	scanstate = (SeqScanState *) outerstate;
+
+	/* the scan's rows are never counted, so not under EXPLAIN ANALYZE */
+	if (scanstate->batch == NULL || scanstate->ss.ps.qual != NULL ||
+		scanstate->ss.ps.instrument != NULL)
+		return;
+
+	/* the tlist and qual must not need a representative input tuple */
+	vars = pull_var_clause((Node *) list_make2(node->plan.targetlist,
+											   node->plan.qual),
+						   PVC_INCLUDE_AGGREGATES |
+						   PVC_INCLUDE_WINDOWFUNCS |
+						   PVC_INCLUDE_PLACEHOLDERS);
+	foreach(lc, vars)
+	{
+		if (IsA(lfirst(lc), Var))
+			return;
+	}
+
+	scantlist = scanstate->ss.ps.plan->targetlist;
+	btrans = palloc0(aggstate->numtrans * sizeof(BatchAggTrans));
+
+	for (transno = 0; transno < aggstate->numtrans; transno++)
+	{
+		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
+		Aggref	   *aggref = pertrans->aggref;
+		TargetEntry *tle;
+		TargetEntry *scantle;
+		Var		   *var;
+
+		if (aggref->aggfilter != NULL || aggref->aggdistinct != NIL ||
+			pertrans->numSortCols > 0 || !pertrans->transtypeByVal ||
+			!ExecBatchAggSupported(pertrans->transfn_oid, &btrans[transno]))
+			return;
+
+		if (btrans[transno].kind == BATCH_AGG_COUNT_STAR)
+		{
+			if (pertrans->numInputs != 0)
+				return;
+			continue;
+		}
+
+		/* the argument must be a column read by the scan */
+		if (pertrans->numInputs != 1)
+			return;
+		tle = (TargetEntry *) linitial(aggref->args);
+		var = (Var *) tle->expr;
+		if (!IsA(var, Var) || var->varno != OUTER_VAR)
+			return;
+
+		scantle = get_tle_by_resno(scantlist, var->varattno);
+		if (scantle == NULL || !IsA(scantle->expr, Var))
+			return;
+		var = (Var *) scantle->expr;
+		if (var->varattno <= 0)
+			return;
+
+		btrans[transno].attno = var->varattno - 1;
+	}
+
+	aggstate->batch_input = scanstate;
+	aggstate->batch_trans = btrans;
+}
+
 /*
  * Build the state needed to calculate a state value for an aggregate.
  *
@@ -37,6 +37,7 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "port/atomics.h"
@@ -51,6 +52,9 @@
 #include "cdb/cdbutil.h"
 #include "cdb/cdbvars.h"
 
+/* largest fraction of bits set for a runtime filter to be worth probing */
+#define RUNTIME_FILTER_MAX_FILL		0.5
+
 static void ExecHashIncreaseNumBatches(HashJoinTable hashtable);
 static void ExecHashIncreaseNumBuckets(HashJoinTable hashtable);
 static void ExecParallelHashIncreaseNumBatches(HashJoinTable hashtable);
@@ -175,6 +179,35 @@ MultiExecPrivateHash(HashState *node)
 
 	SIMPLE_FAULT_INJECTOR("multi_exec_hash_large_vmem");
 
+	/*
+	 * GPDB: if the scan on the outer side of the join takes a runtime filter,
+	 * collect the hash values of the inner tuples in a Bloom filter.  It
+	 * lives as long as the hash table, across batches and rescans that reuse
+	 * the table.
+	 *
+	 * The filter is charged to the memory quota of the hash table, of which
+	 * it may take up to a quarter.  bloom_create() never makes a filter
+	 * smaller than 1MB, so there is none if the quota is below 4MB.
+	 */
+	if (node->hs_runtimeFilter)
+	{
+		int64		total_elems = Max((int64) node->ps.plan->plan_rows, 1);
+		int			bloom_work_mem;
+		uint64		bloom_bytes;
+
+		bloom_work_mem = (int) Min(hashtable->spaceAllowed / 4 / 1024, INT_MAX);
+		bloom_bytes = bloom_bitset_bytes(total_elems, bloom_work_mem);
+		if (bloom_bytes <= (uint64) bloom_work_mem * 1024)
+		{
+			MemoryContext oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+
+			hashtable->bloom = bloom_create(total_elems, bloom_work_mem, 0);
+			hashtable->spaceBloom = bloom_bytes;
+			hashtable->spaceAllowed -= bloom_bytes;
+			MemoryContextSwitchTo(oldcxt);
+		}
+	}
+
 	/*
 	 * Get all tuples from the node below the Hash node and insert into the
 	 * hash table (or temp files).
@@ -209,6 +242,10 @@ MultiExecPrivateHash(HashState *node)
 				ExecHashTableInsert(node, hashtable, slot, hashvalue);
 			}
 			hashtable->totalTuples += 1;
+
+			if (hashtable->bloom)
+				bloom_add_element(hashtable->bloom, (unsigned char *) &hashvalue,
+								  sizeof(hashvalue));
 		}
 
 		if (hashkeys_null)
@@ -222,6 +259,20 @@ MultiExecPrivateHash(HashState *node)
 		}
 	}
 
+	/*
+	 * A Bloom filter with most of its bits set lets nearly everything
+	 * through, and isn't worth probing.  That happens when the inner side is
+	 * much larger than estimated.
+	 */
+	if (hashtable->bloom &&
+		bloom_prop_bits_set(hashtable->bloom) > RUNTIME_FILTER_MAX_FILL)
+	{
+		bloom_free(hashtable->bloom);
+		hashtable->bloom = NULL;
+		hashtable->spaceAllowed += hashtable->spaceBloom;
+		hashtable->spaceBloom = 0;
+	}
+
 	/* Now we have set up all the initial batches & primary overflow batches. */
 	hashtable->nbatch_outstart = hashtable->nbatch;
 
@@ -552,6 +603,8 @@ ExecHashTableCreate(HashState *state, HashJoinState *hjstate,
 	hashtable->eagerlyReleased = false;
 	hashtable->hjstate = hjstate;
 	hashtable->first_pass = true;
+	hashtable->bloom = NULL;
+	hashtable->spaceBloom = 0;
 
 	hashtable->chunks = NULL;
 	hashtable->current_chunk = NULL;
@@ -1012,6 +1065,9 @@ ExecHashTableDestroy(HashState *hashState, HashJoinTable hashtable)
 
 	/* Release working memory (batchCxt is a child, so it goes away too) */
 	MemoryContextDelete(hashtable->hashCxt);
+
+	/* the runtime filter lived in hashCxt */
+	hashtable->bloom = NULL;
 }
 
 /*
@@ -2449,6 +2505,7 @@ ExecHashTableExplainEnd(PlanState *planstate, struct StringInfoData *buf)
     HashJoinState      *hjstate = (HashJoinState *)planstate;
     HashJoinTable       hashtable = hjstate->hj_HashTable;
     HashJoinTableStats *stats;
+    HashState          *hashState = (HashState *) innerPlanState(hjstate);
     Instrumentation    *jinstrument = hjstate->js.ps.instrument;
     int                 total_buckets;
     int                 i;
@@ -2466,8 +2523,6 @@ ExecHashTableExplainEnd(PlanState *planstate, struct StringInfoData *buf)
 
 	if (!hashtable->eagerlyReleased)
 	{		
-		HashState *hashState = (HashState *) innerPlanState(hjstate);
-
 		/* Report on batch in progress, in case the join is being ended early. */
 		ExecHashTableExplainBatchEnd(hashState, hashtable);
 	}
@@ -2553,6 +2608,17 @@ ExecHashTableExplainEnd(PlanState *planstate, struct StringInfoData *buf)
                              "  Skipped %d empty batches.",
                              hashtable->nbatch - stats->nonemptybatches);
     }
+
+	/* Report the outer tuples that the runtime filter dropped in the scan. */
+	if (hashState->hs_runtimeFilter)
+	{
+		ScanState  *scanState = (ScanState *) outerPlanState(hjstate);
+
+		appendStringInfo(buf,
+						 "%sRuntime filter removed " UINT64_FORMAT " outer rows.",
+						 buf->len > 0 ? "  " : "",
+						 scanState->ss_runtimeFilter->nremoved);
+	}
 }                               /* ExecHashTableExplainEnd */
 
 
@@ -115,6 +115,7 @@
 #include "executor/instrument.h"	/* Instrumentation */
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "utils/memutils.h"
@@ -162,6 +163,7 @@ static void ReleaseHashTable(HashJoinState *node);
 static void SpillCurrentBatch(HashJoinState *node);
 static bool ExecHashJoinReloadHashTable(HashJoinState *hjstate);
 static void ExecEagerFreeHashJoin(HashJoinState *node);
+static void ExecHashJoinInitRuntimeFilter(HashJoinState *hjstate, EState *estate);
 
 static inline void SaveWorkFileSetStatsInfo(HashJoinTable hashtable);
 
@@ -933,9 +935,91 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	hjstate->hj_MatchedOuter = false;
 	hjstate->hj_OuterNotEmpty = false;
 
+	if (gp_enable_runtime_filter)
+		ExecHashJoinInitRuntimeFilter(hjstate, estate);
+
 	return hjstate;
 }
 
+/*
+ * ExecHashJoinInitRuntimeFilter
+ *		Push a runtime filter down into the scan on the outer side, if there
+ *		is one.
+ *
+ * Only joins that drop the outer tuples without a match can use a filter.
+ * The filter is probed by the scan process itself, so the scan must be a
+ * direct child of the join: a Motion in between means the scan runs in
+ * another slice, and a filter on the receiving end of the Motion wouldn't
+ * save anything over probing the hash table.
+ */
+static void
+ExecHashJoinInitRuntimeFilter(HashJoinState *hjstate, EState *estate)
+{
+	HashJoin   *node = (HashJoin *) hjstate->js.ps.plan;
+	PlanState  *outerState = outerPlanState(hjstate);
+	RuntimeFilterState *rfstate;
+
+	if (hjstate->js.jointype != JOIN_INNER &&
+		hjstate->js.jointype != JOIN_SEMI &&
+		hjstate->js.jointype != JOIN_RIGHT)
+		return;
+
+	switch (nodeTag(outerState))
+	{
+		case T_SeqScanState:
+		case T_IndexScanState:
+		case T_IndexOnlyScanState:
+		case T_BitmapHeapScanState:
+			break;
+		default:
+			return;
+	}
+
+	/* the hash keys refer to the outer tuple, which is the scan's output */
+	rfstate = (RuntimeFilterState *) palloc0(sizeof(RuntimeFilterState));
+	rfstate->hjstate = hjstate;
+	rfstate->hashkeys = ExecInitExprList(node->hashkeys, outerState);
+	rfstate->econtext = CreateExprContext(estate);
+
+	((ScanState *) outerState)->ss_runtimeFilter = rfstate;
+	((HashState *) innerPlanState(hjstate))->hs_runtimeFilter = true;
+}
+
+/*
+ * ExecHashJoinRuntimeFilter
+ *		Can the output tuple of a scan find a match in the inner side of
+ *		the hash join the runtime filter comes from?
+ *
+ * False means that it certainly can't, and the scan can drop it.  Before
+ * the hash table is built, e.g. for the tuple the join fetches to see if the
+ * outer side is empty, every tuple passes.
+ */
+bool
+ExecHashJoinRuntimeFilter(RuntimeFilterState *rfstate, TupleTableSlot *slot)
+{
+	HashJoinState *hjstate = rfstate->hjstate;
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	uint32		hashvalue;
+	bool		hashkeys_null;
+
+	if (hashtable == NULL || hashtable->eagerlyReleased ||
+		hashtable->bloom == NULL)
+		return true;
+
+	rfstate->econtext->ecxt_outertuple = slot;
+	if (ExecHashGetHashValue((HashState *) innerPlanState(hjstate), hashtable,
+							 rfstate->econtext, rfstate->hashkeys,
+							 true,	/* outer tuple */
+							 hjstate->hj_nonequijoin,
+							 &hashvalue, &hashkeys_null) &&
+		!bloom_lacks_element(hashtable->bloom, (unsigned char *) &hashvalue,
+							 sizeof(hashvalue)))
+		return true;
+
+	rfstate->nremoved++;
+	return false;
+}
+
 /* ----------------------------------------------------------------
  *		ExecEndHashJoin
  *
@@ -0,0 +1,480 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeIncrementalSort.c
+ *	  Routines to handle incremental sorting of relations.
+ *
+ * Portions Copyright (c) 2012-Present VMware, Inc. or its affiliates.
+ * Portions Copyright (c) 1996-2019, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/nodeIncrementalSort.c
+ *
+ * An incremental sort is used when the input is already sorted on a prefix
+ * of the required sort keys, for instance by an index scan or by a merging
+ * Gather Motion.  Rather than sorting the whole input, the input is read in
+ * batches made of whole groups of rows sharing the values of the presorted
+ * keys, and each batch is sorted on its own, on all keys.  Since the batches
+ * follow each other in the order of the presorted keys, returning the
+ * sorted batches one after the other returns the input in the required
+ * order.
+ *
+ * Each batch holds at least INCSORT_MIN_BATCH_TUPLES rows, unless the input
+ * runs out, so that the cost of setting up a sort is shared by the many
+ * small groups a prefix with many distinct values yields.  Once a batch is
+ * that large, it is only extended with the rows of its trailing group: the
+ * first row of that group is kept as the "pivot", and reading stops at the
+ * first row that differs from the pivot on the presorted keys.  That row
+ * starts the next batch.
+ *
+ * Only one batch is held at a time, so a sort whose groups fit in the
+ * operator's memory never spills, however large the input is.  When the
+ * output is bounded, e.g. by a LIMIT, each batch is sorted with a bound of
+ * the rows still to be returned, and no more of the input is read than the
+ * groups holding those rows.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "executor/execdebug.h"
+#include "executor/executor.h"
+#include "executor/nodeIncrementalSort.h"
+#include "lib/stringinfo.h"
+#include "miscadmin.h"
+#include "utils/lsyscache.h"
+#include "utils/tuplesort.h"
+
+/*
+ * Minimum number of rows in a batch, unless the input or the bound runs out
+ * first.
+ */
+#define INCSORT_MIN_BATCH_TUPLES 256
+
+static void ExecIncrementalSortExplainEnd(PlanState *planstate,
+										  struct StringInfoData *buf);
+static bool incsort_same_group(IncrementalSortState *node,
+							   TupleTableSlot *pivot, TupleTableSlot *slot);
+static void incsort_fill_batch(IncrementalSortState *node);
+static void incsort_finish_batch(IncrementalSortState *node);
+
+/*
+ * incsort_same_group
+ *		Does the tuple in 'slot' belong to the group of the tuple in 'pivot',
+ *		i.e. are their presorted columns not distinct?
+ */
+static bool
+incsort_same_group(IncrementalSortState *node,
+				   TupleTableSlot *pivot, TupleTableSlot *slot)
+{
+	ExprContext *econtext = node->ss.ps.ps_ExprContext;
+
+	econtext->ecxt_innertuple = pivot;
+	econtext->ecxt_outertuple = slot;
+
+	return ExecQualAndReset(node->presortedEq, econtext);
+}
+
+/*
+ * incsort_fill_batch
+ *		Read the next batch of the input into a new tuplesort, and sort it.
+ *
+ * If the input holds no more rows, no batch is started.
+ */
+static void
+incsort_fill_batch(IncrementalSortState *node)
+{
+	IncrementalSort *plannode = (IncrementalSort *) node->ss.ps.plan;
+	Sort	   *sort = &plannode->sort;
+	PlanState  *outerNode = outerPlanState(node);
+	EState	   *estate = node->ss.ps.state;
+	ScanDirection dir = estate->es_direction;
+	Tuplesortstate *batchsortstate;
+	int64		minTuples = INCSORT_MIN_BATCH_TUPLES;
+
+	Assert(node->batchsortstate == NULL);
+
+	/*
+	 * With a bound, the batch holding the last row to return needs no more
+	 * than the groups holding the rows still to be returned.
+	 */
+	if (node->bounded)
+		minTuples = Min(minTuples, node->bound - node->bound_Done);
+
+	batchsortstate = tuplesort_begin_heap(ExecGetResultType(outerNode),
+										  sort->numCols,
+										  sort->sortColIdx,
+										  sort->sortOperators,
+										  sort->collations,
+										  sort->nullsFirst,
+										  PlanStateOperatorMemKB((PlanState *) node),
+										  NULL,
+										  false);
+	if (node->bounded)
+		tuplesort_set_bound(batchsortstate, node->bound - node->bound_Done);
+	node->batchsortstate = (void *) batchsortstate;
+	node->batchTuples = 0;
+
+	/*
+	 * Want to scan subplan in the forward direction while reading the batch.
+	 */
+	estate->es_direction = ForwardScanDirection;
+
+	for (;;)
+	{
+		TupleTableSlot *slot;
+
+		/* the first row of the batch may have been read with the last one */
+		if (!TupIsNull(node->transfer_tuple))
+			slot = node->transfer_tuple;
+		else
+		{
+			slot = ExecProcNode(outerNode);
+			if (TupIsNull(slot))
+			{
+				node->outerNodeDone = true;
+				break;
+			}
+		}
+
+		if (!TupIsNull(node->group_pivot) &&
+			!incsort_same_group(node, node->group_pivot, slot))
+		{
+			/* first row of the next group, which starts the next batch */
+			ExecCopySlot(node->transfer_tuple, slot);
+			break;
+		}
+
+		tuplesort_puttupleslot(batchsortstate, slot);
+		node->batchTuples++;
+
+		/*
+		 * Once the batch is large enough, it is only completed with the rows
+		 * of its trailing group.
+		 */
+		if (TupIsNull(node->group_pivot) && node->batchTuples >= minTuples)
+			ExecCopySlot(node->group_pivot, slot);
+
+		if (slot == node->transfer_tuple)
+			ExecClearTuple(node->transfer_tuple);
+	}
+
+	ExecClearTuple(node->group_pivot);
+
+	if (node->batchTuples == 0)
+	{
+		tuplesort_end(batchsortstate);
+		node->batchsortstate = NULL;
+	}
+	else
+	{
+		SO1_printf("ExecIncrementalSort: sorting batch of " INT64_FORMAT " tuples\n",
+				   node->batchTuples);
+		tuplesort_performsort(batchsortstate);
+		node->batchSorted = true;
+	}
+
+	/*
+	 * restore to user specified direction
+	 */
+	estate->es_direction = dir;
+}
+
+/*
+ * incsort_finish_batch
+ *		Account for the current batch in the instrumentation, and release it.
+ */
+static void
+incsort_finish_batch(IncrementalSortState *node)
+{
+	IncrementalSortInfo *info = &node->incsort_info;
+	TuplesortInstrumentation stats;
+
+	Assert(node->batchsortstate != NULL);
+
+	tuplesort_get_stats((Tuplesortstate *) node->batchsortstate, &stats);
+
+	info->batchCount++;
+	info->maxBatchTuples = Max(info->maxBatchTuples, node->batchTuples);
+	if (stats.spaceType == SORT_SPACE_TYPE_DISK)
+		info->diskBatchCount++;
+	info->maxSpaceUsed = Max(info->maxSpaceUsed, stats.spaceUsed);
+
+	tuplesort_end((Tuplesortstate *) node->batchsortstate);
+	node->batchsortstate = NULL;
+	node->batchSorted = false;
+	node->batchTuples = 0;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecIncrementalSort
+ *
+ *		Returns the tuples of the outer subtree, sorted one batch of
+ *		presorted groups at a time.
+ *
+ *		Conditions:
+ *		  -- the outer subtree returns its tuples sorted on the first
+ *			 nPresortedCols sort columns.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+ExecIncrementalSort(PlanState *pstate)
+{
+	IncrementalSortState *node = castNode(IncrementalSortState, pstate);
+	TupleTableSlot *slot = node->ss.ps.ps_ResultTupleSlot;
+
+	CHECK_FOR_INTERRUPTS();
+
+	/* incremental sort does not support backward scans */
+	Assert(ScanDirectionIsForward(node->ss.ps.state->es_direction));
+
+	for (;;)
+	{
+		if (node->batchSorted)
+		{
+			/*
+			 * Get the next tuple of the current batch.  Note that we only
+			 * rely on slot tuple remaining valid until the next fetch from
+			 * the tuplesort.
+			 */
+			if (tuplesort_gettupleslot((Tuplesortstate *) node->batchsortstate,
+									   true, false, slot, NULL))
+			{
+				node->bound_Done++;
+				return slot;
+			}
+
+			incsort_finish_batch(node);
+		}
+
+		if (node->outerNodeDone ||
+			(node->bounded && node->bound_Done >= node->bound))
+			return ExecClearTuple(slot);
+
+		incsort_fill_batch(node);
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		ExecInitIncrementalSort
+ *
+ *		Creates the run-time state information for the incremental sort
+ *		node produced by the planner and initializes its outer subtree.
+ * ----------------------------------------------------------------
+ */
+IncrementalSortState *
+ExecInitIncrementalSort(IncrementalSort *node, EState *estate, int eflags)
+{
+	IncrementalSortState *incrsortstate;
+	Sort	   *sort = &node->sort;
+	TupleDesc	tupDesc;
+	Oid		   *eqOperators;
+	int			i;
+
+	SO1_printf("ExecInitIncrementalSort: %s\n",
+			   "initializing incremental sort node");
+
+	/*
+	 * Incremental sort keeps no more than the current batch, so it can
+	 * neither go backwards nor restore marked positions.
+	 */
+	Assert((eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)) == 0);
+	Assert(node->nPresortedCols > 0 && node->nPresortedCols < sort->numCols);
+
+	/*
+	 * create state structure
+	 */
+	incrsortstate = makeNode(IncrementalSortState);
+	incrsortstate->ss.ps.plan = (Plan *) node;
+	incrsortstate->ss.ps.state = estate;
+	incrsortstate->ss.ps.ExecProcNode = ExecIncrementalSort;
+
+	incrsortstate->bounded = false;
+	incrsortstate->bound_Done = 0;
+	incrsortstate->outerNodeDone = false;
+	incrsortstate->batchSorted = false;
+	incrsortstate->batchTuples = 0;
+	incrsortstate->batchsortstate = NULL;
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * The ExprContext is used to compare the presorted columns of the rows.
+	 */
+	ExecAssignExprContext(estate, &incrsortstate->ss.ps);
+
+	/*
+	 * CDB: Offer extra info for EXPLAIN ANALYZE.
+	 */
+	if (estate->es_instrument && (estate->es_instrument & INSTRUMENT_CDB))
+	{
+		/* Allocate string buffer. */
+		incrsortstate->ss.ps.cdbexplainbuf = makeStringInfo();
+
+		/* Request a callback at end of query. */
+		incrsortstate->ss.ps.cdbexplainfun = ExecIncrementalSortExplainEnd;
+	}
+
+	/*
+	 * initialize child nodes
+	 *
+	 * A rescan of the incremental sort rescans its child, so the child keeps
+	 * the REWIND flag.
+	 */
+	outerPlanState(incrsortstate) = ExecInitNode(outerPlan(node), estate, eflags);
+
+	/*
+	 * Initialize scan slot and type.
+	 */
+	ExecCreateScanSlotFromOuterPlan(estate, &incrsortstate->ss, &TTSOpsVirtual);
+
+	/*
+	 * Initialize return slot and type. No need to initialize projection info
+	 * because this node doesn't do projections.
+	 */
+	ExecInitResultTupleSlotTL(&incrsortstate->ss.ps, &TTSOpsMinimalTuple);
+	incrsortstate->ss.ps.ps_ProjInfo = NULL;
+
+	/*
+	 * Initialize the slots holding the pivot of the trailing group of the
+	 * batch and the first row of the next batch.
+	 */
+	tupDesc = ExecGetResultType(outerPlanState(incrsortstate));
+	incrsortstate->group_pivot = MakeSingleTupleTableSlot(tupDesc,
+														  &TTSOpsMinimalTuple);
+	incrsortstate->transfer_tuple = MakeSingleTupleTableSlot(tupDesc,
+															 &TTSOpsMinimalTuple);
+
+	/*
+	 * Prepare the comparison of the presorted columns, using the equality
+	 * operators matching the ordering operators.
+	 */
+	eqOperators = (Oid *) palloc(node->nPresortedCols * sizeof(Oid));
+	for (i = 0; i < node->nPresortedCols; i++)
+	{
+		eqOperators[i] = get_equality_op_for_ordering_op(sort->sortOperators[i],
+														 NULL);
+		if (!OidIsValid(eqOperators[i]))
+			elog(ERROR, "missing equality operator for ordering operator %u",
+				 sort->sortOperators[i]);
+	}
+
+	incrsortstate->presortedEq = execTuplesMatchPrepare(tupDesc,
+														node->nPresortedCols,
+														sort->sortColIdx,
+														eqOperators,
+														sort->collations,
+														&incrsortstate->ss.ps);
+
+	SO1_printf("ExecInitIncrementalSort: %s\n",
+			   "incremental sort node initialized");
+
+	return incrsortstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndIncrementalSort(node)
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndIncrementalSort(IncrementalSortState *node)
+{
+	SO1_printf("ExecEndIncrementalSort: %s\n",
+			   "shutting down incremental sort node");
+
+	/* clean out the tuple table */
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecDropSingleTupleTableSlot(node->group_pivot);
+	ExecDropSingleTupleTableSlot(node->transfer_tuple);
+
+	if (node->batchsortstate != NULL)
+	{
+		tuplesort_end((Tuplesortstate *) node->batchsortstate);
+		node->batchsortstate = NULL;
+	}
+
+	/*
+	 * shut down the subplan
+	 */
+	ExecEndNode(outerPlanState(node));
+
+	SO1_printf("ExecEndIncrementalSort: %s\n",
+			   "incremental sort node shutdown");
+}
+
+void
+ExecReScanIncrementalSort(IncrementalSortState *node)
+{
+	PlanState  *outerPlan = outerPlanState(node);
+
+	/*
+	 * Only the current batch is kept, so there is nothing to rewind: forget
+	 * it, and read the subplan again.
+	 */
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->group_pivot);
+	ExecClearTuple(node->transfer_tuple);
+
+	if (node->batchsortstate != NULL)
+	{
+		tuplesort_end((Tuplesortstate *) node->batchsortstate);
+		node->batchsortstate = NULL;
+	}
+
+	node->outerNodeDone = false;
+	node->batchSorted = false;
+	node->batchTuples = 0;
+	node->bound_Done = 0;
+
+	/*
+	 * if chgParam of subnode is not null then plan will be re-scanned by
+	 * first ExecProcNode.
+	 */
+	if (outerPlan->chgParam == NULL)
+		ExecReScan(outerPlan);
+}
+
+void
+ExecSquelchIncrementalSort(IncrementalSortState *node)
+{
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+
+	if (node->batchsortstate != NULL)
+		incsort_finish_batch(node);
+
+	/* no more rows are needed until the next rescan */
+	node->outerNodeDone = true;
+
+	ExecSquelchNode(outerPlanState(node));
+}
+
+/*
+ * ExecIncrementalSortExplainEnd
+ *      Called before ExecutorEnd to finish EXPLAIN ANALYZE reporting.
+ */
+static void
+ExecIncrementalSortExplainEnd(PlanState *planstate, struct StringInfoData *buf)
+{
+	IncrementalSortState *node = (IncrementalSortState *) planstate;
+	IncrementalSortInfo *info = &node->incsort_info;
+
+	/* a bounded sort usually stops in the middle of its last batch */
+	if (node->batchsortstate != NULL)
+		incsort_finish_batch(node);
+
+	appendStringInfo(buf,
+					 "Sort batches: " INT64_FORMAT ", largest batch: " INT64_FORMAT
+					 " rows, spilled batches: " INT64_FORMAT ".",
+					 info->batchCount,
+					 info->maxBatchTuples,
+					 info->diskBatchCount);
+
+	if (planstate->instrument)
+	{
+		planstate->instrument->workfileCreated = (info->diskBatchCount > 0);
+		planstate->instrument->workmemused = info->maxSpaceUsed * 1024L;
+	}
+}								/* ExecIncrementalSortExplainEnd */
@@ -39,6 +39,12 @@
 
 /* #define CDB_MOTION_DEBUG */
 
+/*
+ * With gp_motion_compression on, a Motion compresses its tuples from the
+ * start if the planner expects wide rows and at least this much data.
+ */
+#define MOTION_COMPRESS_MIN_ESTIMATED_BYTES	(1024 * 1024)
+
 #ifdef CDB_MOTION_DEBUG
 #include "utils/lsyscache.h"	/* getTypeOutputInfo */
 #include "lib/stringinfo.h"		/* StringInfo */
@@ -54,6 +60,10 @@ static TupleTableSlot *execMotionSortedReceiver(MotionState *node);
 
 static int	CdbMergeComparator(Datum lhs, Datum rhs, void *context);
 static uint32 evalHashKey(ExprContext *econtext, List *hashkeys, CdbHash *h);
+static void initSkewHotHashes(MotionState *node, Motion *motion);
+static bool isSkewHotHash(MotionState *node, uint32 hash);
+
+static void ExecMotionExplainEnd(PlanState *planstate, struct StringInfoData *buf);
 
 static void doSendEndOfStream(Motion *motion, MotionState *node);
 static void doSendTuple(Motion *motion, MotionState *node, TupleTableSlot *outerTupleSlot);
@@ -667,6 +677,7 @@ ExecInitMotion(Motion *node, EState *estate, int eflags)
 	SliceTable *sliceTable = estate->es_sliceTable;
 	PlanState  *outerPlan;
 	int			parentIndex;
+	bool		compress;
 
 	/*
 	 * If GDD is enabled, the lock of table may downgrade to RowExclusiveLock,
@@ -820,6 +831,9 @@ ExecInitMotion(Motion *node, EState *estate, int eflags)
 		motionstate->cdbhash = makeCdbHash(motionstate->numHashSegments,
 										   nkeys,
 										   node->hashFuncs);
+
+		if (node->skewMode != MOTIONSKEW_NONE && nkeys > 0)
+			initSkewHotHashes(motionstate, node);
 	}
 
 	/*
@@ -864,13 +878,30 @@ ExecInitMotion(Motion *node, EState *estate, int eflags)
 								motionstate);
 	}
 
+	/*
+	 * CDB: Offer extra info for EXPLAIN ANALYZE.
+	 */
+	if (estate->es_instrument && (estate->es_instrument & INSTRUMENT_CDB))
+		motionstate->ps.cdbexplainfun = ExecMotionExplainEnd;
+
+	/*
+	 * Compress the tuples from the start if the planner expects this Motion
+	 * to move wide rows in bulk.  Otherwise the motion layer may still switch
+	 * compression on if the link turns out to be slow.
+	 */
+	compress = gp_motion_compression &&
+		node->plan.plan_width >= gp_motion_compression_min_width &&
+		node->plan.plan_rows * node->plan.plan_width >=
+		MOTION_COMPRESS_MIN_ESTIMATED_BYTES;
+
 	/*
 	 * Perform per-node initialization in the motion layer.
 	 */
 	UpdateMotionLayerNode(motionstate->ps.state->motionlayer_context,
 						  node->motionID,
 						  node->sendSorted,
-						  tupDesc);
+						  tupDesc,
+						  compress);
 
 
 #ifdef CDB_MOTION_DEBUG
@@ -977,6 +1008,11 @@ ExecEndMotion(MotionState *node)
 		pfree(node->cdbhash);
 		node->cdbhash = NULL;
 	}
+	if (node->skewHotHashes != NULL)
+	{
+		pfree(node->skewHotHashes);
+		node->skewHotHashes = NULL;
+	}
 
 	/*
 	 * Free up this motion node's resources in the Motion Layer.
@@ -994,6 +1030,31 @@ ExecEndMotion(MotionState *node)
 
 
 
+/*
+ * ExecMotionExplainEnd
+ *		Called before ExecutorEnd to finish EXPLAIN ANALYZE reporting.
+ */
+static void
+ExecMotionExplainEnd(PlanState *planstate, struct StringInfoData *buf)
+{
+	Motion	   *motion = (Motion *) planstate->plan;
+	MotionState *node = (MotionState *) planstate;
+	uint64		saved;
+
+	saved = GetMotionLayerNodeBytesSaved(planstate->state->motionlayer_context,
+										 motion->motionID);
+	if (saved > 0)
+		appendStringInfo(buf, "Compression saved " UINT64_FORMAT " bytes.",
+						 saved);
+	if (node->numSkewTuples > 0)
+		appendStringInfo(buf, "%sHot-key rows %s: " UINT64_FORMAT ".",
+						 saved > 0 ? "  " : "",
+						 motion->skewMode == MOTIONSKEW_SPREAD ?
+						 "spread" : "broadcast",
+						 node->numSkewTuples);
+}								/* ExecMotionExplainEnd */
+
+
 /*=========================================================================
  * HELPER FUNCTIONS
  */
@@ -1105,6 +1166,60 @@ evalHashKey(ExprContext *econtext, List *hashkeys, CdbHash * h)
 	return target_seg;
 }
 
+/*
+ * Compute the raw hash value of each hot key of a skew-aware Motion.
+ *
+ * The hot keys are hashed with the Motion's own hash functions, before the
+ * reduction to a segment, so the two Motions below a join classify equal
+ * keys the same way.  A row whose key merely collides with a hot key is
+ * treated as hot on both sides too, which costs nothing in correctness.
+ */
+static void
+initSkewHotHashes(MotionState *node, Motion *motion)
+{
+	CdbHash    *h = node->cdbhash;
+	ListCell   *lc;
+	int			n = 0;
+
+	node->skewHotHashes = (uint32 *)
+		palloc(list_length(motion->skewHotKeys) * sizeof(uint32));
+
+	foreach(lc, motion->skewHotKeys)
+	{
+		List	   *key = (List *) lfirst(lc);
+		ListCell   *lck;
+		int			i = 0;
+
+		if (list_length(key) != h->natts)
+			elog(ERROR, "skew hot key has %d columns, expected %d",
+				 list_length(key), h->natts);
+
+		cdbhashinit(h);
+		foreach(lck, key)
+		{
+			Const	   *c = lfirst_node(Const, lck);
+
+			cdbhash(h, ++i, c->constvalue, c->constisnull);
+		}
+		node->skewHotHashes[n++] = h->hash;
+	}
+	node->numSkewHotHashes = n;
+
+	/* start each sender at a different segment */
+	node->skewNextRoute = cdbhashrandomseg(node->numHashSegments);
+}
+
+static bool
+isSkewHotHash(MotionState *node, uint32 hash)
+{
+	for (int i = 0; i < node->numSkewHotHashes; i++)
+	{
+		if (node->skewHotHashes[i] == hash)
+			return true;
+	}
+	return false;
+}
+
 
 void
 doSendEndOfStream(Motion *motion, MotionState *node)
@@ -1199,6 +1314,24 @@ doSendTuple(Motion *motion, MotionState *node, TupleTableSlot *outerTupleSlot)
 		 * is passed around our system a fair amount!).
 		 */
 		Assert(targetRoute != BROADCAST_SEGIDX);
+
+		/*
+		 * Skew-aware redistribution: rows of a hot key don't go to the
+		 * key's segment.  Either spread them round-robin, or broadcast them
+		 * so that they meet the spread rows of the other side everywhere.
+		 */
+		if (node->numSkewHotHashes > 0 &&
+			isSkewHotHash(node, node->cdbhash->hash))
+		{
+			node->numSkewTuples++;
+			if (motion->skewMode == MOTIONSKEW_BROADCAST)
+				targetRoute = BROADCAST_SEGIDX;
+			else
+			{
+				targetRoute = node->skewNextRoute;
+				node->skewNextRoute = (targetRoute + 1) % node->numHashSegments;
+			}
+		}
 	}
 	else if (motion->motionType == MOTIONTYPE_EXPLICIT)
 	{
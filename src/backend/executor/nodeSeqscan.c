@@ -19,6 +19,7 @@
  *		ExecInitSeqScan			creates and initializes a seqscan node.
  *		ExecEndSeqScan			releases any storage allocated.
  *		ExecReScanSeqScan		rescans the relation
+ *		ExecSeqScanNextBatch	retrieve next batch of qualifying rows
  *
  *		ExecSeqScanEstimate		estimates DSM space needed for parallel scan
  *		ExecSeqScanInitializeDSM initialize DSM for parallel scan
@@ -29,11 +30,15 @@
 
 #include "access/relscan.h"
 #include "access/tableam.h"
+#include "cdb/cdbvars.h"
+#include "executor/execBatch.h"
 #include "executor/execdebug.h"
 #include "executor/nodeSeqscan.h"
+#include "miscadmin.h"
 #include "utils/rel.h"
 #include "nodes/nodeFuncs.h"
 
+static TableScanDesc SeqBeginScan(SeqScanState *node);
 static TupleTableSlot *SeqNext(SeqScanState *node);
 
 /* ----------------------------------------------------------------
@@ -42,26 +47,15 @@ static TupleTableSlot *SeqNext(SeqScanState *node);
  */
 
 /* ----------------------------------------------------------------
- *		SeqNext
+ *		SeqBeginScan
  *
- *		This is a workhorse for ExecSeqScan
+ *		Start the scan on first use
  * ----------------------------------------------------------------
  */
-static TupleTableSlot *
-SeqNext(SeqScanState *node)
+static TableScanDesc
+SeqBeginScan(SeqScanState *node)
 {
-	TableScanDesc scandesc;
-	EState	   *estate;
-	ScanDirection direction;
-	TupleTableSlot *slot;
-
-	/*
-	 * get information from the estate and scan state
-	 */
-	scandesc = node->ss.ss_currentScanDesc;
-	estate = node->ss.ps.state;
-	direction = estate->es_direction;
-	slot = node->ss.ss_ScanTupleSlot;
+	TableScanDesc scandesc = node->ss.ss_currentScanDesc;
 
 	if (scandesc == NULL)
 	{
@@ -75,7 +69,7 @@ SeqNext(SeqScanState *node)
 		 * comment in table_beginscan_es() for more info.
 		 */
 		scandesc = table_beginscan_es(node->ss.ss_currentRelation,
-									  estate->es_snapshot,
+									  node->ss.ps.state->es_snapshot,
 									  node->ss.ps.plan->targetlist,
 									  node->ss.ps.plan->qual,
 									  NULL,
@@ -83,6 +77,45 @@ SeqNext(SeqScanState *node)
 		node->ss.ss_currentScanDesc = scandesc;
 	}
 
+	return scandesc;
+}
+
+/* ----------------------------------------------------------------
+ *		SeqNext
+ *
+ *		This is a workhorse for ExecSeqScan
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+SeqNext(SeqScanState *node)
+{
+	TableScanDesc scandesc;
+	EState	   *estate;
+	ScanDirection direction;
+	TupleTableSlot *slot;
+
+	/*
+	 * get information from the estate and scan state
+	 */
+	scandesc = SeqBeginScan(node);
+	estate = node->ss.ps.state;
+	direction = estate->es_direction;
+	slot = node->ss.ss_ScanTupleSlot;
+
+	/*
+	 * GPDB: in batch mode, hand out the rows of the current batch that passed
+	 * the vectorized quals, and fetch the next batch when they run out.
+	 */
+	if (node->batch != NULL)
+	{
+		while (!ExecBatchStoreNext(node->batch, slot))
+		{
+			if (ExecSeqScanNextBatch(node) == NULL)
+				return NULL;
+		}
+		return slot;
+	}
+
 	/*
 	 * get the next tuple from the table
 	 */
@@ -91,6 +124,40 @@ SeqNext(SeqScanState *node)
 	return NULL;
 }
 
+/* ----------------------------------------------------------------
+ *		ExecSeqScanNextBatch
+ *
+ *		GPDB: Fetches the next batch of rows from a batch mode scan,
+ *		with the vectorized quals applied. Returns NULL at the end of
+ *		the scan. Any residual qual in ps.qual is NOT applied; that is
+ *		left to the caller.
+ * ----------------------------------------------------------------
+ */
+TupleBatch
+ExecSeqScanNextBatch(SeqScanState *node)
+{
+	TableScanDesc scandesc = SeqBeginScan(node);
+	TupleBatch	batch = node->batch;
+
+	Assert(batch != NULL);
+
+	for (;;)
+	{
+		CHECK_FOR_INTERRUPTS();
+
+		if (!table_scan_getnextbatch(scandesc, batch))
+		{
+			batch->nsel = 0;
+			batch->next = 0;
+			return NULL;
+		}
+
+		ExecBatchQual(batch, node->batchquals, node->nbatchquals);
+		if (batch->nsel > 0)
+			return batch;
+	}
+}
+
 /*
  * SeqRecheck -- access method routine to recheck a tuple in EvalPlanQual
  */
@@ -185,6 +252,26 @@ ExecInitSeqScanForPartition(SeqScan *node, EState *estate,
 	ExecInitResultTypeTL(&scanstate->ss.ps);
 	ExecAssignScanProjectionInfo(&scanstate->ss);
 
+	/*
+	 * GPDB: scan in batches if the table AM supports it. The conjuncts of the
+	 * qual that can be evaluated over column vectors are split off; only the
+	 * rest is initialized as the regular per-tuple qual.
+	 */
+	if (gp_enable_aocs_batch_scan &&
+		table_scan_supports_batch(currentRelation))
+	{
+		List	   *residual;
+
+		scanstate->batch = ExecBatchCreate(RelationGetDescr(currentRelation),
+										   TUPLE_BATCH_SIZE);
+		residual = ExecBatchSplitQual(node->plan.qual, node->scanrelid,
+									  &scanstate->batchquals,
+									  &scanstate->nbatchquals);
+		scanstate->ss.ps.qual =
+			ExecInitQual(residual, (PlanState *) scanstate);
+		return scanstate;
+	}
+
 	/*
 	 * initialize child expressions
 	 */
@@ -251,6 +338,12 @@ ExecReScanSeqScan(SeqScanState *node)
 		table_rescan(scan,		/* scan desc */
 					 NULL);		/* new scan keys */
 
+	if (node->batch != NULL)
+	{
+		node->batch->nsel = 0;
+		node->batch->next = 0;
+	}
+
 	ExecScanReScan((ScanState *) node);
 }
 
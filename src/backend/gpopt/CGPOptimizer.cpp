@@ -219,6 +219,51 @@ SerializeDXLPlan(Query *query)
 }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		GetOptimizerProfile
+//
+//	@doc:
+//		Return the per-xform and per-job counters of the last optimization
+//		request, or of all requests since the last reset
+//
+//---------------------------------------------------------------------------
+extern "C" {
+List *
+GetOptimizerProfile(bool cumulative)
+{
+	GPOS_TRY
+	{
+		return COptTasks::GetOptimizerProfile(cumulative);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		if (GPOS_MATCH_EX(ex, gpdxl::ExmaGPDB, gpdxl::ExmiGPDBError))
+		{
+			PG_RE_THROW();
+		}
+	}
+	GPOS_CATCH_END;
+	return NIL;
+}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		ResetOptimizerProfile
+//
+//	@doc:
+//		Clear the optimization profile of this backend
+//
+//---------------------------------------------------------------------------
+extern "C" {
+void
+ResetOptimizerProfile()
+{
+	COptTasks::ResetOptimizerProfile();
+}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		InitGPOPT()
@@ -16,6 +16,7 @@
 extern "C" {
 #include "postgres.h"
 
+#include "cdb/cdbvars.h"
 #include "utils/guc.h"
 }
 
@@ -88,6 +89,30 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT("Generate optimizer minidump.")},
 
+	{EopttraceMinidumpBinary, &optimizer_minidump_binary,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Write optimizer minidumps in binary DXL.")},
+
+	{EopttraceEnableRuntimeFilter, &gp_enable_runtime_filter,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Cost hash joins pushing runtime filters into their outer scan.")},
+
+	{EopttraceEnableMemoize, &optimizer_enable_memoize,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Cache the rows of parameterized inner scans and correlated subplans.")},
+
+	{EopttraceEnableIncrementalSort, &optimizer_enable_incremental_sort,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Sort inputs already sorted on a prefix of the required order incrementally.")},
+
+	{EopttraceEnableAOCSBlockSkipping, &gp_enable_aocs_block_skipping,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Cost AOCS scans skipping varblocks using their zone maps.")},
+
+	{EopttraceEnableSkewRedistribute, &optimizer_enable_skew_redistribute,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Spread the heavy hitters of hash join inputs over all segments.")},
+
 	{EopttraceDisableMotions, &optimizer_enable_motions,
 	 true,	// m_negate_param
 	 GPOS_WSZ_LIT("Disable motion nodes in optimizer.")},
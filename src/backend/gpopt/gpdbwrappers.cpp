@@ -42,12 +42,14 @@ extern "C" {
 #include "optimizer/clauses.h"
 #include "optimizer/optimizer.h"
 #include "optimizer/plancat.h"
+#include "optimizer/planmain.h"
 #include "optimizer/subselect.h"
 #include "parser/parse_agg.h"
 #include "partitioning/partdesc.h"
 #include "storage/lmgr.h"
 #include "utils/fmgroids.h"
 #include "utils/memutils.h"
+#include "utils/orcamdcache.h"
 #include "utils/partcache.h"
 }
 #define GP_WRAP_START                                            \
@@ -379,6 +381,21 @@ gpdb::CopyObject(void *from)
 	return nullptr;
 }
 
+void *
+gpdb::CopyObjectInContext(MemoryContext context, void *from)
+{
+	GP_WRAP_START;
+	{
+		MemoryContext oldcxt = MemoryContextSwitchTo(context);
+		void *result = copyObjectImpl(from);
+		MemoryContextSwitchTo(oldcxt);
+
+		return result;
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 Size
 gpdb::DatumSize(Datum value, bool type_by_val, int iTypLen)
 {
@@ -2410,6 +2427,53 @@ gpdb::MDCacheNeedsReset(void)
 	return true;
 }
 
+/*
+ * The shared metadata cache (see utils/cache/orcamdcache.c) complements the
+ * per-backend metadata cache: it holds the binary DXL of objects translated by any
+ * backend, and drops the objects that committed catalog changes affect.
+ */
+bool
+gpdb::MDSharedCacheEnabled(void)
+{
+	// No GP_WRAP_START/END needed here, it cannot throw an ereport().
+	return OrcaMDCacheEnabled();
+}
+
+uint64
+gpdb::MDSharedCacheGetGeneration(void)
+{
+	GP_WRAP_START;
+	{
+		return OrcaMDCacheGetGeneration();
+	}
+	GP_WRAP_END;
+
+	return 0;
+}
+
+char *
+gpdb::MDSharedCacheLookup(const char *key, Size *len)
+{
+	GP_WRAP_START;
+	{
+		return OrcaMDCacheLookup(key, len);
+	}
+	GP_WRAP_END;
+
+	return nullptr;
+}
+
+void
+gpdb::MDSharedCacheInsert(const char *key, uint64 generation, Oid relid,
+						  AttrNumber attnum, const char *value, Size len)
+{
+	GP_WRAP_START;
+	{
+		OrcaMDCacheInsert(key, generation, relid, attnum, value, len);
+	}
+	GP_WRAP_END;
+}
+
 // returns true if a query cancel is requested in GPDB
 bool
 gpdb::IsAbortRequested(void)
@@ -2538,6 +2602,30 @@ gpdb::GPDBAllocSetContextCreate()
 	return nullptr;
 }
 
+MemoryContext
+gpdb::GPDBArenaContextCreate()
+{
+	GP_WRAP_START;
+	{
+		MemoryContext cxt;
+
+		/*
+		 * Arena pools only palloc their slabs from this context and carve
+		 * the individual objects out of them, see CMemoryPoolPallocArena.
+		 * Slabs are larger than the chunk limit, so every slab is a block
+		 * of its own and is returned to malloc() when it is freed.
+		 */
+		cxt = AllocSetContextCreate(OptimizerMemoryContext,
+									"GPORCA arena memory pool",
+									ALLOCSET_DEFAULT_SIZES);
+		MemoryContextDeclareAccountingRoot(cxt);
+
+		return cxt;
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 bool
 gpdb::ExpressionReturnsSet(Node *clause)
 {
@@ -2754,4 +2842,16 @@ gpdb::TestexprIsHashable(Node *testexpr, List *param_ids)
 	return false;
 }
 
+Memoize *
+gpdb::MakeMemoizeForParams(Plan *lefttree, List *param_exprs, double calls)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_type, pg_operator, pg_amop, pg_proc */
+		return make_memoize_for_params(lefttree, param_exprs, calls);
+	}
+	GP_WRAP_END;
+	return nullptr;
+}
+
 // EOF
@@ -17,16 +17,32 @@
 extern "C" {
 #include "postgres.h"
 }
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRg.h"
+
+#include "gpopt/gpdbwrappers.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/relcache/CMDProviderRelcache.h"
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/exception.h"
+#include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdRelStats.h"
+#include "naucrates/md/IMDRelation.h"
 
 using namespace gpos;
 using namespace gpdxl;
 using namespace gpmd;
 
+CMDProviderRelcache::CMDProviderRelcache()
+	: m_use_shared_cache(gpdb::MDSharedCacheEnabled()), m_shared_generation(0)
+{
+	if (m_use_shared_cache)
+	{
+		m_shared_generation = gpdb::MDSharedCacheGetGeneration();
+	}
+}
+
 CWStringBase *
 CMDProviderRelcache::GetMDObjDXLStr(CMemoryPool *mp, CMDAccessor *md_accessor,
 									IMDId *md_id) const
@@ -35,15 +51,93 @@ CMDProviderRelcache::GetMDObjDXLStr(CMemoryPool *mp, CMDAccessor *md_accessor,
 	return nullptr;
 }
 
+// find the relation described by an object, and the column for column
+// statistics; the shared cache only drops such objects when that relation
+// or the statistics of that column change
+static void
+GetSharedCacheRel(CMDAccessor *md_accessor, IMDId *mdid,
+				  IMDCacheObject::Emdtype mdtype, OID *relid,
+				  AttrNumber *attnum)
+{
+	switch (mdtype)
+	{
+		case IMDCacheObject::EmdtRel:
+		case IMDCacheObject::EmdtInd:
+		{
+			*relid = CMDIdGPDB::CastMdid(mdid)->Oid();
+			break;
+		}
+		case IMDCacheObject::EmdtRelStats:
+		{
+			IMDId *mdid_rel = CMDIdRelStats::CastMdid(mdid)->GetRelMdId();
+			*relid = CMDIdGPDB::CastMdid(mdid_rel)->Oid();
+			break;
+		}
+		case IMDCacheObject::EmdtColStats:
+		{
+			CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(mdid);
+			IMDId *mdid_rel = mdid_col_stats->GetRelMdId();
+			const IMDRelation *md_rel = md_accessor->RetrieveRel(mdid_rel);
+			*relid = CMDIdGPDB::CastMdid(mdid_rel)->Oid();
+			*attnum = (AttrNumber) md_rel->GetMdCol(mdid_col_stats->Position())
+						  ->AttrNum();
+			break;
+		}
+		default:
+			// not tied to a relation
+			break;
+	}
+}
+
 // return the requested metadata object
 IMDCacheObject *
 CMDProviderRelcache::GetMDObj(CMemoryPool *mp, CMDAccessor *md_accessor,
 							  IMDId *mdid, IMDCacheObject::Emdtype mdtype) const
 {
+	// CTAS objects have a fixed id, so they must never be shared
+	if (!m_use_shared_cache || IMDId::EmdidGPDBCtas == mdid->MdidType())
+	{
+		IMDCacheObject *md_obj = CTranslatorRelcacheToDXL::RetrieveObject(
+			mp, md_accessor, mdid, mdtype);
+		GPOS_ASSERT(nullptr != md_obj);
+
+		return md_obj;
+	}
+
+	// the same generic mdid may denote objects of different types
+	CWStringDynamic key_str(mp);
+	key_str.AppendFormat(GPOS_WSZ_LIT("%d:%ls"), mdtype, mdid->GetBuffer());
+	CAutoRg<CHAR> key;
+	key = CDXLUtils::CreateMultiByteCharStringFromWCString(
+		mp, key_str.GetBuffer());
+
+	// objects are shared in binary DXL, which is decoded without Xerces
+	Size cached_size = 0;
+	char *cached_dxl = gpdb::MDSharedCacheLookup(key.Rgt(), &cached_size);
+	if (nullptr != cached_dxl)
+	{
+		IMDCacheObject *md_obj = CDXLUtils::ParseDXLBinaryToIMDIdCacheObj(
+			mp, (const BYTE *) cached_dxl, (ULONG) cached_size);
+		gpdb::GPDBFree(cached_dxl);
+		GPOS_ASSERT(nullptr != md_obj);
+
+		return md_obj;
+	}
+
 	IMDCacheObject *md_obj =
 		CTranslatorRelcacheToDXL::RetrieveObject(mp, md_accessor, mdid, mdtype);
 	GPOS_ASSERT(nullptr != md_obj);
 
+	ULONG binary_size = 0;
+	CAutoRg<BYTE> binary_dxl;
+	binary_dxl = CDXLUtils::SerializeMDObjToBinary(mp, md_obj, &binary_size);
+
+	OID relid = InvalidOid;
+	AttrNumber attnum = InvalidAttrNumber;
+	GetSharedCacheRel(md_accessor, mdid, mdtype, &relid, &attnum);
+	gpdb::MDSharedCacheInsert(key.Rgt(), m_shared_generation, relid, attnum,
+							  (const char *) binary_dxl.Rgt(), binary_size);
+
 	return md_obj;
 }
 
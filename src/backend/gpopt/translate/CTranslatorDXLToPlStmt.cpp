@@ -2074,6 +2074,29 @@ CTranslatorDXLToPlStmt::TranslateDXLNLJoin(
 		((NestLoop *) plan)->nestParams = TranslateNestLoopParamList(
 			dxl_nlj->GetNestLoopParamsColRefs(), &left_dxl_translate_ctxt,
 			&right_dxl_translate_ctxt);
+
+		// cache the index scan results per distinct value of the params,
+		// if the optimizer expects enough of the rescans to hit the cache
+		if (dxl_nlj->FMemoize())
+		{
+			List *param_exprs = NIL;
+			ListCell *lc;
+			ForEach(lc, ((NestLoop *) plan)->nestParams)
+			{
+				NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+				Param *param = MakeNode(Param);
+				param->paramkind = PARAM_EXEC;
+				param->paramid = nlp->paramno;
+				param->paramtype = gpdb::ExprType((Node *) nlp->paramval);
+				param->paramtypmod = gpdb::ExprTypeMod((Node *) nlp->paramval);
+				param->paramcollid =
+					gpdb::ExprCollation((Node *) nlp->paramval);
+				param_exprs = gpdb::LAppend(param_exprs, param);
+			}
+			right_plan = MemoizeRescannedPlan(right_plan, param_exprs,
+											  left_plan->plan_rows,
+											  false /* singlerow */);
+		}
 	}
 	plan->lefttree = left_plan;
 	plan->righttree = right_plan;
@@ -2086,6 +2109,43 @@ CTranslatorDXLToPlStmt::TranslateDXLNLJoin(
 	return (Plan *) nested_loop;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::MemoizeRescannedPlan
+//
+//	@doc:
+//		Put a Memoize node over a plan that is rescanned with new values of
+//		the given PARAM_EXEC params, such as the inner side of an index
+//		nested loop join or the plan of a correlated subplan, so that
+//		rescans with param values seen before return the cached rows.
+//		The optimizer decides which joins and subplans to memoize, see
+//		CTranslatorExprToDXL::FMemoizeInnerChild. Returns the plan unchanged
+//		if it can't be memoized.
+//
+//---------------------------------------------------------------------------
+Plan *
+CTranslatorDXLToPlStmt::MemoizeRescannedPlan(Plan *plan, List *param_exprs,
+											 DOUBLE num_rescans,
+											 BOOL singlerow)
+{
+	if (NIL == param_exprs)
+	{
+		return plan;
+	}
+
+	Memoize *memoize =
+		gpdb::MakeMemoizeForParams(plan, param_exprs, num_rescans);
+	if (nullptr == memoize)
+	{
+		return plan;
+	}
+
+	memoize->plan.plan_node_id = m_dxl_to_plstmt_context->GetNextPlanId();
+	memoize->singlerow = singlerow;
+
+	return (Plan *) memoize;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorDXLToPlStmt::TranslateDXLMergeJoin
@@ -2540,6 +2600,34 @@ CTranslatorDXLToPlStmt::TranslateDXLMotion(
 			motion->numHashSegments =
 				(int) motion_dxlop->GetOutputSegIdsArray()->Size();
 			GPOS_ASSERT(motion->numHashSegments > 0);
+
+			// the hot keys of a skew-aware motion follow the relational child
+			EdxlSkewMode skew_mode =
+				(EdxlopPhysicalMotionRedistribute ==
+				 motion_dxlop->GetDXLOperator())
+					? CDXLPhysicalRedistributeMotion::Cast(motion_dxlop)
+						  ->GetSkewMode()
+					: EdxlskewNone;
+			if (EdxlskewNone != skew_mode)
+			{
+				motion->skewMode = (EdxlskewSpread == skew_mode)
+									   ? MOTIONSKEW_SPREAD
+									   : MOTIONSKEW_BROADCAST;
+
+				CDXLNode *hot_keys_dxlnode =
+					(*motion_dxlnode)[EdxlrmIndexSkewHotKeys];
+				for (ULONG ul = 0; ul < hot_keys_dxlnode->Arity(); ul++)
+				{
+					CDXLScalarConstValue *const_dxlop =
+						CDXLScalarConstValue::Cast(
+							(*hot_keys_dxlnode)[ul]->GetOperator());
+					Expr *const_expr =
+						m_translator_dxl_to_scalar->TranslateDXLDatumToScalar(
+							const_cast<CDXLDatum *>(const_dxlop->GetDatumVal()));
+					motion->skewHotKeys = gpdb::LAppend(
+						motion->skewHotKeys, ListMake1(const_expr));
+				}
+			}
 			break;
 		}
 		case EdxlopPhysicalMotionBroadcast:
@@ -3224,8 +3312,22 @@ CTranslatorDXLToPlStmt::TranslateDXLSort(
 	GPOS_ASSERT(EdxlopPhysicalSort ==
 				sort_dxlnode->GetOperator()->GetDXLOperator());
 
-	// create sort plan node
-	Sort *sort = MakeNode(Sort);
+	CDXLPhysicalSort *dxl_sort =
+		CDXLPhysicalSort::Cast(sort_dxlnode->GetOperator());
+
+	// create sort plan node, sorting only within the groups of the
+	// presorted columns if the input is already sorted on a prefix
+	Sort *sort;
+	if (0 < dxl_sort->PresortedCols())
+	{
+		IncrementalSort *incremental_sort = MakeNode(IncrementalSort);
+		incremental_sort->nPresortedCols = dxl_sort->PresortedCols();
+		sort = &(incremental_sort->sort);
+	}
+	else
+	{
+		sort = MakeNode(Sort);
+	}
 
 	Plan *plan = &(sort->plan);
 	plan->plan_node_id = m_dxl_to_plstmt_context->GetNextPlanId();
@@ -894,6 +894,29 @@ CTranslatorDXLToScalar::TranslateDXLScalarSubplanToScalar(
 	GPOS_ASSERT(nullptr != plan_child->targetlist &&
 				1 <= gpdb::ListLength(plan_child->targetlist));
 
+	// cache the subplan results per distinct value of the outer refs, if
+	// the optimizer asked for it, for the sublinks that read the subplan to
+	// the end, or only its first row for [NOT] EXISTS; ANY and ALL may stop
+	// anywhere in between
+	const BOOL is_exists =
+		(EXISTS_SUBLINK == slink || NOT_EXISTS_SUBLINK == slink);
+	if (dxlop->FMemoize() && 0 < len &&
+		(EXPR_SUBLINK == slink || ARRAY_SUBLINK == slink || is_exists))
+	{
+		List *param_exprs = NIL;
+		for (ULONG ul = 0; ul < len; ul++)
+		{
+			param_exprs = gpdb::LAppend(
+				param_exprs,
+				TranslateParamFromMapping(
+					subplan_translate_ctxt.GetParamIdMappingElement(
+						(*outer_refs)[ul]->Id())));
+		}
+		plan_child = dxl_to_plstmt_translator.MemoizeRescannedPlan(
+			plan_child, param_exprs, 0.0 /* num_rescans, unknown */,
+			is_exists);
+	}
+
 	// translate subplan and set test expression
 	SubPlan *subplan =
 		TranslateSubplanFromChildPlan(plan_child, slink, dxl_to_plstmt_ctxt);
@@ -50,6 +50,7 @@ CMemoryPoolPalloc::NewImpl(const ULONG bytes, const CHAR *, const ULONG,
 		SArrayAllocHeader *header = static_cast<SArrayAllocHeader *>(ptr);
 
 		header->m_user_size = bytes;
+		header->m_tag = 0;
 		return static_cast<BYTE *>(ptr) +
 			   GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader);
 	}
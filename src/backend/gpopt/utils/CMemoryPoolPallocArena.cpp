@@ -0,0 +1,51 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolPallocArena.cpp
+//
+//	@doc:
+//		Bump-pointer memory pool whose slabs come from a PostgreSQL memory
+//		context
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include "postgres.h"
+
+#include "utils/memutils.h"
+}
+
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/utils/CMemoryPoolPallocArena.h"
+
+using namespace gpos;
+
+// ctor
+CMemoryPoolPallocArena::CMemoryPoolPallocArena()
+{
+	m_cxt = gpdb::GPDBArenaContextCreate();
+}
+
+void *
+CMemoryPoolPallocArena::AllocSlab(ULLONG size)
+{
+	return gpdb::GPDBMemoryContextAlloc(m_cxt, size);
+}
+
+void
+CMemoryPoolPallocArena::FreeSlab(void *slab)
+{
+	gpdb::GPDBFree(slab);
+}
+
+// Prepare the memory pool to be deleted
+void
+CMemoryPoolPallocArena::TearDown()
+{
+	CMemoryPoolArena::TearDown();
+	gpdb::GPDBMemoryContextDelete(m_cxt);
+}
+
+// EOF
@@ -7,7 +7,7 @@
 //
 //	@doc:
 //		MemoryPoolManager implementation that creates
-//		CMemoryPoolPalloc memory pools
+//		CMemoryPoolPalloc and CMemoryPoolPallocArena memory pools
 //
 //---------------------------------------------------------------------------
 
@@ -18,6 +18,7 @@ extern "C" {
 }
 
 #include "gpopt/utils/CMemoryPoolPalloc.h"
+#include "gpopt/utils/CMemoryPoolPallocArena.h"
 #include "gpopt/utils/CMemoryPoolPallocManager.h"
 
 using namespace gpos;
@@ -36,10 +37,26 @@ CMemoryPoolPallocManager::NewMemoryPool()
 	return GPOS_NEW(GetInternalMemoryPool()) CMemoryPoolPalloc();
 }
 
+// create new bump-pointer memory pool
+CMemoryPool *
+CMemoryPoolPallocManager::NewArenaMemoryPool()
+{
+	return GPOS_NEW(GetInternalMemoryPool()) CMemoryPoolPallocArena();
+}
+
+// Arena allocations are told apart by the tag preceding them. For palloc'd
+// memory that word is either zeroed (arrays) or the upper half of the chunk
+// header's context pointer, which never matches the tag.
 void
 CMemoryPoolPallocManager::DeleteImpl(void *ptr,
 									 CMemoryPool::EAllocationType eat)
 {
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		CMemoryPoolArena::DeleteImpl(ptr, eat);
+		return;
+	}
+
 	CMemoryPoolPalloc::DeleteImpl(ptr, eat);
 }
 
@@ -47,6 +64,11 @@ CMemoryPoolPallocManager::DeleteImpl(void *ptr,
 ULONG
 CMemoryPoolPallocManager::UserSizeOfAlloc(const void *ptr)
 {
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		return CMemoryPoolArena::UserSizeOfAlloc(ptr);
+	}
+
 	return CMemoryPoolPalloc::UserSizeOfAlloc(ptr);
 }
 
@@ -15,8 +15,11 @@
 
 #include "gpopt/utils/COptTasks.h"
 
+#include <algorithm>
+
 extern "C" {
 #include "cdb/cdbvars.h"
+#include "miscadmin.h"
 #include "optimizer/hints.h"
 #include "optimizer/orca.h"
 #include "utils/fmgroids.h"
@@ -37,6 +40,7 @@ extern "C" {
 #include "gpopt/config/CConfigParamMapping.h"
 #include "gpopt/engine/CCTEConfig.h"
 #include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/engine/CHint.h"
 #include "gpopt/engine/CStatisticsConfig.h"
 #include "gpopt/eval/CConstExprEvaluatorDXL.h"
@@ -57,6 +61,7 @@ extern "C" {
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
 #include "gpopt/translate/CTranslatorUtils.h"
 #include "gpopt/utils/CConstExprEvaluatorProxy.h"
+#include "gpopt/utils/CPlanCache.h"
 #include "gpopt/utils/gpdbdefs.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "naucrates/base/CQueryToDXLResult.h"
@@ -82,14 +87,21 @@ using namespace gpdbcost;
 // size of error buffer
 #define GPOPT_ERROR_BUFFER_SIZE 10 * 1024 * 1024
 
-// definition of default AutoMemoryPool
-#define AUTO_MEM_POOL(amp) CAutoMemoryPool amp(CAutoMemoryPool::ElcExc)
 
 // default id for the source system
 const CSystemId default_sysid(IMDId::EmdidGeneral, GPOS_WSZ_STR_LENGTH("GPDB"));
 
 plan_hint_hook_type plan_hint_hook = nullptr;
 
+// per-xform and per-job counters of the last optimization request of this
+// backend
+static COptimizationProfile query_profile;
+
+// counters of all earlier optimization requests since the last reset; the
+// last request is folded in when the next one starts, so that it is counted
+// even if it raised an error
+static COptimizationProfile workload_profile;
+
 // Check one-to-one mapping of row hint types
 GPOS_CPL_ASSERT(CRowHint::RVT_ABSOLUTE ==
 					(CRowHint::RowsValueType) RVT_ABSOLUTE,
@@ -309,6 +321,50 @@ COptTasks::ConvertToPlanStmtFromDXL(
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::IsPlanCacheable
+//
+//	@doc:
+//		Can the plan of the given query be reused from the plan cache? The
+//		key only covers the query and the optimizer configuration, so plans
+//		that depend on anything else are not cached: the target of a
+//		CREATE TABLE AS, the foreign data wrapper of a foreign table, and
+//		the row level security policies applied for the current role
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::IsPlanCacheable(const Query *query, const PlannedStmt *plan_stmt)
+{
+	GPOS_ASSERT(nullptr != query);
+	GPOS_ASSERT(nullptr != plan_stmt);
+
+	if (PARENTSTMTTYPE_NONE != query->parentStmtType || !query->canSetTag)
+	{
+		return false;
+	}
+
+	ListCell *lc = nullptr;
+	ForEach(lc, plan_stmt->rtable)
+	{
+		RangeTblEntry *rte = (RangeTblEntry *) lfirst(lc);
+		if (RTE_RELATION != rte->rtekind)
+		{
+			continue;
+		}
+
+		gpdb::RelationWrapper rel = gpdb::GetRelation(rte->relid);
+		if (RELKIND_FOREIGN_TABLE == rel->rd_rel->relkind ||
+			rel->rd_rel->relrowsecurity)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::LoadSearchStrategy
@@ -386,6 +442,9 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model,
 		(ULONG) optimizer_push_group_by_below_setop_threshold;
 	ULONG xform_bind_threshold = (ULONG) optimizer_xform_bind_threshold;
 	ULONG skew_factor = (ULONG) optimizer_skew_factor;
+	ULONG search_time_budget = (ULONG) optimizer_search_time_budget;
+	// a Memoize cache gets a share of the statement memory
+	ULONG memoize_memory_limit = (ULONG) statement_mem;
 
 	return GPOS_NEW(mp) COptimizerConfig(
 		GPOS_NEW(mp)
@@ -401,7 +460,7 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model,
 				  false, /* don't create Assert nodes for constraints, we'll
 								      * enforce them ourselves in the executor */
 				  push_group_by_below_setop_threshold, xform_bind_threshold,
-				  skew_factor),
+				  skew_factor, search_time_budget, memoize_memory_limit),
 		plan_hints,
 		GPOS_NEW(mp) CWindowOids(OID(F_WINDOW_ROW_NUMBER), OID(F_WINDOW_RANK)));
 }
@@ -856,7 +915,8 @@ COptTasks::OptimizeTask(void *ptr)
 	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_dxl);
 	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_stmt);
 
-	AUTO_MEM_POOL(amp);
+	// all objects allocated during optimization die with the task
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, CMemoryPoolManager::EpkArena);
 	CMemoryPool *mp = amp.Pmp();
 
 	// Does the metadatacache need to be reset?
@@ -884,6 +944,32 @@ COptTasks::OptimizeTask(void *ptr)
 		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
 	}
 
+	// cached plans are only valid as long as the metadata they were
+	// produced from, so purge them along with the metadata cache
+	if (CPlanCache::FInitialized() &&
+		(reset_mdcache || 0 == optimizer_plan_cache_size))
+	{
+		CPlanCache::Shutdown();
+	}
+	if (0 < optimizer_plan_cache_size)
+	{
+		if (!CPlanCache::FInitialized())
+		{
+			CPlanCache::Init(optimizer_plan_cache_size * 1024L);
+		}
+		else
+		{
+			CPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+		}
+	}
+
+	// a cache hit skips optimization and translation, so do not use cached
+	// plans when a minidump of every optimization or the plan DXL is
+	// requested
+	BOOL use_plan_cache = CPlanCache::FInitialized() &&
+						  OPTIMIZER_MINIDUMP_ALWAYS != optimizer_minidump &&
+						  opt_ctxt->m_should_generate_plan_stmt &&
+						  !opt_ctxt->m_should_serialize_plan_dxl;
 
 	// load search strategy
 	CSearchStageArray *search_strategy_arr =
@@ -953,10 +1039,65 @@ COptTasks::OptimizeTask(void *ptr)
 			CAutoTraceFlag atf2(EopttraceUseLegacyOpfamilies,
 								use_legacy_opfamilies);
 
-			plan_dxl = COptimizer::PdxlnOptimize(
-				mp, &mda, query_dxl, query_output_dxlnode_array,
-				cte_dxlnode_array, expr_evaluator, num_segments, gp_session_id,
-				gp_command_count, search_strategy_arr, optimizer_config);
+			// statistics of the optimization request, including the search
+			// stage cut off by the search time budget, if any, and the
+			// per-xform and per-job profile
+			SOptimizationStats optimization_stats;
+			workload_profile.Add(query_profile);
+			query_profile.Reset();
+			optimization_stats.m_pprofile = &query_profile;
+
+			// the key is built after setting all trace flags, which are
+			// part of it
+			CAutoP<CWStringDynamic> plan_cache_key;
+			CAutoP<CPlanCache::PlanCacheAccessor> plan_cache_accessor;
+			CPlanCacheEntry *plan_cache_entry = nullptr;
+			CStatisticsConfig *stats_conf = optimizer_config->GetStatsConf();
+			if (use_plan_cache)
+			{
+				plan_cache_key = CPlanCache::PstrKey(
+					mp, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, optimizer_config, num_segments,
+					optimizer_search_strategy_path);
+				// the translation to a planned statement depends on it
+				plan_cache_key->AppendFormat(
+					GPOS_WSZ_LIT("<DirectDispatch Enabled=\"%d\"/>"),
+					optimizer_enable_direct_dispatch);
+				plan_cache_accessor = GPOS_NEW(mp)
+					CPlanCache::PlanCacheAccessor(CPlanCache::Pcache());
+				plan_cache_entry = CPlanCache::PentryLookup(
+					plan_cache_accessor.Value(), plan_cache_key.Value());
+			}
+
+			if (nullptr != plan_cache_entry)
+			{
+				// the caller post-processes the plan in place, so hand it a
+				// copy of the cached one
+				opt_ctxt->m_plan_stmt = (PlannedStmt *) gpdb::CopyObject(
+					plan_cache_entry->PplstmtPlan());
+				opt_ctxt->m_plan_stmt->optimizerPlanCacheHit = true;
+
+				// report the columns with missing statistics as if the
+				// query had been optimized
+				IMdIdArray *missing_col_stats =
+					plan_cache_entry->PdrgpmdidMissingColStats();
+				for (ULONG ul = 0; ul < missing_col_stats->Size(); ul++)
+				{
+					CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(
+						(*missing_col_stats)[ul]->Copy(mp));
+					stats_conf->AddMissingStatsColumn(mdid_col_stats);
+					mdid_col_stats->Release();
+				}
+			}
+			else
+			{
+				plan_dxl = COptimizer::PdxlnOptimize(
+					mp, &mda, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, expr_evaluator, num_segments,
+					gp_session_id, gp_command_count, search_strategy_arr,
+					optimizer_config, nullptr /*szMinidumpFileName*/,
+					&optimization_stats);
+			}
 
 			if (opt_ctxt->m_should_serialize_plan_dxl)
 			{
@@ -973,7 +1114,7 @@ COptTasks::OptimizeTask(void *ptr)
 			}
 
 			// translate DXL->PlStmt only when needed
-			if (opt_ctxt->m_should_generate_plan_stmt)
+			if (opt_ctxt->m_should_generate_plan_stmt && nullptr != plan_dxl)
 			{
 				// always use opt_ctxt->m_query->can_set_tag as the query_to_dxl_translator->Pquery() is a mutated Query object
 				// that may not have the correct can_set_tag
@@ -982,9 +1123,29 @@ COptTasks::OptimizeTask(void *ptr)
 						mp, &mda, opt_ctxt->m_query, plan_dxl,
 						opt_ctxt->m_query->canSetTag,
 						query_to_dxl_translator->GetDistributionHashOpsKind()));
+
+				if (gpos::ulong_max != optimization_stats.m_ulCutoffSearchStage)
+				{
+					opt_ctxt->m_plan_stmt->optimizerCutoffStage =
+						(int) optimization_stats.m_ulCutoffSearchStage + 1;
+				}
+
+				// don't cache plans of a search that was cut off, a later
+				// search might get further
+				if (use_plan_cache &&
+					gpos::ulong_max ==
+						optimization_stats.m_ulCutoffSearchStage &&
+					IsPlanCacheable(opt_ctxt->m_query, opt_ctxt->m_plan_stmt))
+				{
+					IMdIdArray *missing_col_stats = GPOS_NEW(mp) IMdIdArray(mp);
+					stats_conf->CollectMissingStatsColumns(missing_col_stats);
+					CPlanCache::Insert(plan_cache_key.Value(),
+									   opt_ctxt->m_plan_stmt,
+									   missing_col_stats);
+					missing_col_stats->Release();
+				}
 			}
 
-			CStatisticsConfig *stats_conf = optimizer_config->GetStatsConf();
 			col_stats = GPOS_NEW(mp) IMdIdArray(mp);
 			stats_conf->CollectMissingStatsColumns(col_stats);
 
@@ -997,7 +1158,7 @@ COptTasks::OptimizeTask(void *ptr)
 			expr_evaluator->Release();
 			query_dxl->Release();
 			optimizer_config->Release();
-			plan_dxl->Release();
+			CRefCount::SafeRelease(plan_dxl);
 		}
 	}
 	GPOS_CATCH_EX(ex)
@@ -1175,4 +1336,98 @@ COptTasks::SetXform(char *xform_str, bool should_disable)
 	return false;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::GetOptimizerProfile
+//
+//	@doc:
+//		Return the non-zero counters of the optimization profile as a list
+//		of OptimizerProfileEntry, xforms first, most expensive first,
+//		followed by job types; the profile covers the last optimization
+//		request or, if cumulative is set, all requests since the last reset
+//
+//---------------------------------------------------------------------------
+List *
+COptTasks::GetOptimizerProfile(bool cumulative)
+{
+	COptimizationProfile profile;
+	profile.Add(query_profile);
+	if (cumulative)
+	{
+		profile.Add(workload_profile);
+	}
+
+	OptimizerProfileEntry *xform_entries = (OptimizerProfileEntry *)
+		gpdb::GPDBAlloc(CXform::ExfSentinel * sizeof(OptimizerProfileEntry));
+	ULONG num_xform_entries = 0;
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		CXform::EXformId exfid = (CXform::EXformId) ul;
+		const COptimizationProfile::SXformCounters &counters =
+			profile.Xform(exfid);
+		if (0 == counters.m_ullCalls)
+		{
+			continue;
+		}
+
+		OptimizerProfileEntry *entry = &xform_entries[num_xform_entries++];
+		entry->kind = "xform";
+		entry->name = PStrDup(CXformFactory::Pxff()->Pxf(exfid)->SzId());
+		entry->calls = (int64) counters.m_ullCalls;
+		entry->time_ms = (double) counters.m_ullTimeUS / GPOS_USEC_IN_MSEC;
+		entry->alternatives = (int64) counters.m_ullAlternatives;
+		entry->memo_inserts = (int64) counters.m_ullMemoInserts;
+	}
+
+	std::sort(xform_entries, xform_entries + num_xform_entries,
+			  [](const OptimizerProfileEntry &left,
+				 const OptimizerProfileEntry &right) {
+				  return left.time_ms > right.time_ms;
+			  });
+
+	List *entries = NIL;
+	for (ULONG ul = 0; ul < num_xform_entries; ul++)
+	{
+		entries = gpdb::LAppend(entries, &xform_entries[ul]);
+	}
+
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		CJob::EJobType ejt = (CJob::EJobType) ul;
+		const COptimizationProfile::SJobCounters &counters = profile.Job(ejt);
+		if (0 == counters.m_ullExecutions)
+		{
+			continue;
+		}
+
+		OptimizerProfileEntry *entry =
+			(OptimizerProfileEntry *) gpdb::GPDBAlloc(
+				sizeof(OptimizerProfileEntry));
+		entry->kind = "job";
+		entry->name = PStrDup(COptimizationProfile::SzJobType(ejt));
+		entry->calls = (int64) counters.m_ullExecutions;
+		entry->time_ms = (double) counters.m_ullTimeUS / GPOS_USEC_IN_MSEC;
+		entry->alternatives = 0;
+		entry->memo_inserts = 0;
+		entries = gpdb::LAppend(entries, entry);
+	}
+
+	return entries;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ResetOptimizerProfile
+//
+//	@doc:
+//		Clear the optimization profile of this backend
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::ResetOptimizerProfile()
+{
+	query_profile.Reset();
+	workload_profile.Reset();
+}
+
 // EOF
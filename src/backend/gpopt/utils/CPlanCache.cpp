@@ -0,0 +1,322 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPlanCache.cpp
+//
+//	@doc:
+//		Implementation of the backend-local cache of optimizer plans
+//
+//	@test:
+//
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include "postgres.h"
+}
+
+#include "gpopt/utils/CPlanCache.h"
+
+#include "gpos/io/COstreamString.h"
+#include "gpos/memory/CCacheFactory.h"
+#include "gpos/task/CTask.h"
+#include "gpos/utils.h"
+
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpopt/utils/CMemoryPoolPalloc.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpos;
+using namespace gpdxl;
+using namespace gpopt;
+
+// global instance of plan cache
+CPlanCache::PlanCache *CPlanCache::m_pcache = nullptr;
+
+// cache statistics
+ULLONG CPlanCache::m_ullHits = 0;
+ULLONG CPlanCache::m_ullMisses = 0;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::CPlanCacheKey
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPlanCacheKey::CPlanCacheKey(const CWStringBase *str)
+	: m_str(str),
+	  m_hash(gpos::HashByteArray((const BYTE *) str->GetBuffer(),
+								 str->Length() * GPOS_SIZEOF(WCHAR)))
+{
+	GPOS_ASSERT(nullptr != str);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::FEqualPlanKey
+//
+//	@doc:
+//		Equality function for using plan keys in a cache
+//
+//---------------------------------------------------------------------------
+BOOL
+CPlanCacheKey::FEqualPlanKey(CPlanCacheKey *const &pkeyLeft,
+							 CPlanCacheKey *const &pkeyRight)
+{
+	GPOS_ASSERT(nullptr != pkeyLeft && nullptr != pkeyRight);
+
+	return pkeyLeft->m_hash == pkeyRight->m_hash &&
+		   pkeyLeft->m_str->Equals(pkeyRight->m_str);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheKey::UlHashPlanKey
+//
+//	@doc:
+//		Hash function for using plan keys in a cache
+//
+//---------------------------------------------------------------------------
+ULONG
+CPlanCacheKey::UlHashPlanKey(CPlanCacheKey *const &pkey)
+{
+	GPOS_ASSERT(nullptr != pkey);
+
+	return pkey->m_hash;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheEntry::CPlanCacheEntry
+//
+//	@doc:
+//		Ctor; takes over the given plan and the reference of the given
+//		array
+//
+//---------------------------------------------------------------------------
+CPlanCacheEntry::CPlanCacheEntry(PlannedStmt *plan_stmt,
+								 IMdIdArray *missing_col_stats)
+	: m_plan_stmt(plan_stmt), m_missing_col_stats(missing_col_stats)
+{
+	GPOS_ASSERT(nullptr != plan_stmt);
+	GPOS_ASSERT(nullptr != missing_col_stats);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCacheEntry::~CPlanCacheEntry
+//
+//	@doc:
+//		Dtor; the plan is freed along with the memory context of the
+//		entry pool
+//
+//---------------------------------------------------------------------------
+CPlanCacheEntry::~CPlanCacheEntry()
+{
+	m_missing_col_stats->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Init
+//
+//	@doc:
+//		Initializes global instance
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Init(ULLONG ullCacheQuota)
+{
+	GPOS_ASSERT(nullptr == m_pcache && "Plan cache was already created");
+
+	m_pcache =
+		CCacheFactory::CreateCache<CPlanCacheEntry *, CPlanCacheKey *>(
+			true /*fUnique*/, ullCacheQuota, CPlanCacheKey::UlHashPlanKey,
+			CPlanCacheKey::FEqualPlanKey);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Shutdown
+//
+//	@doc:
+//		Cleans up the underlying cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Shutdown()
+{
+	GPOS_DELETE(m_pcache);
+	m_pcache = nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Reset
+//
+//	@doc:
+//		Drop all cached plans, keeping the current quota
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Reset()
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+
+	ULLONG ullCacheQuota = m_pcache->GetCacheQuota();
+	Shutdown();
+	Init(ullCacheQuota);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::SetCacheQuota
+//
+//	@doc:
+//		Set the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::SetCacheQuota(ULLONG ullCacheQuota)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+
+	if (m_pcache->GetCacheQuota() != ullCacheQuota)
+	{
+		m_pcache->SetCacheQuota(ullCacheQuota);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::PstrKey
+//
+//	@doc:
+//		Build the key text for an optimization request. Besides the query
+//		itself, the key covers the optimizer configuration (including cost
+//		model parameters, plan hints and the trace flags of the current
+//		task) and the remaining inputs of COptimizer::PdxlnOptimize().
+//		Catalog changes are not part of the key; callers reset the cache
+//		whenever the metadata cache is invalidated.
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+CPlanCache::PstrKey(CMemoryPool *mp, const CDXLNode *query_dxl,
+					const CDXLNodeArray *query_output_dxlnode_array,
+					const CDXLNodeArray *cte_dxlnode_array,
+					const COptimizerConfig *optimizer_config,
+					ULONG num_segments, const CHAR *search_strategy_path)
+{
+	GPOS_ASSERT(nullptr != query_dxl);
+	GPOS_ASSERT(nullptr != optimizer_config);
+
+	CWStringDynamic *pstrKey = GPOS_NEW(mp) CWStringDynamic(mp);
+	COstreamString oss(pstrKey);
+
+	CDXLUtils::SerializeQuery(mp, oss, query_dxl, query_output_dxlnode_array,
+							  cte_dxlnode_array, false /*fSerializeHeaders*/,
+							  false /*indentation*/);
+
+	{
+		CXMLSerializer xml_serializer(mp, oss, false /*Indent*/);
+		CBitSet *pbsTrace = CTask::Self()->GetTaskCtxt()->copy_trace_flags(mp);
+		optimizer_config->Serialize(mp, &xml_serializer, pbsTrace);
+		pbsTrace->Release();
+	}
+
+	oss << GPOS_WSZ_LIT("<Segments ") << num_segments << GPOS_WSZ_LIT("/>");
+
+	if (nullptr != search_strategy_path)
+	{
+		oss << GPOS_WSZ_LIT("<SearchStrategy ") << search_strategy_path
+			<< GPOS_WSZ_LIT("/>");
+	}
+
+	return pstrKey;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::PentryLookup
+//
+//	@doc:
+//		Look up the plan cached under the given key using the given
+//		accessor; the accessor pins the returned entry until it is destroyed
+//
+//---------------------------------------------------------------------------
+CPlanCacheEntry *
+CPlanCache::PentryLookup(PlanCacheAccessor *pacc, const CWStringBase *pstrKey)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+	GPOS_ASSERT(nullptr != pacc);
+
+	CPlanCacheKey key(pstrKey);
+	pacc->Lookup(&key);
+
+	CPlanCacheEntry *pentry = pacc->Val();
+	if (nullptr == pentry)
+	{
+		m_ullMisses++;
+	}
+	else
+	{
+		m_ullHits++;
+	}
+
+	return pentry;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Insert
+//
+//	@doc:
+//		Store a copy of the given plan under the given key. The key, the
+//		plan and the mdids of the columns with missing statistics are
+//		copied into the memory pool of the new cache entry, so they outlive
+//		the memory pool of the current optimization request. The plan is
+//		copied node by node into the memory context backing the entry pool,
+//		so it counts against the cache quota and is freed with the entry.
+//
+//---------------------------------------------------------------------------
+void
+CPlanCache::Insert(const CWStringBase *pstrKey, PlannedStmt *plan_stmt,
+				   const IMdIdArray *missing_col_stats)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Plan cache was not created");
+	GPOS_ASSERT(nullptr != plan_stmt);
+	GPOS_ASSERT(nullptr != missing_col_stats);
+
+	PlanCacheAccessor acc(m_pcache);
+	CMemoryPoolPalloc *pmpEntry = dynamic_cast<CMemoryPoolPalloc *>(acc.Pmp());
+	GPOS_ASSERT(nullptr != pmpEntry);
+
+	PlannedStmt *plan_stmt_copy = (PlannedStmt *) gpdb::CopyObjectInContext(
+		pmpEntry->GetMemoryContext(), plan_stmt);
+
+	IMdIdArray *missing_col_stats_copy =
+		GPOS_NEW(pmpEntry) IMdIdArray(pmpEntry);
+	for (ULONG ul = 0; ul < missing_col_stats->Size(); ul++)
+	{
+		missing_col_stats_copy->Append(
+			(*missing_col_stats)[ul]->Copy(pmpEntry));
+	}
+	CPlanCacheEntry *pentry = GPOS_NEW(pmpEntry)
+		CPlanCacheEntry(plan_stmt_copy, missing_col_stats_copy);
+
+	CWStringConst *pstrKeyCopy =
+		GPOS_NEW(pmpEntry) CWStringConst(pmpEntry, pstrKey->GetBuffer());
+	CPlanCacheKey *pkey = GPOS_NEW(pmpEntry) CPlanCacheKey(pstrKeyCopy);
+
+	// the cache entry takes over the reference of the copied entry; if an
+	// equal entry exists already, the accessor destroys the new entry pool
+	(void) acc.Insert(pkey, pentry);
+}
+
+// EOF
@@ -19,6 +19,7 @@
 #include "gpopt/cost/ICostModel.h"
 #include "gpopt/cost/ICostModelParams.h"
 #include "gpopt/operators/COperator.h"
+#include "gpopt/operators/CPhysicalSort.h"
 
 
 namespace gpdbcost
@@ -75,6 +76,18 @@ private:
 	// check if given operator is unary
 	static BOOL FUnary(COperator::EOperatorId op_id);
 
+	// check if a hash join pushes a runtime filter into its outer scan
+	static BOOL FRuntimeFilterScan(CExpressionHandle &exprhdl);
+
+	// check if the scan below a filter can skip varblocks using zone maps
+	static BOOL FZoneMapSkippingScan(CExpressionHandle &exprhdl);
+
+	// cost of the inner child of a nested loop join, scaled down to the
+	// rescans that miss the memoize cache over it
+	static CCost CostMemoizedInnerChild(const CCostModelGPDB *pcmgpdb,
+										CExpressionHandle &exprhdl,
+										const SCostingInfo *pci);
+
 	// cost of scan
 	static CCost CostScan(CMemoryPool *mp, CExpressionHandle &exprhdl,
 						  const CCostModelGPDB *pcmgpdb,
@@ -152,6 +165,12 @@ private:
 						  const CCostModelGPDB *pcmgpdb,
 						  const SCostingInfo *pci);
 
+	// cost of incremental sort
+	static CCost CostIncrementalSort(CMemoryPool *mp, CExpressionHandle &exprhdl,
+									 const CCostModelGPDB *pcmgpdb,
+									 const SCostingInfo *pci,
+									 CPhysicalSort *popSort);
+
 	// cost of TVF
 	static CCost CostTVF(CMemoryPool *mp, CExpressionHandle &exprhdl,
 						 const CCostModelGPDB *pcmgpdb,
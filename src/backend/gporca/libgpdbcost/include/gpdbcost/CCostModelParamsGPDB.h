@@ -108,6 +108,14 @@ public:
 		EcpIndexOnlyScanTupCostUnit,  // index only scan cost per tuple retrieving
 
 		EcpIndexCostConversionFactor,  // Cost conversion factor for Index & Index only scans
+
+		EcpHJRuntimeFilterTupColumnCostUnit,  // runtime filter probing cost per outer tuple per column in hash join
+
+		EcpMemoizeProbeTupColumnCostUnit,  // memoize cache lookup cost per rescan per cache key column
+
+		EcpIncrementalSortTupColumnCostUnit,  // incremental sort group boundary check cost per tuple per presorted column
+
+		EcpZoneMapSkipFactor,  // fraction of the filtered-out rows of an AOCS scan whose varblocks are skipped using zone maps
 		EcpSentinel
 	};
 
@@ -287,6 +295,19 @@ private:
 	// Cost conversion factor for Index & Index only scan
 	static const CDouble DIndexCostConversionFactor;
 
+	// runtime filter probing cost per outer tuple per column in hash join
+	static const CDouble DHJRuntimeFilterTupColumnCostUnitVal;
+
+	// memoize cache lookup cost per rescan per cache key column
+	static const CDouble DMemoizeProbeTupColumnCostUnitVal;
+
+	// incremental sort group boundary check cost per tuple per presorted column
+	static const CDouble DIncrementalSortTupColumnCostUnitVal;
+
+	// fraction of the filtered-out rows of an AOCS scan whose varblocks are
+	// skipped using zone maps
+	static const CDouble DZoneMapSkipFactorVal;
+
 public:
 	CCostModelParamsGPDB(CCostModelParamsGPDB &) = delete;
 
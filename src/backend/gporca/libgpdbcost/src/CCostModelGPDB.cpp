@@ -15,6 +15,7 @@
 
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CDistributionSpecSkewHashed.h"
 #include "gpopt/base/COrderSpec.h"
 #include "gpopt/base/CWindowFrame.h"
 #include "gpopt/engine/CHint.h"
@@ -29,12 +30,17 @@
 #include "gpopt/operators/CPhysicalIndexScan.h"
 #include "gpopt/operators/CPhysicalMotion.h"
 #include "gpopt/operators/CPhysicalMotionBroadcast.h"
+#include "gpopt/operators/CPhysicalMotionSkewHashDistribute.h"
+#include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
+#include "gpopt/operators/CPhysicalScan.h"
 #include "gpopt/operators/CPhysicalSequenceProject.h"
 #include "gpopt/operators/CPhysicalStreamAgg.h"
 #include "gpopt/operators/CPhysicalUnionAll.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarBitmapIndexProbe.h"
+#include "gpopt/operators/CScalarCmp.h"
+#include "gpopt/operators/CScalarIdent.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/xforms/CXformUtils.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
@@ -42,6 +48,10 @@
 using namespace gpos;
 using namespace gpdbcost;
 
+// false positive rate of the Bloom filter of a runtime filter, see
+// bloom_create() in the executor
+#define GPDB_RUNTIME_FILTER_FALSE_POSITIVE_RATE 0.02
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -270,6 +280,185 @@ CCostModelGPDB::FUnary(COperator::EOperatorId op_id)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::FRuntimeFilterScan
+//
+//	@doc:
+//		Check if the executor pushes a runtime filter from the given hash
+//		join into its outer child: the join must drop the outer tuples
+//		without a match, and the outer child must be a scan the executor
+//		can filter, in the same slice as the join
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostModelGPDB::FRuntimeFilterScan(CExpressionHandle &exprhdl)
+{
+	COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
+	if (COperator::EopPhysicalInnerHashJoin != op_id &&
+		COperator::EopPhysicalLeftSemiHashJoin != op_id)
+	{
+		return false;
+	}
+
+	COperator *popOuter = exprhdl.Pop(0);
+	if (nullptr == popOuter)
+	{
+		return false;
+	}
+
+	op_id = popOuter->Eopid();
+	return COperator::EopPhysicalTableScan == op_id ||
+		   COperator::EopPhysicalIndexScan == op_id ||
+		   COperator::EopPhysicalIndexOnlyScan == op_id ||
+		   COperator::EopPhysicalBitmapTableScan == op_id;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::FZoneMapSkippingScan
+//
+//	@doc:
+//		Check if the scan below the given filter can skip varblocks using
+//		the zone maps in the block directory: the scan must be on an AOCS
+//		table, which has a block directory, with a zone map for every
+//		varblock, once it has had an index, and one of the filter's
+//		conjuncts must compare a column of a type with zone maps to a
+//		constant
+//
+//---------------------------------------------------------------------------
+BOOL
+CCostModelGPDB::FZoneMapSkippingScan(CExpressionHandle &exprhdl)
+{
+	GPOS_ASSERT(COperator::EopPhysicalFilter == exprhdl.Pop()->Eopid());
+
+	if (!GPOS_FTRACE(EopttraceEnableAOCSBlockSkipping))
+	{
+		return false;
+	}
+
+	COperator *popChild = exprhdl.Pop(0);
+	if (nullptr == popChild ||
+		(COperator::EopPhysicalTableScan != popChild->Eopid() &&
+		 COperator::EopPhysicalDynamicTableScan != popChild->Eopid()))
+	{
+		return false;
+	}
+
+	CTableDescriptor *ptabdesc = CPhysicalScan::PopConvert(popChild)->Ptabdesc();
+	if (IMDRelation::ErelstorageAppendOnlyCols !=
+			ptabdesc->RetrieveRelStorageType() ||
+		0 == ptabdesc->IndexCount())
+	{
+		return false;
+	}
+
+	CExpression *pexprScalar = exprhdl.PexprScalarRepChild(1);
+	if (nullptr == pexprScalar)
+	{
+		return false;
+	}
+
+	CMemoryPool *mp = COptCtxt::PoctxtFromTLS()->Pmp();
+	CExpressionArray *pdrgpexprConjuncts =
+		CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
+	BOOL fSkipping = false;
+	const ULONG ulConjuncts = pdrgpexprConjuncts->Size();
+	for (ULONG ul = 0; ul < ulConjuncts && !fSkipping; ul++)
+	{
+		CExpression *pexprConjunct = (*pdrgpexprConjuncts)[ul];
+		if (!CPredicateUtils::FCompareIdentToConst(pexprConjunct) ||
+			!CUtils::FScalarIdent((*pexprConjunct)[0]) ||
+			IMDType::EcmptNEq ==
+				CScalarCmp::PopConvert(pexprConjunct->Pop())->ParseCmpType())
+		{
+			continue;
+		}
+
+		IMDId *mdid_type = CScalarIdent::PopConvert((*pexprConjunct)[0]->Pop())
+							   ->Pcr()
+							   ->RetrieveType()
+							   ->MDId();
+		fSkipping = mdid_type->Equals(&CMDIdGPDB::m_mdid_int2) ||
+					mdid_type->Equals(&CMDIdGPDB::m_mdid_int4) ||
+					mdid_type->Equals(&CMDIdGPDB::m_mdid_int8) ||
+					mdid_type->Equals(&CMDIdGPDB::m_mdid_date) ||
+					mdid_type->Equals(&CMDIdGPDB::m_mdid_timestamp) ||
+					mdid_type->Equals(&CMDIdGPDB::m_mdid_timestampTz);
+	}
+	pdrgpexprConjuncts->Release();
+
+	return fSkipping;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostMemoizedInnerChild
+//
+//	@doc:
+//		Cost saved on the inner child of an index or correlated nested loop
+//		join by the Memoize node the plan translator puts over it: only the
+//		rescans with outer values not seen before, or evicted from the
+//		cache, reach the child; the others cost a cache lookup. The hit
+//		ratio is estimated by CPhysicalNLJoin::DMemoizeHitRatio, which the
+//		translator uses as well to decide whether to plan the cache.
+//		Returns the cost change to add to the join, zero when there is no
+//		cache
+//
+//---------------------------------------------------------------------------
+CCost
+CCostModelGPDB::CostMemoizedInnerChild(const CCostModelGPDB *pcmgpdb,
+									   CExpressionHandle &exprhdl,
+									   const SCostingInfo *pci)
+{
+	if (!GPOS_FTRACE(EopttraceEnableMemoize))
+	{
+		return CCost(0);
+	}
+
+	COperator *pop = exprhdl.Pop();
+	if (COperator::EopPhysicalInnerIndexNLJoin != pop->Eopid() &&
+		COperator::EopPhysicalLeftOuterIndexNLJoin != pop->Eopid() &&
+		!CUtils::FCorrelatedNLJoin(pop))
+	{
+		return CCost(0);
+	}
+
+	const DOUBLE num_rows_outer = pci->PdRows()[0];
+	ICostModel::CCostingStats *stats_outer = pci->Pcstats(0);
+	if (1.0 >= num_rows_outer || nullptr == stats_outer)
+	{
+		return CCost(0);
+	}
+
+	ULONG ulKeys = 0;
+	const CDouble dDistinct = CPhysicalNLJoin::DMemoizeKeys(
+		stats_outer->Pstats(), exprhdl.DeriveOuterReferences(1),
+		exprhdl.DeriveOutputColumns(0), &ulKeys);
+	const CDouble dHitRatio = CPhysicalNLJoin::DMemoizeHitRatio(
+		num_rows_outer, dDistinct, pci->PdRows()[1], pci->GetWidth()[1]);
+	if (0.0 == dHitRatio)
+	{
+		// the plan translator does not put a Memoize node there either
+		return CCost(0);
+	}
+
+	const CDouble dMemoizeProbeTupColumnCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(CCostModelParamsGPDB::EcpMemoizeProbeTupColumnCostUnit)
+			->Get();
+	GPOS_ASSERT(0 < dMemoizeProbeTupColumnCostUnit);
+
+	const CDouble dCostInner(pci->PdCost()[1]);
+	const CDouble dCostProbe = pci->NumRebinds() * num_rows_outer * ulKeys *
+							   dMemoizeProbeTupColumnCostUnit;
+
+	return CCost(dCostProbe - dHitRatio * dCostInner);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostChildren
@@ -710,6 +899,12 @@ CCostModelGPDB::CostSort(CMemoryPool *mp, CExpressionHandle &exprhdl,
 			->Get();
 	GPOS_ASSERT(0 < dSortTupWidthCost);
 
+	CPhysicalSort *popSort = CPhysicalSort::PopConvert(exprhdl.Pop());
+	if (popSort->FIncremental())
+	{
+		return CostIncrementalSort(mp, exprhdl, pcmgpdb, pci, popSort);
+	}
+
 	// sort cost is correlated with the number of rows and width of input tuples. We use n*log(n) for sorting complexity.
 	CCost costLocal =
 		CCost(num_rebinds * (rows * rows.Log2() * width * dSortTupWidthCost));
@@ -720,6 +915,65 @@ CCostModelGPDB::CostSort(CMemoryPool *mp, CExpressionHandle &exprhdl,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostIncrementalSort
+//
+//	@doc:
+//		Cost of incremental sort: the input only needs to be sorted within
+//		the groups of rows sharing the presorted prefix, whose number is
+//		estimated from the NDVs of the prefix columns, plus a comparison
+//		of each row to its group on the prefix columns
+//
+//---------------------------------------------------------------------------
+CCost
+CCostModelGPDB::CostIncrementalSort(CMemoryPool *mp, CExpressionHandle &exprhdl,
+									const CCostModelGPDB *pcmgpdb,
+									const SCostingInfo *pci,
+									CPhysicalSort *popSort)
+{
+	const CDouble rows = CDouble(std::max(2.0, pci->Rows()));
+	const CDouble num_rebinds = CDouble(pci->NumRebinds());
+	const CDouble width = CDouble(pci->Width());
+	const ULONG ulPresorted = popSort->UlPresortedCols();
+
+	const CDouble dSortTupWidthCost =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(CCostModelParamsGPDB::EcpSortTupWidthCostUnit)
+			->Get();
+	const CDouble dIncrementalSortTupColumnCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(
+				CCostModelParamsGPDB::EcpIncrementalSortTupColumnCostUnit)
+			->Get();
+	GPOS_ASSERT(0 < dSortTupWidthCost);
+	GPOS_ASSERT(0 < dIncrementalSortTupColumnCostUnit);
+
+	// without statistics on the input, assume a single group
+	CDouble dGroups(1.0);
+	ICostModel::CCostingStats *stats_child = pci->Pcstats(0);
+	if (nullptr != stats_child)
+	{
+		const COrderSpec *pos = popSort->Pos();
+		for (ULONG ul = 0; ul < ulPresorted; ul++)
+		{
+			dGroups = dGroups * stats_child->GetNDVs(pos->Pcr(ul));
+		}
+		dGroups = std::min(rows, std::max(CDouble(1.0), dGroups));
+	}
+
+	const CDouble dGroupRows = std::max(CDouble(2.0), rows / dGroups);
+	CCost costLocal = CCost(
+		num_rebinds *
+		(rows * dGroupRows.Log2() * width * dSortTupWidthCost +
+		 rows * ulPresorted * dIncrementalSortTupColumnCostUnit));
+	CCost costChild =
+		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
+
+	return costLocal + costChild;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostTVF
@@ -957,6 +1211,11 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 		pcmgpdb->GetCostModelParams()
 			->PcpLookup(CCostModelParamsGPDB::EcpPenalizeHJSkewUpperLimit)
 			->Get();
+	const CDouble dHJRuntimeFilterTupColumnCostUnit =
+		pcmgpdb->GetCostModelParams()
+			->PcpLookup(
+				CCostModelParamsGPDB::EcpHJRuntimeFilterTupColumnCostUnit)
+			->Get();
 	GPOS_ASSERT(0 < dHJHashTableInitCostFactor);
 	GPOS_ASSERT(0 < dHJHashTableColumnCostUnit);
 	GPOS_ASSERT(0 < dHJHashTableWidthCostUnit);
@@ -969,12 +1228,32 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	GPOS_ASSERT(0 < dHJFeedingTupWidthSpillingCostUnit);
 	GPOS_ASSERT(0 < dHJHashingTupWidthSpillingCostUnit);
 	GPOS_ASSERT(0 < dPenalizeHJSkewUpperLimit);
+	GPOS_ASSERT(0 < dHJRuntimeFilterTupColumnCostUnit);
 
 	// get the number of columns used in join condition
 	CExpression *pexprJoinCond = exprhdl.PexprScalarRepChild(2);
 	CColRefSet *pcrsUsed = pexprJoinCond->DeriveUsedColumns();
 	const ULONG ulColsUsed = pcrsUsed->Size();
 
+	// number of outer tuples fed into the join, and the cost of the runtime
+	// filter that the executor pushes into a scan directly below an inner or
+	// semi hash join; the filter drops the outer tuples without a match,
+	// except for the false positives of its Bloom filter
+	DOUBLE dRowsOuterFed = num_rows_outer;
+	CDouble dRuntimeFilterCost(0.0);
+	if (GPOS_FTRACE(EopttraceEnableRuntimeFilter) &&
+		FRuntimeFilterScan(exprhdl))
+	{
+		const DOUBLE dRowsOuterMatched =
+			std::min(num_rows_outer, pci->Rows());
+		dRowsOuterFed =
+			dRowsOuterMatched +
+			(num_rows_outer - dRowsOuterMatched) *
+				GPDB_RUNTIME_FILTER_FALSE_POSITIVE_RATE;
+		dRuntimeFilterCost =
+			ulColsUsed * num_rows_outer * dHJRuntimeFilterTupColumnCostUnit;
+	}
+
 	// TODO 2014-03-14
 	// currently, we hard coded a spilling memory threshold for judging whether hash join spills or not
 	// In the future, we should calculate it based on the number of memory-intensive operators and statement memory available
@@ -996,9 +1275,10 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 				// cost of building hash table
 				dRowsInner * (ulColsUsed * dHJHashTableColumnCostUnit +
 							  dWidthInner * dHJHashTableWidthCostUnit) +
-				// cost of feeding outer tuples
-				ulColsUsed * num_rows_outer * dJoinFeedingTupColumnCostUnit +
-				dWidthOuter * num_rows_outer * dJoinFeedingTupWidthCostUnit +
+				// cost of filtering and feeding outer tuples
+				dRuntimeFilterCost +
+				ulColsUsed * dRowsOuterFed * dJoinFeedingTupColumnCostUnit +
+				dWidthOuter * dRowsOuterFed * dJoinFeedingTupWidthCostUnit +
 				// cost of matching inner tuples
 				dWidthInner * dRowsInner * dHJHashingTupWidthCostUnit +
 				// cost of output tuples
@@ -1015,8 +1295,9 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 			(dHJHashTableInitCostFactor +
 			 dRowsInner * (ulColsUsed * dHJHashTableColumnCostUnit +
 						   dWidthInner * dHJHashTableWidthCostUnit) +
-			 ulColsUsed * num_rows_outer * dHJFeedingTupColumnSpillingCostUnit +
-			 dWidthOuter * num_rows_outer * dHJFeedingTupWidthSpillingCostUnit +
+			 dRuntimeFilterCost +
+			 ulColsUsed * dRowsOuterFed * dHJFeedingTupColumnSpillingCostUnit +
+			 dWidthOuter * dRowsOuterFed * dHJFeedingTupWidthSpillingCostUnit +
 			 dWidthInner * dRowsInner * dHJHashingTupWidthSpillingCostUnit +
 			 pci->Rows() * pci->Width() * dJoinOutputTupCostUnit));
 	}
@@ -1121,6 +1402,25 @@ CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 				skew_ratio = CDouble(std::max(sk.Get(), skew_ratio.Get()));
 			}
 
+			// when the skew-aware redistribution is enabled, a single hot key
+			// is penalized like the nulls above, so that the plain
+			// redistribution competes with it on cost
+			if (GPOS_FTRACE(EopttraceEnableSkewRedistribute) &&
+				1 == columns->Size())
+			{
+				CDouble maxFreq = CPhysicalMotionSkewHashDistribute::DMaxKeyFreq(
+					pci->Pcstats(ul)->Pstats(), columns->PcrFirst());
+				if (maxFreq > .05)
+				{
+					CDouble skewed_percent =
+						maxFreq + (1.0 / pcmgpdb->UlHosts());
+					CDouble expected_percent_if_uniform =
+						1.0 / pcmgpdb->UlHosts();
+					CDouble sk = skewed_percent / expected_percent_if_uniform;
+					skew_ratio = CDouble(std::max(sk.Get(), skew_ratio.Get()));
+				}
+			}
+
 			ULONG skew_factor = optimizer_config->GetHint()->UlSkewFactor();
 			if (skew_factor > 0)
 			{
@@ -1293,7 +1593,8 @@ CCostModelGPDB::CostIndexNLJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 				  pci->Rows() * pci->Width() * dJoinOutputTupCostUnit));
 
 	CCost costChild =
-		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
+		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams()) +
+		CostMemoizedInnerChild(pcmgpdb, exprhdl, pci);
 
 	ULONG risk = pci->Pcstats()->StatsEstimationRisk();
 	ULONG ulPenalizationFactor = 1;
@@ -1413,7 +1714,8 @@ CCostModelGPDB::CostNLJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 			pci->Rows() * pci->Width() * dJoinOutputTupCostUnit));
 
 	CCost costChild =
-		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
+		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams()) +
+		CostMemoizedInnerChild(pcmgpdb, exprhdl, pci);
 
 	CCost costTotal = CCost(costLocal + costChild);
 
@@ -1460,6 +1762,7 @@ CCostModelGPDB::CostMotion(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	GPOS_ASSERT(COperator::EopPhysicalMotionGather == op_id ||
 				COperator::EopPhysicalMotionBroadcast == op_id ||
 				COperator::EopPhysicalMotionHashDistribute == op_id ||
+				COperator::EopPhysicalMotionSkewHashDistribute == op_id ||
 				COperator::EopPhysicalMotionRandom == op_id ||
 				COperator::EopPhysicalMotionRoutedDistribute == op_id);
 
@@ -1494,6 +1797,7 @@ CCostModelGPDB::CostMotion(CMemoryPool *mp, CExpressionHandle &exprhdl,
 			num_rows_outer * dWidthOuter * pcmgpdb->UlHosts() * dRecvCostUnit;
 	}
 	else if (COperator::EopPhysicalMotionHashDistribute == op_id ||
+			 COperator::EopPhysicalMotionSkewHashDistribute == op_id ||
 			 COperator::EopPhysicalMotionRandom == op_id ||
 			 COperator::EopPhysicalMotionRoutedDistribute == op_id)
 	{
@@ -1523,6 +1827,19 @@ CCostModelGPDB::CostMotion(CMemoryPool *mp, CExpressionHandle &exprhdl,
 		}
 
 		recvCost = pci->Rows() * pci->Width() * dRecvCostUnit;
+
+		if (CDistributionSpec::EdtSkewHashed == pds->Edt())
+		{
+			// the broadcast side of a skew-aware pair sends the rows matching
+			// a hot key to all segments
+			CDistributionSpecSkewHashed *pdsSkew =
+				CDistributionSpecSkewHashed::PdsConvert(pds);
+			if (CDistributionSpecSkewHashed::EskmBroadcast == pdsSkew->Eskm())
+			{
+				recvCost = recvCost * (1.0 + pdsSkew->DHotFreq() *
+												 (pcmgpdb->UlHosts() - 1));
+			}
+		}
 	}
 	else if (COperator::EopPhysicalMotionGather == op_id)
 	{
@@ -2382,6 +2699,20 @@ CCostModelGPDB::CostFilter(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	CCost costChild =
 		CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
 
+	// an AOCS scan never reads the varblocks whose zone maps rule out the
+	// filter; part of the rows the filter drops sit in such varblocks
+	if (0 < dInput && FZoneMapSkippingScan(exprhdl))
+	{
+		const CDouble dZoneMapSkipFactor =
+			pcmgpdb->GetCostModelParams()
+				->PcpLookup(CCostModelParamsGPDB::EcpZoneMapSkipFactor)
+				->Get();
+		CDouble dSelectivity = std::min(pci->Rows() / dInput, 1.0);
+		CDouble dSkipped = (CDouble(1.0) - dSelectivity) * dZoneMapSkipFactor;
+		costChild = CCost(costChild.Get() -
+						  pci->PdCost()[0] * dSkipped.Get());
+	}
+
 	return costLocal + costChild;
 }
 
@@ -2530,6 +2861,7 @@ CCostModelGPDB::Cost(
 		case COperator::EopPhysicalMotionGather:
 		case COperator::EopPhysicalMotionBroadcast:
 		case COperator::EopPhysicalMotionHashDistribute:
+		case COperator::EopPhysicalMotionSkewHashDistribute:
 		case COperator::EopPhysicalMotionRandom:
 		case COperator::EopPhysicalMotionRoutedDistribute:
 		{
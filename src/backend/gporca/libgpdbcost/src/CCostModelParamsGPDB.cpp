@@ -200,6 +200,27 @@ const CDouble CCostModelParamsGPDB::DScalarFuncCost(1.0e-04);
 // 'Initial cost' mapped to DInitScanFacorVal (431.0). It is not present in the
 // "Index scan costing".
 const CDouble CCostModelParamsGPDB::DIndexCostConversionFactor = 1.0e-04;
+
+// runtime filter probing cost per outer tuple per column in hash join, a
+// hash computation and a Bloom filter lookup in the scan below the join
+const CDouble CCostModelParamsGPDB::DHJRuntimeFilterTupColumnCostUnitVal =
+	2.0e-05;
+
+// memoize cache lookup cost per rescan per cache key column, hashing the
+// param values and comparing them to the cached key
+const CDouble CCostModelParamsGPDB::DMemoizeProbeTupColumnCostUnitVal =
+	1.0e-04;
+
+// incremental sort cost per tuple per presorted column, comparing the
+// tuple to the first tuple of the current group
+const CDouble CCostModelParamsGPDB::DIncrementalSortTupColumnCostUnitVal =
+	2.0e-05;
+
+// fraction of the rows an AOCS scan filters out that sit in varblocks whose
+// zone maps rule them out as a whole, so that the scan never reads them;
+// rows are rarely clustered perfectly on the filtered column
+const CDouble CCostModelParamsGPDB::DZoneMapSkipFactorVal = 0.5;
+
 #define GPOPT_COSTPARAM_NAME_MAX_LENGTH 80
 
 // parameter names in the same order of param enumeration
@@ -457,6 +478,28 @@ CCostModelParamsGPDB::CCostModelParamsGPDB(CMemoryPool *mp) : m_mp(mp)
 	m_rgpcp[EcpIndexCostConversionFactor] = GPOS_NEW(mp) SCostParam(
 		EcpIndexCostConversionFactor, DIndexCostConversionFactor,
 		DIndexCostConversionFactor - 0.0, DIndexCostConversionFactor + 0.0);
+
+	m_rgpcp[EcpHJRuntimeFilterTupColumnCostUnit] =
+		GPOS_NEW(mp) SCostParam(EcpHJRuntimeFilterTupColumnCostUnit,
+								DHJRuntimeFilterTupColumnCostUnitVal,
+								DHJRuntimeFilterTupColumnCostUnitVal - 0.0,
+								DHJRuntimeFilterTupColumnCostUnitVal + 0.0);
+
+	m_rgpcp[EcpMemoizeProbeTupColumnCostUnit] =
+		GPOS_NEW(mp) SCostParam(EcpMemoizeProbeTupColumnCostUnit,
+								DMemoizeProbeTupColumnCostUnitVal,
+								DMemoizeProbeTupColumnCostUnitVal - 0.0,
+								DMemoizeProbeTupColumnCostUnitVal + 0.0);
+
+	m_rgpcp[EcpIncrementalSortTupColumnCostUnit] =
+		GPOS_NEW(mp) SCostParam(EcpIncrementalSortTupColumnCostUnit,
+								DIncrementalSortTupColumnCostUnitVal,
+								DIncrementalSortTupColumnCostUnitVal - 0.0,
+								DIncrementalSortTupColumnCostUnitVal + 0.0);
+
+	m_rgpcp[EcpZoneMapSkipFactor] = GPOS_NEW(mp)
+		SCostParam(EcpZoneMapSkipFactor, DZoneMapSkipFactorVal,
+				   DZoneMapSkipFactorVal - 0.0, DZoneMapSkipFactorVal + 0.0);
 }
 
 
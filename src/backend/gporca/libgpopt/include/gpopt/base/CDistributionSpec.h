@@ -75,6 +75,7 @@ public:
 		EdtUniversal,  // data is available everywhere (derived only)
 		EdtNonSingleton,  // data can have any distribution except singleton (required only)
 		EdtNonReplicated,  // data cannot be duplicated (required only)
+		EdtSkewHashed,	// data is hashed except for the rows of a few hot keys, which are spread or broadcast
 
 		EdtSentinel
 	};
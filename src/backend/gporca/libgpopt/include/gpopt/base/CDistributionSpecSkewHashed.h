@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDistributionSpecSkewHashed.h
+//
+//	@doc:
+//		Description of a hashed distribution that routes the rows of a few
+//		hot keys differently
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CDistributionSpecSkewHashed_H
+#define GPOPT_CDistributionSpecSkewHashed_H
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CDistributionSpecHashed.h"
+#include "naucrates/base/IDatum.h"
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpnaucrates;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDistributionSpecSkewHashed
+//
+//	@doc:
+//		Distribution required from the two inputs of a hash join on a key
+//		with a few heavy hitters. On one side the rows of the hot keys are
+//		spread round-robin, on the other side the rows matching them are
+//		broadcast, so that every hot pair still meets on exactly one
+//		segment. All other rows are hashed as usual.
+//
+//		Neither side on its own is co-located on the hash columns, and the
+//		broadcast side holds some rows on all segments, so the spec only
+//		satisfies a matching request; the join above derives a random
+//		distribution from such a pair of inputs.
+//
+//---------------------------------------------------------------------------
+class CDistributionSpecSkewHashed : public CDistributionSpec
+{
+public:
+	// routing of the hot-key rows
+	enum ESkewMode
+	{
+		EskmSpread,		// send hot-key rows round-robin
+		EskmBroadcast,	// send hot-key rows to all segments
+
+		EskmSentinel
+	};
+
+private:
+	// hashed distribution of the other rows, on a single column
+	CDistributionSpecHashed *m_pdsHashed;
+
+	// routing of the hot-key rows
+	ESkewMode m_eskm;
+
+	// hot key values
+	IDatumArray *m_pdrgpdatumHot;
+
+	// estimated fraction of the input rows carrying a hot key
+	CDouble m_dHotFreq;
+
+public:
+	CDistributionSpecSkewHashed(const CDistributionSpecSkewHashed &) = delete;
+
+	// ctor
+	CDistributionSpecSkewHashed(CDistributionSpecHashed *pdsHashed,
+								ESkewMode eskm, IDatumArray *pdrgpdatumHot,
+								CDouble dHotFreq);
+
+	// dtor
+	~CDistributionSpecSkewHashed() override;
+
+	// accessor
+	EDistributionType
+	Edt() const override
+	{
+		return CDistributionSpec::EdtSkewHashed;
+	}
+
+	virtual const CHAR *
+	SzId() const
+	{
+		return "SKEW HASHED";
+	}
+
+	// hashed distribution of the other rows
+	CDistributionSpecHashed *
+	PdsHashed() const
+	{
+		return m_pdsHashed;
+	}
+
+	// routing of the hot-key rows
+	ESkewMode
+	Eskm() const
+	{
+		return m_eskm;
+	}
+
+	// hot key values
+	IDatumArray *
+	PdrgpdatumHot() const
+	{
+		return m_pdrgpdatumHot;
+	}
+
+	// estimated fraction of the input rows carrying a hot key
+	CDouble
+	DHotFreq() const
+	{
+		return m_dHotFreq;
+	}
+
+	// columns used by the distribution spec
+	CColRefSet *PcrsUsed(CMemoryPool *mp) const override;
+
+	// hash function
+	ULONG HashValue() const override;
+
+	// does this distribution match the given one
+	BOOL Matches(const CDistributionSpec *pds) const override;
+
+	// does this distribution satisfy the given one
+	BOOL FSatisfies(const CDistributionSpec *pds) const override;
+
+	// append enforcers to dynamic array for the given plan properties
+	void AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl,
+						 CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr,
+						 CExpression *pexpr) override;
+
+	// return distribution partitioning type
+	EDistributionPartitioningType
+	Edpt() const override
+	{
+		return EdptPartitioned;
+	}
+
+	// print
+	IOstream &OsPrint(IOstream &os) const override;
+
+	// conversion function
+	static CDistributionSpecSkewHashed *
+	PdsConvert(CDistributionSpec *pds)
+	{
+		GPOS_ASSERT(nullptr != pds);
+		GPOS_ASSERT(EdtSkewHashed == pds->Edt());
+
+		return dynamic_cast<CDistributionSpecSkewHashed *>(pds);
+	}
+
+	// conversion function: const argument
+	static const CDistributionSpecSkewHashed *
+	PdsConvert(const CDistributionSpec *pds)
+	{
+		GPOS_ASSERT(nullptr != pds);
+		GPOS_ASSERT(EdtSkewHashed == pds->Edt());
+
+		return dynamic_cast<const CDistributionSpecSkewHashed *>(pds);
+	}
+
+};	// class CDistributionSpecSkewHashed
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CDistributionSpecSkewHashed_H
+
+// EOF
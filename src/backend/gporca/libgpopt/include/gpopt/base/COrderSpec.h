@@ -198,6 +198,12 @@ public:
 	// check if order specs satisfies req'd spec
 	BOOL FSatisfies(const COrderSpec *pos) const;
 
+	// number of leading order expressions shared with the given order spec
+	ULONG UlMatchingPrefix(const COrderSpec *pos) const;
+
+	// return a copy of the first given number of order expressions
+	COrderSpec *PosPrefix(CMemoryPool *mp, ULONG ulPrefix) const;
+
 	// append enforcers to dynamic array for the given plan properties
 	void AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl,
 						 CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr,
@@ -12,6 +12,7 @@
 #define GPOPT_CEngine_H
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 
 #include "gpopt/search/CMemo.h"
 #include "gpopt/search/CSearchStage.h"
@@ -33,6 +34,7 @@ class COptimizationContext;
 class CReqdPropPlan;
 class CReqdPropRelational;
 class CEnumeratorConfig;
+class COptimizationProfile;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -57,6 +59,27 @@ private:
 	// index of current search stage
 	ULONG m_ulCurrSearchStage;
 
+	// wall clock time budget of the search in milliseconds, 0 if unlimited
+	ULONG m_ulSearchTimeBudget;
+
+	// number of stages preceding the search strategy that complete a plan
+	// before the time budget can cut the search off
+	ULONG m_ulPreliminarySearchStages;
+
+	// wall clock time elapsed since the search started
+	CWallClock m_search_timer;
+
+	// index of the search stage that was cut off because the search ran
+	// out of time budget, gpos::ulong_max if the search completed
+	ULONG m_ulCutoffSearchStage;
+
+	// number of optimization jobs completed by the scheduler
+	ULONG_PTR m_ulpJobs;
+
+	// per-xform and per-job counters of the search, null if not profiled;
+	// not owned
+	COptimizationProfile *m_pprofile;
+
 	// memo table
 	CMemo *m_pmemo;
 
@@ -160,10 +183,25 @@ private:
 	BOOL
 	FSearchTerminated() const
 	{
-		// at least one stage has completed and achieved required cost
-		return (nullptr != PssPrevious() && PssPrevious()->FAchievedReqdCost());
+		// search ran out of time budget, or at least one stage has completed
+		// and achieved required cost
+		return gpos::ulong_max != m_ulCutoffSearchStage ||
+			   (nullptr != PssPrevious() && PssPrevious()->FAchievedReqdCost());
 	}
 
+	// prepend a preliminary stage to the search strategy if the search has
+	// a time budget
+	void InitSearchTimeBudget();
+
+	// start measuring the time budget of the search
+	void StartSearchTimer();
+
+	// hand the remaining time budget of the search to the current stage
+	void SetStageTimeBudget();
+
+	// check if the current stage was cut off by the time budget
+	void CheckStageTimeBudget();
+
 	// generate random plan id
 	ULLONG UllRandomPlanId(ULONG *seed);
 
@@ -323,6 +361,43 @@ public:
 		return m_ulCurrSearchStage;
 	}
 
+	// index of the search stage cut off by the time budget of the search,
+	// gpos::ulong_max if the search was not cut off
+	ULONG
+	UlCutoffSearchStage() const
+	{
+		return m_ulCutoffSearchStage;
+	}
+
+	// number of optimization jobs completed by the scheduler
+	ULONG_PTR
+	UlpJobs() const
+	{
+		return m_ulpJobs;
+	}
+
+	// memo accessor
+	CMemo *
+	Pmemo() const
+	{
+		return m_pmemo;
+	}
+
+	// profile accessor, null if the search is not profiled
+	COptimizationProfile *
+	Pprofile() const
+	{
+		return m_pprofile;
+	}
+
+	// collect per-xform and per-job counters of the search into the
+	// given profile
+	void
+	SetProfile(COptimizationProfile *pprofile)
+	{
+		m_pprofile = pprofile;
+	}
+
 	// return previous search stage
 	CSearchStage *
 	PssPrevious() const
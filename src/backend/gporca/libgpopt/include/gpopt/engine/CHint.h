@@ -20,6 +20,8 @@
 #define PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD ULONG(10)
 #define XFORM_BIND_THRESHOLD ULONG(0)
 #define SKEW_FACTOR ULONG(0)
+#define SEARCH_TIME_BUDGET ULONG(0)
+#define MEMOIZE_MEMORY_LIMIT ULONG(128000)
 
 
 namespace gpopt
@@ -53,6 +55,10 @@ private:
 
 	ULONG m_ulSkewFactor;
 
+	ULONG m_ulSearchTimeBudget;
+
+	ULONG m_ulMemoizeMemoryLimit;
+
 public:
 	CHint(const CHint &) = delete;
 
@@ -61,7 +67,8 @@ public:
 		  ULONG array_expansion_threshold, ULONG ulJoinOrderDPLimit,
 		  ULONG broadcast_threshold, BOOL enforce_constraint_on_dml,
 		  ULONG push_group_by_below_setop_threshold, ULONG xform_bind_threshold,
-		  ULONG skew_factor)
+		  ULONG skew_factor, ULONG search_time_budget,
+		  ULONG memoize_memory_limit)
 		: m_ulJoinArityForAssociativityCommutativity(
 			  join_arity_for_associativity_commutativity),
 		  m_ulArrayExpansionThreshold(array_expansion_threshold),
@@ -71,7 +78,9 @@ public:
 		  m_ulPushGroupByBelowSetopThreshold(
 			  push_group_by_below_setop_threshold),
 		  m_ulXform_bind_threshold(xform_bind_threshold),
-		  m_ulSkewFactor(skew_factor)
+		  m_ulSkewFactor(skew_factor),
+		  m_ulSearchTimeBudget(search_time_budget),
+		  m_ulMemoizeMemoryLimit(memoize_memory_limit)
 	{
 	}
 
@@ -143,6 +152,23 @@ public:
 		return m_ulSkewFactor;
 	}
 
+	// Wall clock time in milliseconds the search may take over all search
+	// stages, 0 if unlimited. Once it runs out, the best plan found so far
+	// is returned.
+	ULONG
+	UlSearchTimeBudget() const
+	{
+		return m_ulSearchTimeBudget;
+	}
+
+	// Memory in kB a Memoize cache may use. The optimizer only plans a
+	// Memoize node if enough of the distinct keys fit.
+	ULONG
+	UlMemoizeMemoryLimit() const
+	{
+		return m_ulMemoizeMemoryLimit;
+	}
+
 	// generate default hint configurations, which disables sort during insert on
 	// append only row-oriented partitioned tables by default
 	static CHint *
@@ -156,7 +182,9 @@ public:
 			true,								 /* enforce_constraint_on_dml */
 			PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD, /* push_group_by_below_setop_threshold */
 			XFORM_BIND_THRESHOLD,				 /* xform_bind_threshold */
-			SKEW_FACTOR							 /* skew_factor */
+			SKEW_FACTOR,						 /* skew_factor */
+			SEARCH_TIME_BUDGET,					 /* search_time_budget */
+			MEMOIZE_MEMORY_LIMIT				 /* memoize_memory_limit */
 		);
 	}
 
@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		COptimizationProfile.h
+//
+//	@doc:
+//		Per-xform and per-job counters of an optimization request
+//---------------------------------------------------------------------------
+#ifndef GPOPT_COptimizationProfile_H
+#define GPOPT_COptimizationProfile_H
+
+#include "gpos/base.h"
+
+#include "gpopt/search/CJob.h"
+#include "gpopt/xforms/CXform.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COptimizationProfile
+//
+//	@doc:
+//		Time spent, alternatives generated and memo insertions per xform,
+//		and time spent per job type, collected while optimizing a query.
+//
+//		Unlike the statistics printed under
+//		EopttracePrintOptimizationStatistics, the profile is a set of flat
+//		counter arrays that needs no allocation and is cheap enough to be
+//		collected for every query; the engine only records into it if the
+//		caller of the optimizer passes one in.
+//
+//---------------------------------------------------------------------------
+class COptimizationProfile
+{
+public:
+	// counters of a single xform
+	struct SXformCounters
+	{
+		// number of times the xform was applied
+		ULLONG m_ullCalls{0};
+
+		// time spent applying the xform, in us
+		ULLONG m_ullTimeUS{0};
+
+		// number of alternatives produced by the xform
+		ULLONG m_ullAlternatives{0};
+
+		// number of alternatives that were new to the memo
+		ULLONG m_ullMemoInserts{0};
+	};
+
+	// counters of a single job type
+	struct SJobCounters
+	{
+		// number of times a job of this type was executed; a job that
+		// suspends waiting for its children is executed more than once
+		ULLONG m_ullExecutions{0};
+
+		// time spent executing jobs of this type, in us
+		ULLONG m_ullTimeUS{0};
+	};
+
+private:
+	// counters per xform id
+	SXformCounters m_rgxform[CXform::ExfSentinel];
+
+	// counters per job type
+	SJobCounters m_rgjob[CJob::EjtSentinel];
+
+public:
+	COptimizationProfile(const COptimizationProfile &) = delete;
+
+	// ctor
+	COptimizationProfile() = default;
+
+	// record an application of an xform
+	void
+	RecordXform(CXform::EXformId exfid, ULLONG ullTimeUS, ULONG ulAlternatives)
+	{
+		GPOS_ASSERT(CXform::ExfSentinel > exfid);
+
+		SXformCounters &counters = m_rgxform[exfid];
+		counters.m_ullCalls++;
+		counters.m_ullTimeUS += ullTimeUS;
+		counters.m_ullAlternatives += ulAlternatives;
+	}
+
+	// record an alternative of an xform inserted into the memo
+	void
+	RecordMemoInsert(CXform::EXformId exfid)
+	{
+		GPOS_ASSERT(CXform::ExfSentinel > exfid);
+
+		m_rgxform[exfid].m_ullMemoInserts++;
+	}
+
+	// record an execution of a job
+	void
+	RecordJob(CJob::EJobType ejt, ULLONG ullTimeUS)
+	{
+		GPOS_ASSERT(CJob::EjtSentinel > ejt);
+
+		SJobCounters &counters = m_rgjob[ejt];
+		counters.m_ullExecutions++;
+		counters.m_ullTimeUS += ullTimeUS;
+	}
+
+	// counters of an xform
+	const SXformCounters &
+	Xform(CXform::EXformId exfid) const
+	{
+		GPOS_ASSERT(CXform::ExfSentinel > exfid);
+
+		return m_rgxform[exfid];
+	}
+
+	// counters of a job type
+	const SJobCounters &
+	Job(CJob::EJobType ejt) const
+	{
+		GPOS_ASSERT(CJob::EjtSentinel > ejt);
+
+		return m_rgjob[ejt];
+	}
+
+	// clear all counters
+	void Reset();
+
+	// add the counters of another profile to this one
+	void Add(const COptimizationProfile &profile);
+
+	// name of a job type
+	static const CHAR *SzJobType(CJob::EJobType ejt);
+
+};	// class COptimizationProfile
+}  // namespace gpopt
+
+#endif	// !GPOPT_COptimizationProfile_H
+
+// EOF
@@ -75,6 +75,15 @@ public:
 	// get the number of times we evicted entries from this cache
 	static ULLONG ULLGetCacheEvictionCounter();
 
+	// get the number of entries evicted from this cache
+	static ULLONG ULLGetCacheEvictedEntriesCounter();
+
+	// get the number of lookups that found an entry in this cache
+	static ULLONG ULLGetCacheHitCounter();
+
+	// get the number of lookups that did not find an entry in this cache
+	static ULLONG ULLGetCacheMissCounter();
+
 	// reset global instance
 	static void Reset();
 
@@ -25,6 +25,7 @@ class ICostModel;
 class CMiniDumperDXL;
 class COptimizerConfig;
 class IConstExprEvaluator;
+struct SOptimizationStats;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -59,14 +60,15 @@ public:
 		CMemoryPool *mp, CDXLMinidump *pdxlmdp, const CHAR *file_name,
 		ULONG ulSegments, ULONG ulSessionId, ULONG ulCmdId,
 		COptimizerConfig *optimizer_config,
-		IConstExprEvaluator *pceeval = nullptr);
+		IConstExprEvaluator *pceeval = nullptr,
+		SOptimizationStats *pstats = nullptr);
 
 	// execute the given minidump using the given MD accessor
 	static CDXLNode *PdxlnExecuteMinidump(
 		CMemoryPool *mp, CMDAccessor *md_accessor, CDXLMinidump *pdxlmd,
 		const CHAR *file_name, ULONG ulSegments, ULONG ulSessionId,
 		ULONG ulCmdId, COptimizerConfig *optimizer_config,
-		IConstExprEvaluator *pceeval);
+		IConstExprEvaluator *pceeval, SOptimizationStats *pstats = nullptr);
 
 };	// class CMinidumperUtils
 
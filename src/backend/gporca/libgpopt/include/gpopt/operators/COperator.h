@@ -226,6 +226,7 @@ public:
 		EopPhysicalMotionGather,
 		EopPhysicalMotionBroadcast,
 		EopPhysicalMotionHashDistribute,
+		EopPhysicalMotionSkewHashDistribute,
 		EopPhysicalMotionRoutedDistribute,
 		EopPhysicalMotionRandom,
 
@@ -20,6 +20,7 @@ namespace gpopt
 {
 // fwd declarations
 class CDistributionSpecHashed;
+class CDistributionSpecSkewHashed;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -73,6 +74,19 @@ protected:
 											   CDrvdPropArray *pdrgpdpCtxt,
 											   ULONG ulOptReq) const;
 
+	// skew-hashed distribution of the n-th child, NULL if the join keys
+	// are not skewed
+	CDistributionSpecSkewHashed *PdsSkewHashed(CMemoryPool *mp,
+											   CExpressionHandle &exprhdl,
+											   ULONG child_index) const;
+
+	// create (skew-hashed, skew-hashed) optimization request
+	CDistributionSpec *PdsRequiredSkewHashed(CMemoryPool *mp,
+											 CExpressionHandle &exprhdl,
+											 CDistributionSpec *pdsInput,
+											 ULONG child_index,
+											 CDrvdPropArray *pdrgpdpCtxt) const;
+
 	// create the set of redistribute requests to send to first hash join child
 	void CreateHashRedistributeRequests(CMemoryPool *mp);
 
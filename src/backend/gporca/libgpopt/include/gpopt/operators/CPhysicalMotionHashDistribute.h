@@ -67,6 +67,13 @@ public:
 		return m_pdsHashed;
 	}
 
+	// hash distribution spec
+	CDistributionSpecHashed *
+	PdsHashed() const
+	{
+		return m_pdsHashed;
+	}
+
 	// is motion eliminating duplicates
 	BOOL
 	IsDuplicateSensitive() const
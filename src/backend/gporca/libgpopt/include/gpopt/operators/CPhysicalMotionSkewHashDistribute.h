@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPhysicalMotionSkewHashDistribute.h
+//
+//	@doc:
+//		Skew-aware hash distribute motion operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalMotionSkewHashDistribute_H
+#define GPOPT_CPhysicalMotionSkewHashDistribute_H
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CDistributionSpecSkewHashed.h"
+#include "gpopt/operators/CPhysicalMotionHashDistribute.h"
+#include "naucrates/statistics/IStatistics.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalMotionSkewHashDistribute
+//
+//	@doc:
+//		Hash distribute motion that routes the rows of a few hot keys
+//		differently, see CDistributionSpecSkewHashed. It is the enforcer of
+//		that spec, which hash joins require from both inputs as one of their
+//		optimization requests, so the pair competes on cost with the plain
+//		redistribution and the broadcast alternatives.
+//
+//		The hashed spec of the base class describes how the other rows are
+//		hashed; the operator delivers the skew-hashed spec.
+//
+//---------------------------------------------------------------------------
+class CPhysicalMotionSkewHashDistribute : public CPhysicalMotionHashDistribute
+{
+private:
+	// delivered distribution
+	CDistributionSpecSkewHashed *m_pdsSkewHashed;
+
+public:
+	CPhysicalMotionSkewHashDistribute(
+		const CPhysicalMotionSkewHashDistribute &) = delete;
+
+	// ctor
+	CPhysicalMotionSkewHashDistribute(
+		CMemoryPool *mp, CDistributionSpecSkewHashed *pdsSkewHashed);
+
+	// dtor
+	~CPhysicalMotionSkewHashDistribute() override;
+
+	// ident accessors
+	EOperatorId
+	Eopid() const override
+	{
+		return EopPhysicalMotionSkewHashDistribute;
+	}
+
+	const CHAR *
+	SzId() const override
+	{
+		return "CPhysicalMotionSkewHashDistribute";
+	}
+
+	// output distribution accessor
+	CDistributionSpec *
+	Pds() const override
+	{
+		return m_pdsSkewHashed;
+	}
+
+	// routing of the hot-key rows
+	CDistributionSpecSkewHashed::ESkewMode
+	Eskm() const
+	{
+		return m_pdsSkewHashed->Eskm();
+	}
+
+	// hot key values
+	IDatumArray *
+	PdrgpdatumHot() const
+	{
+		return m_pdsSkewHashed->PdrgpdatumHot();
+	}
+
+	// match function
+	BOOL Matches(COperator *) const override;
+
+	// print
+	IOstream &OsPrint(IOstream &) const override;
+
+	// conversion function
+	static CPhysicalMotionSkewHashDistribute *PopConvert(COperator *pop);
+
+	// hot keys of a column, nullptr if the column is not skewed
+	static IDatumArray *PdrgpdatumHot(CMemoryPool *mp, IStatistics *stats,
+									  const CColRef *colref, ULONG ulSegments,
+									  CDouble *pdHotFreq);
+
+	// estimated fraction of the rows whose column matches one of the given
+	// keys, a negative value if unknown
+	static CDouble DMatchingFreq(IStatistics *stats, const CColRef *colref,
+								 IDatumArray *pdrgpdatum);
+
+	// estimated fraction of the rows carrying the most frequent value of a
+	// column, zero if unknown
+	static CDouble DMaxKeyFreq(IStatistics *stats, const CColRef *colref);
+
+};	// class CPhysicalMotionSkewHashDistribute
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalMotionSkewHashDistribute_H
+
+// EOF
@@ -15,6 +15,10 @@
 
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/CPhysicalJoin.h"
+#include "naucrates/statistics/IStatistics.h"
+
+// smallest fraction of cache hits for which a Memoize node is planned
+#define GPOPT_MEMOIZE_MIN_HIT_RATIO 0.1
 
 namespace gpopt
 {
@@ -88,6 +92,17 @@ public:
 		return nullptr;
 	}
 
+	// estimated number of distinct values of the outer columns an inner
+	// child references, zero if it references none
+	static CDouble DMemoizeKeys(IStatistics *pstatsOuter,
+								CColRefSet *pcrsOuterRefs,
+								CColRefSet *pcrsOuterOutput, ULONG *pulKeys);
+
+	// expected fraction of the rescans of an inner child that a Memoize
+	// cache over it serves, zero if no Memoize node should be planned
+	static CDouble DMemoizeHitRatio(CDouble dRowsOuter, CDouble dDistinctKeys,
+									CDouble dRowsInner, CDouble dWidthInner);
+
 	// conversion function
 	static CPhysicalNLJoin *
 	PopConvert(COperator *pop)
@@ -36,11 +36,19 @@ private:
 	// columns used by order spec
 	CColRefSet *m_pcrsSort;
 
+	// number of leading order expressions the input is already sorted on;
+	// a non-zero value makes this an incremental sort, which sorts only
+	// the rows sharing the values of these expressions
+	ULONG m_ulPresortedCols;
+
+	// order required from the child of an incremental sort
+	COrderSpec *m_posPresorted;
+
 public:
 	CPhysicalSort(const CPhysicalSort &) = delete;
 
 	// ctor
-	CPhysicalSort(CMemoryPool *mp, COrderSpec *pos);
+	CPhysicalSort(CMemoryPool *mp, COrderSpec *pos, ULONG ulPresortedCols = 0);
 
 	// dtor
 	~CPhysicalSort() override;
@@ -59,6 +67,27 @@ public:
 		return m_pos;
 	}
 
+	// number of leading order expressions the input is sorted on
+	ULONG
+	UlPresortedCols() const
+	{
+		return m_ulPresortedCols;
+	}
+
+	// order required from the child of an incremental sort
+	const COrderSpec *
+	PosPresorted() const
+	{
+		return m_posPresorted;
+	}
+
+	// is this an incremental sort
+	BOOL
+	FIncremental() const
+	{
+		return 0 < m_ulPresortedCols;
+	}
+
 	// return a string for operator name
 	const CHAR *
 	SzId() const override
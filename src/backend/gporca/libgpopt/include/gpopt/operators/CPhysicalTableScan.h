@@ -24,6 +24,15 @@ namespace gpopt
 //	@doc:
 //		Table scan operator
 //
+//		The scan runs in the segment's own process; there is no parallel
+//		variant with a Gather below the Motion. Parallel workers are disabled
+//		in Greenplum (see the GPDB_96_MERGE_FIXME in standard_planner()): a
+//		worker started on a QE gets neither the distributed snapshot nor the
+//		reader-gang, session and resource group state of its leader, so it
+//		could see the wrong rows and would escape resource management.
+//		Segments already scan their share of a table in parallel with each
+//		other.
+//
 //---------------------------------------------------------------------------
 class CPhysicalTableScan : public CPhysicalScan
 {
@@ -38,6 +38,35 @@ class ICostModel;
 class COptimizerConfig;
 class CQueryContext;
 class CEnumeratorConfig;
+class COptimizationProfile;
+
+//---------------------------------------------------------------------------
+//	@struct:
+//		SOptimizationStats
+//
+//	@doc:
+//		Statistics of a single optimization request
+//
+//---------------------------------------------------------------------------
+struct SOptimizationStats
+{
+	// index of the search stage cut off by the time budget of the search,
+	// gpos::ulong_max if the search was not cut off
+	ULONG m_ulCutoffSearchStage{gpos::ulong_max};
+
+	// number of optimization jobs completed by the scheduler
+	ULLONG m_ullJobs{0};
+
+	// number of groups in the memo at the end of the search
+	ULLONG m_ullGroups{0};
+
+	// number of group expressions in the memo at the end of the search
+	ULLONG m_ullGroupExprs{0};
+
+	// input: if set, per-xform and per-job counters of the search are
+	// added to it; not owned
+	COptimizationProfile *m_pprofile{nullptr};
+};
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -55,7 +84,8 @@ private:
 
 	// optimize query in the given query context
 	static CExpression *PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-									  CSearchStageArray *search_stage_array);
+									  CSearchStageArray *search_stage_array,
+									  SOptimizationStats *pstats);
 
 	// translate an optimizer expression into a DXL tree
 	static CDXLNode *CreateDXLNode(CMemoryPool *mp, CMDAccessor *md_accessor,
@@ -97,7 +127,9 @@ public:
 		CSearchStageArray *search_stage_array,	// search strategy
 		COptimizerConfig *optimizer_config,		// optimizer configurations
 		const CHAR *szMinidumpFileName =
-			nullptr	 // name of minidump file to be created
+			nullptr,  // name of minidump file to be created
+		SOptimizationStats *pstats =
+			nullptr	 // output: statistics of the optimization request
 	);
 };	// class COptimizer
 }  // namespace gpopt
@@ -102,6 +102,10 @@ private:
 	// of order-insensitive operators
 	CGroupArray *m_pdrgpgroupSorted{nullptr};
 
+	// hash value, computed from operator and child groups; it changes only
+	// when a child group is merged, and is then updated by the memo
+	ULONG m_ulHash{0};
+
 	// back pointer to group
 	CGroup *m_pgroup{nullptr};
 
@@ -326,7 +330,18 @@ public:
 	ULONG
 	HashValue() const
 	{
-		return HashValue(m_pop, m_pdrgpgroup);
+		return m_ulHash;
+	}
+
+	// did the hash value change because child groups were merged
+	BOOL FHashValueChanged() const;
+
+	// recompute hash value after child groups were merged; the group
+	// expression must not be in the memo hash table
+	void
+	UpdateHashValue()
+	{
+		m_ulHash = HashValue(m_pop, m_pdrgpgroup);
 	}
 
 	// static hash function for operator and group references
@@ -78,10 +78,17 @@ private:
 				   CGroupExpression>
 		m_sht;
 
+	// number of rehash passes after group merges
+	ULONG m_ulRehashPasses;
+
+	// number of group expressions re-inserted into the hash table by
+	// rehash passes
+	ULONG m_ulRehashedGExprs;
+
 	// add new group
 	void Add(CGroup *pgroup, CExpression *pexprOrigin);
 
-	// rehash all group expressions after group merge - not thread-safe
+	// rehash group expressions affected by group merge - not thread-safe
 	BOOL FRehash();
 
 	// helper for inserting group expression in target group
@@ -121,6 +128,20 @@ public:
 	// return number of duplicate groups
 	ULONG UlDuplicateGroups();
 
+	// return number of rehash passes after group merges
+	ULONG
+	UlRehashPasses() const
+	{
+		return m_ulRehashPasses;
+	}
+
+	// return number of group expressions re-inserted by rehash passes
+	ULONG
+	UlRehashedGExprs() const
+	{
+		return m_ulRehashedGExprs;
+	}
+
 	// mark groups as duplicates
 	static void MarkDuplicates(CGroup *pgroupFst, CGroup *pgroupSnd);
 
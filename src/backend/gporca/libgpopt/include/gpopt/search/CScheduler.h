@@ -32,7 +32,7 @@ class CSchedulerContext;
 //		CScheduler
 //
 //	@doc:
-//		MT-scheduler for optimization jobs
+//		Scheduler for optimization jobs
 //
 //		Maintaining job dependencies and controlling the order of job execution
 //		are the main responsibilities of job scheduler.
@@ -51,6 +51,15 @@ class CSchedulerContext;
 //		complete. At this point, a queued job can be terminated if it does not
 //		have any further dependencies.
 //
+//		Jobs are executed on the single GPOS worker of the optimizer task.
+//		Although the job graph does not impose an execution order on
+//		independent group jobs, running them concurrently is not supported:
+//		GPOS only manages one worker (see CWorkerPoolManager), the sync
+//		containers used by the memo and the scheduler carry no locks, memory
+//		pools are not thread-safe, and jobs call back into the host database
+//		(metadata lookups, interrupt checks, error reporting), which must
+//		happen on the backend's main thread.
+//
 //---------------------------------------------------------------------------
 class CScheduler
 {
@@ -69,7 +78,7 @@ public:
 	};
 
 private:
-	// job wrapper; used for inserting job to waiting list (lock-free)
+	// job wrapper; used for inserting job to waiting list
 	struct SJobLink
 	{
 		// link id, set by sync set
@@ -188,6 +197,13 @@ public:
 	// print statistics
 	void PrintStats() const;
 
+	// number of jobs completed so far
+	ULONG_PTR
+	UlpCompletedJobs() const
+	{
+		return m_ulpStatsCompleted;
+	}
+
 #ifdef GPOS_DEBUG
 	// get flag for tracking jobs
 	BOOL
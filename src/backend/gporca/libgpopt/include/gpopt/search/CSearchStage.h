@@ -14,6 +14,7 @@
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
 #include "gpos/common/CTimerUser.h"
+#include "gpos/common/CWallClock.h"
 
 #include "gpopt/xforms/CXform.h"
 
@@ -59,6 +60,13 @@ private:
 	// elapsed time
 	CTimerUser m_timer;
 
+	// wall clock time budget in milliseconds left for the stage,
+	// gpos::ulong_max if the search time is not limited
+	ULONG m_time_budget;
+
+	// wall clock time elapsed since the time budget was set
+	CWallClock m_budget_timer;
+
 public:
 	// ctor
 	CSearchStage(CXformSet *xform_set, ULONG ulTimeThreshold = gpos::ulong_max,
@@ -84,6 +92,11 @@ public:
 	BOOL
 	FTimedOut() const
 	{
+		if (FExhaustedTimeBudget())
+		{
+			return true;
+		}
+
 		if (m_time_threshold == gpos::ulong_max)
 		{
 			return false;
@@ -91,6 +104,28 @@ public:
 		return m_timer.ElapsedMS() > m_time_threshold;
 	}
 
+	// set wall clock time budget left for the stage, and start measuring it
+	void
+	SetTimeBudget(ULONG ulTimeBudget)
+	{
+		m_time_budget = ulTimeBudget;
+		if (m_time_budget != gpos::ulong_max)
+		{
+			m_budget_timer.Restart();
+		}
+	}
+
+	// has the stage used up the time budget of the search?
+	BOOL
+	FExhaustedTimeBudget() const
+	{
+		if (m_time_budget == gpos::ulong_max)
+		{
+			return false;
+		}
+		return m_budget_timer.ElapsedMS() >= m_time_budget;
+	}
+
 	// return elapsed time (in millseconds) since timer was last restarted
 	ULONG
 	UlElapsedTime() const
@@ -147,6 +182,11 @@ public:
 
 	// generate default search strategy
 	static CSearchStageArray *PdrgpssDefault(CMemoryPool *mp);
+
+	// generate a copy of the given search strategy preceded by a cheap
+	// stage that keeps the join order of the query
+	static CSearchStageArray *PdrgpssWithPreliminaryStage(
+		CMemoryPool *mp, const CSearchStageArray *search_stage_array);
 };
 
 // shorthand for printing
@@ -276,6 +276,9 @@ private:
 	// store outer references in index NLJ inner child into global map
 	void StoreIndexNLJOuterRefs(CPhysical *pop);
 
+	// should a Memoize node cache the inner child of a nested loop join
+	BOOL FMemoizeInnerChild(CExpression *pexprNLJ);
+
 	// build a scalar DXL subplan node
 	void BuildDxlnSubPlan(CDXLNode *pdxlnRelChild, const CColRef *colref,
 						  CDXLColRefArray *dxl_colref_array);
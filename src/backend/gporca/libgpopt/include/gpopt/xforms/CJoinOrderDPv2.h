@@ -322,9 +322,15 @@ private:
 		SExpressionInfoArray *m_best_expr_info_array;
 		CDouble m_cardinality;
 		CDouble m_lowest_expr_cost;
+		// inner join edges that reference at least one atom of the group,
+		// computed on demand, see GetInnerJoinEdges()
+		CBitSet *m_inner_join_edges;
 
 		SGroupInfo(CMemoryPool *mp, CBitSet *atoms)
-			: m_atoms(atoms), m_cardinality(-1.0), m_lowest_expr_cost(-1.0)
+			: m_atoms(atoms),
+			  m_cardinality(-1.0),
+			  m_lowest_expr_cost(-1.0),
+			  m_inner_join_edges(nullptr)
 		{
 			m_best_expr_info_array = GPOS_NEW(mp) SExpressionInfoArray(mp);
 		}
@@ -333,6 +339,7 @@ private:
 		{
 			m_atoms->Release();
 			m_best_expr_info_array->Release();
+			CRefCount::SafeRelease(m_inner_join_edges);
 		}
 
 		BOOL
@@ -403,6 +410,11 @@ private:
 		CHashMapIter<CBitSet, SGroupInfo, UlHashBitSet, FEqualBitSet,
 					 CleanupRelease<CBitSet>, CleanupRelease<SGroupInfo>>;
 
+	// map from a set of atoms to an expression with derived stats
+	using BitSetToExprInfoMap =
+		CHashMap<CBitSet, SExpressionInfo, UlHashBitSet, FEqualBitSet,
+				 CleanupRelease<CBitSet>, CleanupRelease<SExpressionInfo>>;
+
 	// dynamic array of SLevelInfos, where each index represents the level
 	using DPv2Levels = CDynamicPtrArray<SLevelInfo, CleanupRelease<SLevelInfo>>;
 
@@ -416,6 +428,13 @@ private:
 	// map to check whether a DPv2 group already exists
 	BitSetToGroupInfoMap *m_bitset_to_group_info_map;
 
+	// stats expressions of groups that were pruned by FinalizeDPLevel(),
+	// so that we don't derive stats again when we re-create such a group
+	BitSetToExprInfoMap *m_bitset_to_pruned_stats_map;
+
+	// number of re-created groups that took their stats from the above map
+	ULONG m_num_reused_pruned_stats;
+
 	// ON predicates for NIJs (non-inner joins, e.g. LOJs)
 	// currently NIJs are LOJs only, this may change in the future
 	// if/when we add semijoins, anti-semijoins and relatives
@@ -449,8 +468,12 @@ private:
 		return (*m_join_levels)[l];
 	}
 
+	// get the inner join edges that reference at least one atom of a group
+	CBitSet *GetInnerJoinEdges(SGroupInfo *group_info);
+
 	// build expression linking given groups
-	CExpression *PexprBuildInnerJoinPred(CBitSet *pbsFst, CBitSet *pbsSnd);
+	CExpression *PexprBuildInnerJoinPred(SGroupInfo *fst_group_info,
+										 SGroupInfo *snd_group_info);
 
 	// compute cost of a join expression in a group
 	void ComputeCost(SExpressionInfo *expr_info, CDouble join_cardinality);
@@ -551,6 +574,13 @@ public:
 
 	CExpression *GetNextOfTopK();
 
+	// number of re-created groups that reused the stats of a pruned group
+	ULONG
+	NumReusedPrunedStats() const
+	{
+		return m_num_reused_pruned_stats;
+	}
+
 	// check for NIJs
 	BOOL IsRightChildOfNIJ(SGroupInfo *groupInfo,
 						   CExpression **onPredToUse = nullptr,
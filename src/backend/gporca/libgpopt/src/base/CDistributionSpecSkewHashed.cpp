@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDistributionSpecSkewHashed.cpp
+//
+//	@doc:
+//		Specification of a hashed distribution with hot keys
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CDistributionSpecSkewHashed.h"
+
+#include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CDistributionSpecRandom.h"
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CPhysicalMotionSkewHashDistribute.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::CDistributionSpecSkewHashed
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDistributionSpecSkewHashed::CDistributionSpecSkewHashed(
+	CDistributionSpecHashed *pdsHashed, ESkewMode eskm,
+	IDatumArray *pdrgpdatumHot, CDouble dHotFreq)
+	: m_pdsHashed(pdsHashed),
+	  m_eskm(eskm),
+	  m_pdrgpdatumHot(pdrgpdatumHot),
+	  m_dHotFreq(dHotFreq)
+{
+	GPOS_ASSERT(nullptr != pdsHashed);
+	GPOS_ASSERT(1 == pdsHashed->Pdrgpexpr()->Size());
+	GPOS_ASSERT(EskmSentinel > eskm);
+	GPOS_ASSERT(nullptr != pdrgpdatumHot);
+	GPOS_ASSERT(0 < pdrgpdatumHot->Size());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::~CDistributionSpecSkewHashed
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDistributionSpecSkewHashed::~CDistributionSpecSkewHashed()
+{
+	m_pdsHashed->Release();
+	m_pdrgpdatumHot->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::PcrsUsed
+//
+//	@doc:
+//		Extract columns used by the distribution spec
+//
+//---------------------------------------------------------------------------
+CColRefSet *
+CDistributionSpecSkewHashed::PcrsUsed(CMemoryPool *mp) const
+{
+	return m_pdsHashed->PcrsUsed(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::HashValue
+//
+//	@doc:
+//		Hash function
+//
+//---------------------------------------------------------------------------
+ULONG
+CDistributionSpecSkewHashed::HashValue() const
+{
+	ULONG ulHash = gpos::CombineHashes((ULONG) Edt(), (ULONG) m_eskm);
+	ulHash = gpos::CombineHashes(ulHash, m_pdsHashed->HashValue());
+	for (ULONG ul = 0; ul < m_pdrgpdatumHot->Size(); ul++)
+	{
+		ulHash =
+			gpos::CombineHashes(ulHash, (*m_pdrgpdatumHot)[ul]->HashValue());
+	}
+
+	return ulHash;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::Matches
+//
+//	@doc:
+//		Match function
+//
+//---------------------------------------------------------------------------
+BOOL
+CDistributionSpecSkewHashed::Matches(const CDistributionSpec *pds) const
+{
+	if (Edt() != pds->Edt())
+	{
+		return false;
+	}
+
+	const CDistributionSpecSkewHashed *pdsSkew =
+		CDistributionSpecSkewHashed::PdsConvert(pds);
+	IDatumArray *pdrgpdatumOther = pdsSkew->PdrgpdatumHot();
+	if (m_eskm != pdsSkew->Eskm() ||
+		!m_pdsHashed->Equals(pdsSkew->PdsHashed()) ||
+		m_pdrgpdatumHot->Size() != pdrgpdatumOther->Size())
+	{
+		return false;
+	}
+
+	for (ULONG ul = 0; ul < m_pdrgpdatumHot->Size(); ul++)
+	{
+		if (!(*m_pdrgpdatumHot)[ul]->Matches((*pdrgpdatumOther)[ul]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::FSatisfies
+//
+//	@doc:
+//		Check if this distribution spec satisfies the given one. Apart from
+//		a matching request, the spread side is as good as a random
+//		distribution; the broadcast side duplicates its hot-key rows and
+//		only satisfies a request for any distribution.
+//
+//---------------------------------------------------------------------------
+BOOL
+CDistributionSpecSkewHashed::FSatisfies(const CDistributionSpec *pds) const
+{
+	if (Matches(pds) || EdtAny == pds->Edt())
+	{
+		return true;
+	}
+
+	if (EskmBroadcast == m_eskm)
+	{
+		return false;
+	}
+
+	return EdtNonSingleton == pds->Edt() || EdtNonReplicated == pds->Edt() ||
+		   (EdtRandom == pds->Edt() &&
+			!CDistributionSpecRandom::PdsConvert(pds)->IsDuplicateSensitive());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::AppendEnforcers
+//
+//	@doc:
+//		Add required enforcers to dynamic array
+//
+//---------------------------------------------------------------------------
+void
+CDistributionSpecSkewHashed::AppendEnforcers(CMemoryPool *mp,
+											 CExpressionHandle &,  // exprhdl
+											 CReqdPropPlan *
+#ifdef GPOS_DEBUG
+												 prpp
+#endif	// GPOS_DEBUG
+											 ,
+											 CExpressionArray *pdrgpexpr,
+											 CExpression *pexpr)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != prpp);
+	GPOS_ASSERT(nullptr != pdrgpexpr);
+	GPOS_ASSERT(nullptr != pexpr);
+	GPOS_ASSERT(!GPOS_FTRACE(EopttraceDisableMotions));
+	GPOS_ASSERT(
+		this == prpp->Ped()->PdsRequired() &&
+		"required plan properties don't match enforced distribution spec");
+
+	if (GPOS_FTRACE(EopttraceDisableMotionHashDistribute))
+	{
+		// hash-distribute Motion is disabled
+		return;
+	}
+
+	// add a skew-aware hash distribution enforcer
+	this->AddRef();
+	pexpr->AddRef();
+	CExpression *pexprMotion = GPOS_NEW(mp) CExpression(
+		mp, GPOS_NEW(mp) CPhysicalMotionSkewHashDistribute(mp, this), pexpr);
+	pdrgpexpr->Append(pexprMotion);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDistributionSpecSkewHashed::OsPrint
+//
+//	@doc:
+//		Print function
+//
+//---------------------------------------------------------------------------
+IOstream &
+CDistributionSpecSkewHashed::OsPrint(IOstream &os) const
+{
+	os << this->SzId() << " "
+	   << (EskmSpread == m_eskm ? "SPREAD" : "BROADCAST") << " "
+	   << m_pdrgpdatumHot->Size() << " hot keys: ";
+
+	return m_pdsHashed->OsPrint(os);
+}
+
+// EOF
@@ -12,8 +12,11 @@
 #include "gpopt/base/COrderSpec.h"
 
 #include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/base/COptCtxt.h"
+#include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPhysicalSort.h"
+#include "naucrates/traceflags/traceflags.h"
 
 #ifdef GPOS_DEBUG
 #include "gpos/error/CAutoTrace.h"
@@ -185,6 +188,58 @@ COrderSpec::FSatisfies(const COrderSpec *pos) const
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COrderSpec::UlMatchingPrefix
+//
+//	@doc:
+//		Number of leading order expressions shared with the given order spec
+//
+//---------------------------------------------------------------------------
+ULONG
+COrderSpec::UlMatchingPrefix(const COrderSpec *pos) const
+{
+	GPOS_ASSERT(nullptr != pos);
+
+	const ULONG arity =
+		std::min(m_pdrgpoe->Size(), pos->m_pdrgpoe->Size());
+
+	ULONG ul = 0;
+	while (ul < arity && (*m_pdrgpoe)[ul]->Matches((*(pos->m_pdrgpoe))[ul]))
+	{
+		ul++;
+	}
+
+	return ul;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COrderSpec::PosPrefix
+//
+//	@doc:
+//		Return a copy of the first given number of order expressions
+//
+//---------------------------------------------------------------------------
+COrderSpec *
+COrderSpec::PosPrefix(CMemoryPool *mp, ULONG ulPrefix) const
+{
+	GPOS_ASSERT(ulPrefix <= m_pdrgpoe->Size());
+
+	COrderSpec *pos = GPOS_NEW(mp) COrderSpec(mp);
+	for (ULONG ul = 0; ul < ulPrefix; ul++)
+	{
+		COrderExpression *poe = (*m_pdrgpoe)[ul];
+		IMDId *mdid = poe->GetMdIdSortOp();
+		mdid->AddRef();
+		pos->Append(mdid, poe->Pcr(), poe->Ent());
+	}
+
+	return pos;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COrderSpec::AppendEnforcers
@@ -194,8 +249,7 @@ COrderSpec::FSatisfies(const COrderSpec *pos) const
 //
 //---------------------------------------------------------------------------
 void
-COrderSpec::AppendEnforcers(CMemoryPool *mp,
-							CExpressionHandle &,  // exprhdl
+COrderSpec::AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl,
 							CReqdPropPlan *
 #ifdef GPOS_DEBUG
 								prpp
@@ -215,6 +269,23 @@ COrderSpec::AppendEnforcers(CMemoryPool *mp,
 	CExpression *pexprSort = GPOS_NEW(mp)
 		CExpression(mp, GPOS_NEW(mp) CPhysicalSort(mp, this), pexpr);
 	pdrgpexpr->Append(pexprSort);
+
+	// if the expression already delivers a prefix of the required order,
+	// also offer an incremental sort that only sorts the rows sharing
+	// the values of that prefix
+	if (GPOS_FTRACE(EopttraceEnableIncrementalSort))
+	{
+		COrderSpec *posDerived = CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Pos();
+		const ULONG ulPresorted = UlMatchingPrefix(posDerived);
+		if (0 < ulPresorted && ulPresorted < UlSortColumns())
+		{
+			AddRef();
+			pexpr->AddRef();
+			CExpression *pexprIncrementalSort = GPOS_NEW(mp) CExpression(
+				mp, GPOS_NEW(mp) CPhysicalSort(mp, this, ulPresorted), pexpr);
+			pdrgpexpr->Append(pexprIncrementalSort);
+		}
+	}
 }
 
 
@@ -4420,6 +4420,7 @@ CUtils::ValidateCTEProducerConsumerLocality(
 		eelt = EeltSegments;
 	}
 	else if (COperator::EopPhysicalMotionHashDistribute == pop->Eopid() ||
+			 COperator::EopPhysicalMotionSkewHashDistribute == pop->Eopid() ||
 			 COperator::EopPhysicalMotionRandom == pop->Eopid() ||
 			 COperator::EopPhysicalMotionBroadcast == pop->Eopid())
 	{
@@ -29,6 +29,7 @@
 #include "gpopt/base/CReqdPropPlan.h"
 #include "gpopt/base/CReqdPropRelational.h"
 #include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/engine/CStatisticsConfig.h"
 #include "gpopt/exception.h"
 #include "gpopt/minidump/CSerializableStackTrace.h"
@@ -81,6 +82,11 @@ CEngine::CEngine(CMemoryPool *mp)
 	  m_pqc(nullptr),
 	  m_search_stage_array(nullptr),
 	  m_ulCurrSearchStage(0),
+	  m_ulSearchTimeBudget(0),
+	  m_ulPreliminarySearchStages(0),
+	  m_ulCutoffSearchStage(gpos::ulong_max),
+	  m_ulpJobs(0),
+	  m_pprofile(nullptr),
 	  m_pmemo(nullptr),
 	  m_pexprEnforcerPattern(nullptr),
 	  m_xforms(nullptr),
@@ -169,6 +175,8 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 	}
 	GPOS_ASSERT(0 < m_search_stage_array->Size());
 
+	InitSearchTimeBudget();
+
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
 		// initialize per-stage xform calls array
@@ -338,6 +346,10 @@ CEngine::PgroupInsert(CGroup *pgroupTarget, CExpression *pexpr,
 		// insertion failed, release created group expression
 		pgexpr->Release();
 	}
+	else if (nullptr != m_pprofile && CXform::ExfInvalid != exfidOrigin)
+	{
+		m_pprofile->RecordMemoInsert(exfidOrigin);
+	}
 
 	return pgroupContainer;
 }
@@ -548,9 +560,11 @@ CEngine::FOptimizeChild(
 
 	if (nullptr != pgexprParent &&
 		COperator::EopPhysicalSort == pgexprParent->Pop()->Eopid() &&
+		!CPhysicalSort::PopConvert(pgexprParent->Pop())->FIncremental() &&
 		COperator::EopPhysicalMotionGather == popChild->Eopid())
 	{
-		// prevent (Sort --> GatherMerge), since Sort destroys order maintained by GatherMerge
+		// prevent (Sort --> GatherMerge), since Sort destroys order maintained by GatherMerge;
+		// an incremental sort builds on that order instead
 		return !CPhysicalMotionGather::PopConvert(popChild)->FOrderPreserving();
 	}
 
@@ -727,8 +741,14 @@ CEngine::ApplyTransformations(CMemoryPool *pmpLocal, CXformSet *xform_set,
 		CXformResult *pxfres = GPOS_NEW(m_mp) CXformResult(m_mp);
 		ULONG ulElapsedTime = 0;
 		ULONG ulNumberOfBindings = 0;
+		CWallClock clock;
 		pgexpr->Transform(m_mp, pmpLocal, pxform, pxfres, &ulElapsedTime,
 						  &ulNumberOfBindings);
+		if (nullptr != m_pprofile)
+		{
+			m_pprofile->RecordXform(pxform->Exfid(), clock.ElapsedUS(),
+									pxfres->Pdrgpexpr()->Size());
+		}
 		InsertXformResult(pgexpr->Pgroup(), pxfres, pxform->Exfid(), pgexpr,
 						  ulElapsedTime, ulNumberOfBindings);
 		pxfres->Release();
@@ -1289,9 +1309,11 @@ CEngine::RecursiveOptimize()
 				  GPOS_FTRACE(EopttracePrintOptimizationStatistics));
 
 	const ULONG ulSearchStages = m_search_stage_array->Size();
+	StartSearchTimer();
 	for (ULONG ul = 0; !FSearchTerminated() && ul < ulSearchStages; ul++)
 	{
 		PssCurrent()->RestartTimer();
+		SetStageTimeBudget();
 
 		// apply exploration xforms
 		Explore();
@@ -1323,6 +1345,7 @@ CEngine::RecursiveOptimize()
 			m_search_stage_array->Size());
 		PssCurrent()->SetBestExpr(pexprPlan);
 
+		CheckStageTimeBudget();
 		FinalizeSearchStage();
 	}
 
@@ -1514,6 +1537,115 @@ CEngine::FinalizeImplementation()
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::InitSearchTimeBudget
+//
+//	@doc:
+//		Read the wall clock time budget of the search from the hint
+//		configuration; if there is one, the search strategy is preceded by
+//		an unbudgeted preliminary stage, since a stage cut off during
+//		exploration or implementation may leave no complete plan in the
+//		memo, and the optimizer would fall back to the planner
+//
+//---------------------------------------------------------------------------
+void
+CEngine::InitSearchTimeBudget()
+{
+	m_ulSearchTimeBudget = COptCtxt::PoctxtFromTLS()
+							   ->GetOptimizerConfig()
+							   ->GetHint()
+							   ->UlSearchTimeBudget();
+	if (0 == m_ulSearchTimeBudget)
+	{
+		return;
+	}
+
+	CSearchStageArray *search_stage_array =
+		CSearchStage::PdrgpssWithPreliminaryStage(m_mp,
+												  m_search_stage_array);
+	m_search_stage_array->Release();
+	m_search_stage_array = search_stage_array;
+	m_ulPreliminarySearchStages = 1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::StartSearchTimer
+//
+//	@doc:
+//		Start measuring the wall clock time budget of the search, if the
+//		hint configuration sets one; the time spent in preliminary stages
+//		counts against the budget
+//
+//---------------------------------------------------------------------------
+void
+CEngine::StartSearchTimer()
+{
+	m_ulCutoffSearchStage = gpos::ulong_max;
+
+	if (0 < m_ulSearchTimeBudget)
+	{
+		m_search_timer.Restart();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::SetStageTimeBudget
+//
+//	@doc:
+//		Hand the time left of the search budget to the current stage; the
+//		stage times out as soon as either its own time threshold or the
+//		budget is exceeded, and jobs check for time-out at every step
+//
+//---------------------------------------------------------------------------
+void
+CEngine::SetStageTimeBudget()
+{
+	if (0 == m_ulSearchTimeBudget ||
+		m_ulCurrSearchStage < m_ulPreliminarySearchStages)
+	{
+		return;
+	}
+
+	ULONG ulElapsed = m_search_timer.ElapsedMS();
+	ULONG ulRemaining =
+		(ulElapsed < m_ulSearchTimeBudget) ? m_ulSearchTimeBudget - ulElapsed
+										   : 0;
+	PssCurrent()->SetTimeBudget(ulRemaining);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::CheckStageTimeBudget
+//
+//	@doc:
+//		Record the current stage as cut off if it used up the time budget
+//		of the search; this terminates the search, and the best plan found
+//		so far is extracted from the memo
+//
+//---------------------------------------------------------------------------
+void
+CEngine::CheckStageTimeBudget()
+{
+	if (!PssCurrent()->FExhaustedTimeBudget())
+	{
+		return;
+	}
+
+	// report the stage as numbered in the search strategy of the caller
+	GPOS_ASSERT(m_ulPreliminarySearchStages <= m_ulCurrSearchStage);
+	m_ulCutoffSearchStage = m_ulCurrSearchStage - m_ulPreliminarySearchStages;
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(m_mp);
+		at.Os() << "[OPT]: Search time budget of " << m_ulSearchTimeBudget
+				<< "ms exhausted in stage " << m_ulCutoffSearchStage;
+	}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngine::FinalizeSearchStage
@@ -1641,6 +1773,12 @@ CEngine::ProcessTraceFlags()
 				<< ", " << m_pmemo->UlGrpExprs() << " group expressions"
 				<< ", " << m_xforms->Size() << " activated xforms]";
 
+		at.Os() << std::endl
+				<< "[OPT]: Memo rehash (stage " << m_ulCurrSearchStage << "): ["
+				<< m_pmemo->UlRehashPasses() << " passes"
+				<< ", " << m_pmemo->UlRehashedGExprs()
+				<< " rehashed group expressions]";
+
 		at.Os() << std::endl
 				<< "[OPT]: stage " << m_ulCurrSearchStage << " completed in "
 				<< PssCurrent()->UlElapsedTime() << "ms, ";
@@ -1689,9 +1827,11 @@ CEngine::Optimize()
 	sc.Init(m_mp, &jf, &sched, this);
 
 	const ULONG ulSearchStages = m_search_stage_array->Size();
+	StartSearchTimer();
 	for (ULONG ul = 0; !FSearchTerminated() && ul < ulSearchStages; ul++)
 	{
 		PssCurrent()->RestartTimer();
+		SetStageTimeBudget();
 
 		// optimize root group
 		m_pqc->Prpp()->AddRef();
@@ -1717,9 +1857,11 @@ CEngine::Optimize()
 			m_search_stage_array->Size());
 		PssCurrent()->SetBestExpr(pexprPlan);
 
+		CheckStageTimeBudget();
 		FinalizeSearchStage();
 	}
 
+	m_ulpJobs = sched.UlpCompletedJobs();
 
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
@@ -2299,6 +2441,18 @@ CEngine::FCheckReqdProps(CExpressionHandle &exprhdl, CReqdPropPlan *prpp,
 		return false;
 	}
 
+	// similarly, an incremental sort must not be used to establish an
+	// order that its presorted prefix, which it requires from the same
+	// group, already satisfies
+	if (COperator::EopPhysicalSort == op_id &&
+		CPhysicalSort::PopConvert(popPhysical)->FIncremental() &&
+		CPhysicalSort::PopConvert(popPhysical)
+			->PosPresorted()
+			->FSatisfies(prpp->Peo()->PosRequired()))
+	{
+		return false;
+	}
+
 	// check if motion operator is passed an ANY distribution spec;
 	// this check is required to avoid self-deadlocks, i.e.
 	// motion optimizing same group with the same optimization context;
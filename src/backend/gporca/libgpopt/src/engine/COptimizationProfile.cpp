@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		COptimizationProfile.cpp
+//
+//	@doc:
+//		Implementation of per-xform and per-job counters of an
+//		optimization request
+//---------------------------------------------------------------------------
+
+#include "gpopt/engine/COptimizationProfile.h"
+
+using namespace gpopt;
+
+// names of job types, indexed by CJob::EJobType
+static const CHAR *rgszJobTypes[] = {
+	"Test",
+	"GroupOptimization",
+	"GroupImplementation",
+	"GroupExploration",
+	"GroupExpressionOptimization",
+	"GroupExpressionImplementation",
+	"GroupExpressionExploration",
+	"Transformation",
+};
+
+GPOS_CPL_ASSERT(GPOS_ARRAY_SIZE(rgszJobTypes) == CJob::EjtSentinel,
+				"job type names do not match CJob::EJobType");
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::Reset
+//
+//	@doc:
+//		Clear all counters
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::Reset()
+{
+	for (auto &counters : m_rgxform)
+	{
+		counters = SXformCounters();
+	}
+
+	for (auto &counters : m_rgjob)
+	{
+		counters = SJobCounters();
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::Add
+//
+//	@doc:
+//		Add the counters of another profile to this one
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::Add(const COptimizationProfile &profile)
+{
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		const SXformCounters &counters = profile.m_rgxform[ul];
+		m_rgxform[ul].m_ullCalls += counters.m_ullCalls;
+		m_rgxform[ul].m_ullTimeUS += counters.m_ullTimeUS;
+		m_rgxform[ul].m_ullAlternatives += counters.m_ullAlternatives;
+		m_rgxform[ul].m_ullMemoInserts += counters.m_ullMemoInserts;
+	}
+
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		const SJobCounters &counters = profile.m_rgjob[ul];
+		m_rgjob[ul].m_ullExecutions += counters.m_ullExecutions;
+		m_rgjob[ul].m_ullTimeUS += counters.m_ullTimeUS;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::SzJobType
+//
+//	@doc:
+//		Name of a job type
+//
+//---------------------------------------------------------------------------
+const CHAR *
+COptimizationProfile::SzJobType(CJob::EJobType ejt)
+{
+	GPOS_ASSERT(CJob::EjtSentinel > ejt);
+
+	return rgszJobTypes[ejt];
+}
+
+// EOF
@@ -382,6 +382,10 @@ CMDAccessor::~CMDAccessor()
 				<< std::endl;
 		at.Os() << "[OPT]: Total metadata lookup time (including fetch time): "
 				<< m_dLookupTime << "ms" << std::endl;
+		at.Os() << "[OPT]: Metadata cache hits: " << m_pcache->GetHitCounter()
+				<< ", misses: " << m_pcache->GetMissCounter()
+				<< ", evicted entries: "
+				<< m_pcache->GetEvictedEntriesCounter() << std::endl;
 	}
 }
 
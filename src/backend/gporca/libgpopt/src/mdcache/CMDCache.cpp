@@ -109,6 +109,54 @@ CMDCache::ULLGetCacheEvictionCounter()
 	return m_pcache->GetEvictionCounter();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::ULLGetCacheEvictedEntriesCounter
+//
+//	@doc:
+// 		Get the number of entries evicted from this cache
+//
+//---------------------------------------------------------------------------
+ULLONG
+CMDCache::ULLGetCacheEvictedEntriesCounter()
+{
+	GPOS_ASSERT(nullptr != m_pcache);
+
+	return m_pcache->GetEvictedEntriesCounter();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::ULLGetCacheHitCounter
+//
+//	@doc:
+// 		Get the number of lookups that found an entry in this cache
+//
+//---------------------------------------------------------------------------
+ULLONG
+CMDCache::ULLGetCacheHitCounter()
+{
+	GPOS_ASSERT(nullptr != m_pcache);
+
+	return m_pcache->GetHitCounter();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::ULLGetCacheMissCounter
+//
+//	@doc:
+// 		Get the number of lookups that did not find an entry in this cache
+//
+//---------------------------------------------------------------------------
+ULLONG
+CMDCache::ULLGetCacheMissCounter()
+{
+	GPOS_ASSERT(nullptr != m_pcache);
+
+	return m_pcache->GetMissCounter();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDCache::Reset
@@ -261,7 +261,8 @@ CMinidumperUtils::PdxlnExecuteMinidump(CMemoryPool *mp, CDXLMinidump *pdxlmd,
 									   const CHAR *file_name, ULONG ulSegments,
 									   ULONG ulSessionId, ULONG ulCmdId,
 									   COptimizerConfig *optimizer_config,
-									   IConstExprEvaluator *pceeval)
+									   IConstExprEvaluator *pceeval,
+									   SOptimizationStats *pstats)
 {
 	GPOS_ASSERT(nullptr != file_name);
 
@@ -272,7 +273,7 @@ CMinidumperUtils::PdxlnExecuteMinidump(CMemoryPool *mp, CDXLMinidump *pdxlmd,
 
 	CDXLNode *result = CMinidumperUtils::PdxlnExecuteMinidump(
 		mp, factory.Pmda(), pdxlmd, file_name, ulSegments, ulSessionId, ulCmdId,
-		optimizer_config, pceeval);
+		optimizer_config, pceeval, pstats);
 
 	return result;
 }
@@ -290,7 +291,8 @@ CDXLNode *
 CMinidumperUtils::PdxlnExecuteMinidump(
 	CMemoryPool *mp, CMDAccessor *md_accessor, CDXLMinidump *pdxlmd,
 	const CHAR *file_name, ULONG ulSegments, ULONG ulSessionId, ULONG ulCmdId,
-	COptimizerConfig *optimizer_config, IConstExprEvaluator *pceeval)
+	COptimizerConfig *optimizer_config, IConstExprEvaluator *pceeval,
+	SOptimizationStats *pstats)
 {
 	GPOS_ASSERT(nullptr != md_accessor);
 	GPOS_ASSERT(nullptr != pdxlmd->GetQueryDXLRoot() &&
@@ -327,7 +329,7 @@ CMinidumperUtils::PdxlnExecuteMinidump(
 			pdxlmd->PdrgpdxlnQueryOutput(), pdxlmd->GetCTEProducerDXLArray(),
 			pceeval, ulSegments, ulSessionId, ulCmdId,
 			nullptr,  // search_stage_array
-			optimizer_config, file_name);
+			optimizer_config, file_name, pstats);
 	}
 	GPOS_CATCH_EX(ex)
 	{
@@ -18,14 +18,18 @@
 #include "gpopt/base/CDistributionSpecHashed.h"
 #include "gpopt/base/CDistributionSpecNonReplicated.h"
 #include "gpopt/base/CDistributionSpecNonSingleton.h"
+#include "gpopt/base/CDistributionSpecRandom.h"
 #include "gpopt/base/CDistributionSpecReplicated.h"
 #include "gpopt/base/CDistributionSpecSingleton.h"
+#include "gpopt/base/CDistributionSpecSkewHashed.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CPhysicalMotionSkewHashDistribute.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarConst.h"
 #include "gpopt/operators/CScalarIdent.h"
+#include "gpopt/search/CGroupExpression.h"
 
 using namespace gpopt;
 
@@ -493,6 +497,12 @@ CPhysicalHashJoin::PdsDeriveForOuterJoin(CMemoryPool *mp,
 		pdsInner = exprhdl.Pdpplan(0 /*child_index*/)->Pds();
 	}
 
+	if (CDistributionSpec::EdtSkewHashed == pdsOuter->Edt())
+	{
+		// hot outer rows were spread, so the output is not hashed on them
+		return GPOS_NEW(mp) CDistributionSpecRandom();
+	}
+
 	if (CDistributionSpec::EdtHashed == pdsOuter->Edt() &&
 		CDistributionSpec::EdtHashed == pdsInner->Edt())
 	{
@@ -959,6 +969,8 @@ CPhysicalHashJoin::PdsRequiredRedistribute(CMemoryPool *mp,
 // 		Req(N + 1) (hashed, broadcast)
 // 		Req(N + 2) (non-singleton, broadcast)
 // 		Req(N + 3) (singleton, singleton)
+// 		Req(N + 4) (skew-hashed, skew-hashed), only with skew-aware
+// 			redistribution turned on
 //
 //		we always check the distribution delivered by the first child (as
 //		given by child optimization order), and then match the delivered
@@ -1047,6 +1059,15 @@ CPhysicalHashJoin::Ped(CMemoryPool *mp, CExpressionHandle &exprhdl,
 		return GPOS_NEW(mp) CEnfdDistribution(pds, dmatch);
 	}
 
+	if (ulOptReq == ulHashDistributeRequests + GPOPT_NON_HASH_DIST_REQUESTS)
+	{
+		// request N+4 is (skew-hashed, skew-hashed)
+		return GPOS_NEW(mp) CEnfdDistribution(
+			PdsRequiredSkewHashed(mp, exprhdl, pdsInput, child_index,
+								  pdrgpdpCtxt),
+			dmatch);
+	}
+
 	GPOS_ASSERT(ulOptReq == ulHashDistributeRequests + 2);
 
 	// requests N+3 is (singleton, singleton)
@@ -1107,6 +1128,194 @@ CPhysicalHashJoin::PedRightOrFullJoin(
 		dmatch);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::PdsSkewHashed
+//
+//	@doc:
+//		Skew-hashed distribution of the n-th child for the (skew-hashed,
+//		skew-hashed) request, or NULL if no join key is skewed enough.
+//
+//		Both children compute the same pair from the stats of the child
+//		groups: the key and the input to spread are the ones that move the
+//		most hot rows off their segment, net of the copies broadcast from
+//		the other input. Only the outer input of an outer, semi or anti
+//		join may be spread, since its rows must meet all of their matches
+//		on one segment. Both key columns must have the same type for the
+//		two motions to hash the hot keys the same way.
+//
+//---------------------------------------------------------------------------
+CDistributionSpecSkewHashed *
+CPhysicalHashJoin::PdsSkewHashed(CMemoryPool *mp, CExpressionHandle &exprhdl,
+								 ULONG child_index) const
+{
+	const EOperatorId eopid = Eopid();
+	if (EopPhysicalInnerHashJoin != eopid &&
+		EopPhysicalLeftOuterHashJoin != eopid &&
+		EopPhysicalLeftSemiHashJoin != eopid &&
+		EopPhysicalLeftAntiSemiHashJoin != eopid)
+	{
+		return nullptr;
+	}
+
+	CGroupExpression *pgexpr = exprhdl.Pgexpr();
+	if (nullptr == pgexpr)
+	{
+		return nullptr;
+	}
+
+	IStatistics *pstatsOuter = (*pgexpr)[0]->Pstats();
+	IStatistics *pstatsInner = (*pgexpr)[1]->Pstats();
+	const ULONG ulSegments =
+		COptCtxt::PoctxtFromTLS()->GetCostModel()->UlHosts();
+	if (nullptr == pstatsOuter || nullptr == pstatsInner || 1 >= ulSegments)
+	{
+		return nullptr;
+	}
+
+	ULONG ulBestKey = gpos::ulong_max;
+	BOOL fSpreadOuter = true;
+	IDatumArray *pdrgpdatumBest = nullptr;
+	CDouble dBestGain(0.0);
+	CDouble dBestHotFreq(0.0);
+	CDouble dBestMatchFreq(0.0);
+	const ULONG ulSides = (EopPhysicalInnerHashJoin == eopid) ? 2 : 1;
+	for (ULONG ulKey = 0; ulKey < m_pdrgpexprOuterKeys->Size(); ulKey++)
+	{
+		CExpression *pexprOuterKey = (*m_pdrgpexprOuterKeys)[ulKey];
+		CExpression *pexprInnerKey = (*m_pdrgpexprInnerKeys)[ulKey];
+		if (COperator::EopScalarIdent != pexprOuterKey->Pop()->Eopid() ||
+			COperator::EopScalarIdent != pexprInnerKey->Pop()->Eopid())
+		{
+			continue;
+		}
+
+		const CColRef *pcrOuter =
+			CScalarIdent::PopConvert(pexprOuterKey->Pop())->Pcr();
+		const CColRef *pcrInner =
+			CScalarIdent::PopConvert(pexprInnerKey->Pop())->Pcr();
+		if (!pcrOuter->RetrieveType()->MDId()->Equals(
+				pcrInner->RetrieveType()->MDId()))
+		{
+			continue;
+		}
+
+		for (ULONG ulSide = 0; ulSide < ulSides; ulSide++)
+		{
+			const BOOL fOuter = (0 == ulSide);
+			IStatistics *pstatsSpread = fOuter ? pstatsOuter : pstatsInner;
+			IStatistics *pstatsBroadcast = fOuter ? pstatsInner : pstatsOuter;
+
+			CDouble dHotFreq(0.0);
+			IDatumArray *pdrgpdatum =
+				CPhysicalMotionSkewHashDistribute::PdrgpdatumHot(
+					mp, pstatsSpread, fOuter ? pcrOuter : pcrInner,
+					ulSegments, &dHotFreq);
+			if (nullptr == pdrgpdatum)
+			{
+				continue;
+			}
+
+			CDouble dMatchFreq =
+				CPhysicalMotionSkewHashDistribute::DMatchingFreq(
+					pstatsBroadcast, fOuter ? pcrInner : pcrOuter, pdrgpdatum);
+			CDouble dGain(0.0);
+			if (0.0 <= dMatchFreq)
+			{
+				dGain = dHotFreq * pstatsSpread->Rows() -
+						dMatchFreq * pstatsBroadcast->Rows() *
+							CDouble(ulSegments);
+			}
+
+			if (dGain > dBestGain)
+			{
+				CRefCount::SafeRelease(pdrgpdatumBest);
+				pdrgpdatumBest = pdrgpdatum;
+				dBestGain = dGain;
+				dBestHotFreq = dHotFreq;
+				dBestMatchFreq = dMatchFreq;
+				ulBestKey = ulKey;
+				fSpreadOuter = fOuter;
+			}
+			else
+			{
+				pdrgpdatum->Release();
+			}
+		}
+	}
+
+	if (nullptr == pdrgpdatumBest)
+	{
+		return nullptr;
+	}
+
+	// the other rows are hashed on the child's side of the chosen key
+	CExpressionArray *pdrgpexprKeys =
+		(0 == child_index) ? m_pdrgpexprOuterKeys : m_pdrgpexprInnerKeys;
+	CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+	(*pdrgpexprKeys)[ulBestKey]->AddRef();
+	pdrgpexpr->Append((*pdrgpexprKeys)[ulBestKey]);
+
+	IMdIdArray *opfamilies = nullptr;
+	if (GPOS_FTRACE(EopttraceConsiderOpfamiliesForDistribution))
+	{
+		GPOS_ASSERT(nullptr != m_hash_opfamilies);
+		opfamilies = GPOS_NEW(mp) IMdIdArray(mp);
+		IMDId *opfamily = (*m_hash_opfamilies)[ulBestKey];
+		opfamily->AddRef();
+		opfamilies->Append(opfamily);
+	}
+
+	CDistributionSpecHashed *pdsHashed = GPOS_NEW(mp) CDistributionSpecHashed(
+		pdrgpexpr, true /* fNullsCollocated */, opfamilies);
+	if (fSpreadOuter == (0 == child_index))
+	{
+		return GPOS_NEW(mp) CDistributionSpecSkewHashed(
+			pdsHashed, CDistributionSpecSkewHashed::EskmSpread,
+			pdrgpdatumBest, dBestHotFreq);
+	}
+
+	return GPOS_NEW(mp) CDistributionSpecSkewHashed(
+		pdsHashed, CDistributionSpecSkewHashed::EskmBroadcast, pdrgpdatumBest,
+		dBestMatchFreq);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalHashJoin::PdsRequiredSkewHashed
+//
+//	@doc:
+//		Compute (skew-hashed, skew-hashed) optimization request; if no join
+//		key is skewed, this falls back to the redistribute request on all
+//		hash join keys, whose optimization contexts already exist
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalHashJoin::PdsRequiredSkewHashed(CMemoryPool *mp,
+										 CExpressionHandle &exprhdl,
+										 CDistributionSpec *pdsInput,
+										 ULONG child_index,
+										 CDrvdPropArray *pdrgpdpCtxt) const
+{
+	CDistributionSpecSkewHashed *pdsSkewHashed =
+		PdsSkewHashed(mp, exprhdl, child_index);
+	if (nullptr != pdsSkewHashed)
+	{
+		return pdsSkewHashed;
+	}
+
+	CDistributionSpec *pds =
+		PdsRequiredRedistribute(mp, exprhdl, pdsInput, child_index,
+								pdrgpdpCtxt, NumDistrReq() - 1 /*ulOptReq*/);
+	if (CDistributionSpec::EdtHashed == pds->Edt())
+	{
+		CDistributionSpecHashed::PdsConvert(pds)->ComputeEquivHashExprs(
+			mp, exprhdl);
+	}
+
+	return pds;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalHashJoin::PdshashedRequired
@@ -1242,6 +1451,11 @@ CPhysicalHashJoin::CreateOptRequests(CMemoryPool *mp)
 	// Req(N + 3) (singleton, singleton)
 
 	ULONG ulDistrReqs = GPOPT_NON_HASH_DIST_REQUESTS + NumDistrReq();
+	if (GPOS_FTRACE(EopttraceEnableSkewRedistribute))
+	{
+		// Req(N + 4) (skew-hashed, skew-hashed), see PdsSkewHashed
+		ulDistrReqs++;
+	}
 	SetDistrRequests(ulDistrReqs);
 
 	// With DP enabled, there are several (max 10 controlled by macro)
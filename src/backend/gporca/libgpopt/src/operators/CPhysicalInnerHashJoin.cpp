@@ -14,6 +14,7 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CDistributionSpecHashed.h"
+#include "gpopt/base/CDistributionSpecRandom.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPredicateUtils.h"
@@ -221,6 +222,13 @@ CPhysicalInnerHashJoin::PdsDerive(CMemoryPool *mp,
 	CDistributionSpec *pdsOuter = exprhdl.Pdpplan(0 /*child_index*/)->Pds();
 	CDistributionSpec *pdsInner = exprhdl.Pdpplan(1 /*child_index*/)->Pds();
 
+	if (CDistributionSpec::EdtSkewHashed == pdsOuter->Edt())
+	{
+		// a skew-aware pair of inputs meets every pair of matching rows on
+		// exactly one segment, but the output is not co-located on the keys
+		return GPOS_NEW(mp) CDistributionSpecRandom();
+	}
+
 	if (CDistributionSpec::EdtUniversal == pdsOuter->Edt())
 	{
 		// if outer is universal, pass through inner distribution
@@ -13,6 +13,7 @@
 
 #include "gpopt/base/CCastUtils.h"
 #include "gpopt/base/CDistributionSpecAny.h"
+#include "gpopt/base/CDistributionSpecRandom.h"
 #include "gpopt/base/CDistributionSpecReplicated.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CUtils.h"
@@ -417,6 +418,13 @@ CPhysicalJoin::PdsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const
 		pdsInner = exprhdl.Pdpplan(0 /*child_index*/)->Pds();
 	}
 
+	if (CDistributionSpec::EdtSkewHashed == pdsOuter->Edt())
+	{
+		// inputs routed by a pair of skew-aware motions, see
+		// CDistributionSpecSkewHashed
+		return GPOS_NEW(mp) CDistributionSpecRandom();
+	}
+
 	CDistributionSpec *pds;
 
 	if ((CDistributionSpec::EdtStrictReplicated == pdsOuter->Edt() ||
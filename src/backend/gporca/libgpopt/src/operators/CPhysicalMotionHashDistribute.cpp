@@ -210,7 +210,8 @@ CPhysicalMotionHashDistribute *
 CPhysicalMotionHashDistribute::PopConvert(COperator *pop)
 {
 	GPOS_ASSERT(nullptr != pop);
-	GPOS_ASSERT(EopPhysicalMotionHashDistribute == pop->Eopid());
+	GPOS_ASSERT(EopPhysicalMotionHashDistribute == pop->Eopid() ||
+				EopPhysicalMotionSkewHashDistribute == pop->Eopid());
 
 	return dynamic_cast<CPhysicalMotionHashDistribute *>(pop);
 }
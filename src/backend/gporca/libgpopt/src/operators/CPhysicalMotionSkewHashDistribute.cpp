@@ -0,0 +1,307 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2023 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPhysicalMotionSkewHashDistribute.cpp
+//
+//	@doc:
+//		Implementation of skew-aware hash distribute motion operator
+//---------------------------------------------------------------------------
+
+#include "gpopt/operators/CPhysicalMotionSkewHashDistribute.h"
+
+#include "gpos/base.h"
+
+#include "naucrates/statistics/CStatistics.h"
+
+using namespace gpopt;
+using namespace gpnaucrates;
+
+// a key is hot if its rows alone make up this share of the rows a segment
+// receives with an even distribution
+#define GPOPT_SKEW_HOT_KEY_SEGMENT_SHARE 0.5
+
+// maximum number of hot keys of a motion, every row is checked against all
+// of them
+#define GPOPT_SKEW_MAX_HOT_KEYS 32
+
+// is the datum in the array
+static BOOL
+FDatumInArray(const IDatum *datum, const IDatumArray *pdrgpdatum)
+{
+	for (ULONG ul = 0; ul < pdrgpdatum->Size(); ul++)
+	{
+		if (datum->Matches((*pdrgpdatum)[ul]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// the hashed spec of a skew-hashed one, with a reference for the caller
+static CDistributionSpecHashed *
+PdsHashedRef(CDistributionSpecSkewHashed *pdsSkewHashed)
+{
+	CDistributionSpecHashed *pdsHashed = pdsSkewHashed->PdsHashed();
+	pdsHashed->AddRef();
+
+	return pdsHashed;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::CPhysicalMotionSkewHashDistribute
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalMotionSkewHashDistribute::CPhysicalMotionSkewHashDistribute(
+	CMemoryPool *mp, CDistributionSpecSkewHashed *pdsSkewHashed)
+	: CPhysicalMotionHashDistribute(mp, PdsHashedRef(pdsSkewHashed)),
+	  m_pdsSkewHashed(pdsSkewHashed)
+{
+	GPOS_ASSERT(nullptr != pdsSkewHashed);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::~CPhysicalMotionSkewHashDistribute
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalMotionSkewHashDistribute::~CPhysicalMotionSkewHashDistribute()
+{
+	m_pdsSkewHashed->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::Matches
+//
+//	@doc:
+//		Match operators
+//
+//---------------------------------------------------------------------------
+BOOL
+CPhysicalMotionSkewHashDistribute::Matches(COperator *pop) const
+{
+	if (Eopid() != pop->Eopid())
+	{
+		return false;
+	}
+
+	return m_pdsSkewHashed->Matches(
+		CPhysicalMotionSkewHashDistribute::PopConvert(pop)->Pds());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::OsPrint
+//
+//	@doc:
+//		Debug print
+//
+//---------------------------------------------------------------------------
+IOstream &
+CPhysicalMotionSkewHashDistribute::OsPrint(IOstream &os) const
+{
+	os << SzId() << " "
+	   << (CDistributionSpecSkewHashed::EskmSpread == Eskm() ? "Spread"
+															 : "Broadcast")
+	   << " " << PdrgpdatumHot()->Size() << " hot keys ";
+
+	return PdsHashed()->OsPrintWithPrefix(
+		os, "                                        ");
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::PopConvert
+//
+//	@doc:
+//		Conversion function
+//
+//---------------------------------------------------------------------------
+CPhysicalMotionSkewHashDistribute *
+CPhysicalMotionSkewHashDistribute::PopConvert(COperator *pop)
+{
+	GPOS_ASSERT(nullptr != pop);
+	GPOS_ASSERT(EopPhysicalMotionSkewHashDistribute == pop->Eopid());
+
+	return dynamic_cast<CPhysicalMotionSkewHashDistribute *>(pop);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::PdrgpdatumHot
+//
+//	@doc:
+//		The most common values of a column whose rows alone fill a good
+//		share of a segment, taken from the singleton buckets of the column
+//		histogram. Returns nullptr if there is no skew, and the total
+//		frequency of the hot keys in pdHotFreq otherwise.
+//
+//---------------------------------------------------------------------------
+IDatumArray *
+CPhysicalMotionSkewHashDistribute::PdrgpdatumHot(CMemoryPool *mp,
+												 IStatistics *stats,
+												 const CColRef *colref,
+												 ULONG ulSegments,
+												 CDouble *pdHotFreq)
+{
+	// the skew estimate of the histogram sample tells if the hot keys are
+	// worth looking for
+	if (nullptr == stats || stats->GetSkew(colref->Id()) <= 1.0)
+	{
+		return nullptr;
+	}
+
+	const CHistogram *histogram =
+		CStatistics::CastStats(stats)->GetHistogram(colref->Id());
+	if (nullptr == histogram || !histogram->IsValid())
+	{
+		return nullptr;
+	}
+
+	// pick the singleton buckets over the threshold, most frequent first
+	const CBucketArray *pdrgpbucket = histogram->GetBuckets();
+	const CDouble dMinFreq =
+		CDouble(GPOPT_SKEW_HOT_KEY_SEGMENT_SHARE) / CDouble(ulSegments);
+	IDatumArray *pdrgpdatum = GPOS_NEW(mp) IDatumArray(mp);
+	CDouble dHotFreq(0.0);
+	while (pdrgpdatum->Size() < GPOPT_SKEW_MAX_HOT_KEYS)
+	{
+		CBucket *pbucketMax = nullptr;
+		for (ULONG ul = 0; ul < pdrgpbucket->Size(); ul++)
+		{
+			CBucket *bucket = (*pdrgpbucket)[ul];
+			if (bucket->IsSingleton() && bucket->GetFrequency() >= dMinFreq &&
+				(nullptr == pbucketMax ||
+				 bucket->GetFrequency() > pbucketMax->GetFrequency()) &&
+				!FDatumInArray(bucket->GetLowerBound()->GetDatum(), pdrgpdatum))
+			{
+				pbucketMax = bucket;
+			}
+		}
+		if (nullptr == pbucketMax)
+		{
+			break;
+		}
+
+		IDatum *datum = pbucketMax->GetLowerBound()->GetDatum();
+		datum->AddRef();
+		pdrgpdatum->Append(datum);
+		dHotFreq = dHotFreq + pbucketMax->GetFrequency();
+	}
+
+	if (0 == pdrgpdatum->Size())
+	{
+		pdrgpdatum->Release();
+		return nullptr;
+	}
+
+	*pdHotFreq = dHotFreq;
+	return pdrgpdatum;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::DMatchingFreq
+//
+//	@doc:
+//		Estimated fraction of the rows whose column matches one of the given
+//		keys, from the histogram of the column
+//
+//---------------------------------------------------------------------------
+CDouble
+CPhysicalMotionSkewHashDistribute::DMatchingFreq(IStatistics *stats,
+												 const CColRef *colref,
+												 IDatumArray *pdrgpdatum)
+{
+	if (nullptr == stats)
+	{
+		return CDouble(-1.0);
+	}
+
+	const CHistogram *histogram =
+		CStatistics::CastStats(stats)->GetHistogram(colref->Id());
+	if (nullptr == histogram || !histogram->IsValid())
+	{
+		return CDouble(-1.0);
+	}
+
+	const CBucketArray *pdrgpbucket = histogram->GetBuckets();
+	CDouble dFreq(0.0);
+	for (ULONG ulDatum = 0; ulDatum < pdrgpdatum->Size(); ulDatum++)
+	{
+		IDatum *datum = (*pdrgpdatum)[ulDatum];
+		for (ULONG ul = 0; ul < pdrgpbucket->Size(); ul++)
+		{
+			CBucket *bucket = (*pdrgpbucket)[ul];
+			if (!bucket->GetLowerBound()->GetDatum()->StatsAreComparable(
+					datum))
+			{
+				return CDouble(-1.0);
+			}
+
+			CPoint point(datum);
+			if (bucket->Contains(&point))
+			{
+				// assume the values of a bucket are equally frequent
+				dFreq = dFreq + bucket->GetFrequency() /
+									std::max(CDouble(1.0),
+											 bucket->GetNumDistinct());
+				break;
+			}
+		}
+	}
+
+	return dFreq;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMotionSkewHashDistribute::DMaxKeyFreq
+//
+//	@doc:
+//		Estimated fraction of the rows carrying the most frequent value of a
+//		column, from the singleton buckets of the column histogram
+//
+//---------------------------------------------------------------------------
+CDouble
+CPhysicalMotionSkewHashDistribute::DMaxKeyFreq(IStatistics *stats,
+											   const CColRef *colref)
+{
+	if (nullptr == stats)
+	{
+		return CDouble(0.0);
+	}
+
+	const CHistogram *histogram =
+		CStatistics::CastStats(stats)->GetHistogram(colref->Id());
+	if (nullptr == histogram || !histogram->IsValid())
+	{
+		return CDouble(0.0);
+	}
+
+	const CBucketArray *pdrgpbucket = histogram->GetBuckets();
+	CDouble dMaxFreq(0.0);
+	for (ULONG ul = 0; ul < pdrgpbucket->Size(); ul++)
+	{
+		CBucket *bucket = (*pdrgpbucket)[ul];
+		if (bucket->IsSingleton() && bucket->GetFrequency() > dMaxFreq)
+		{
+			dMaxFreq = bucket->GetFrequency();
+		}
+	}
+
+	return dMaxFreq;
+}
+
+// EOF
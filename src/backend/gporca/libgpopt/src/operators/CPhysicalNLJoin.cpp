@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 
+#include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CRewindabilitySpec.h"
 #include "gpopt/operators/CExpressionHandle.h"
@@ -20,6 +21,7 @@
 #include "gpopt/operators/CPhysicalCorrelatedInnerNLJoin.h"
 #include "gpopt/operators/CPhysicalCorrelatedLeftOuterNLJoin.h"
 #include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 
 using namespace gpopt;
 
@@ -202,5 +204,87 @@ CPhysicalNLJoin::EpetOrder(CExpressionHandle &exprhdl,
 	return CEnfdProp::EpetRequired;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalNLJoin::DMemoizeKeys
+//
+//	@doc:
+//		Estimated number of distinct values of the outer columns the inner
+//		child references, which key the rows of a Memoize cache over it.
+//		The number of such columns is returned in pulKeys
+//
+//---------------------------------------------------------------------------
+CDouble
+CPhysicalNLJoin::DMemoizeKeys(IStatistics *pstatsOuter,
+							  CColRefSet *pcrsOuterRefs,
+							  CColRefSet *pcrsOuterOutput, ULONG *pulKeys)
+{
+	GPOS_ASSERT(nullptr != pstatsOuter);
+	GPOS_ASSERT(nullptr != pulKeys);
+
+	CDouble dDistinct(1.0);
+	*pulKeys = 0;
+	CColRefSetIter crsi(*pcrsOuterRefs);
+	while (crsi.Advance())
+	{
+		CColRef *colref = crsi.Pcr();
+		if (pcrsOuterOutput->FMember(colref))
+		{
+			dDistinct = dDistinct * pstatsOuter->GetNDVs(colref);
+			(*pulKeys)++;
+		}
+	}
+
+	if (0 == *pulKeys)
+	{
+		return CDouble(0.0);
+	}
+
+	return dDistinct;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalNLJoin::DMemoizeHitRatio
+//
+//	@doc:
+//		Expected fraction of the rescans of the inner child served by a
+//		Memoize cache over it. Only the first rescan with each key misses,
+//		as long as the rows of all the keys fit in the memory limit of the
+//		cache; otherwise only the share of the keys that fit can hit.
+//		Returns zero if the ratio is too small for the cache to pay off
+//
+//---------------------------------------------------------------------------
+CDouble
+CPhysicalNLJoin::DMemoizeHitRatio(CDouble dRowsOuter, CDouble dDistinctKeys,
+								  CDouble dRowsInner, CDouble dWidthInner)
+{
+	if (1.0 > dDistinctKeys || dDistinctKeys >= dRowsOuter)
+	{
+		return CDouble(0.0);
+	}
+
+	// a cache entry holds the inner rows of one key, with a tuple header
+	// per row and the hash table entry
+	const CDouble dEntryBytes =
+		std::max(dRowsInner.Get(), 1.0) * (dWidthInner + 24.0) + 64.0;
+	const CDouble dMemoryBytes = CDouble(COptCtxt::PoctxtFromTLS()
+											 ->GetOptimizerConfig()
+											 ->GetHint()
+											 ->UlMemoizeMemoryLimit()) *
+								 1024.0;
+	const CDouble dFitting =
+		std::min((dMemoryBytes / dEntryBytes).Get(), dDistinctKeys.Get());
+
+	const CDouble dHitRatio =
+		(CDouble(1.0) - dDistinctKeys / dRowsOuter) * (dFitting / dDistinctKeys);
+	if (GPOPT_MEMOIZE_MIN_HIT_RATIO > dHitRatio)
+	{
+		return CDouble(0.0);
+	}
+
+	return dHitRatio;
+}
+
 
 // EOF
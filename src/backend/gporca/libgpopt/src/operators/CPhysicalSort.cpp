@@ -14,6 +14,7 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CCTEMap.h"
+#include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/operators/CExpressionHandle.h"
 
@@ -28,14 +29,22 @@ using namespace gpopt;
 //		Ctor
 //
 //---------------------------------------------------------------------------
-CPhysicalSort::CPhysicalSort(CMemoryPool *mp, COrderSpec *pos)
+CPhysicalSort::CPhysicalSort(CMemoryPool *mp, COrderSpec *pos,
+							 ULONG ulPresortedCols)
 	: CPhysical(mp),
 	  m_pos(pos),  // caller must add-ref pos
-	  m_pcrsSort(nullptr)
+	  m_pcrsSort(nullptr),
+	  m_ulPresortedCols(ulPresortedCols),
+	  m_posPresorted(nullptr)
 {
 	GPOS_ASSERT(nullptr != pos);
+	GPOS_ASSERT(ulPresortedCols < pos->UlSortColumns());
 
 	m_pcrsSort = Pos()->PcrsUsed(mp);
+	if (FIncremental())
+	{
+		m_posPresorted = pos->PosPrefix(mp, ulPresortedCols);
+	}
 }
 
 
@@ -51,6 +60,7 @@ CPhysicalSort::~CPhysicalSort()
 {
 	m_pos->Release();
 	m_pcrsSort->Release();
+	CRefCount::SafeRelease(m_posPresorted);
 }
 
 
@@ -71,7 +81,8 @@ CPhysicalSort::Matches(COperator *pop) const
 	}
 
 	CPhysicalSort *popSort = CPhysicalSort::PopConvert(pop);
-	return m_pos->Matches(popSort->Pos());
+	return m_ulPresortedCols == popSort->UlPresortedCols() &&
+		   m_pos->Matches(popSort->Pos());
 }
 
 
@@ -125,6 +136,14 @@ CPhysicalSort::PosRequired(CMemoryPool *mp,
 {
 	GPOS_ASSERT(0 == child_index);
 
+	if (FIncremental())
+	{
+		// incremental sort relies on its child to deliver the presorted
+		// prefix of the established order
+		m_posPresorted->AddRef();
+		return m_posPresorted;
+	}
+
 	// sort operator is order-establishing and does not require child to deliver
 	// any sort order; we return an empty sort order as child requirement
 	return GPOS_NEW(mp) COrderSpec(mp);
@@ -162,18 +181,20 @@ CPhysicalSort::PdsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
 //---------------------------------------------------------------------------
 CRewindabilitySpec *
 CPhysicalSort::PrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
-						   CRewindabilitySpec *,  //prsRequired,
-						   ULONG
-#ifdef GPOS_DEBUG
-							   child_index
-#endif	// GPOPS_DEBUG
-						   ,
+						   CRewindabilitySpec *prsRequired, ULONG child_index,
 						   CDrvdPropArray *,  // pdrgpdpCtxt
 						   ULONG			  // ulOptReq
 ) const
 {
 	GPOS_ASSERT(0 == child_index);
 
+	if (FIncremental())
+	{
+		// incremental sort streams the groups of its input and re-reads
+		// the input when rescanned, so it passes the request through
+		return PrsPassThru(mp, exprhdl, prsRequired, child_index);
+	}
+
 	// Sort establishes rewindability on its own. It does not require motion
 	// hazard handling since it is inherently blocking. However, if it contains
 	// outer refs in its subtree, a Rescannable request should be sent, so that
@@ -280,10 +301,15 @@ CPhysicalSort::PdsDerive(CMemoryPool *,	 // mp
 //
 //---------------------------------------------------------------------------
 CRewindabilitySpec *
-CPhysicalSort::PrsDerive(CMemoryPool *mp,
-						 CExpressionHandle &  // exprhdl
-) const
+CPhysicalSort::PrsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const
 {
+	if (FIncremental())
+	{
+		// incremental sort keeps no more than the current group, so it
+		// cannot restore marked positions
+		return PrsDerivePassThruOuter(mp, exprhdl);
+	}
+
 	// rewindability of output is always true
 	return GPOS_NEW(mp) CRewindabilitySpec(CRewindabilitySpec::ErtMarkRestore,
 										   CRewindabilitySpec::EmhtNoMotion);
@@ -349,10 +375,22 @@ CPhysicalSort::EpetDistribution(CExpressionHandle & /*exprhdl*/,
 //
 //---------------------------------------------------------------------------
 CEnfdProp::EPropEnforcingType
-CPhysicalSort::EpetRewindability(CExpressionHandle &,		 // exprhdl
-								 const CEnfdRewindability *	 // per
-) const
+CPhysicalSort::EpetRewindability(CExpressionHandle &exprhdl,
+								 const CEnfdRewindability *per) const
 {
+	if (FIncremental())
+	{
+		CRewindabilitySpec *prs = CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Prs();
+		if (per->FCompatible(prs))
+		{
+			// required rewindability is already provided
+			return CEnfdProp::EpetUnnecessary;
+		}
+
+		// rewindability is enforced on operator's output
+		return CEnfdProp::EpetRequired;
+	}
+
 	// no need for enforcing rewindability on output
 	return CEnfdProp::EpetUnnecessary;
 }
@@ -369,6 +407,10 @@ IOstream &
 CPhysicalSort::OsPrint(IOstream &os) const
 {
 	os << SzId() << "  ";
+	if (FIncremental())
+	{
+		os << "presorted: " << m_ulPresortedCols << " ";
+	}
 	return Pos()->OsPrint(os);
 }
 
@@ -234,7 +234,8 @@ COptimizer::PdxlnOptimize(
 	ULONG ulHosts,	// actual number of data nodes in the system
 	ULONG ulSessionId, ULONG ulCmdId, CSearchStageArray *search_stage_array,
 	COptimizerConfig *optimizer_config,
-	const CHAR *szMinidumpFileName	// name of minidump file to be created
+	const CHAR *szMinidumpFileName,	 // name of minidump file to be created
+	SOptimizationStats *pstats	// output: statistics of the request
 )
 {
 	GPOS_ASSERT(nullptr != md_accessor);
@@ -250,10 +251,9 @@ COptimizer::PdxlnOptimize(
 	CMiniDumperDXL mdmp;
 	CAutoP<std::wofstream> wosMinidump;
 	CAutoP<COstreamBasic> osMinidump;
+	CHAR file_name[GPOS_FILE_NAME_BUF_SIZE];
 	if (fMinidump)
 	{
-		CHAR file_name[GPOS_FILE_NAME_BUF_SIZE];
-
 		CMinidumperUtils::GenerateMinidumpFileName(
 			file_name, GPOS_FILE_NAME_BUF_SIZE, ulSessionId, ulCmdId,
 			szMinidumpFileName);
@@ -267,6 +267,11 @@ COptimizer::PdxlnOptimize(
 		mdmp.Init(osMinidump.Value());
 	}
 	CDXLNode *pdxlnPlan = nullptr;
+	SOptimizationStats stats;
+	if (nullptr != pstats)
+	{
+		stats.m_pprofile = pstats->m_pprofile;
+	}
 	CErrorHandlerStandard errhdl;
 	GPOS_TRY_HDL(&errhdl)
 	{
@@ -315,7 +320,8 @@ COptimizer::PdxlnOptimize(
 
 			GPOS_CHECK_ABORT;
 			// optimize logical expression tree into physical expression tree.
-			CExpression *pexprPlan = PexprOptimize(mp, pqc, search_stage_array);
+			CExpression *pexprPlan = PexprOptimize(
+				mp, pqc, search_stage_array, &stats);
 			GPOS_CHECK_ABORT;
 
 			CPlanHint *plan_hint =
@@ -344,6 +350,15 @@ COptimizer::PdxlnOptimize(
 					optimizer_config->GetEnumeratorCfg()->GetPlanSpaceSize());
 				CMinidumperUtils::Finalize(&mdmp, true /* fSerializeErrCtxt*/);
 				GPOS_CHECK_ABORT;
+
+				// re-encode the complete minidump; minidumps of failed
+				// optimizations are left in XML
+				if (GPOS_FTRACE(EopttraceMinidumpBinary))
+				{
+					wosMinidump->close();
+					CDXLUtils::SerializeDXLFileToBinary(mp, file_name,
+														file_name);
+				}
 			}
 
 			if (GPOS_FTRACE(EopttraceSamplePlans))
@@ -371,6 +386,11 @@ COptimizer::PdxlnOptimize(
 	}
 	GPOS_CATCH_END;
 
+	if (nullptr != pstats)
+	{
+		*pstats = stats;
+	}
+
 	return pdxlnPlan;
 }
 
@@ -428,12 +448,21 @@ COptimizer::CheckCTEConsistency(CMemoryPool *mp, CExpression *pexpr)
 //---------------------------------------------------------------------------
 CExpression *
 COptimizer::PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-						  CSearchStageArray *search_stage_array)
+						  CSearchStageArray *search_stage_array,
+						  SOptimizationStats *pstats)
 {
+	GPOS_ASSERT(nullptr != pstats);
+
 	CEngine eng(mp);
 	eng.Init(pqc, search_stage_array);
+	eng.SetProfile(pstats->m_pprofile);
 	eng.Optimize();
 
+	pstats->m_ulCutoffSearchStage = eng.UlCutoffSearchStage();
+	pstats->m_ullJobs = eng.UlpJobs();
+	pstats->m_ullGroups = eng.Pmemo()->UlpGroups();
+	pstats->m_ullGroupExprs = eng.Pmemo()->UlGrpExprs();
+
 	GPOS_CHECK_ABORT;
 
 	CExpression *pexprPlan = eng.PexprExtractPlan();
@@ -939,8 +939,15 @@ CGroup::ResolveDuplicateCoordinator()
 		pgroupTarget = pgroupTarget->m_pgroupDuplicate;
 	}
 
-	// update reference to target group
-	m_pgroupDuplicate = pgroupTarget;
+	// update reference to target group, along with the references of all
+	// groups on the path, so that later lookups take a single step
+	CGroup *pgroup = this;
+	while (pgroup->m_pgroupDuplicate != pgroupTarget)
+	{
+		CGroup *pgroupNext = pgroup->m_pgroupDuplicate;
+		pgroup->m_pgroupDuplicate = pgroupTarget;
+		pgroup = pgroupNext;
+	}
 }
 
 
@@ -66,6 +66,8 @@ CGroupExpression::CGroupExpression(CMemoryPool *mp, COperator *pop,
 	GPOS_ASSERT(nullptr != pdrgpgroup);
 	GPOS_ASSERT_IMP(exfid != CXform::ExfInvalid, nullptr != pgexprOrigin);
 
+	m_ulHash = HashValue(pop, pdrgpgroup);
+
 	// store sorted array of children for faster comparison
 	if (1 < pdrgpgroup->Size() && !pop->FInputOrderSensitive())
 	{
@@ -957,6 +959,31 @@ CGroupExpression::HashValue(COperator *pop, CGroupArray *pdrgpgroup)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::FHashValueChanged
+//
+//	@doc:
+//		Check if the hash value changed; a merged group hashes like the
+//		group it was merged into, so only group expressions with a merged
+//		child group may have a different hash value now
+//
+//---------------------------------------------------------------------------
+BOOL
+CGroupExpression::FHashValueChanged() const
+{
+	BOOL fMergedChild = false;
+	const ULONG arity = Arity();
+	for (ULONG ul = 0; ul < arity && !fMergedChild; ul++)
+	{
+		CGroup *pgroup = (*m_pdrgpgroup)[ul];
+		fMergedChild = pgroup->FDuplicateGroup() && 0 == pgroup->UlGExprs();
+	}
+
+	return fMergedChild && m_ulHash != HashValue(m_pop, m_pdrgpgroup);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CGroupExpression::HashValue
@@ -11,7 +11,10 @@
 
 #include "gpopt/search/CJobTransformation.h"
 
+#include "gpos/common/CWallClock.h"
+
 #include "gpopt/engine/CEngine.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/operators/CLogical.h"
 #include "gpopt/search/CGroup.h"
 #include "gpopt/search/CGroupExpression.h"
@@ -133,8 +136,17 @@ CJobTransformation::EevtTransform(CSchedulerContext *psc, CJob *pjOwner)
 	CXformResult *pxfres = GPOS_NEW(pmpGlobal) CXformResult(pmpGlobal);
 	ULONG ulElapsedTime = 0;
 	ULONG ulNumberOfBindings = 0;
+	CWallClock clock;
 	pgexpr->Transform(pmpGlobal, pmpLocal, pxform, pxfres, &ulElapsedTime,
 					  &ulNumberOfBindings);
+
+	COptimizationProfile *pprofile = psc->Peng()->Pprofile();
+	if (nullptr != pprofile)
+	{
+		pprofile->RecordXform(pxform->Exfid(), clock.ElapsedUS(),
+							  pxfres->Pdrgpexpr()->Size());
+	}
+
 	psc->Peng()->InsertXformResult(pgexpr->Pgroup(), pxfres, pxform->Exfid(),
 								   pgexpr, ulElapsedTime, ulNumberOfBindings);
 	pxfres->Release();
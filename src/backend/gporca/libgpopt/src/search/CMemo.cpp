@@ -47,7 +47,9 @@ CMemo::CMemo(CMemoryPool *mp)
 	  m_aul(0),
 	  m_pgroupRoot(nullptr),
 	  m_ulpGrps(0),
-	  m_pmemotmap(nullptr)
+	  m_pmemotmap(nullptr),
+	  m_ulRehashPasses(0),
+	  m_ulRehashedGExprs(0)
 {
 	GPOS_ASSERT(nullptr != mp);
 
@@ -462,7 +464,8 @@ CMemo::MarkDuplicates(CGroup *pgroupFst, CGroup *pgroupSnd)
 //		CMemo::FRehash
 //
 //	@doc:
-//		Delete then re-insert all group expressions in memo hash table;
+//		Delete then re-insert group expressions whose hash value changed
+//		in memo hash table;
 //		we do this at the end of exploration phase since identified
 //		duplicate groups during exploration may cause changing hash values
 //		of current group expressions,
@@ -470,6 +473,10 @@ CMemo::MarkDuplicates(CGroup *pgroupFst, CGroup *pgroupSnd)
 //		identifying duplicate group expressions that can be skipped from
 //		further processing;
 //
+//		only group expressions with a child group that was merged can
+//		change their hash value, and only those can turn into duplicates
+//		of other group expressions, so all others stay in place;
+//
 //		the function returns TRUE if rehashing resulted in discovering
 //		new duplicate groups;
 //
@@ -484,23 +491,37 @@ CMemo::FRehash()
 	GPOS_ASSERT(m_pgroupRoot->FExplored());
 	GPOS_ASSERT(!m_pgroupRoot->FImplemented());
 
-	// dump memo hash table into a local list
+	m_ulRehashPasses++;
+
+	// move group expressions with changed hash values from memo hash table
+	// into a local list
 	CList<CGroupExpression> listGExprs;
 	listGExprs.Init(GPOS_OFFSET(CGroupExpression, m_linkMemo));
 
-	ShtIter shtit(m_sht);
-	CGroupExpression *pgexpr = nullptr;
-	while (nullptr != pgexpr || shtit.Advance())
+	CGroup *pgroupMemo = m_listGroups.PtFirst();
+	while (nullptr != pgroupMemo)
 	{
+		CGroupProxy gp(pgroupMemo);
+		CGroupExpression *pgexpr = gp.PgexprFirst();
+		while (nullptr != pgexpr)
 		{
-			ShtAccIter shtitacc(shtit);
-			pgexpr = shtitacc.Value();
-			if (nullptr != pgexpr)
+			if (pgexpr->FHashValueChanged())
 			{
-				shtitacc.Remove(pgexpr);
+				// hash table accessor scope, using the old hash value
+				{
+					ShtAcc shta(m_sht, *pgexpr);
+					shta.Remove(pgexpr);
+				}
+
+				pgexpr->UpdateHashValue();
 				listGExprs.Append(pgexpr);
+				m_ulRehashedGExprs++;
 			}
+
+			pgexpr = gp.PgexprNext(pgexpr);
 		}
+
+		pgroupMemo = m_listGroups.Next(pgroupMemo);
 		GPOS_CHECK_ABORT;
 	}
 
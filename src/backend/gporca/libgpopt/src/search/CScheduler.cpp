@@ -12,8 +12,11 @@
 #include "gpopt/search/CScheduler.h"
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/error/CAutoTrace.h"
 
+#include "gpopt/engine/CEngine.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/search/CJobFactory.h"
 #include "gpopt/search/CSchedulerContext.h"
 #include "naucrates/traceflags/traceflags.h"
@@ -112,6 +115,7 @@ CScheduler::ExecuteJobs(CSchedulerContext *psc)
 {
 	CJob *pj = nullptr;
 	ULONG count = 0;
+	COptimizationProfile *pprofile = psc->Peng()->Pprofile();
 
 	// keep retrieving jobs
 	while (nullptr != (pj = PjRetrieve()))
@@ -120,7 +124,13 @@ CScheduler::ExecuteJobs(CSchedulerContext *psc)
 		PreExecute(pj);
 
 		// execute job
+		CWallClock clock;
+		const CJob::EJobType ejt = pj->Ejt();
 		BOOL fCompleted = FExecute(pj, psc);
+		if (nullptr != pprofile)
+		{
+			pprofile->RecordJob(ejt, clock.ElapsedUS());
+		}
 
 #ifdef GPOS_DEBUG
 		// restrict parallelism to keep track of jobs
@@ -32,7 +32,8 @@ CSearchStage::CSearchStage(CXformSet *xform_set, ULONG ulTimeThreshold,
 	  m_time_threshold(ulTimeThreshold),
 	  m_cost_threshold(costThreshold),
 	  m_pexprBest(nullptr),
-	  m_costBest(GPOPT_INVALID_COST)
+	  m_costBest(GPOPT_INVALID_COST),
+	  m_time_budget(gpos::ulong_max)
 {
 	GPOS_ASSERT(nullptr != xform_set);
 	GPOS_ASSERT(0 < xform_set->Size());
@@ -128,4 +129,50 @@ CSearchStage::PdrgpssDefault(CMemoryPool *mp)
 	return search_stage_array;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchStage::PdrgpssWithPreliminaryStage
+//
+//	@doc:
+//		Generate a copy of the given search strategy preceded by a stage
+//		that explores without join order xforms; the preliminary stage
+//		is cheap and completes a plan in the memo, which later stages can
+//		only improve on, even if they are cut off before they finish
+//
+//---------------------------------------------------------------------------
+CSearchStageArray *
+CSearchStage::PdrgpssWithPreliminaryStage(
+	CMemoryPool *mp, const CSearchStageArray *search_stage_array)
+{
+	GPOS_ASSERT(nullptr != search_stage_array);
+
+	CXformSet *xform_set = GPOS_NEW(mp) CXformSet(mp);
+	xform_set->Union(CXformFactory::Pxff()->PxfsExploration());
+
+	CBitSet *pbsJoinOrder = CXform::PbsJoinOrderInQueryXforms(mp);
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		if (pbsJoinOrder->Get(GPOPT_DISABLE_XFORM_TF(ul)))
+		{
+			(void) xform_set->ExchangeClear((CXform::EXformId) ul);
+		}
+	}
+	pbsJoinOrder->Release();
+
+	CSearchStageArray *pdrgpss = GPOS_NEW(mp) CSearchStageArray(mp);
+	pdrgpss->Append(GPOS_NEW(mp) CSearchStage(xform_set));
+
+	const ULONG ulStages = search_stage_array->Size();
+	for (ULONG ul = 0; ul < ulStages; ul++)
+	{
+		CSearchStage *pss = (*search_stage_array)[ul];
+		pss->GetXformSet()->AddRef();
+		pdrgpss->Append(GPOS_NEW(mp) CSearchStage(
+			pss->GetXformSet(), pss->TimeThreshold(), pss->CostThreshold()));
+	}
+
+	return pdrgpss;
+}
+
 // EOF
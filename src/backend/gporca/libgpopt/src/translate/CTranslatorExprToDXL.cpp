@@ -54,6 +54,7 @@
 #include "gpopt/operators/CPhysicalMotionHashDistribute.h"
 #include "gpopt/operators/CPhysicalMotionRandom.h"
 #include "gpopt/operators/CPhysicalMotionRoutedDistribute.h"
+#include "gpopt/operators/CPhysicalMotionSkewHashDistribute.h"
 #include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
 #include "gpopt/operators/CPhysicalScalarAgg.h"
@@ -449,6 +450,7 @@ CTranslatorExprToDXL::CreateDXLNode(CExpression *pexpr,
 		case COperator::EopPhysicalMotionGather:
 		case COperator::EopPhysicalMotionBroadcast:
 		case COperator::EopPhysicalMotionHashDistribute:
+		case COperator::EopPhysicalMotionSkewHashDistribute:
 		case COperator::EopPhysicalMotionRoutedDistribute:
 		case COperator::EopPhysicalMotionRandom:
 			dxlnode = CTranslatorExprToDXL::PdxlnMotion(
@@ -3138,8 +3140,8 @@ CTranslatorExprToDXL::PdxlnSort(CExpression *pexprSort,
 	CDXLNode *filter_dxlnode = PdxlnFilter(nullptr);
 
 	// construct a sort node
-	CDXLPhysicalSort *pdxlopSort =
-		GPOS_NEW(m_mp) CDXLPhysicalSort(m_mp, false /*discard_duplicates*/);
+	CDXLPhysicalSort *pdxlopSort = GPOS_NEW(m_mp) CDXLPhysicalSort(
+		m_mp, false /*discard_duplicates*/, popSort->UlPresortedCols());
 
 	// construct sort node from its components
 	CDXLNode *pdxlnSort = GPOS_NEW(m_mp) CDXLNode(m_mp, pdxlopSort);
@@ -3931,6 +3933,25 @@ CTranslatorExprToDXL::PdxlnCorrelatedNLJoin(
 	{
 		BuildSubplans(pexpr, dxl_colref_array, &pdxlnCond, pdrgpdsBaseTables,
 					  pulNonGatherMotions, pfDML);
+
+		if (FMemoizeInnerChild(pexpr))
+		{
+			// the subplans built from the inner child are all rescanned per
+			// value of the outer references
+			CColRefArray *pdrgpcrInner =
+				CPhysicalNLJoin::PopConvert(pexpr->Pop())->PdrgPcrInner();
+			for (ULONG ul = 0; ul < pdrgpcrInner->Size(); ul++)
+			{
+				CDXLNode *pdxlnSubPlan = m_phmcrdxln->Find((*pdrgpcrInner)[ul]);
+				if (nullptr != pdxlnSubPlan &&
+					EdxlopScalarSubPlan ==
+						pdxlnSubPlan->GetOperator()->GetDXLOperator())
+				{
+					CDXLScalarSubPlan::Cast(pdxlnSubPlan->GetOperator())
+						->SetMemoize(true);
+				}
+			}
+		}
 	}
 
 	// extract dxl properties from correlated join
@@ -4286,6 +4307,45 @@ CTranslatorExprToDXL::StoreIndexNLJOuterRefs(CPhysical *pop)
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorExprToDXL::FMemoizeInnerChild
+//
+//	@doc:
+//		Should a Memoize node cache the inner child of an index or
+//		correlated nested loop join. This is the decision the cost model
+//		assumed when costing the join, see
+//		CCostModelGPDB::CostMemoizedInnerChild
+//
+//---------------------------------------------------------------------------
+BOOL
+CTranslatorExprToDXL::FMemoizeInnerChild(CExpression *pexprNLJ)
+{
+	if (!GPOS_FTRACE(EopttraceEnableMemoize))
+	{
+		return false;
+	}
+
+	CExpression *pexprOuter = (*pexprNLJ)[0];
+	CExpression *pexprInner = (*pexprNLJ)[1];
+	IStatistics *pstatsOuter = const_cast<IStatistics *>(pexprOuter->Pstats());
+	const IStatistics *pstatsInner = pexprInner->Pstats();
+	if (nullptr == pstatsOuter || nullptr == pstatsInner)
+	{
+		return false;
+	}
+
+	ULONG ulKeys = 0;
+	const CDouble dDistinct = CPhysicalNLJoin::DMemoizeKeys(
+		pstatsOuter, pexprInner->DeriveOuterReferences(),
+		pexprOuter->DeriveOutputColumns(), &ulKeys);
+	const CDouble dHitRatio = CPhysicalNLJoin::DMemoizeHitRatio(
+		pstatsOuter->Rows(), dDistinct, pstatsInner->Rows(),
+		pstatsInner->Width(m_mp, pexprInner->DeriveOutputColumns()));
+
+	return 0.0 < dHitRatio;
+}
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -4405,6 +4465,8 @@ CTranslatorExprToDXL::PdxlnNLJoin(CExpression *pexprInnerNLJ,
 	CDXLPhysicalNLJoin *pdxlopNLJ = GPOS_NEW(m_mp)
 		CDXLPhysicalNLJoin(m_mp, join_type, is_index_nlj, nest_params_exists);
 	pdxlopNLJ->SetNestLoopParamsColRefs(col_refs);
+	pdxlopNLJ->SetMemoize(nest_params_exists &&
+						  FMemoizeInnerChild(pexprInnerNLJ));
 
 	// construct projection list
 	// compute required columns
@@ -4800,10 +4862,25 @@ CTranslatorExprToDXL::PdxlnMotion(CExpression *pexprMotion,
 			// CDXLPhysicalRedistributeMotion::is_duplicate_sensitive is set to
 			// decide whether the motion should be translated into result hash
 			// filter node or redistribute motion.
-			motion = GPOS_NEW(m_mp)
-				CDXLPhysicalRedistributeMotion(m_mp, fDuplicateHazardMotion);
+			motion = GPOS_NEW(m_mp) CDXLPhysicalRedistributeMotion(
+				m_mp, fDuplicateHazardMotion, EdxlskewNone);
 			break;
 
+		case COperator::EopPhysicalMotionSkewHashDistribute:
+		{
+			// skew-aware motions are only placed where there is no hazard
+			GPOS_ASSERT(!fDuplicateHazardMotion);
+			CPhysicalMotionSkewHashDistribute *popSkew =
+				CPhysicalMotionSkewHashDistribute::PopConvert(
+					pexprMotion->Pop());
+			motion = GPOS_NEW(m_mp) CDXLPhysicalRedistributeMotion(
+				m_mp, false /*is_duplicate_sensitive*/,
+				CDistributionSpecSkewHashed::EskmSpread == popSkew->Eskm()
+					? EdxlskewSpread
+					: EdxlskewBroadcast);
+			break;
+		}
+
 		case COperator::EopPhysicalMotionRandom:
 			motion = GPOS_NEW(m_mp)
 				CDXLPhysicalRandomMotion(m_mp, fDuplicateHazardMotion);
@@ -4860,13 +4937,15 @@ CTranslatorExprToDXL::PdxlnMotion(CExpression *pexprMotion,
 	pdxlnMotion->AddChild(sort_col_list_dxlnode);
 
 	if (COperator::EopPhysicalMotionHashDistribute ==
-		pexprMotion->Pop()->Eopid())
+			pexprMotion->Pop()->Eopid() ||
+		COperator::EopPhysicalMotionSkewHashDistribute ==
+			pexprMotion->Pop()->Eopid())
 	{
-		// construct a hash expr list node
-		CPhysicalMotionHashDistribute *popHashDistribute =
-			CPhysicalMotionHashDistribute::PopConvert(pexprMotion->Pop());
+		// construct a hash expr list node; a skew-aware motion hashes the
+		// rows without a hot key the same way
 		CDistributionSpecHashed *pdsHashed =
-			CDistributionSpecHashed::PdsConvert(popHashDistribute->Pds());
+			CPhysicalMotionHashDistribute::PopConvert(pexprMotion->Pop())
+				->PdsHashed();
 		CDXLNode *hash_expr_list =
 			PdxlnHashExprList(pdsHashed->Pdrgpexpr(), pdsHashed->Opfamilies());
 		pdxlnMotion->AddChild(hash_expr_list);
@@ -4874,6 +4953,25 @@ CTranslatorExprToDXL::PdxlnMotion(CExpression *pexprMotion,
 
 	pdxlnMotion->AddChild(child_dxlnode);
 
+	if (COperator::EopPhysicalMotionSkewHashDistribute ==
+		pexprMotion->Pop()->Eopid())
+	{
+		// the hot keys follow the relational child
+		IDatumArray *pdrgpdatum =
+			CPhysicalMotionSkewHashDistribute::PopConvert(pexprMotion->Pop())
+				->PdrgpdatumHot();
+		CDXLNode *hot_keys_dxlnode = GPOS_NEW(m_mp)
+			CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarValuesList(m_mp));
+		for (ULONG ul = 0; ul < pdrgpdatum->Size(); ul++)
+		{
+			IDatum *datum = (*pdrgpdatum)[ul];
+			const IMDType *pmdtype = m_pmda->RetrieveType(datum->MDId());
+			hot_keys_dxlnode->AddChild(GPOS_NEW(m_mp) CDXLNode(
+				m_mp, pmdtype->GetDXLOpScConst(m_mp, datum)));
+		}
+		pdxlnMotion->AddChild(hot_keys_dxlnode);
+	}
+
 #ifdef GPOS_DEBUG
 	motion->AssertValid(pdxlnMotion, false /* validate_children */);
 #endif
@@ -7572,6 +7670,7 @@ CTranslatorExprToDXL::GetOutputSegIdsArray(CExpression *pexprMotion)
 		}
 		case COperator::EopPhysicalMotionBroadcast:
 		case COperator::EopPhysicalMotionHashDistribute:
+		case COperator::EopPhysicalMotionSkewHashDistribute:
 		case COperator::EopPhysicalMotionRoutedDistribute:
 		case COperator::EopPhysicalMotionRandom:
 		{
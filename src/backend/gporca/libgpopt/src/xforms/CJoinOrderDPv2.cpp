@@ -70,6 +70,7 @@ CJoinOrderDPv2::CJoinOrderDPv2(CMemoryPool *mp,
 	: CJoinOrder(mp, pdrgpexprAtoms, innerJoinConjuncts, onPredConjuncts,
 				 childPredIndexes),
 	  m_expression_to_edge_map(nullptr),
+	  m_num_reused_pruned_stats(0),
 	  m_on_pred_conjuncts(onPredConjuncts),
 	  m_child_pred_indexes(childPredIndexes),
 	  m_non_inner_join_dependencies(nullptr),
@@ -87,6 +88,7 @@ CJoinOrderDPv2::CJoinOrderDPv2(CMemoryPool *mp,
 	}
 
 	m_bitset_to_group_info_map = GPOS_NEW(mp) BitSetToGroupInfoMap(mp);
+	m_bitset_to_pruned_stats_map = GPOS_NEW(mp) BitSetToExprInfoMap(mp);
 
 	// Contains top k expressions for a general DP algorithm, without considering cost of motions/PS
 	m_top_k_expressions =
@@ -155,6 +157,7 @@ CJoinOrderDPv2::~CJoinOrderDPv2()
 	CRefCount::SafeRelease(m_non_inner_join_dependencies);
 	CRefCount::SafeRelease(m_child_pred_indexes);
 	m_bitset_to_group_info_map->Release();
+	m_bitset_to_pruned_stats_map->Release();
 	CRefCount::SafeRelease(m_expression_to_edge_map);
 	m_top_k_expressions->Release();
 	m_top_k_part_expressions->Release();
@@ -210,34 +213,79 @@ CJoinOrderDPv2::ComputeCost(SExpressionInfo *expr_info,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPv2::GetInnerJoinEdges
+//
+//	@doc:
+//		Get the inner join edges that reference at least one atom of the
+//		given group. The set is computed once per group, so that checking
+//		a pair of groups for connecting edges does not need to scan all the
+//		edges of the join graph.
+//
+//---------------------------------------------------------------------------
+CBitSet *
+CJoinOrderDPv2::GetInnerJoinEdges(SGroupInfo *group_info)
+{
+	if (nullptr == group_info->m_inner_join_edges)
+	{
+		CBitSet *edges = GPOS_NEW(m_mp) CBitSet(m_mp, m_ulEdges);
+
+		for (ULONG ul = 0; ul < m_ulEdges; ul++)
+		{
+			SEdge *pedge = m_rgpedge[ul];
+			if (0 == pedge->m_loj_num &&
+				!group_info->m_atoms->IsDisjoint(pedge->m_pbs))
+			{
+				edges->ExchangeSet(ul);
+			}
+		}
+
+		group_info->m_inner_join_edges = edges;
+	}
+
+	return group_info->m_inner_join_edges;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDPv2::PexprBuildInnerJoinPred
 //
 //	@doc:
-//		Build predicate connecting the two given sets
+//		Build predicate connecting the two given groups
 //
 //---------------------------------------------------------------------------
 CExpression *
-CJoinOrderDPv2::PexprBuildInnerJoinPred(CBitSet *pbsFst, CBitSet *pbsSnd)
+CJoinOrderDPv2::PexprBuildInnerJoinPred(SGroupInfo *fst_group_info,
+										SGroupInfo *snd_group_info)
 {
+	CBitSet *pbsFst = fst_group_info->m_atoms;
+	CBitSet *pbsSnd = snd_group_info->m_atoms;
 	GPOS_ASSERT(pbsFst->IsDisjoint(pbsSnd));
+
+	// only edges that reference both groups can connect them
+	CBitSet *pbsSndEdges = GetInnerJoinEdges(snd_group_info);
+	if (pbsSndEdges->IsDisjoint(GetInnerJoinEdges(fst_group_info)))
+	{
+		return nullptr;
+	}
+
 	// collect edges connecting the given sets
 	CBitSet *pbsEdges = GPOS_NEW(m_mp) CBitSet(m_mp);
 	CBitSet *pbs = GPOS_NEW(m_mp) CBitSet(m_mp, *pbsFst);
 	pbs->Union(pbsSnd);
 
-	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	CBitSetIter bsiFst(*GetInnerJoinEdges(fst_group_info));
+	while (bsiFst.Advance())
 	{
+		ULONG ul = bsiFst.Bit();
 		SEdge *pedge = m_rgpedge[ul];
 		if (
-			// edge represents an inner join pred
-			0 == pedge->m_loj_num &&
-			// all columns referenced in the edge pred are provided
-			pbs->ContainsAll(pedge->m_pbs) &&
 			// the edge represents a true join predicate between the two components
-			!pbsFst->IsDisjoint(pedge->m_pbs) &&
-			!pbsSnd->IsDisjoint(pedge->m_pbs))
+			pbsSndEdges->Get(ul) &&
+			// all columns referenced in the edge pred are provided
+			pbs->ContainsAll(pedge->m_pbs))
 		{
 			BOOL fSet GPOS_ASSERTS_ONLY = pbsEdges->ExchangeSet(ul);
 			GPOS_ASSERT(!fSet);
@@ -348,8 +396,8 @@ CJoinOrderDPv2::GetJoinExpr(const SGroupAndExpression &left_child_expr,
 	{
 		// inner join, compute the predicate from the join graph
 		GPOS_ASSERT(nullptr == scalar_expr);
-		scalar_expr = PexprBuildInnerJoinPred(left_group_info->m_atoms,
-											  right_group_info->m_atoms);
+		scalar_expr =
+			PexprBuildInnerJoinPred(left_group_info, right_group_info);
 	}
 	else
 	{
@@ -1300,14 +1348,27 @@ CJoinOrderDPv2::LookupOrCreateGroupInfo(SLevelInfo *levelInfo, CBitSet *atoms,
 		group_info = GPOS_NEW(m_mp) SGroupInfo(m_mp, atoms);
 		if (!stats_expr_info->m_properties.Satisfies(EJoinOrderStats))
 		{
-			SExpressionProperties stats_props(EJoinOrderStats);
+			// if we pruned this group earlier, reuse the stats we derived then,
+			// deriving join stats is one of the most expensive steps here
+			real_expr_info_for_stats = m_bitset_to_pruned_stats_map->Find(atoms);
+
+			if (nullptr != real_expr_info_for_stats)
+			{
+				real_expr_info_for_stats->AddRef();
+				m_num_reused_pruned_stats++;
+			}
+			else
+			{
+				SExpressionProperties stats_props(EJoinOrderStats);
 
-			// need to derive stats, make sure we use an expression whose children already have stats
-			real_expr_info_for_stats = GetJoinExprForProperties(
-				stats_expr_info->m_left_child_expr.m_group_info,
-				stats_expr_info->m_right_child_expr.m_group_info, stats_props);
+				// need to derive stats, make sure we use an expression whose children already have stats
+				real_expr_info_for_stats = GetJoinExprForProperties(
+					stats_expr_info->m_left_child_expr.m_group_info,
+					stats_expr_info->m_right_child_expr.m_group_info,
+					stats_props);
 
-			DeriveStats(real_expr_info_for_stats->m_expr);
+				DeriveStats(real_expr_info_for_stats->m_expr);
+			}
 		}
 		else
 		{
@@ -1378,11 +1439,32 @@ CJoinOrderDPv2::FinalizeDPLevel(ULONG level)
 		}
 
 		SGroupInfo *loser;
+		SExpressionProperties stats_props(EJoinOrderStats);
 
 		// also remove the groups that didn't make it from the bitset to group info map
 		while (nullptr !=
 			   (loser = level_info->m_top_k_groups->RemoveNextElement()))
 		{
+			// remember the stats of the loser, the greedy enumeration
+			// algorithms may need this group again; the children of the
+			// stats expression are in lower levels, which are final
+			SGroupAndExpression stats_expr =
+				GetBestExprForProperties(loser, stats_props);
+
+			if (stats_expr.IsValid())
+			{
+				SExpressionInfo *stats_expr_info = stats_expr.GetExprInfo();
+
+				loser->m_atoms->AddRef();
+				stats_expr_info->AddRef();
+				if (!m_bitset_to_pruned_stats_map->Insert(loser->m_atoms,
+														  stats_expr_info))
+				{
+					loser->m_atoms->Release();
+					stats_expr_info->Release();
+				}
+			}
+
 			m_bitset_to_group_info_map->Delete(loser->m_atoms);
 			loser->Release();
 		}
@@ -6,7 +6,7 @@
 //		CBitSet.h
 //
 //	@doc:
-//		Implementation of bitset as linked list of bitvectors
+//		Implementation of bitset as a contiguous array of bit units
 //---------------------------------------------------------------------------
 #ifndef GPOS_CBitSet_H
 #define GPOS_CBitSet_H
@@ -18,6 +18,9 @@
 #include "gpos/common/DbgPrintMixin.h"
 
 
+// number of 64-bit units stored inside a bitset before it allocates
+#define GPOS_BITSET_INLINE_UNITS 16
+
 namespace gpos
 {
 //---------------------------------------------------------------------------
@@ -25,7 +28,16 @@ namespace gpos
 //		CBitSet
 //
 //	@doc:
-//		Linked list of CBitSetLink's
+//		Bitset stored as a contiguous array of 64-bit units. The bit space is
+//		divided into links of <vector_size> bits, each link is stored in a
+//		fixed number of units; the array covers the range of links between
+//		the lowest and the highest link that were ever populated. Small
+//		arrays are kept inside the object, larger ones are allocated from
+//		the memory pool.
+//
+//		Bitsets that are combined with each other must use the same vector
+//		size, so that their units line up and set operations can be done a
+//		unit at a time.
 //
 //---------------------------------------------------------------------------
 class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
@@ -34,77 +46,78 @@ class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
 	friend class CBitSetIter;
 
 protected:
-	//---------------------------------------------------------------------------
-	//	@class:
-	//		CBitSetLink
-	//
-	//	@doc:
-	//		bit vector + offset + link
-	//
-	//---------------------------------------------------------------------------
-	class CBitSetLink
-	{
-	private:
-		// offset
-		ULONG m_offset;
+	// pool to allocate units from
+	CMemoryPool *m_mp;
 
-		// bitvector
-		CBitVector *m_vec;
+	// size of individual links, in bits
+	ULONG m_vector_size;
 
-	public:
-		CBitSetLink(const CBitSetLink &) = delete;
+	// number of units per link
+	ULONG m_units_per_link;
 
-		// ctor
-		explicit CBitSetLink(CMemoryPool *, ULONG offset, ULONG vector_size);
+	// number of elements
+	ULONG m_size;
 
-		explicit CBitSetLink(CMemoryPool *, const CBitSetLink &);
+	// index of the first link stored in the unit array
+	ULONG m_first_link;
 
-		// dtor
-		~CBitSetLink();
+	// number of links stored in the unit array
+	ULONG m_num_links;
 
-		// accessor
-		ULONG
-		GetOffset() const
-		{
-			return m_offset;
-		}
+	// number of units the unit array can hold
+	ULONG m_capacity;
 
-		// accessor
-		CBitVector *
-		GetVec() const
-		{
-			return m_vec;
-		}
+	// unit array, points to m_inline_units or to pool memory
+	ULLONG *m_units;
 
-		// list link
-		SLink m_link;
+	// units used before we need to allocate
+	ULLONG m_inline_units[GPOS_BITSET_INLINE_UNITS];
 
-	};	// class CBitSetLink
+	// private copy ctor
+	CBitSet(const CBitSet &);
 
-	// list of bit set links
-	CList<CBitSetLink> m_bsllist;
+	// link containing the given bit
+	ULONG
+	GetLink(ULONG pos) const
+	{
+		return pos / m_vector_size;
+	}
 
-	// pool to allocate links from
-	CMemoryPool *m_mp;
+	// unit containing the given bit, the link must be stored
+	ULLONG *
+	GetUnit(ULONG pos) const
+	{
+		GPOS_ASSERT(IsLinkStored(GetLink(pos)));
 
-	// size of individual bitvectors
-	ULONG m_vector_size;
+		ULONG link = GetLink(pos);
+		return m_units + (link - m_first_link) * m_units_per_link +
+			   (pos - link * m_vector_size) / 64;
+	}
 
-	// number of elements
-	ULONG m_size;
+	// mask of the given bit within its unit
+	ULLONG
+	GetMask(ULONG pos) const
+	{
+		return ((ULLONG) 1) << ((pos % m_vector_size) % 64);
+	}
 
-	// private copy ctor
-	CBitSet(const CBitSet &);
+	// is the given link in the unit array
+	BOOL
+	IsLinkStored(ULONG link) const
+	{
+		return link >= m_first_link && link < m_first_link + m_num_links;
+	}
+
+	// unit of the other set lining up with our unit at index idx,
+	// zero if the other set doesn't store that unit
+	ULLONG GetOtherUnit(const CBitSet *bs, ULONG idx) const;
 
-	// find link with offset less or equal to given value
-	CBitSetLink *FindLinkByOffset(ULONG, CBitSetLink * = nullptr) const;
+	// make sure the unit array stores the given range of links
+	void EnsureLinks(ULONG first_link, ULONG last_link);
 
 	// reset set
 	void Clear();
 
-	// compute target offset
-	ULONG ComputeOffset(ULONG) const;
-
 	// re-compute size of set
 	void RecomputeSize();
 
@@ -22,7 +22,7 @@ namespace gpos
 //
 //	@doc:
 //		Iterator for bitset's; defined as friend, ie can access bitset's
-//		internal links
+//		internal unit array
 //
 //---------------------------------------------------------------------------
 class CBitSetIter
@@ -31,11 +31,14 @@ private:
 	// bitset
 	const CBitSet &m_bs;
 
-	// current cursor position (in current link)
-	ULONG m_cursor;
+	// index of current unit
+	ULONG m_unit_idx;
 
-	// current cursor link
-	CBitSet::CBitSetLink *m_bsl;
+	// bits of current unit that have not been visited yet
+	ULLONG m_unit;
+
+	// current bit
+	ULONG m_bit;
 
 	// is iterator active or exhausted
 	BOOL m_active;
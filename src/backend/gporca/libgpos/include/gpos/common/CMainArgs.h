@@ -55,6 +55,21 @@ public:
 	// getopt functionality
 	BOOL Getopt(CHAR *ch);
 
+	// number of arguments
+	ULONG
+	Argc() const
+	{
+		return m_argc;
+	}
+
+	// argument array; once Getopt() returned false, the arguments following
+	// the options start at index optind
+	const CHAR **
+	Argv() const
+	{
+		return m_argv;
+	}
+
 };	// class CMainArgs
 }  // namespace gpos
 
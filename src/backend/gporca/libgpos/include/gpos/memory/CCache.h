@@ -40,6 +40,9 @@
 // eligible to delete
 #define EXPECTED_REF_COUNT_FOR_DELETE 1
 
+// gclock counter of entries that were inserted but not looked up since
+#define CCACHE_GCLOCK_PROBATION_COUNTER 1
+
 using namespace gpos;
 
 namespace gpos
@@ -65,6 +68,10 @@ class CCacheAccessor;
 //
 //		Cache can only be accessed through the CCacheAccessor friend class.
 //		The current implementation has a fixed gclock based eviction policy.
+//		The policy is made scan resistant in the spirit of 2Q: a new entry
+//		starts on probation with a low gclock counter and gets the full
+//		counter only once it is looked up again, so a burst of one-off
+//		insertions is evicted before the entries that are actually reused.
 //
 //---------------------------------------------------------------------------
 template <class T, class K>
@@ -109,6 +116,15 @@ private:
 	// number of times cache entries were evicted
 	ULLONG m_eviction_counter;
 
+	// number of entries evicted
+	ULLONG m_evicted_entries_counter;
+
+	// number of lookups that found an entry
+	ULLONG m_hit_counter;
+
+	// number of lookups that did not find an entry
+	ULLONG m_miss_counter;
+
 	// if the gclock hand was already advanced and therefore can serve the next entry
 	BOOL m_clock_hand_advanced;
 
@@ -190,13 +206,17 @@ private:
 		{
 			acc.Insert(entry);
 			m_cache_size += entry->Pmp()->TotalAllocatedSize();
+
+			// new entries are on probation until they are used again
+			ret->SetGClockCounter(CCACHE_GCLOCK_PROBATION_COUNTER);
 		}
 		else
 		{
+			// the entry was asked for again
 			ret = found;
+			ret->SetGClockCounter(m_gclock_init_counter);
 		}
 
-		ret->SetGClockCounter(m_gclock_init_counter);
 		ret->IncRefCount();
 
 		return ret;
@@ -217,11 +237,16 @@ private:
 
 		if (nullptr != entry)
 		{
+			++m_hit_counter;
 			entry->SetGClockCounter(m_gclock_init_counter);
 			// increase ref count, since CCacheHashtableAccessor points to the obj
 			// ref count will be decreased when CCacheHashtableAccessor will be destroyed
 			entry->IncRefCount();
 		}
+		else
+		{
+			++m_miss_counter;
+		}
 
 		return entry;
 	}
@@ -404,6 +429,7 @@ private:
 								entry->Pmp()->TotalAllocatedSize();
 							m_cache_size -= num_freed;
 							total_freed += num_freed;
+							++m_evicted_entries_counter;
 						}
 					}
 					else
@@ -435,6 +461,9 @@ public:
 		  m_gclock_init_counter(g_clock_init_counter),
 		  m_eviction_factor((float) 0.1),
 		  m_eviction_counter(0),
+		  m_evicted_entries_counter(0),
+		  m_hit_counter(0),
+		  m_miss_counter(0),
 		  m_clock_hand_advanced(false),
 		  m_hash_func(hash_func),
 		  m_equal_func(equal_func)
@@ -442,7 +471,7 @@ public:
 		GPOS_ASSERT(nullptr != m_mp &&
 					"Cache memory pool could not be initialized");
 
-		GPOS_ASSERT(0 != g_clock_init_counter);
+		GPOS_ASSERT(CCACHE_GCLOCK_PROBATION_COUNTER <= g_clock_init_counter);
 
 		// initialize hashtable
 		m_hash_table.Init(m_mp, CACHE_HT_NUM_OF_BUCKETS,
@@ -495,6 +524,27 @@ public:
 		return m_eviction_counter;
 	}
 
+	// return number of entries evicted from this cache
+	ULLONG
+	GetEvictedEntriesCounter()
+	{
+		return m_evicted_entries_counter;
+	}
+
+	// return number of lookups that found an entry
+	ULLONG
+	GetHitCounter()
+	{
+		return m_hit_counter;
+	}
+
+	// return number of lookups that did not find an entry
+	ULLONG
+	GetMissCounter()
+	{
+		return m_miss_counter;
+	}
+
 	// sets the cache quota
 	void
 	SetCacheQuota(ULLONG new_quota)
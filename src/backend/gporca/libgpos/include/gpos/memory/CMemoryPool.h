@@ -166,6 +166,14 @@ public:
 		return 0;
 	}
 
+	// return the highest total allocated size over the lifetime of the pool
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		GPOS_ASSERT(!"not supported");
+		return 0;
+	}
+
 	// requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
 
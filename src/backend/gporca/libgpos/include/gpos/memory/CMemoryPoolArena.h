@@ -0,0 +1,215 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArena.h
+//
+//	@doc:
+//		Memory pool that carves allocations out of large slabs using a
+//		bump pointer; freed small allocations are kept on per size class
+//		free lists for reuse, and large allocations get a slab of their
+//		own that is released when they are freed
+//
+//	@owner:
+//
+//	@test:
+//
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMemoryPoolArena_H
+#define GPOS_CMemoryPoolArena_H
+
+#include "gpos/assert.h"
+#include "gpos/memory/CMemoryPool.h"
+#include "gpos/types.h"
+#include "gpos/utils.h"
+
+// size of the first slab; subsequent slabs double up to the max size
+#define GPOS_MEM_ARENA_INIT_SLAB_SIZE (64 * 1024)
+#define GPOS_MEM_ARENA_MAX_SLAB_SIZE (8 * 1024 * 1024)
+
+// largest user size served from a size class; larger allocations get a
+// dedicated slab
+#define GPOS_MEM_ARENA_MAX_CLASS_SIZE (16 * 1024)
+
+// number of size classes: multiples of 8 bytes up to 128 bytes, then four
+// classes per power of two up to the largest class size
+#define GPOS_MEM_ARENA_NUM_SIZE_CLASSES (16 + 7 * 4)
+
+// tag stored in the header of every arena allocation
+#define GPOS_MEM_ARENA_TAG (0xA4E7A4E7)
+
+namespace gpos
+{
+// bump-pointer memory pool for short-lived, allocation-heavy work
+class CMemoryPoolArena : public CMemoryPool
+{
+private:
+	// header preceding every slab
+	struct SSlab
+	{
+		// next slab in list of slabs
+		SSlab *m_next;
+
+		// previous slab; only maintained for dedicated slabs
+		SSlab *m_prev;
+
+		// total size of slab (including header)
+		ULLONG m_size;
+
+		// end of the allocations carved out of the slab; only maintained
+		// for slabs other than the current one
+		BYTE *m_used_end;
+	};
+
+	// header preceding every allocation; the tag occupies the same bytes
+	// as the tag in CMemoryPoolTracker's allocation header
+	struct SAllocHeader
+	{
+		// pointer to pool
+		CMemoryPoolArena *m_mp;
+
+#ifdef GPOS_DEBUG
+		// file name
+		const CHAR *m_filename;
+
+		// sequence number
+		ULLONG m_serial;
+
+		// line in file
+		ULONG m_line;
+
+		// set once the allocation was freed, see WalkLiveObjects()
+		BOOL m_freed;
+#endif	// GPOS_DEBUG
+
+		// user requested size
+		ULONG m_user_size;
+
+		// arena tag, see IsArenaAlloc()
+		ULONG m_tag;
+	};
+
+	// list of regular slabs, most recent first
+	SSlab *m_slabs{nullptr};
+
+	// doubly-linked list of slabs holding a single large allocation
+	SSlab *m_dedicated_slabs{nullptr};
+
+	// freed small allocations by size class; the link to the next one is
+	// kept in the user memory
+	SAllocHeader *m_free_lists[GPOS_MEM_ARENA_NUM_SIZE_CLASSES]{};
+
+	// next free byte in the current slab
+	BYTE *m_next_free{nullptr};
+
+	// end of the current slab
+	BYTE *m_slab_end{nullptr};
+
+	// size of the next regular slab
+	ULLONG m_next_slab_size{GPOS_MEM_ARENA_INIT_SLAB_SIZE};
+
+	// total size of slabs obtained from the system
+	ULLONG m_total_slab_size{0};
+
+	// peak of the total size of slabs
+	ULLONG m_peak_slab_size{0};
+
+	// number of allocations served
+	ULLONG m_num_allocations{0};
+
+	// total size of the memory block of an allocation in a regular slab
+	static ULLONG BlockSize(ULONG bytes);
+
+	// obtain a new regular slab
+	void AddSlab();
+
+	// allocate a large object in a slab of its own
+	SAllocHeader *AllocDedicated(ULONG bytes);
+
+	// release the slab of a large object
+	void FreeDedicated(SAllocHeader *header);
+
+	// account for a slab obtained from or returned to the system
+	void RecordSlab(ULLONG size, BOOL is_alloc);
+
+	// release all slabs
+	void FreeSlabs();
+
+protected:
+	// obtain memory for a slab from the system
+	virtual void *AllocSlab(ULLONG size);
+
+	// return memory of a slab to the system
+	virtual void FreeSlab(void *slab);
+
+	// dtor
+	~CMemoryPoolArena() override;
+
+public:
+	CMemoryPoolArena(CMemoryPoolArena &) = delete;
+
+	// ctor
+	CMemoryPoolArena() = default;
+
+	// prepare the memory pool to be deleted
+	void TearDown() override;
+
+	// allocate memory
+	void *NewImpl(const ULONG bytes, const CHAR *file, const ULONG line,
+				  CMemoryPool::EAllocationType eat) override;
+
+	// free memory allocation
+	static void DeleteImpl(void *ptr, EAllocationType eat);
+
+	// get user requested size of allocation
+	static ULONG UserSizeOfAlloc(const void *ptr);
+
+	// check if the given allocation was made by an arena pool
+	static BOOL
+	IsArenaAlloc(const void *ptr)
+	{
+		return GPOS_MEM_ARENA_TAG ==
+			   (static_cast<const SAllocHeader *>(ptr) - 1)->m_tag;
+	}
+
+	// return total size of slabs held by the pool
+	ULLONG
+	TotalAllocatedSize() const override
+	{
+		return m_total_slab_size;
+	}
+
+	// return peak size of slabs held by the pool
+	ULLONG
+	PeakAllocatedSize() const override
+	{
+		return m_peak_slab_size;
+	}
+
+	// number of allocations served by the pool
+	ULLONG
+	NumAllocations() const
+	{
+		return m_num_allocations;
+	}
+
+#ifdef GPOS_DEBUG
+
+	// freed allocations are flagged, so leak checks can find live ones
+	BOOL
+	SupportsLiveObjectWalk() const override
+	{
+		return true;
+	}
+
+	// walk the live objects
+	void WalkLiveObjects(IMemoryVisitor *visitor) override;
+
+#endif	// GPOS_DEBUG
+};
+}  // namespace gpos
+
+#endif	// !GPOS_CMemoryPoolArena_H
+
+// EOF
@@ -62,6 +62,9 @@ private:
 	// create new pool of given type
 	virtual CMemoryPool *NewMemoryPool();
 
+	// create new bump-pointer pool
+	virtual CMemoryPool *NewArenaMemoryPool();
+
 	// clean-up memory pools
 	static void Cleanup();
 
@@ -113,10 +116,18 @@ protected:
 	}
 
 public:
+	// kind of memory pool to create
+	enum EPoolKind
+	{
+		EpkGeneral = 0,	 // general purpose pool
+		EpkArena,		 // bump-pointer pool with size class free lists
+		EpkSentinel
+	};
+
 	CMemoryPoolManager(const CMemoryPoolManager &) = delete;
 
 	// create new memory pool
-	static CMemoryPool *CreateMemoryPool();
+	static CMemoryPool *CreateMemoryPool(EPoolKind pool_kind = EpkGeneral);
 
 	// release memory pool
 	static void Destroy(CMemoryPool *);
@@ -26,6 +26,9 @@
 #include "gpos/types.h"
 #include "gpos/utils.h"
 
+// tag stored in the header of every tracker allocation
+#define GPOS_MEM_TRACKER_TAG (0x7AC4E7)
+
 namespace gpos
 {
 // memory pool with statistics and debugging support
@@ -51,9 +54,6 @@ private:
 		// file name
 		const CHAR *m_filename;
 
-		// line in file
-		ULONG m_line;
-
 #ifdef GPOS_DEBUG
 		// allocation stack
 		CStackDescriptor m_stack_desc;
@@ -61,6 +61,13 @@ private:
 
 		// link for allocation list
 		SLink m_link;
+
+		// line in file
+		ULONG m_line;
+
+		// tracker tag; must directly precede the user memory so that
+		// allocations can be told apart from CMemoryPoolArena's
+		ULONG m_tag;
 	};
 
 	// statistics
@@ -108,6 +115,13 @@ public:
 		return m_memory_pool_statistics.TotalAllocatedSize();
 	}
 
+	// return peak allocated size
+	ULLONG
+	PeakAllocatedSize() const override
+	{
+		return m_memory_pool_statistics.PeakLiveObjTotalSize();
+	}
+
 #ifdef GPOS_DEBUG
 
 	// check if the memory pool keeps track of live objects
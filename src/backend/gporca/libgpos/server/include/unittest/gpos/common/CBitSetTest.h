@@ -12,6 +12,7 @@
 #define GPOS_CBitSetTest_H
 
 #include "gpos/base.h"
+#include "gpos/memory/CMemoryPool.h"
 
 namespace gpos
 {
@@ -25,6 +26,11 @@ namespace gpos
 //---------------------------------------------------------------------------
 class CBitSetTest
 {
+private:
+	// run a mix of set operations typical for column reference sets;
+	// return elapsed time in milliseconds
+	static ULONG UlColRefSetLoop(CMemoryPool *mp);
+
 public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
@@ -32,6 +38,8 @@ public:
 	static GPOS_RESULT EresUnittest_Removal();
 	static GPOS_RESULT EresUnittest_SetOps();
 	static GPOS_RESULT EresUnittest_Performance();
+	static GPOS_RESULT EresUnittest_Random();
+	static GPOS_RESULT EresUnittest_Benchmark();
 
 };	// class CBitSetTest
 }  // namespace gpos
@@ -154,6 +154,7 @@ public:
 	static GPOS_RESULT EresUnittest_Basic();
 	static GPOS_RESULT EresUnittest_Refcount();
 	static GPOS_RESULT EresUnittest_Eviction();
+	static GPOS_RESULT EresUnittest_ScanResistance();
 	static GPOS_RESULT EresUnittest_DeepObject();
 	static GPOS_RESULT EresUnittest_Iteration();
 	static GPOS_RESULT EresUnittest_IterativeDeletion();
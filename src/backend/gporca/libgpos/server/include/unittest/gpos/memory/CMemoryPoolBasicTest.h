@@ -29,11 +29,19 @@ private:
 	static GPOS_RESULT EresTestExpectedError(GPOS_RESULT (*pfunc)(),
 											 ULONG minor);
 
-	static GPOS_RESULT EresNewDelete();
+	static GPOS_RESULT EresNewDelete(CMemoryPoolManager::EPoolKind pool_kind);
 	static GPOS_RESULT EresThrowingCtor();
+	static GPOS_RESULT EresThrowingCtorArena();
+	static GPOS_RESULT EresLargeAlloc(CMemoryPoolManager::EPoolKind pool_kind);
+	static GPOS_RESULT EresPeakSize(CMemoryPoolManager::EPoolKind pool_kind);
+	static GPOS_RESULT EresArenaReuse();
+
+	// allocate and free a batch of small objects, return elapsed time in ms
+	static ULONG UlAllocFreeLoop(CMemoryPool *mp, ULONG ulRounds);
 #ifdef GPOS_DEBUG
 	static GPOS_RESULT EresLeak();
 	static GPOS_RESULT EresLeakByException();
+	static GPOS_RESULT EresLeakArena();
 #endif	// GPOS_DEBUG
 
 	static ULONG Size(ULONG offset);
@@ -45,7 +53,8 @@ public:
 	static GPOS_RESULT EresUnittest_Print();
 #endif	// GPOS_DEBUG
 	static GPOS_RESULT EresUnittest_TestTracker();
-	static GPOS_RESULT EresUnittest_TestSlab();
+	static GPOS_RESULT EresUnittest_TestArena();
+	static GPOS_RESULT EresUnittest_BenchmarkArena();
 
 };	// class CMemoryPoolBasicTest
 }  // namespace gpos
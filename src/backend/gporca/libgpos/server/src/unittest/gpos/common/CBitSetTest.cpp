@@ -13,6 +13,9 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
+#include "gpos/common/CRandom.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/string/CWStringDynamic.h"
@@ -20,6 +23,10 @@
 
 using namespace gpos;
 
+// number of rounds and number of sets used by the benchmark
+#define GPOS_BITSET_TEST_BENCH_ROUNDS 2000
+#define GPOS_BITSET_TEST_BENCH_SETS 64
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CBitSet::EresUnittest
@@ -35,7 +42,9 @@ CBitSetTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Basics),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Removal),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_SetOps),
-		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Performance)};
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Performance),
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Random),
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Benchmark)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
 }
@@ -262,4 +271,221 @@ CBitSetTest::EresUnittest_Performance()
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSetTest::EresUnittest_Random
+//
+//	@doc:
+//		Check set operations on sparse sets against a plain array of flags
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBitSetTest::EresUnittest_Random()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG vector_size = 100;
+	const ULONG max_bit = 20 * vector_size;
+	CRandom rand(1);
+
+	for (ULONG round = 0; round < 100; round++)
+	{
+		CBitSet *pbs1 = GPOS_NEW(mp) CBitSet(mp, vector_size);
+		CBitSet *pbs2 = GPOS_NEW(mp) CBitSet(mp, vector_size);
+		BOOL *rgf1 = GPOS_NEW_ARRAY(mp, BOOL, max_bit);
+		BOOL *rgf2 = GPOS_NEW_ARRAY(mp, BOOL, max_bit);
+
+		// populate sets with bits in a few random links, in random order
+		for (ULONG ul = 0; ul < max_bit; ul++)
+		{
+			rgf1[ul] = false;
+			rgf2[ul] = false;
+		}
+		for (ULONG ul = 0; ul < 30; ul++)
+		{
+			ULONG bit1 = rand.Next() % max_bit;
+			ULONG bit2 = (0 == ul % 3) ? bit1 : rand.Next() % max_bit;
+
+			GPOS_UNITTEST_ASSERT(rgf1[bit1] == pbs1->ExchangeSet(bit1));
+			GPOS_UNITTEST_ASSERT(rgf2[bit2] == pbs2->ExchangeSet(bit2));
+			rgf1[bit1] = true;
+			rgf2[bit2] = true;
+		}
+
+		// clear some bits again
+		for (ULONG ul = 0; ul < 10; ul++)
+		{
+			ULONG bit = rand.Next() % max_bit;
+			GPOS_UNITTEST_ASSERT(rgf1[bit] == pbs1->ExchangeClear(bit));
+			rgf1[bit] = false;
+		}
+
+		CBitSet *pbsUnion = GPOS_NEW(mp) CBitSet(mp, *pbs1);
+		pbsUnion->Union(pbs2);
+		CBitSet *pbsIntersection = GPOS_NEW(mp) CBitSet(mp, *pbs1);
+		pbsIntersection->Intersection(pbs2);
+		CBitSet *pbsDifference = GPOS_NEW(mp) CBitSet(mp, *pbs1);
+		pbsDifference->Difference(pbs2);
+
+		BOOL fDisjoint = true;
+		BOOL fContainsAll = true;
+		ULONG ulSize = 0;
+		for (ULONG ul = 0; ul < max_bit; ul++)
+		{
+			BOOL f1 = rgf1[ul];
+			BOOL f2 = rgf2[ul];
+
+			GPOS_UNITTEST_ASSERT(f1 == pbs1->Get(ul));
+			GPOS_UNITTEST_ASSERT((f1 || f2) == pbsUnion->Get(ul));
+			GPOS_UNITTEST_ASSERT((f1 && f2) == pbsIntersection->Get(ul));
+			GPOS_UNITTEST_ASSERT((f1 && !f2) == pbsDifference->Get(ul));
+
+			fDisjoint = fDisjoint && !(f1 && f2);
+			fContainsAll = fContainsAll && (f1 || !f2);
+			if (f1)
+			{
+				ulSize++;
+			}
+		}
+
+		GPOS_UNITTEST_ASSERT(ulSize == pbs1->Size());
+		GPOS_UNITTEST_ASSERT(fDisjoint == pbs1->IsDisjoint(pbs2));
+		GPOS_UNITTEST_ASSERT(fContainsAll == pbs1->ContainsAll(pbs2));
+		GPOS_UNITTEST_ASSERT(pbsUnion->ContainsAll(pbs1) &&
+							 pbsUnion->ContainsAll(pbs2));
+
+		// the iterator returns the set bits in ascending order
+		ULONG ulIterated = 0;
+		ULONG ulPrevBit = 0;
+		CBitSetIter bsiter(*pbs1);
+		while (bsiter.Advance())
+		{
+			ULONG bit = bsiter.Bit();
+			GPOS_UNITTEST_ASSERT(rgf1[bit]);
+			GPOS_UNITTEST_ASSERT(0 == ulIterated || ulPrevBit < bit);
+			ulPrevBit = bit;
+			ulIterated++;
+		}
+		GPOS_UNITTEST_ASSERT(ulSize == ulIterated);
+
+		// equal sets that were built differently have the same hash value
+		CBitSet *pbsRebuilt = GPOS_NEW(mp) CBitSet(mp, vector_size);
+		pbsRebuilt->Union(pbsDifference);
+		pbsRebuilt->Union(pbsIntersection);
+		GPOS_UNITTEST_ASSERT(pbsRebuilt->Equals(pbs1));
+		GPOS_UNITTEST_ASSERT(pbs1->Equals(pbsRebuilt));
+		GPOS_UNITTEST_ASSERT(pbsRebuilt->HashValue() == pbs1->HashValue());
+
+		pbsRebuilt->Release();
+		pbsDifference->Release();
+		pbsIntersection->Release();
+		pbsUnion->Release();
+		GPOS_DELETE_ARRAY(rgf2);
+		GPOS_DELETE_ARRAY(rgf1);
+		pbs2->Release();
+		pbs1->Release();
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSetTest::EresUnittest_Benchmark
+//
+//	@doc:
+//		Time set operations typical for column reference sets
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBitSetTest::EresUnittest_Benchmark()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG ulTime = UlColRefSetLoop(mp);
+
+	GPOS_TRACE_FORMAT(
+		"Ran set operations on %d column reference sets %d times: %dms",
+		GPOS_BITSET_TEST_BENCH_SETS, GPOS_BITSET_TEST_BENCH_ROUNDS, ulTime);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSetTest::UlColRefSetLoop
+//
+//	@doc:
+//		Copy, combine, compare and iterate sets of a few dozen column ids,
+//		sized like column reference sets; return elapsed time in
+//		milliseconds
+//
+//---------------------------------------------------------------------------
+ULONG
+CBitSetTest::UlColRefSetLoop(CMemoryPool *mp)
+{
+	const ULONG vector_size = 1024;
+	const ULONG max_colid = 2 * vector_size;
+	CRandom rand(1);
+
+	CBitSet *rgpbs[GPOS_BITSET_TEST_BENCH_SETS];
+	for (ULONG ul = 0; ul < GPOS_BITSET_TEST_BENCH_SETS; ul++)
+	{
+		rgpbs[ul] = GPOS_NEW(mp) CBitSet(mp, vector_size);
+		for (ULONG ulCol = 0; ulCol < 24; ulCol++)
+		{
+			(void) rgpbs[ul]->ExchangeSet(rand.Next() % max_colid);
+		}
+	}
+
+	CWallClock clock;
+	ULONG ulChecksum = 0;
+
+	for (ULONG ulRound = 0; ulRound < GPOS_BITSET_TEST_BENCH_ROUNDS; ulRound++)
+	{
+		for (ULONG ul = 0; ul < GPOS_BITSET_TEST_BENCH_SETS; ul++)
+		{
+			CBitSet *pbsFst = rgpbs[ul];
+			CBitSet *pbsSnd = rgpbs[(ul + ulRound) % GPOS_BITSET_TEST_BENCH_SETS];
+
+			CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, *pbsFst);
+			pbs->Union(pbsSnd);
+			ulChecksum += pbs->ContainsAll(pbsFst);
+			ulChecksum += pbsFst->IsDisjoint(pbsSnd);
+			ulChecksum += pbs->Get(ulRound % max_colid);
+			ulChecksum += pbs->HashValue();
+
+			pbs->Intersection(pbsSnd);
+			ulChecksum += pbs->Equals(pbsSnd);
+
+			CBitSetIter bsiter(*pbs);
+			while (bsiter.Advance())
+			{
+				ulChecksum += bsiter.Bit();
+			}
+
+			pbs->Release();
+		}
+	}
+
+	ULONG ulElapsed = clock.ElapsedMS();
+
+	for (ULONG ul = 0; ul < GPOS_BITSET_TEST_BENCH_SETS; ul++)
+	{
+		rgpbs[ul]->Release();
+	}
+
+	// make sure the loop is not optimized away
+	GPOS_TRACE_FORMAT("Checksum: %d", ulChecksum);
+
+	return ulElapsed;
+}
+
 // EOF
@@ -45,6 +45,7 @@ CCacheTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Basic),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Refcount),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Eviction),
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_ScanResistance),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Iteration),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_DeepObject),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion)};
@@ -625,6 +626,70 @@ CCacheTest::EresUnittest_Eviction()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::EresUnittest_ScanResistance
+//
+//	@doc:
+//		Test that entries which are looked up survive a burst of one-off
+//		insertions, and that hits, misses and evictions are counted
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCacheTest::EresUnittest_ScanResistance()
+{
+	const ULONG ulHotKeys = 4;
+
+	CAutoP<CCache<SSimpleObject *, ULONG *> > apCache;
+	apCache = CCacheFactory::CreateCache<SSimpleObject *, ULONG *>(
+		true, /* unique cache */
+		10240 /* cache quota */, SSimpleObject::UlMyHash,
+		SSimpleObject::FMyEqual);
+	CCache<SSimpleObject *, ULONG *> *pCache = apCache.Value();
+
+	ULONG ulLastKey = ULFillCacheWithoutEviction(pCache, 0);
+	GPOS_UNITTEST_ASSERT(0 == pCache->GetEvictedEntriesCounter());
+
+	// look up the first few entries again, which takes them off probation
+	for (ULONG ulKey = 0; ulKey < ulHotKeys; ulKey++)
+	{
+		CSimpleObjectCacheAccessor ca(pCache);
+		ca.Lookup(&ulKey);
+		SSimpleObject *pso = ca.Val();
+		GPOS_UNITTEST_ASSERT(nullptr != pso);
+		pso->Release();
+	}
+	GPOS_UNITTEST_ASSERT(ulHotKeys == pCache->GetHitCounter());
+	GPOS_UNITTEST_ASSERT(0 == pCache->GetMissCounter());
+
+	// scan through as many new keys as the cache can hold
+	ULFillCacheWithoutEviction(pCache, ulLastKey + 1);
+	GPOS_UNITTEST_ASSERT(0 < pCache->GetEvictedEntriesCounter());
+
+	// the entries that were used again are still cached
+	for (ULONG ulKey = 0; ulKey < ulHotKeys; ulKey++)
+	{
+		CSimpleObjectCacheAccessor ca(pCache);
+		ca.Lookup(&ulKey);
+		SSimpleObject *pso = ca.Val();
+		GPOS_UNITTEST_ASSERT(nullptr != pso);
+		pso->Release();
+	}
+
+	// the entries that were not used again are evicted first
+	{
+		ULONG ulKey = ulHotKeys;
+		CSimpleObjectCacheAccessor ca(pCache);
+		ca.Lookup(&ulKey);
+		GPOS_UNITTEST_ASSERT(nullptr == ca.Val());
+	}
+	GPOS_UNITTEST_ASSERT(2 * ulHotKeys == pCache->GetHitCounter());
+	GPOS_UNITTEST_ASSERT(1 == pCache->GetMissCounter());
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCacheTest::EresInsertDuplicates
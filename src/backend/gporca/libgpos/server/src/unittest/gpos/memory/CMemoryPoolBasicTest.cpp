@@ -13,11 +13,13 @@
 
 #include "gpos/assert.h"
 #include "gpos/common/CAutoTimer.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/common/clibwrapper.h"
 #include "gpos/error/CErrorHandlerStandard.h"
 #include "gpos/error/CException.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
 #include "gpos/string/CWStringDynamic.h"
 #include "gpos/task/CAutoTaskProxy.h"
@@ -28,6 +30,12 @@
 #define GPOS_MEM_TEST_ALLOC_SMALL (8)
 #define GPOS_MEM_TEST_ALLOC_LARGE (256)
 
+// number of objects allocated per round of the allocation benchmark
+#define GPOS_MEM_TEST_BENCH_OBJECTS (20000)
+
+// number of rounds of the allocation benchmark
+#define GPOS_MEM_TEST_BENCH_ROUNDS (10)
+
 using namespace gpos;
 
 //---------------------------------------------------------------------------
@@ -45,7 +53,9 @@ CMemoryPoolBasicTest::EresUnittest()
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_Print),
 #endif	// GPOS_DEBUG
-		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker)};
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestArena),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_BenchmarkArena)};
 
 	CAutoTraceFlag atf(EtraceTestMemoryPools, true /*value*/);
 
@@ -97,6 +107,152 @@ CMemoryPoolBasicTest::EresUnittest_TestTracker()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_TestArena
+//
+//	@doc:
+//		Run tests for bump-pointer pool
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_TestArena()
+{
+	if (GPOS_OK != EresNewDelete(CMemoryPoolManager::EpkArena) ||
+		GPOS_OK != EresLargeAlloc(CMemoryPoolManager::EpkArena) ||
+		GPOS_OK != EresPeakSize(CMemoryPoolManager::EpkArena) ||
+		GPOS_OK != EresArenaReuse() ||
+		GPOS_OK != EresTestExpectedError(EresThrowingCtorArena,
+										 CException::ExmiOOM)
+#ifdef GPOS_DEBUG
+		|| GPOS_OK != EresTestExpectedError(EresLeakArena, CException::ExmiAssert)
+#endif	// GPOS_DEBUG
+	)
+	{
+		return GPOS_FAILED;
+	}
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_BenchmarkArena
+//
+//	@doc:
+//		Compare allocation throughput of bump-pointer and tracker pools,
+//		and check that an arena pool stops growing once the objects freed
+//		in one round are reused in the next
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_BenchmarkArena()
+{
+	CAutoMemoryPool ampTracker(CAutoMemoryPool::ElcStrict,
+							   CMemoryPoolManager::EpkGeneral);
+	CAutoMemoryPool ampArena(CAutoMemoryPool::ElcStrict,
+							 CMemoryPoolManager::EpkArena);
+	CMemoryPool *mpArena = ampArena.Pmp();
+
+	ULONG ulTrackerTime =
+		UlAllocFreeLoop(ampTracker.Pmp(), GPOS_MEM_TEST_BENCH_ROUNDS);
+
+	// the first round carves the objects out of fresh slabs
+	(void) UlAllocFreeLoop(mpArena, 1 /*ulRounds*/);
+	const ULLONG ullSize = mpArena->TotalAllocatedSize();
+	const ULLONG ullPeakSize = mpArena->PeakAllocatedSize();
+
+	ULONG ulArenaTime = UlAllocFreeLoop(mpArena, GPOS_MEM_TEST_BENCH_ROUNDS);
+	GPOS_UNITTEST_ASSERT(ullSize == mpArena->TotalAllocatedSize());
+	GPOS_UNITTEST_ASSERT(ullPeakSize == mpArena->PeakAllocatedSize());
+
+	GPOS_TRACE_FORMAT(
+		"Allocated and freed %d objects %d times: tracker pool %dms, "
+		"arena pool %dms",
+		GPOS_MEM_TEST_BENCH_OBJECTS, GPOS_MEM_TEST_BENCH_ROUNDS, ulTrackerTime,
+		ulArenaTime);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::UlAllocFreeLoop
+//
+//	@doc:
+//		Allocate a batch of small objects and free them again, for the
+//		given number of rounds; return elapsed time in milliseconds
+//
+//---------------------------------------------------------------------------
+ULONG
+CMemoryPoolBasicTest::UlAllocFreeLoop(CMemoryPool *mp, ULONG ulRounds)
+{
+	CWallClock clock;
+
+	for (ULONG ulRound = 0; ulRound < ulRounds; ulRound++)
+	{
+		BYTE **rgpb = GPOS_NEW_ARRAY(mp, BYTE *, GPOS_MEM_TEST_BENCH_OBJECTS);
+		for (ULONG ul = 0; ul < GPOS_MEM_TEST_BENCH_OBJECTS; ul++)
+		{
+			rgpb[ul] = GPOS_NEW_ARRAY(mp, BYTE, Size(ul));
+		}
+
+		for (ULONG ul = 0; ul < GPOS_MEM_TEST_BENCH_OBJECTS; ul++)
+		{
+			GPOS_DELETE_ARRAY(rgpb[ul]);
+		}
+		GPOS_DELETE_ARRAY(rgpb);
+	}
+
+	return clock.ElapsedMS();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresArenaReuse
+//
+//	@doc:
+//		Check that a bump-pointer pool hands out freed memory again
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresArenaReuse()
+{
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, CMemoryPoolManager::EpkArena);
+	CMemoryPool *mp = amp.Pmp();
+
+	// a freed object is reused for one of the same size class
+	BYTE *pbFirst = GPOS_NEW_ARRAY(mp, BYTE, 24);
+	BYTE *pbOther = GPOS_NEW_ARRAY(mp, BYTE, 200);
+	GPOS_DELETE_ARRAY(pbFirst);
+	BYTE *pbSecond = GPOS_NEW_ARRAY(mp, BYTE, 20);
+	GPOS_UNITTEST_ASSERT(pbFirst == pbSecond);
+	GPOS_UNITTEST_ASSERT(20 == CMemoryPool::UserSizeOfAlloc(pbSecond));
+
+	// but not for a larger one
+	GPOS_DELETE_ARRAY(pbSecond);
+	BYTE *pbLarger = GPOS_NEW_ARRAY(mp, BYTE, 32);
+	GPOS_UNITTEST_ASSERT(pbFirst != pbLarger);
+
+	// the slab of a large object is released when the object is freed
+	const ULLONG ullSize = mp->TotalAllocatedSize();
+	BYTE *pbLarge =
+		GPOS_NEW_ARRAY(mp, BYTE, 2 * GPOS_MEM_ARENA_MAX_CLASS_SIZE);
+	GPOS_UNITTEST_ASSERT(ullSize < mp->TotalAllocatedSize());
+	GPOS_DELETE_ARRAY(pbLarge);
+	GPOS_UNITTEST_ASSERT(ullSize == mp->TotalAllocatedSize());
+	GPOS_UNITTEST_ASSERT(ullSize < mp->PeakAllocatedSize());
+
+	GPOS_DELETE_ARRAY(pbLarger);
+	GPOS_DELETE_ARRAY(pbOther);
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolBasicTest::EresTestType
@@ -108,7 +264,8 @@ CMemoryPoolBasicTest::EresUnittest_TestTracker()
 GPOS_RESULT
 CMemoryPoolBasicTest::EresTestType()
 {
-	if (GPOS_OK != EresNewDelete() ||
+	if (GPOS_OK != EresNewDelete(CMemoryPoolManager::EpkGeneral) ||
+		GPOS_OK != EresPeakSize(CMemoryPoolManager::EpkGeneral) ||
 		GPOS_OK != EresTestExpectedError(EresThrowingCtor, CException::ExmiOOM)
 
 #ifdef GPOS_DEBUG
@@ -167,11 +324,11 @@ CMemoryPoolBasicTest::EresTestExpectedError(GPOS_RESULT (*pfunc)(), ULONG minor)
 //
 //---------------------------------------------------------------------------
 GPOS_RESULT
-CMemoryPoolBasicTest::EresNewDelete()
+CMemoryPoolBasicTest::EresNewDelete(CMemoryPoolManager::EPoolKind pool_kind)
 {
 	// create memory pool
 	CAutoTimer at("NewDelete test", true /*fPrint*/);
-	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc);
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, pool_kind);
 	CMemoryPool *mp = amp.Pmp();
 
 	WCHAR rgwszText[] = GPOS_WSZ_LIT(
@@ -207,11 +364,86 @@ CMemoryPoolBasicTest::EresNewDelete()
 
 #endif	// GPOS_DEBUG
 
+	GPOS_UNITTEST_ASSERT(sizeof(rgwszText) ==
+						 CMemoryPool::UserSizeOfAlloc(wsz));
+	GPOS_UNITTEST_ASSERT(0 == clib::Wcsncmp(wsz, rgwszText,
+											GPOS_ARRAY_SIZE(rgwszText)));
+
 	GPOS_DELETE_ARRAY(wsz);
 
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresPeakSize
+//
+//	@doc:
+//		Check that the peak size of a pool survives freeing allocations
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresPeakSize(CMemoryPoolManager::EPoolKind pool_kind)
+{
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, pool_kind);
+	CMemoryPool *mp = amp.Pmp();
+
+	BYTE *pbSmall = GPOS_NEW_ARRAY(mp, BYTE, 16);
+	BYTE *pbLarge = GPOS_NEW_ARRAY(mp, BYTE, 4096);
+	const ULLONG ullSize = mp->TotalAllocatedSize();
+	GPOS_UNITTEST_ASSERT(0 < ullSize);
+	GPOS_UNITTEST_ASSERT(ullSize == mp->PeakAllocatedSize());
+
+	GPOS_DELETE_ARRAY(pbLarge);
+	GPOS_UNITTEST_ASSERT(mp->TotalAllocatedSize() <= ullSize);
+	GPOS_UNITTEST_ASSERT(ullSize == mp->PeakAllocatedSize());
+
+	GPOS_DELETE_ARRAY(pbSmall);
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresLargeAlloc
+//
+//	@doc:
+//		Interleave small allocations with allocations larger than a slab
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresLargeAlloc(CMemoryPoolManager::EPoolKind pool_kind)
+{
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, pool_kind);
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulAllocs = 64;
+	const ULONG ulLargeSize = 2 * GPOS_MEM_ARENA_INIT_SLAB_SIZE;
+	ULONG *rgpul[ulAllocs];
+
+	for (ULONG ul = 0; ul < ulAllocs; ul++)
+	{
+		ULONG ulSize = (0 == ul % 8) ? ulLargeSize : Size(ul);
+		ULONG ulElems = ulSize / GPOS_SIZEOF(ULONG);
+		rgpul[ul] = GPOS_NEW_ARRAY(mp, ULONG, ulElems);
+		rgpul[ul][0] = ul;
+		rgpul[ul][ulElems - 1] = ul;
+	}
+
+	for (ULONG ul = 0; ul < ulAllocs; ul++)
+	{
+		ULONG ulElems =
+			CMemoryPool::UserSizeOfAlloc(rgpul[ul]) / GPOS_SIZEOF(ULONG);
+		GPOS_UNITTEST_ASSERT(ul == rgpul[ul][0]);
+		GPOS_UNITTEST_ASSERT(ul == rgpul[ul][ulElems - 1]);
+		GPOS_DELETE_ARRAY(rgpul[ul]);
+	}
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolBasicTest::EresThrowingCtor
@@ -248,6 +480,39 @@ CMemoryPoolBasicTest::EresThrowingCtor()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresThrowingCtorArena
+//
+//	@doc:
+//		Exception in constructor of an object allocated in a bump-pointer pool
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresThrowingCtorArena()
+{
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, CMemoryPoolManager::EpkArena);
+	CMemoryPool *mp = amp.Pmp();
+
+	// malicious test class
+	class CMyTestClass
+	{
+	public:
+		CMyTestClass()
+		{
+			// throw in ctor
+			GPOS_RAISE(CException::ExmaSystem, CException::ExmiOOM);
+		}
+	};
+
+	// try instantiating the class
+	GPOS_NEW(mp) CMyTestClass();
+
+	// doesn't reach this line
+	return GPOS_FAILED;
+}
+
+
 #ifdef GPOS_DEBUG
 
 //---------------------------------------------------------------------------
@@ -321,6 +586,43 @@ CMemoryPoolBasicTest::EresLeakByException()
 	return GPOS_FAILED;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresLeakArena
+//
+//	@doc:
+//		Leak checking in a bump-pointer pool, including allocations that
+//		get a dedicated slab
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresLeakArena()
+{
+	CAutoTimer at("Arena leak test", true /*fPrint*/);
+
+	// scope for pool
+	{
+		CAutoMemoryPool amp(CAutoMemoryPool::ElcStrict,
+							CMemoryPoolManager::EpkArena);
+		CMemoryPool *mp = amp.Pmp();
+
+		for (ULONG i = 0; i < 10; i++)
+		{
+			ULONG ulElems = (0 == i % 4) ? GPOS_MEM_ARENA_INIT_SLAB_SIZE : 10;
+			ULONG *rgul = GPOS_NEW_ARRAY(mp, ULONG, ulElems);
+			rgul[2] = 1;
+
+			if (4 != i && 7 != i)
+			{
+				GPOS_DELETE_ARRAY(rgul);
+			}
+		}
+	}
+
+	return GPOS_FAILED;
+}
+
 #endif	// GPOS_DEBUG
 
 
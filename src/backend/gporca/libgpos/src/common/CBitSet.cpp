@@ -8,14 +8,13 @@
 //	@doc:
 //		Implementation of bit sets
 //
-//		Underlying assumption: a set contains only a few links of bitvectors
-//		hence, keeping them in a linked list is efficient;
+//		Underlying assumption: a set contains bits in only a few, nearby
+//		links, hence, keeping them in a contiguous array is efficient;
 //---------------------------------------------------------------------------
 
 #include "gpos/common/CBitSet.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 #include "gpos/common/CBitSetIter.h"
 
 #ifdef GPOS_DEBUG
@@ -26,96 +25,117 @@ using namespace gpos;
 
 FORCE_GENERATE_DBGSTR(CBitSet);
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSetLink
-//
-//	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, ULONG offset,
-								  ULONG vector_size)
-	: m_offset(offset)
+#define BITS_PER_UNIT (8 * GPOS_SIZEOF(ULLONG))
+
+// number of bits set in a unit
+static inline ULONG
+CountSetBits(ULLONG unit)
 {
-	m_vec = GPOS_NEW(mp) CBitVector(mp, vector_size);
+	return (ULONG) __builtin_popcountll(unit);
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSetLink
+//		CBitSet::GetOtherUnit
 //
 //	@doc:
-//		copy ctor
+//		Unit of the other set lining up with our unit at index idx, zero
+//		if the other set doesn't store that unit
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, const CBitSetLink &bsl)
-	: m_offset(bsl.m_offset)
+ULLONG
+CBitSet::GetOtherUnit(const CBitSet *bs, ULONG idx) const
 {
-	m_vec = GPOS_NEW(mp) CBitVector(mp, *bsl.GetVec());
-}
+	GPOS_ASSERT(m_vector_size == bs->m_vector_size);
 
+	ULONG link = m_first_link + idx / m_units_per_link;
+	if (!bs->IsLinkStored(link))
+	{
+		return 0;
+	}
 
-//---------------------------------------------------------------------------
-//	@function:
-//		~CBitSetLink
-//
-//	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::~CBitSetLink()
-{
-	GPOS_DELETE(m_vec);
+	return bs->m_units[(link - bs->m_first_link) * m_units_per_link +
+					   idx % m_units_per_link];
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::FindLinkByOffset
+//		CBitSet::EnsureLinks
 //
 //	@doc:
-//		Find bit set link for a given offset; if non-existent return previous
-//		link (may be NULL);
-//		By providing a starting link we can implement a number of operations
-//		in one sweep, ie O(N)
+//		Extend the unit array so that it stores all links between the given
+//		ones; the array grows geometrically, and links that were stored
+//		before are moved to their new position
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSetLink *
-CBitSet::FindLinkByOffset(ULONG offset, CBitSetLink *bsl) const
+void
+CBitSet::EnsureLinks(ULONG first_link, ULONG last_link)
 {
-	CBitSetLink *found = nullptr;
-	CBitSetLink *cursor = bsl;
+	GPOS_ASSERT(first_link <= last_link);
 
-	if (nullptr == bsl)
+	ULONG new_first_link = first_link;
+	ULONG new_last_link = last_link;
+	if (0 < m_num_links)
 	{
-		// if no cursor provided start with first element
-		cursor = m_bsllist.First();
-	}
-	else
-	{
-		GPOS_ASSERT(bsl->GetOffset() <= offset && "invalid start cursor");
-		found = bsl;
+		ULONG old_last_link = m_first_link + m_num_links - 1;
+		if (m_first_link <= first_link && last_link <= old_last_link)
+		{
+			// all links are stored already
+			return;
+		}
+
+		new_first_link = std::min(first_link, m_first_link);
+		new_last_link = std::max(last_link, old_last_link);
 	}
 
-	GPOS_ASSERT_IMP(nullptr != cursor,
-					GPOS_OK == m_bsllist.Find(cursor) && "cursor not in list");
+	const ULONG old_num_units = m_num_links * m_units_per_link;
+	const ULONG new_num_units =
+		(new_last_link - new_first_link + 1) * m_units_per_link;
+	const ULONG shift = (0 < m_num_links)
+							? (m_first_link - new_first_link) * m_units_per_link
+							: 0;
 
-	while (true)
+	ULLONG *units = m_units;
+	if (new_num_units > m_capacity)
 	{
-		// no more links or we've overshot the target
-		if (nullptr == cursor || cursor->GetOffset() > offset)
+		ULONG capacity = std::max(new_num_units, 2 * m_capacity);
+		units = GPOS_NEW_ARRAY(m_mp, ULLONG, capacity);
+		if (0 < old_num_units)
 		{
-			break;
+			clib::Memcpy(units + shift, m_units,
+						 old_num_units * sizeof(ULLONG));
 		}
 
-		found = cursor;
-		cursor = m_bsllist.Next(cursor);
+		if (m_units != m_inline_units)
+		{
+			GPOS_DELETE_ARRAY(m_units);
+		}
+		m_units = units;
+		m_capacity = capacity;
+	}
+	else if (0 < shift)
+	{
+		// move units up in place, starting from the end
+		for (ULONG ul = old_num_units; ul > 0; ul--)
+		{
+			units[ul - 1 + shift] = units[ul - 1];
+		}
 	}
 
-	GPOS_ASSERT_IMP(found, found->GetOffset() <= offset);
-	return found;
+	// clear the units of the new links
+	for (ULONG ul = 0; ul < shift; ul++)
+	{
+		units[ul] = 0;
+	}
+	for (ULONG ul = shift + old_num_units; ul < new_num_units; ul++)
+	{
+		units[ul] = 0;
+	}
+
+	m_first_link = new_first_link;
+	m_num_links = new_last_link - new_first_link + 1;
 }
 
 
@@ -124,18 +144,18 @@ CBitSet::FindLinkByOffset(ULONG offset, CBitSetLink *bsl) const
 //		CBitSet::RecomputeSize
 //
 //	@doc:
-//		Compute size of set by adding up sizes of links
+//		Compute size of set by counting the bits of all units
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::RecomputeSize()
 {
 	m_size = 0;
-	CBitSetLink *bsl = nullptr;
 
-	for (bsl = m_bsllist.First(); bsl != nullptr; bsl = m_bsllist.Next(bsl))
+	const ULONG num_units = m_num_links * m_units_per_link;
+	for (ULONG ul = 0; ul < num_units; ul++)
 	{
-		m_size += bsl->GetVec()->CountSetBits();
+		m_size += CountSetBits(m_units[ul]);
 	}
 }
 
@@ -145,43 +165,25 @@ CBitSet::RecomputeSize()
 //		CBitSet::Clear
 //
 //	@doc:
-//		release all links
+//		release all units
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Clear()
 {
-	CBitSetLink *bsl = nullptr;
-
-	while (nullptr != (bsl = m_bsllist.First()))
+	if (m_units != m_inline_units)
 	{
-		CBitSetLink *bsl_to_remove = bsl;
-		bsl = m_bsllist.Next(bsl);
-
-		m_bsllist.Remove(bsl_to_remove);
-		GPOS_DELETE(bsl_to_remove);
+		GPOS_DELETE_ARRAY(m_units);
 	}
 
-	RecomputeSize();
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::GetOffset
-//
-//	@doc:
-//		Compute offset
-//
-//---------------------------------------------------------------------------
-ULONG
-CBitSet::ComputeOffset(ULONG ul) const
-{
-	return (ul / m_vector_size) * m_vector_size;
+	m_units = m_inline_units;
+	m_capacity = GPOS_BITSET_INLINE_UNITS;
+	m_first_link = 0;
+	m_num_links = 0;
+	m_size = 0;
 }
 
 
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CBitSet::CBitSet
@@ -191,9 +193,16 @@ CBitSet::ComputeOffset(ULONG ul) const
 //
 //---------------------------------------------------------------------------
 CBitSet::CBitSet(CMemoryPool *mp, ULONG vector_size)
-	: m_mp(mp), m_vector_size(vector_size), m_size(0)
+	: m_mp(mp),
+	  m_vector_size(vector_size),
+	  m_units_per_link((vector_size + BITS_PER_UNIT - 1) / BITS_PER_UNIT),
+	  m_size(0),
+	  m_first_link(0),
+	  m_num_links(0),
+	  m_capacity(GPOS_BITSET_INLINE_UNITS),
+	  m_units(m_inline_units)
 {
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
+	GPOS_ASSERT(0 < vector_size);
 }
 
 
@@ -206,9 +215,15 @@ CBitSet::CBitSet(CMemoryPool *mp, ULONG vector_size)
 //
 //---------------------------------------------------------------------------
 CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
-	: m_mp(mp), m_vector_size(bs.m_vector_size), m_size(0)
+	: m_mp(mp),
+	  m_vector_size(bs.m_vector_size),
+	  m_units_per_link(bs.m_units_per_link),
+	  m_size(0),
+	  m_first_link(0),
+	  m_num_links(0),
+	  m_capacity(GPOS_BITSET_INLINE_UNITS),
+	  m_units(m_inline_units)
 {
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
 	Union(&bs);
 }
 
@@ -238,15 +253,12 @@ CBitSet::~CBitSet()
 BOOL
 CBitSet::Get(ULONG pos) const
 {
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr != bsl && bsl->GetOffset() == offset)
+	if (!IsLinkStored(GetLink(pos)))
 	{
-		return bsl->GetVec()->Get(pos - offset);
+		return false;
 	}
 
-	return false;
+	return 0 != (*GetUnit(pos) & GetMask(pos));
 }
 
 
@@ -255,37 +267,22 @@ CBitSet::Get(ULONG pos) const
 //		CBitSet::ExchangeSet
 //
 //	@doc:
-//		Set given bit; return previous value; allocate new link if necessary
+//		Set given bit; return previous value; extend unit array if necessary
 //
 //---------------------------------------------------------------------------
 BOOL
 CBitSet::ExchangeSet(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
+	ULONG link = GetLink(pos);
+	EnsureLinks(link, link);
 
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr == bsl || bsl->GetOffset() != offset)
-	{
-		CBitSetLink *pbsl_new =
-			GPOS_NEW(m_mp) CBitSetLink(m_mp, offset, m_vector_size);
-		if (nullptr == bsl)
-		{
-			m_bsllist.Prepend(pbsl_new);
-		}
-		else
-		{
-			// insert after found link
-			m_bsllist.Append(pbsl_new, bsl);
-		}
+	ULLONG *unit = GetUnit(pos);
+	ULLONG mask = GetMask(pos);
 
-		bsl = pbsl_new;
-	}
-
-	GPOS_ASSERT(bsl->GetOffset() == offset);
-
-	BOOL bit = bsl->GetVec()->ExchangeSet(pos - offset);
+	BOOL bit = (0 != (*unit & mask));
 	if (!bit)
 	{
+		*unit |= mask;
 		m_size++;
 	}
 
@@ -304,29 +301,22 @@ CBitSet::ExchangeSet(ULONG pos)
 BOOL
 CBitSet::ExchangeClear(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr != bsl && bsl->GetOffset() == offset)
+	if (!IsLinkStored(GetLink(pos)))
 	{
-		BOOL bit = bsl->GetVec()->ExchangeClear(pos - offset);
-
-		// remove empty link
-		if (bsl->GetVec()->IsEmpty())
-		{
-			m_bsllist.Remove(bsl);
-			GPOS_DELETE(bsl);
-		}
+		return false;
+	}
 
-		if (bit)
-		{
-			m_size--;
-		}
+	ULLONG *unit = GetUnit(pos);
+	ULLONG mask = GetMask(pos);
 
-		return bit;
+	BOOL bit = (0 != (*unit & mask));
+	if (bit)
+	{
+		*unit &= ~mask;
+		m_size--;
 	}
 
-	return false;
+	return bit;
 }
 
 
@@ -335,74 +325,30 @@ CBitSet::ExchangeClear(ULONG pos)
 //		CBitSet::Union
 //
 //	@doc:
-//		Union with given other set;
-//		(1) determine which links need to be allocated before(!) modifying
-//			the set allocate and copy missing links aside
-//		(2) insert the new links into the list
-//		(3) union all links, old and new, on a per-bitvector basis
-//
-//		For clarity step (2) and (3) are separated;
+//		Union with given other set; extend the unit array to the links
+//		of the other set, then OR the units lining up with the other set
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Union(const CBitSet *pbsOther)
 {
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// dynamic array of CBitSetLink
-	using CBitSetLinkArray = CDynamicPtrArray<CBitSetLink, CleanupNULL>;
-
-	CAutoRef<CBitSetLinkArray> a_drgpbsl;
-	a_drgpbsl = GPOS_NEW(m_mp) CBitSetLinkArray(m_mp);
+	GPOS_ASSERT(m_vector_size == pbsOther->m_vector_size &&
+				"bitsets must have the same vector size");
 
-	// iterate through other's links and copy missing links to array
-	for (bsl_other = pbsOther->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = pbsOther->m_bsllist.Next(bsl_other))
+	if (0 == pbsOther->Size())
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-		if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset())
-		{
-			// need to copy this link
-			CAutoP<CBitSetLink> a_pbsl;
-			a_pbsl = GPOS_NEW(m_mp) CBitSetLink(m_mp, *bsl_other);
-			a_drgpbsl->Append(a_pbsl.Value());
-
-			a_pbsl.Reset();
-		}
+		return;
 	}
 
-	// insert all new links
-	bsl = nullptr;
-	for (ULONG i = 0; i < a_drgpbsl->Size(); i++)
-	{
-		CBitSetLink *pbslInsert = (*a_drgpbsl)[i];
-		bsl = FindLinkByOffset(pbslInsert->GetOffset(), bsl);
-
-		GPOS_ASSERT_IMP(nullptr != bsl,
-						bsl->GetOffset() < pbslInsert->GetOffset());
-		if (nullptr == bsl)
-		{
-			m_bsllist.Prepend(pbslInsert);
-		}
-		else
-		{
-			m_bsllist.Append(pbslInsert, bsl);
-		}
-	}
+	EnsureLinks(pbsOther->m_first_link,
+				pbsOther->m_first_link + pbsOther->m_num_links - 1);
 
-	// iterate through all links and union them up
-	bsl_other = nullptr;
-	bsl = m_bsllist.First();
-	while (nullptr != bsl)
+	ULLONG *units =
+		m_units + (pbsOther->m_first_link - m_first_link) * m_units_per_link;
+	const ULONG num_units = pbsOther->m_num_links * m_units_per_link;
+	for (ULONG ul = 0; ul < num_units; ul++)
 	{
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
-		{
-			bsl->GetVec()->Or(bsl_other->GetVec());
-		}
-
-		bsl = m_bsllist.Next(bsl);
+		units[ul] |= pbsOther->m_units[ul];
 	}
 
 	RecomputeSize();
@@ -414,7 +360,7 @@ CBitSet::Union(const CBitSet *pbsOther)
 //		CBitSet::Intersection
 //
 //	@doc:
-//		Iterate through all links and intersect them; release unused links
+//		AND all units with the units lining up with the other set
 //
 //---------------------------------------------------------------------------
 void
@@ -425,36 +371,12 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 		return;
 	}
 
-	CBitSetLink *bsl_other = nullptr;
-	CBitSetLink *bsl = m_bsllist.First();
-
-	while (nullptr != bsl)
+	const ULONG num_units = m_num_links * m_units_per_link;
+	for (ULONG ul = 0; ul < num_units; ul++)
 	{
-		CBitSetLink *bsl_to_remove = nullptr;
-
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
+		if (0 != m_units[ul])
 		{
-			bsl->GetVec()->And(bsl_other->GetVec());
-			CBitSetLink *bsl_prev = bsl;
-
-			bsl = m_bsllist.Next(bsl);
-			// If vector is empty after "ANDing", remove the vector, otherwise
-			// we can get into a situation where an empty vector exists
-			// and causes wrong results for equals/contains operations later
-			if (bsl_prev->GetVec()->IsEmpty())
-			{
-				m_bsllist.Remove(bsl_prev);
-				GPOS_DELETE(bsl_prev);
-			}
-		}
-		else
-		{
-			bsl_to_remove = bsl;
-			bsl = m_bsllist.Next(bsl);
-
-			m_bsllist.Remove(bsl_to_remove);
-			GPOS_DELETE(bsl_to_remove);
+			m_units[ul] &= GetOtherUnit(pbsOther, ul);
 		}
 	}
 
@@ -467,23 +389,28 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 //		CBitSet::Difference
 //
 //	@doc:
-//		Substract other set from this by iterating through other set and
-//		explicit removal of elements;
+//		Clear the bits of all units that are set in the units lining up
+//		with the other set
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Difference(const CBitSet *pbs)
 {
-	if (IsDisjoint(pbs))
+	if (0 == Size() || 0 == pbs->Size())
 	{
 		return;
 	}
 
-	CBitSetIter bsiter(*pbs);
-	while (bsiter.Advance())
+	const ULONG num_units = m_num_links * m_units_per_link;
+	for (ULONG ul = 0; ul < num_units; ul++)
 	{
-		(void) ExchangeClear(bsiter.Bit());
+		if (0 != m_units[ul])
+		{
+			m_units[ul] &= ~GetOtherUnit(pbs, ul);
+		}
 	}
+
+	RecomputeSize();
 }
 
 
@@ -492,7 +419,8 @@ CBitSet::Difference(const CBitSet *pbs)
 //		CBitSet::FSubset
 //
 //	@doc:
-//		Determine if given vector is subset
+//		Determine if given vector is subset; all bits of the other set must
+//		be in units lining up with our units, and be set there
 //
 //---------------------------------------------------------------------------
 BOOL
@@ -504,23 +432,20 @@ CBitSet::ContainsAll(const CBitSet *bs) const
 		return false;
 	}
 
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// iterate through other's links and check for subsets
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	ULONG contained = 0;
+	const ULONG num_units = m_num_links * m_units_per_link;
+	for (ULONG ul = 0; ul < num_units && contained < bs->Size(); ul++)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-
-		if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->ContainsAll(bsl_other->GetVec()))
+		ULLONG other_unit = GetOtherUnit(bs, ul);
+		if (0 != (other_unit & ~m_units[ul]))
 		{
 			return false;
 		}
+
+		contained += CountSetBits(other_unit);
 	}
 
-	return true;
+	return contained == bs->Size();
 }
 
 
@@ -541,30 +466,8 @@ CBitSet::Equals(const CBitSet *bs) const
 		return true;
 	}
 
-	// skip iterating if we can already tell by the sizes
-	if (Size() != bs->Size())
-	{
-		return false;
-	}
-
-	CBitSetLink *bsl = m_bsllist.First();
-	CBitSetLink *bsl_other = bs->m_bsllist.First();
-
-	while (nullptr != bsl)
-	{
-		if (nullptr == bsl_other ||
-			bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->Equals(bsl_other->GetVec()))
-		{
-			return false;
-		}
-
-		bsl = m_bsllist.Next(bsl);
-		bsl_other = bs->m_bsllist.Next(bsl_other);
-	}
-
-	// same length implies bsl_other must have reached end as well
-	return bsl_other == nullptr;
+	// sets of equal size are equal if one contains the other
+	return Size() == bs->Size() && ContainsAll(bs);
 }
 
 
@@ -580,17 +483,15 @@ CBitSet::Equals(const CBitSet *bs) const
 BOOL
 CBitSet::IsDisjoint(const CBitSet *bs) const
 {
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// iterate through other's links an check if disjoint
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	if (0 == Size() || 0 == bs->Size())
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
+		return true;
+	}
 
-		if (nullptr != bsl && bsl->GetOffset() == bsl_other->GetOffset() &&
-			!bsl->GetVec()->IsDisjoint(bsl_other->GetVec()))
+	const ULONG num_units = m_num_links * m_units_per_link;
+	for (ULONG ul = 0; ul < num_units; ul++)
+	{
+		if (0 != m_units[ul] && 0 != (m_units[ul] & GetOtherUnit(bs, ul)))
 		{
 			return false;
 		}
@@ -605,7 +506,8 @@ CBitSet::IsDisjoint(const CBitSet *bs) const
 //		CBitSet::HashValue
 //
 //	@doc:
-//		Compute hash value for set
+//		Compute hash value for set by combining the hash values of the
+//		non-empty links
 //
 //---------------------------------------------------------------------------
 ULONG
@@ -613,11 +515,22 @@ CBitSet::HashValue() const
 {
 	ULONG ulHash = 0;
 
-	CBitSetLink *bsl = m_bsllist.First();
-	while (nullptr != bsl)
+	for (ULONG link = 0; link < m_num_links; link++)
 	{
-		ulHash = gpos::CombineHashes(ulHash, bsl->GetVec()->HashValue());
-		bsl = m_bsllist.Next(bsl);
+		const ULLONG *units = m_units + link * m_units_per_link;
+
+		BOOL is_empty = true;
+		for (ULONG ul = 0; ul < m_units_per_link && is_empty; ul++)
+		{
+			is_empty = (0 == units[ul]);
+		}
+
+		if (!is_empty)
+		{
+			ulHash = gpos::CombineHashes(
+				ulHash, gpos::HashByteArray((const BYTE *) units,
+											m_units_per_link * sizeof(ULLONG)));
+		}
 	}
 
 	return ulHash;
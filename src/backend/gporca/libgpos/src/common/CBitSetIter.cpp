@@ -12,7 +12,6 @@
 #include "gpos/common/CBitSetIter.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 
 using namespace gpos;
 
@@ -26,7 +25,11 @@ using namespace gpos;
 //
 //---------------------------------------------------------------------------
 CBitSetIter::CBitSetIter(const CBitSet &bs)
-	: m_bs(bs), m_cursor((ULONG) -1), m_bsl(nullptr), m_active(true)
+	: m_bs(bs),
+	  m_unit_idx(gpos::ulong_max),
+	  m_unit(0),
+	  m_bit(gpos::ulong_max),
+	  m_active(true)
 {
 }
 
@@ -44,25 +47,28 @@ CBitSetIter::Advance()
 {
 	GPOS_ASSERT(m_active && "called advance on exhausted iterator");
 
-	if (nullptr == m_bsl)
+	// skip empty units
+	const ULONG num_units = m_bs.m_num_links * m_bs.m_units_per_link;
+	while (0 == m_unit)
 	{
-		m_bsl = m_bs.m_bsllist.First();
-	}
-
-	while (nullptr != m_bsl)
-	{
-		if (m_cursor + 1 <= m_bs.m_vector_size &&
-			m_bsl->GetVec()->GetNextSetBit(m_cursor + 1, m_cursor))
+		m_unit_idx++;
+		if (m_unit_idx >= num_units)
 		{
-			break;
+			m_active = false;
+			return false;
 		}
 
-		m_bsl = m_bs.m_bsllist.Next(m_bsl);
-		m_cursor = (ULONG) -1;
+		m_unit = m_bs.m_units[m_unit_idx];
 	}
 
-	m_active = (nullptr != m_bsl);
-	return m_active;
+	// visit lowest remaining bit of current unit
+	const ULONG link = m_bs.m_first_link + m_unit_idx / m_bs.m_units_per_link;
+	m_bit = link * m_bs.m_vector_size +
+			(m_unit_idx % m_bs.m_units_per_link) * 64 +
+			(ULONG) __builtin_ctzll(m_unit);
+	m_unit &= m_unit - 1;
+
+	return true;
 }
 
 
@@ -77,10 +83,11 @@ CBitSetIter::Advance()
 ULONG
 CBitSetIter::Bit() const
 {
-	GPOS_ASSERT(m_active && nullptr != m_bsl && "iterator uninitialized");
-	GPOS_ASSERT(m_bsl->GetVec()->Get(m_cursor));
+	GPOS_ASSERT(m_active && gpos::ulong_max != m_bit &&
+				"iterator uninitialized");
+	GPOS_ASSERT(m_bs.Get(m_bit));
 
-	return m_bsl->GetOffset() + m_cursor;
+	return m_bit;
 }
 
 // EOF
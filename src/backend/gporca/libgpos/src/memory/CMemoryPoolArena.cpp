@@ -0,0 +1,388 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArena.cpp
+//
+//	@doc:
+//		Implementation of bump-pointer memory pool
+//
+//---------------------------------------------------------------------------
+
+#include "gpos/memory/CMemoryPoolArena.h"
+
+#include "gpos/assert.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/IMemoryVisitor.h"
+#include "gpos/types.h"
+#include "gpos/utils.h"
+
+using namespace gpos;
+
+#define GPOS_MEM_ARENA_SLAB_HEADER_SIZE GPOS_MEM_ALIGNED_STRUCT_SIZE(SSlab)
+
+#define GPOS_MEM_ARENA_ALLOC_HEADER_SIZE \
+	GPOS_MEM_ALIGNED_STRUCT_SIZE(SAllocHeader)
+
+#define GPOS_MEM_ARENA_BYTES_TOTAL(ulNumBytes) \
+	(GPOS_MEM_ARENA_ALLOC_HEADER_SIZE + GPOS_MEM_ALIGNED_SIZE(ulNumBytes))
+
+// round the user size of a small allocation up to its size class; return
+// the index of the class
+static ULONG
+SizeClass(ULONG bytes, ULONG *class_size)
+{
+	GPOS_ASSERT(bytes <= GPOS_MEM_ARENA_MAX_CLASS_SIZE);
+
+	if (bytes <= 128)
+	{
+		ULONG ul = std::max((ULONG) 1, (bytes + 7) / 8);
+		*class_size = ul * 8;
+		return ul - 1;
+	}
+
+	// four classes per power of two, starting at 128 < bytes <= 256
+	ULONG power = 7;
+	while ((1U << (power + 1)) < bytes)
+	{
+		power++;
+	}
+	const ULONG step = (1U << power) / 4;
+	const ULONG ul = (bytes - (1U << power) + step - 1) / step;
+	*class_size = (1U << power) + ul * step;
+
+	const ULONG size_class = 16 + (power - 7) * 4 + ul - 1;
+	GPOS_ASSERT(size_class < GPOS_MEM_ARENA_NUM_SIZE_CLASSES);
+
+	return size_class;
+}
+
+
+// total size of the memory block of an allocation in a regular slab
+ULLONG
+CMemoryPoolArena::BlockSize(ULONG bytes)
+{
+	ULONG class_size = 0;
+	(void) SizeClass(bytes, &class_size);
+
+	return GPOS_MEM_ARENA_BYTES_TOTAL((ULLONG) class_size);
+}
+
+
+// dtor
+CMemoryPoolArena::~CMemoryPoolArena()
+{
+	GPOS_ASSERT(nullptr == m_slabs);
+	GPOS_ASSERT(nullptr == m_dedicated_slabs);
+}
+
+
+// account for a slab obtained from or returned to the system
+void
+CMemoryPoolArena::RecordSlab(ULLONG size, BOOL is_alloc)
+{
+	if (is_alloc)
+	{
+		m_total_slab_size += size;
+		m_peak_slab_size = std::max(m_peak_slab_size, m_total_slab_size);
+	}
+	else
+	{
+		GPOS_ASSERT(size <= m_total_slab_size);
+		m_total_slab_size -= size;
+	}
+}
+
+
+// obtain a new regular slab; the rest of the current slab is abandoned
+void
+CMemoryPoolArena::AddSlab()
+{
+	const ULLONG slab_size = m_next_slab_size;
+	m_next_slab_size =
+		std::min((ULLONG) GPOS_MEM_ARENA_MAX_SLAB_SIZE, 2 * m_next_slab_size);
+
+	SSlab *slab = static_cast<SSlab *>(AllocSlab(slab_size));
+	GPOS_OOM_CHECK(slab);
+
+	slab->m_size = slab_size;
+	slab->m_prev = nullptr;
+	slab->m_used_end = nullptr;
+	RecordSlab(slab_size, true /*is_alloc*/);
+
+	if (nullptr != m_slabs)
+	{
+		m_slabs->m_used_end = m_next_free;
+	}
+
+	slab->m_next = m_slabs;
+	m_slabs = slab;
+	m_next_free = reinterpret_cast<BYTE *>(slab) +
+				  GPOS_MEM_ARENA_SLAB_HEADER_SIZE;
+	m_slab_end = reinterpret_cast<BYTE *>(slab) + slab_size;
+}
+
+
+// allocate a large object in a slab of its own
+CMemoryPoolArena::SAllocHeader *
+CMemoryPoolArena::AllocDedicated(ULONG bytes)
+{
+	const ULLONG slab_size = GPOS_MEM_ARENA_SLAB_HEADER_SIZE +
+							 GPOS_MEM_ARENA_BYTES_TOTAL((ULLONG) bytes);
+
+	SSlab *slab = static_cast<SSlab *>(AllocSlab(slab_size));
+	GPOS_OOM_CHECK(slab);
+
+	slab->m_size = slab_size;
+	slab->m_used_end = reinterpret_cast<BYTE *>(slab) + slab_size;
+	RecordSlab(slab_size, true /*is_alloc*/);
+
+	slab->m_prev = nullptr;
+	slab->m_next = m_dedicated_slabs;
+	if (nullptr != m_dedicated_slabs)
+	{
+		m_dedicated_slabs->m_prev = slab;
+	}
+	m_dedicated_slabs = slab;
+
+	return reinterpret_cast<SAllocHeader *>(reinterpret_cast<BYTE *>(slab) +
+											GPOS_MEM_ARENA_SLAB_HEADER_SIZE);
+}
+
+
+// release the slab of a large object
+void
+CMemoryPoolArena::FreeDedicated(SAllocHeader *header)
+{
+	SSlab *slab = reinterpret_cast<SSlab *>(reinterpret_cast<BYTE *>(header) -
+											GPOS_MEM_ARENA_SLAB_HEADER_SIZE);
+
+	if (nullptr != slab->m_prev)
+	{
+		slab->m_prev->m_next = slab->m_next;
+	}
+	else
+	{
+		GPOS_ASSERT(slab == m_dedicated_slabs);
+		m_dedicated_slabs = slab->m_next;
+	}
+
+	if (nullptr != slab->m_next)
+	{
+		slab->m_next->m_prev = slab->m_prev;
+	}
+
+	RecordSlab(slab->m_size, false /*is_alloc*/);
+	FreeSlab(slab);
+}
+
+
+void *
+CMemoryPoolArena::NewImpl(const ULONG bytes,
+						  const CHAR *file GPOS_ASSERTS_ONLY,
+						  const ULONG line GPOS_ASSERTS_ONLY,
+						  CMemoryPool::EAllocationType)
+{
+	GPOS_ASSERT(bytes <= GPOS_MEM_ALLOC_MAX);
+
+	SAllocHeader *header = nullptr;
+	if (GPOS_MEM_ARENA_MAX_CLASS_SIZE < bytes)
+	{
+		header = AllocDedicated(bytes);
+	}
+	else
+	{
+		ULONG class_size = 0;
+		const ULONG size_class = SizeClass(bytes, &class_size);
+
+		header = m_free_lists[size_class];
+		if (nullptr != header)
+		{
+			// reuse a freed allocation of the same size class
+			m_free_lists[size_class] =
+				*reinterpret_cast<SAllocHeader **>(header + 1);
+		}
+		else
+		{
+			const ULLONG alloc_size =
+				GPOS_MEM_ARENA_BYTES_TOTAL((ULLONG) class_size);
+			if ((ULLONG)(m_slab_end - m_next_free) < alloc_size)
+			{
+				AddSlab();
+			}
+
+			header = reinterpret_cast<SAllocHeader *>(m_next_free);
+			m_next_free += alloc_size;
+			GPOS_ASSERT(m_next_free <= m_slab_end);
+		}
+	}
+
+	header->m_mp = this;
+	header->m_user_size = bytes;
+	header->m_tag = GPOS_MEM_ARENA_TAG;
+	m_num_allocations++;
+
+#ifdef GPOS_DEBUG
+	header->m_filename = file;
+	header->m_serial = m_num_allocations;
+	header->m_line = line;
+	header->m_freed = false;
+#endif	// GPOS_DEBUG
+
+	void *ptr_result = header + 1;
+
+#ifdef GPOS_DEBUG
+	clib::Memset(ptr_result, GPOS_MEM_INIT_PATTERN_CHAR, bytes);
+#endif	// GPOS_DEBUG
+
+	return ptr_result;
+}
+
+
+// free memory allocation; a small allocation goes on the free list of its
+// size class, the slab of a large one is returned to the system
+void
+CMemoryPoolArena::DeleteImpl(void *ptr, EAllocationType)
+{
+	GPOS_ASSERT(IsArenaAlloc(ptr));
+
+	SAllocHeader *header = static_cast<SAllocHeader *>(ptr) - 1;
+	CMemoryPoolArena *mp = header->m_mp;
+
+#ifdef GPOS_DEBUG
+	GPOS_ASSERT(!header->m_freed && "double free");
+	header->m_freed = true;
+
+	// mark user memory as unused in debug mode
+	clib::Memset(ptr, GPOS_MEM_FREED_PATTERN_CHAR, UserSizeOfAlloc(ptr));
+#endif	// GPOS_DEBUG
+
+	if (GPOS_MEM_ARENA_MAX_CLASS_SIZE < header->m_user_size)
+	{
+		mp->FreeDedicated(header);
+		return;
+	}
+
+	ULONG class_size = 0;
+	const ULONG size_class = SizeClass(header->m_user_size, &class_size);
+	*static_cast<SAllocHeader **>(ptr) = mp->m_free_lists[size_class];
+	mp->m_free_lists[size_class] = header;
+}
+
+
+// get user requested size of allocation
+ULONG
+CMemoryPoolArena::UserSizeOfAlloc(const void *ptr)
+{
+	GPOS_ASSERT(IsArenaAlloc(ptr));
+
+	const SAllocHeader *header = static_cast<const SAllocHeader *>(ptr) - 1;
+	return header->m_user_size;
+}
+
+
+// release all slabs
+void
+CMemoryPoolArena::FreeSlabs()
+{
+	while (nullptr != m_slabs)
+	{
+		SSlab *slab = m_slabs;
+		m_slabs = slab->m_next;
+		FreeSlab(slab);
+	}
+
+	while (nullptr != m_dedicated_slabs)
+	{
+		SSlab *slab = m_dedicated_slabs;
+		m_dedicated_slabs = slab->m_next;
+		FreeSlab(slab);
+	}
+
+	for (ULONG ul = 0; ul < GPOS_MEM_ARENA_NUM_SIZE_CLASSES; ul++)
+	{
+		m_free_lists[ul] = nullptr;
+	}
+
+	m_next_free = nullptr;
+	m_slab_end = nullptr;
+	m_total_slab_size = 0;
+}
+
+
+// obtain memory for a slab from the system
+void *
+CMemoryPoolArena::AllocSlab(ULLONG size)
+{
+	return clib::Malloc(size);
+}
+
+
+// return memory of a slab to the system
+void
+CMemoryPoolArena::FreeSlab(void *slab)
+{
+	clib::Free(slab);
+}
+
+
+#ifdef GPOS_DEBUG
+
+// walk the allocations of all slabs and visit those not yet freed
+void
+CMemoryPoolArena::WalkLiveObjects(IMemoryVisitor *visitor)
+{
+	GPOS_ASSERT(nullptr != visitor);
+
+	for (SSlab *slab = m_slabs; nullptr != slab; slab = slab->m_next)
+	{
+		BYTE *alloc = reinterpret_cast<BYTE *>(slab) +
+					  GPOS_MEM_ARENA_SLAB_HEADER_SIZE;
+		BYTE *used_end = (slab == m_slabs) ? m_next_free : slab->m_used_end;
+
+		while (alloc < used_end)
+		{
+			SAllocHeader *header = reinterpret_cast<SAllocHeader *>(alloc);
+			GPOS_ASSERT(GPOS_MEM_ARENA_TAG == header->m_tag);
+
+			if (!header->m_freed)
+			{
+				visitor->Visit(header + 1, header->m_user_size, header,
+							   BlockSize(header->m_user_size),
+							   header->m_filename, header->m_line,
+							   header->m_serial, nullptr);
+			}
+
+			alloc += BlockSize(header->m_user_size);
+		}
+	}
+
+	// a dedicated slab holds one live allocation; it is released on free
+	for (SSlab *slab = m_dedicated_slabs; nullptr != slab;
+		 slab = slab->m_next)
+	{
+		SAllocHeader *header = reinterpret_cast<SAllocHeader *>(
+			reinterpret_cast<BYTE *>(slab) + GPOS_MEM_ARENA_SLAB_HEADER_SIZE);
+		GPOS_ASSERT(GPOS_MEM_ARENA_TAG == header->m_tag);
+
+		visitor->Visit(header + 1, header->m_user_size, header,
+					   GPOS_MEM_ARENA_BYTES_TOTAL(header->m_user_size),
+					   header->m_filename, header->m_line, header->m_serial,
+					   nullptr);
+	}
+}
+
+#endif	// GPOS_DEBUG
+
+
+// Prepare the memory pool to be deleted
+void
+CMemoryPoolArena::TearDown()
+{
+	FreeSlabs();
+}
+
+
+// EOF
@@ -18,6 +18,7 @@
 #include "gpos/common/clibwrapper.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
 #include "gpos/task/CAutoSuspendAbort.h"
@@ -75,10 +76,14 @@ CMemoryPoolManager::Init()
 
 
 CMemoryPool *
-CMemoryPoolManager::CreateMemoryPool()
+CMemoryPoolManager::CreateMemoryPool(EPoolKind pool_kind)
 {
 	GPOS_ASSERT(nullptr != m_memory_pool_mgr);
-	CMemoryPool *mp = m_memory_pool_mgr->NewMemoryPool();
+	GPOS_ASSERT(EpkSentinel > pool_kind);
+
+	CMemoryPool *mp = EpkArena == pool_kind
+						  ? m_memory_pool_mgr->NewArenaMemoryPool()
+						  : m_memory_pool_mgr->NewMemoryPool();
 
 	// accessor scope
 	{
@@ -101,6 +106,14 @@ CMemoryPoolManager::NewMemoryPool()
 }
 
 
+// Allocate a new bump-pointer memory pool
+CMemoryPool *
+CMemoryPoolManager::NewArenaMemoryPool()
+{
+	return GPOS_NEW(m_internal_memory_pool) CMemoryPoolArena();
+}
+
+
 // Release given memory pool
 void
 CMemoryPoolManager::Destroy(CMemoryPool *mp)
@@ -146,6 +159,12 @@ CMemoryPoolManager::TotalAllocatedSize()
 void
 CMemoryPoolManager::DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat)
 {
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		CMemoryPoolArena::DeleteImpl(ptr, eat);
+		return;
+	}
+
 	CMemoryPoolTracker::DeleteImpl(ptr, eat);
 }
 
@@ -153,6 +172,11 @@ CMemoryPoolManager::DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat)
 ULONG
 CMemoryPoolManager::UserSizeOfAlloc(const void *ptr)
 {
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		return CMemoryPoolArena::UserSizeOfAlloc(ptr);
+	}
+
 	return CMemoryPoolTracker::UserSizeOfAlloc(ptr);
 }
 
@@ -87,6 +87,7 @@ CMemoryPoolTracker::NewImpl(const ULONG bytes, const CHAR *file,
 	header->m_filename = file;
 	header->m_line = line;
 	header->m_user_size = bytes;
+	header->m_tag = GPOS_MEM_TRACKER_TAG;
 
 	RecordAllocation(header);
 
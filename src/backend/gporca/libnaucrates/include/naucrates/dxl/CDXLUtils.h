@@ -83,10 +83,36 @@ public:
 	static CParseHandlerDXL *GetParseHandlerForDXLString(
 		CMemoryPool *, const CHAR *dxl_string, const CHAR *xsd_file_path);
 
-	// same as above but with DXL file name specified instead of the file contents
+	// same as above but with DXL file name specified instead of the file
+	// contents; files in binary DXL are recognized and decoded as such
 	static CParseHandlerDXL *GetParseHandlerForDXLFile(
 		CMemoryPool *, const CHAR *dxl_filename, const CHAR *xsd_file_path);
 
+	// does the given file contain a binary DXL document
+	static BOOL FBinaryDXLFile(const CHAR *filename);
+
+	// same as GetParseHandlerForDXLString for a binary DXL document, which
+	// is not validated
+	static CParseHandlerDXL *GetParseHandlerForDXLBinary(CMemoryPool *,
+														 const BYTE *data,
+														 ULONG size);
+
+	// encode a DXL document into binary DXL, returning a buffer owned by
+	// the caller and its size
+	static BYTE *SerializeDXLToBinary(CMemoryPool *, const CHAR *dxl_string,
+									  ULONG *size);
+
+	// encode a metadata document holding the given MD object into binary
+	// DXL, without going through its XML text
+	static BYTE *SerializeMDObjToBinary(CMemoryPool *,
+										const IMDCacheObject *imd_cache_obj,
+										ULONG *size);
+
+	// encode a DXL file into a binary DXL file
+	static void SerializeDXLFileToBinary(CMemoryPool *,
+										 const CHAR *dxl_filename,
+										 const CHAR *binary_filename);
+
 	// parse a DXL document containing a DXL plan
 	static CDXLNode *GetPlanDXLNode(CMemoryPool *, const CHAR *dxl_string,
 									const CHAR *xsd_file_path, ULLONG *plan_id,
@@ -132,6 +158,12 @@ public:
 		CMemoryPool *, const CWStringBase *dxl_string,
 		const CHAR *xsd_file_path);
 
+	// parse a single metadata object from a binary DXL document, such as
+	// one kept in a shared metadata cache
+	static IMDCacheObject *ParseDXLBinaryToIMDIdCacheObj(CMemoryPool *,
+														 const BYTE *data,
+														 ULONG size);
+
 	// parse statistics object from the statistics document
 	static CDXLStatsDerivedRelationArray *ParseDXLToStatsDerivedRelArray(
 		CMemoryPool *, const CHAR *dxl_string, const CHAR *xsd_file_path);
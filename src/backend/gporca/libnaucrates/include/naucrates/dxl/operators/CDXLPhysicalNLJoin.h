@@ -54,6 +54,9 @@ private:
 	// if nest params are required to be parsed
 	BOOL m_nest_params_exists;
 
+	// should the inner side be cached per value of the nest params
+	BOOL m_memoize;
+
 	void SerializeNestLoopParamsToDXL(CXMLSerializer *pxmlser) const;
 
 public:
@@ -87,6 +90,19 @@ public:
 
 	CDXLColRefArray *GetNestLoopParamsColRefs() const;
 
+	// put a Memoize node over the inner side
+	void
+	SetMemoize(BOOL memoize)
+	{
+		m_memoize = memoize;
+	}
+
+	BOOL
+	FMemoize() const
+	{
+		return m_memoize;
+	}
+
 	// conversion function
 	static CDXLPhysicalNLJoin *
 	PdxlConvert(CDXLOperator *dxl_op)
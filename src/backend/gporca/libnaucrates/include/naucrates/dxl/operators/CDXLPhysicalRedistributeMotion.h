@@ -28,7 +28,19 @@ enum Edxlrm
 	EdxlrmIndexSortColList,
 	EdxlrmIndexHashExprList,
 	EdxlrmIndexChild,
-	EdxlrmIndexSentinel
+	EdxlrmIndexSentinel,
+
+	// list of hot key constants, only present on skew-aware motions
+	EdxlrmIndexSkewHotKeys = EdxlrmIndexSentinel
+};
+
+// routing of the hot-key rows of a skew-aware redistribute motion
+enum EdxlSkewMode
+{
+	EdxlskewNone,		// plain hash redistribution
+	EdxlskewSpread,		// send hot-key rows round-robin
+	EdxlskewBroadcast,	// send hot-key rows to all segments
+	EdxlskewSentinel
 };
 
 
@@ -47,6 +59,9 @@ private:
 	// is this a duplicate sensitive redistribute motion
 	BOOL m_is_duplicate_sensitive;
 
+	// routing of hot-key rows
+	EdxlSkewMode m_skew_mode;
+
 
 public:
 	CDXLPhysicalRedistributeMotion(const CDXLPhysicalRedistributeMotion &) =
@@ -54,7 +69,8 @@ public:
 
 	// ctor
 	CDXLPhysicalRedistributeMotion(CMemoryPool *mp,
-								   BOOL is_duplicate_sensitive);
+								   BOOL is_duplicate_sensitive,
+								   EdxlSkewMode skew_mode);
 
 	// accessors
 	Edxlopid GetDXLOperator() const override;
@@ -67,6 +83,13 @@ public:
 		return m_is_duplicate_sensitive;
 	}
 
+	// routing of hot-key rows, the hot keys follow the relational child
+	EdxlSkewMode
+	GetSkewMode() const
+	{
+		return m_skew_mode;
+	}
+
 	// index of relational child node in the children array
 	ULONG
 	GetRelationChildIdx() const override
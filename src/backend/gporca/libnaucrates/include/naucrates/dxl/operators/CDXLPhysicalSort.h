@@ -46,17 +46,23 @@ private:
 	// whether sort discards duplicates
 	BOOL m_discard_duplicates;
 
+	// number of leading sort columns the input is already sorted on; a
+	// non-zero value makes the sort incremental, sorting only the groups
+	// of rows sharing these columns
+	ULONG m_presorted_cols;
 
 public:
 	CDXLPhysicalSort(const CDXLPhysicalSort &) = delete;
 
 	// ctor/dtor
-	CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates);
+	CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates,
+					 ULONG presorted_cols = 0);
 
 	// accessors
 	Edxlopid GetDXLOperator() const override;
 	const CWStringConst *GetOpNameStr() const override;
 	BOOL FDiscardDuplicates() const;
+	ULONG PresortedCols() const;
 
 	// serialize operator in DXL format
 	void SerializeToDXL(CXMLSerializer *xml_serializer,
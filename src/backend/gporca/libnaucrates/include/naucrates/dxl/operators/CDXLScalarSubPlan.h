@@ -66,6 +66,9 @@ private:
 	// does test expression contain outer param
 	BOOL m_outer_param;
 
+	// should the subplan be cached per value of the outer references
+	BOOL m_memoize;
+
 public:
 	CDXLScalarSubPlan(CDXLScalarSubPlan &) = delete;
 
@@ -117,6 +120,19 @@ public:
 		return m_outer_param;
 	}
 
+	// put a Memoize node over the subplan
+	void
+	SetMemoize(BOOL memoize)
+	{
+		m_memoize = memoize;
+	}
+
+	BOOL
+	FMemoize() const
+	{
+		return m_memoize;
+	}
+
 	// serialize operator in DXL format
 	void SerializeToDXL(CXMLSerializer *xml_serializer,
 						const CDXLNode *dxlnode) const override;
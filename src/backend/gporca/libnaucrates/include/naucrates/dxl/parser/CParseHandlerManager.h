@@ -48,7 +48,9 @@ private:
 	// the memory manager used for parsing the current document
 	CDXLMemoryManager *m_dxl_memory_manager;
 
-	// parser object responsible for parsing the current XML document
+	// parser object responsible for parsing the current XML document;
+	// null when parsing binary DXL, whose reader feeds the current
+	// handler directly
 	SAX2XMLReader *m_xml_reader;
 
 	// current parse handler
@@ -95,8 +97,8 @@ public:
 	// Deactivates current handler and returns control to the previously active one.
 	void DeactivateHandler();
 
-	// Returns the current parse handler if one exists; used for debugging purposes
-	const CParseHandlerBase *GetCurrentParseHandler();
+	// Returns the current parse handler if one exists
+	CParseHandlerBase *GetCurrentParseHandler();
 };
 }  // namespace gpdxl
 #endif	// !GPDXL_CParseHandlerManager_H
@@ -41,6 +41,9 @@ private:
 	// subplan type
 	EdxlSubPlanType m_dxl_subplan_type;
 
+	// is the subplan cached per value of the outer references
+	BOOL m_memoize;
+
 	// map character sequence to subplan type
 	static EdxlSubPlanType GetDXLSubplanType(const XMLCh *xml_subplan_type);
 
@@ -0,0 +1,186 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryReader.h
+//
+//	@doc:
+//		Decoder of binary DXL documents, feeding the DXL parse handlers
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryReader_H
+#define GPDXL_CDXLBinaryReader_H
+
+#include <xercesc/sax2/Attributes.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CStack.h"
+
+#include "naucrates/dxl/xml/dxlbinary.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+class CParseHandlerManager;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryAttributes
+//
+//	@doc:
+//		Attributes of an element decoded from binary DXL, presented to the
+//		parse handlers through the Xerces SAX interface. Attributes carry no
+//		namespace, so their local name is their qualified name.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryAttributes : public Attributes
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// names and values of the attributes, pointing into the dictionary of
+	// the reader
+	const XMLCh **m_names;
+
+	const XMLCh **m_values;
+
+	// number of attributes
+	ULONG m_length;
+
+	// number of allocated attribute slots
+	ULONG m_capacity;
+
+	// empty string reported as the namespace URI of the attributes
+	static const XMLCh m_empty[];
+
+public:
+	CDXLBinaryAttributes(const CDXLBinaryAttributes &) = delete;
+
+	// ctor
+	explicit CDXLBinaryAttributes(CMemoryPool *mp);
+
+	// dtor
+	~CDXLBinaryAttributes() override;
+
+	// remove all attributes, making room for the given number of them
+	void Reset(ULONG num_attrs);
+
+	// add an attribute
+	void Add(const XMLCh *name, const XMLCh *value);
+
+	// Xerces Attributes interface
+	XMLSize_t getLength() const override;
+
+	const XMLCh *getURI(const XMLSize_t index) const override;
+
+	const XMLCh *getLocalName(const XMLSize_t index) const override;
+
+	const XMLCh *getQName(const XMLSize_t index) const override;
+
+	const XMLCh *getType(const XMLSize_t index) const override;
+
+	const XMLCh *getValue(const XMLSize_t index) const override;
+
+	bool getIndex(const XMLCh *const uri, const XMLCh *const local_part,
+				  XMLSize_t &index) const override;
+
+	int getIndex(const XMLCh *const uri,
+				 const XMLCh *const local_part) const override;
+
+	bool getIndex(const XMLCh *const qname, XMLSize_t &index) const override;
+
+	int getIndex(const XMLCh *const qname) const override;
+
+	const XMLCh *getType(const XMLCh *const uri,
+						 const XMLCh *const local_part) const override;
+
+	const XMLCh *getType(const XMLCh *const qname) const override;
+
+	const XMLCh *getValue(const XMLCh *const uri,
+						  const XMLCh *const local_part) const override;
+
+	const XMLCh *getValue(const XMLCh *const qname) const override;
+
+};	// class CDXLBinaryAttributes
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryReader
+//
+//	@doc:
+//		Decodes a binary DXL document (see dxlbinary.h) and replays its SAX
+//		events into the current handler of a parse handler manager, so
+//		that the same parse handlers build the same DXL trees and metadata
+//		objects as from the equivalent XML document, without scanning XML
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryReader
+{
+private:
+	// dictionary of decoded strings
+	using XMLChArray = CDynamicPtrArray<XMLCh, CleanupDeleteArray>;
+
+	// stack of open elements, holding the namespace URI and qualified
+	// name of each of them
+	using XMLChStack = CStack<const XMLCh>;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// encoded document, not owned
+	const BYTE *m_data;
+
+	// size of the encoded document
+	ULONG m_size;
+
+	// read position
+	ULONG m_pos;
+
+	// strings decoded so far
+	XMLChArray *m_strings;
+
+	// open elements
+	XMLChStack *m_open_elements;
+
+	// attributes of the current element
+	CDXLBinaryAttributes m_attrs;
+
+	// raise an error for a malformed document
+	static void RaiseMalformed();
+
+	// read a byte
+	BYTE ReadByte();
+
+	// read an unsigned varint
+	ULONG ReadVarint();
+
+	// read a string reference, decoding a new string if needed
+	const XMLCh *ReadString();
+
+	// local part of a qualified name
+	static const XMLCh *LocalName(const XMLCh *qname);
+
+public:
+	CDXLBinaryReader(const CDXLBinaryReader &) = delete;
+
+	// ctor
+	CDXLBinaryReader(CMemoryPool *mp, const BYTE *data, ULONG size);
+
+	// dtor
+	~CDXLBinaryReader();
+
+	// decode the document, feeding its elements to the handlers of the
+	// given manager
+	void Parse(CParseHandlerManager *parse_handler_mgr);
+
+};	// class CDXLBinaryReader
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryReader_H
+
+// EOF
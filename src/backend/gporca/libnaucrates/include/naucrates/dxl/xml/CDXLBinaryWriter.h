@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryWriter.h
+//
+//	@doc:
+//		Encoder of binary DXL documents
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryWriter_H
+#define GPDXL_CDXLBinaryWriter_H
+
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/string/CWStringBase.h"
+
+#include "naucrates/dxl/xml/dxlbinary.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryWriter
+//
+//	@doc:
+//		Appends the binary DXL encoding (see dxlbinary.h) of a DXL document
+//		to an in-memory buffer. The document is either received as the SAX
+//		events of its XML text, or element by element from a CXMLSerializer,
+//		which skips the XML text altogether.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryWriter : public DefaultHandler
+{
+private:
+	// hash function and equality of dictionary strings
+	static ULONG HashString(const XMLCh *str);
+
+	static BOOL FEqualStrings(const XMLCh *str_left, const XMLCh *str_right);
+
+	// map of the strings written so far to their dictionary reference
+	using StringToRefMap =
+		CHashMap<XMLCh, ULONG, HashString, FEqualStrings,
+				 CleanupDeleteArray<XMLCh>, CleanupDelete<ULONG>>;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// encoded document
+	BYTE *m_data;
+
+	// number of bytes used and allocated in the buffer
+	ULONG m_size;
+
+	ULONG m_capacity;
+
+	// strings written so far
+	StringToRefMap *m_string_refs;
+
+	// namespace URI and qualified name of the element started last,
+	// followed by the qualified names and values of its attributes, as
+	// long as the element record has not been written
+	CDynamicPtrArray<XMLCh, CleanupDeleteArray<XMLCh>> *m_pending_element;
+
+	// make room for the given number of bytes
+	void Reserve(ULONG num_bytes);
+
+	// append a byte
+	void WriteByte(BYTE value);
+
+	// append an unsigned varint
+	void WriteVarint(ULONG value);
+
+	// append a string reference, defining the string if it is new
+	void WriteString(const XMLCh *str);
+
+	// append the start of an element with the given number of attributes,
+	// which must follow
+	void WriteStartElement(const XMLCh *uri, const XMLCh *qname,
+						   ULONG num_attrs);
+
+	// append the record of the pending element, if any
+	void WritePendingElement();
+
+	// copy the given string into a new UTF-16 string
+	XMLCh *CreateXMLChString(const CWStringBase *str) const;
+
+public:
+	CDXLBinaryWriter(const CDXLBinaryWriter &) = delete;
+
+	// ctor
+	explicit CDXLBinaryWriter(CMemoryPool *mp);
+
+	// dtor
+	~CDXLBinaryWriter() override;
+
+	// encoded document
+	const BYTE *
+	GetData() const
+	{
+		return m_data;
+	}
+
+	// size of the encoded document
+	ULONG
+	Size() const
+	{
+		return m_size;
+	}
+
+	// start an element; the attributes added until the next element
+	// starts or ends belong to it
+	void StartElement(const CWStringBase *uri, const CWStringBase *qname);
+
+	// add an attribute to the element started last
+	void AddAttribute(const CWStringBase *qname, const CWStringBase *value);
+
+	// end the innermost open element
+	void EndElement();
+
+	// end the document
+	void EndDocument();
+
+	// SAX handler functions
+	void startElement(const XMLCh *const element_uri,
+					  const XMLCh *const element_local_name,
+					  const XMLCh *const element_qname,
+					  const Attributes &attrs) override;
+
+	void endElement(const XMLCh *const element_uri,
+					const XMLCh *const element_local_name,
+					const XMLCh *const element_qname) override;
+
+	void endDocument() override;
+
+};	// class CDXLBinaryWriter
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryWriter_H
+
+// EOF
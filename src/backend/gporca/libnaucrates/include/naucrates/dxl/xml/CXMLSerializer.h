@@ -17,6 +17,7 @@
 #include "gpos/common/CStack.h"
 #include "gpos/io/COstream.h"
 #include "gpos/string/CWStringConst.h"
+#include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/dxl/xml/dxltokens.h"
 
@@ -24,12 +25,17 @@ namespace gpdxl
 {
 using namespace gpos;
 
+class CDXLBinaryWriter;
+
 //---------------------------------------------------------------------------
 //	@class:
 //		CXMLSerializer
 //
 //	@doc:
-//		Class for creating XML documents.
+//		Class for creating XML documents. A serializer created with a
+//		binary DXL writer hands the elements and attributes to the writer
+//		instead, so the document is encoded without producing and parsing
+//		its XML text.
 //
 //---------------------------------------------------------------------------
 class CXMLSerializer
@@ -41,8 +47,15 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
-	// output stream for writing out the xml document
-	IOstream &m_os;
+	// output stream for writing out the xml document; for binary DXL, the
+	// stream formatting the value of the current attribute
+	IOstream *m_os;
+
+	// writer of the binary DXL document, if any
+	CDXLBinaryWriter *m_binary_writer;
+
+	// value of the current attribute, for binary DXL
+	CWStringDynamic *m_value_str;
 
 	// should XML document be indented
 	BOOL m_indentation;
@@ -65,13 +78,22 @@ private:
 	// escape the given string and write it to the given stream
 	static void WriteEscaped(IOstream &os, const CWStringBase *str);
 
+	// start an attribute of the currently open tag, returning the stream
+	// to write its value to
+	IOstream &OpenAttribute(const CWStringBase *pstrAttr);
+
+	// finish the attribute started last
+	void CloseAttribute(const CWStringBase *pstrAttr);
+
 public:
 	CXMLSerializer(const CXMLSerializer &) = delete;
 
 	// ctor/dtor
 	CXMLSerializer(CMemoryPool *mp, IOstream &os, BOOL indentation = true)
 		: m_mp(mp),
-		  m_os(os),
+		  m_os(&os),
+		  m_binary_writer(nullptr),
+		  m_value_str(nullptr),
 		  m_indentation(indentation),
 		  m_strstackElems(nullptr),
 		  m_fOpenTag(false),
@@ -81,6 +103,9 @@ public:
 		m_strstackElems = GPOS_NEW(m_mp) StrStack(m_mp);
 	}
 
+	// ctor of a serializer writing binary DXL
+	CXMLSerializer(CMemoryPool *mp, CDXLBinaryWriter *binary_writer);
+
 	~CXMLSerializer();
 
 	// get underlying memory pool
@@ -133,7 +158,7 @@ public:
 	void
 	SetFullPrecision(BOOL fullPrecision)
 	{
-		m_os.SetFullPrecision(fullPrecision);
+		m_os->SetFullPrecision(fullPrecision);
 	}
 };
 
@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		dxlbinary.h
+//
+//	@doc:
+//		Constants of the binary DXL encoding.
+//
+//		A binary DXL document is the stream of SAX events of the equivalent
+//		XML document. It starts with a header of the 4 magic bytes "DXLB" and
+//		a version byte, followed by records, each starting with a record
+//		type byte:
+//
+//		EdxlbinStartElement		namespace URI, qualified name, number of
+//								attributes, and the qualified name and value
+//								of each attribute
+//		EdxlbinEndElement		no payload, closes the innermost open element
+//		EdxlbinEndDocument		no payload, ends the document
+//
+//		Numbers are unsigned LEB128 varints. Strings are references into a
+//		dictionary built while reading: a reference n > 0 denotes the n-th
+//		string defined so far, while 0 is followed by the length in bytes
+//		and the UTF-8 bytes of a new string, which is added to the
+//		dictionary. Element and attribute names, mdids and other repeated
+//		values are therefore written once per document.
+//
+//		Character data is not encoded, as DXL carries all information in
+//		elements and attributes.
+//---------------------------------------------------------------------------
+#ifndef GPDXL_dxlbinary_H
+#define GPDXL_dxlbinary_H
+
+#include "gpos/base.h"
+
+// magic bytes at the start of a binary DXL document
+#define GPDXL_BINARY_MAGIC "DXLB"
+
+// length of the magic bytes
+#define GPDXL_BINARY_MAGIC_LENGTH 4
+
+// version of the encoding
+#define GPDXL_BINARY_VERSION 1
+
+// length of the header of a binary DXL document
+#define GPDXL_BINARY_HEADER_LENGTH (GPDXL_BINARY_MAGIC_LENGTH + 1)
+
+namespace gpdxl
+{
+using namespace gpos;
+
+// record types of binary DXL
+enum Edxlbinrecord
+{
+	EdxlbinEndDocument = 0,
+	EdxlbinStartElement,
+	EdxlbinEndElement,
+
+	EdxlbinSentinel
+};
+
+// does the given buffer start with the header of a binary DXL document
+inline BOOL
+FBinaryDXL(const BYTE *data, ULONG size)
+{
+	return GPDXL_BINARY_HEADER_LENGTH <= size &&
+		   0 == clib::Memcmp(data, GPDXL_BINARY_MAGIC,
+							 GPDXL_BINARY_MAGIC_LENGTH);
+}
+
+}  // namespace gpdxl
+
+#endif	// !GPDXL_dxlbinary_H
+
+// EOF
@@ -72,6 +72,9 @@ enum Edxltoken
 	EdxltokenPushGroupByBelowSetopThreshold,
 	EdxltokenXformBindThreshold,
 	EdxltokenSkewFactor,
+	EdxltokenSearchTimeBudget,
+	EdxltokenMemoizeMemoryLimit,
+	EdxltokenMemoize,
 	EdxltokenMaxStatsBuckets,
 	EdxltokenWindowOids,
 	EdxltokenOidRowNumber,
@@ -130,6 +133,9 @@ enum Edxltoken
 	EdxltokenPhysicalCTEConsumer,
 
 	EdxltokenDuplicateSensitive,
+	EdxltokenSkewMode,
+	EdxltokenSkewModeSpread,
+	EdxltokenSkewModeBroadcast,
 
 	EdxltokenSegmentIdCol,
 
@@ -418,6 +424,7 @@ enum Edxltoken
 	EdxltokenSortOpId,
 	EdxltokenSortOpName,
 	EdxltokenSortDiscardDuplicates,
+	EdxltokenSortPresortedCols,
 	EdxltokenSortNullsFirst,
 
 	EdxltokenMaterializeEager,
@@ -16,6 +16,7 @@
 
 #include "gpopt/base/CKHeap.h"
 #include "naucrates/statistics/CBucket.h"
+#include "naucrates/statistics/CHistogramBounds.h"
 #include "naucrates/statistics/CStatsPred.h"
 
 namespace gpopt
@@ -95,6 +96,18 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
+	// flat array of bucket bounds, built on first use; bucket arrays are
+	// only ever replaced by copies that differ in frequencies and NDVs,
+	// so the bounds stay valid for the lifetime of the histogram
+	mutable CHistogramBounds *m_bounds;
+
+	// have we tried to build the flat bounds
+	mutable BOOL m_bounds_were_built;
+
+	// flat array of bucket bounds, nullptr if bounds don't map to LINT
+	// or double values
+	const CHistogramBounds *GetBounds() const;
+
 	// return an array buckets after applying equality filter on the histogram buckets
 	CBucketArray *MakeBucketsWithEqualityFilter(CPoint *point) const;
 
@@ -363,6 +376,7 @@ public:
 	virtual ~CHistogram()
 	{
 		m_histogram_buckets->Release();
+		GPOS_DELETE(m_bounds);
 	}
 
 	// normalize histogram and return scaling factor
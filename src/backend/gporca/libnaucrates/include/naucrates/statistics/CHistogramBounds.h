@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CHistogramBounds.h
+//
+//	@doc:
+//		Flat array representation of the bucket bounds of a histogram
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CHistogramBounds_H
+#define GPNAUCRATES_CHistogramBounds_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+
+#include "naucrates/statistics/CBucket.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CHistogramBounds
+//
+//	@doc:
+//		Bucket bounds of a histogram, mapped to LINT or to double values and
+//		stored in parallel arrays. Comparing two buckets through their
+//		CPoint bounds costs several virtual calls on the underlying datums;
+//		for histograms whose bounds all map to the same kind of value, the
+//		methods below answer the same questions from the flat arrays.
+//
+//		The comparisons mirror IDatum::StatsAreEqual() and
+//		IDatum::StatsAreLessThan(), and the bucket predicates mirror the
+//		corresponding CBucket methods, so results are identical to
+//		comparing the CBucket objects.
+//
+//---------------------------------------------------------------------------
+class CHistogramBounds
+{
+private:
+	// a bound mapped to a comparable value, only one of the members is
+	// used, depending on how the histogram bounds are mapped
+	struct SValue
+	{
+		LINT m_lint;
+
+		CDouble m_double;
+
+		SValue() : m_lint(0), m_double(0.0)
+		{
+		}
+	};
+
+	// number of buckets
+	ULONG m_size;
+
+	// are the bounds mapped to LINT (rather than to double) values
+	BOOL m_is_lint;
+
+	// lower and upper bounds of the buckets
+	SValue *m_lower;
+
+	SValue *m_upper;
+
+	// closedness of the bounds of the buckets
+	BOOL *m_is_lower_closed;
+
+	BOOL *m_is_upper_closed;
+
+	// private ctor, use Create()
+	CHistogramBounds(CMemoryPool *mp, ULONG size, BOOL is_lint);
+
+	// map a datum to a value, return false if the datum can't be mapped
+	// the same way as the bounds
+	static BOOL MapDatum(const IDatum *datum, BOOL is_lint, SValue *value);
+
+	// three-way comparison of two mapped values
+	INT Compare(const SValue &value1, const SValue &value2) const;
+
+	// is the bucket a singleton
+	BOOL
+	IsSingleton(ULONG idx) const
+	{
+		return 0 == Compare(m_lower[idx], m_upper[idx]);
+	}
+
+	// does the bucket contain the value
+	BOOL Contains(ULONG idx, const SValue &value) const;
+
+	// compare lower bounds, see CBucket::CompareLowerBounds()
+	static INT CompareLowerBounds(const CHistogramBounds *bounds1, ULONG idx1,
+								  const CHistogramBounds *bounds2, ULONG idx2);
+
+	// compare a lower bound to an upper bound, see
+	// CBucket::CompareLowerBoundToUpperBound()
+	static INT CompareLowerBoundToUpperBound(const CHistogramBounds *bounds1,
+											 ULONG idx1,
+											 const CHistogramBounds *bounds2,
+											 ULONG idx2);
+
+	// does the first bucket subsume the second, see CBucket::Subsumes()
+	static BOOL Subsumes(const CHistogramBounds *bounds1, ULONG idx1,
+						 const CHistogramBounds *bounds2, ULONG idx2);
+
+public:
+	CHistogramBounds(const CHistogramBounds &) = delete;
+
+	// dtor
+	~CHistogramBounds();
+
+	// build the bounds of the given buckets, return nullptr if the bounds
+	// do not all map to LINT or all map to double values
+	static CHistogramBounds *Create(CMemoryPool *mp,
+									const CBucketArray *buckets);
+
+	// number of buckets
+	ULONG
+	Size() const
+	{
+		return m_size;
+	}
+
+	// can buckets of the two histograms be compared using the flat bounds
+	BOOL
+	IsComparable(const CHistogramBounds *bounds) const
+	{
+		return m_is_lint == bounds->m_is_lint;
+	}
+
+	// index of the bucket containing the point, gpos::ulong_max if there is
+	// none; return false if the point can't be compared to the flat bounds
+	BOOL FindBucketContaining(const CPoint *point, ULONG *idx) const;
+
+	// do two buckets intersect, see CBucket::Intersects()
+	static BOOL Intersects(const CHistogramBounds *bounds1, ULONG idx1,
+						   const CHistogramBounds *bounds2, ULONG idx2);
+
+	// is the first bucket before the second, see CBucket::IsBefore()
+	static BOOL IsBefore(const CHistogramBounds *bounds1, ULONG idx1,
+						 const CHistogramBounds *bounds2, ULONG idx2);
+
+	// compare upper bounds, see CBucket::CompareUpperBounds()
+	static INT CompareUpperBounds(const CHistogramBounds *bounds1, ULONG idx1,
+								  const CHistogramBounds *bounds2, ULONG idx2);
+
+};	// class CHistogramBounds
+
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CHistogramBounds_H
+
+// EOF
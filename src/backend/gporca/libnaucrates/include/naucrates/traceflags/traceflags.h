@@ -226,6 +226,26 @@ enum EOptTraceFlag
 	// Ordered Agg
 	EopttraceDisableOrderedAgg = 103047,
 
+	// write minidumps in binary DXL
+	EopttraceMinidumpBinary = 103048,
+
+	// hash joins push runtime filters into the scans on their outer side
+	EopttraceEnableRuntimeFilter = 103049,
+
+	// memoize the rows of parameterized inner scans and correlated subplans
+	EopttraceEnableMemoize = 103050,
+
+	// sort inputs that already deliver a prefix of the required order
+	// incrementally
+	EopttraceEnableIncrementalSort = 103051,
+
+	// AOCS scans skip varblocks using the zone maps in the block directory
+	EopttraceEnableAOCSBlockSkipping = 103052,
+
+	// spread heavy hitters of a hash join's redistributed side round-robin
+	// and broadcast the matching rows of the other side
+	EopttraceEnableSkewRedistribute = 103053,
+
 	///////////////////////////////////////////////////////
 	///////////////////// statistics flags ////////////////
 	//////////////////////////////////////////////////////
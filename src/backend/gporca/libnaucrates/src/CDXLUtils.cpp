@@ -22,6 +22,7 @@
 #include "gpos/common/CAutoRg.h"
 #include "gpos/common/CAutoTimer.h"
 #include "gpos/io/CFileReader.h"
+#include "gpos/io/CFileWriter.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/io/ioutils.h"
 #include "gpos/task/CAutoTraceFlag.h"
@@ -39,6 +40,8 @@
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/dxl/parser/CParseHandlerPlan.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "naucrates/md/CDXLStatsDerivedRelation.h"
@@ -156,6 +159,21 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 {
 	GPOS_ASSERT(nullptr != mp);
 
+	// files in binary DXL are decoded without Xerces
+	if (FBinaryDXLFile(dxl_filename))
+	{
+		CFileReader fr;
+		fr.Open(dxl_filename);
+
+		const ULONG_PTR file_size = (ULONG_PTR) fr.FileSize();
+		CAutoRg<BYTE> data(GPOS_NEW_ARRAY(mp, BYTE, file_size));
+		const ULONG_PTR read_bytes =
+			fr.ReadBytesToBuffer(data.Rgt(), file_size);
+		fr.Close();
+
+		return GetParseHandlerForDXLBinary(mp, data.Rgt(), (ULONG) read_bytes);
+	}
+
 	// setup own memory manager
 	CDXLMemoryManager mm(mp);
 	SAX2XMLReader *sax_2_xml_reader = nullptr;
@@ -232,6 +250,186 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::FBinaryDXLFile
+//
+//	@doc:
+//		Does the given file start with the header of a binary DXL document
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLUtils::FBinaryDXLFile(const CHAR *filename)
+{
+	CFileReader fr;
+	fr.Open(filename);
+
+	BYTE header[GPDXL_BINARY_HEADER_LENGTH];
+	const ULONG_PTR read_bytes =
+		fr.ReadBytesToBuffer(header, GPDXL_BINARY_HEADER_LENGTH);
+	fr.Close();
+
+	return FBinaryDXL(header, (ULONG) read_bytes);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::GetParseHandlerForDXLBinary
+//
+//	@doc:
+//		Parse the given binary DXL document and return the top-level parser.
+//		The document is fed to the same parse handlers as its XML
+//		counterpart, but it is neither scanned by Xerces nor validated.
+//
+//---------------------------------------------------------------------------
+CParseHandlerDXL *
+CDXLUtils::GetParseHandlerForDXLBinary(CMemoryPool *mp, const BYTE *data,
+									   ULONG size)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != data);
+
+	CDXLMemoryManager mm(mp);
+	CParseHandlerManager parse_handler_mgr(&mm, nullptr /*sax_2_xml_reader*/);
+	CParseHandlerDXL *parse_handler_dxl =
+		CParseHandlerFactory::GetParseHandlerDXL(mp, &parse_handler_mgr);
+	CAutoP<CParseHandlerDXL> parse_handler_dxl_wrapper(parse_handler_dxl);
+	parse_handler_mgr.ActivateParseHandler(parse_handler_dxl);
+
+	CDXLBinaryReader reader(mp, data, size);
+	reader.Parse(&parse_handler_mgr);
+
+	GPOS_CHECK_ABORT;
+
+	return parse_handler_dxl_wrapper.Reset();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeDXLToBinary
+//
+//	@doc:
+//		Encode the given DXL document into binary DXL.
+//		The function allocates memory from the provided memory pool, and it is
+//		the responsibility of the caller to deallocate it.
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::SerializeDXLToBinary(CMemoryPool *mp, const CHAR *dxl_string,
+								ULONG *size)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != dxl_string);
+	GPOS_ASSERT(nullptr != size);
+
+	CDXLMemoryManager mm(mp);
+	SAX2XMLReader *sax_2_xml_reader = XMLReaderFactory::createXMLReader(&mm);
+	CAutoP<CDXLBinaryWriter> writer(GPOS_NEW(mp) CDXLBinaryWriter(mp));
+	sax_2_xml_reader->setContentHandler(writer.Value());
+	sax_2_xml_reader->setErrorHandler(writer.Value());
+
+	MemBufInputSource input_src_memory_buffer((const XMLByte *) dxl_string,
+											  strlen(dxl_string), "dxl binary",
+											  false, &mm);
+
+	try
+	{
+		sax_2_xml_reader->parse(input_src_memory_buffer);
+	}
+	catch (const XMLException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+	catch (const SAXException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+
+	delete sax_2_xml_reader;
+
+	*size = writer->Size();
+	BYTE *data = GPOS_NEW_ARRAY(mp, BYTE, *size);
+	clib::Memcpy(data, writer->GetData(), *size);
+
+	return data;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeMDObjToBinary
+//
+//	@doc:
+//		Encode a metadata document holding the given MD object into binary
+//		DXL. The result is the same as that of SerializeDXLToBinary on the
+//		document produced by SerializeMDObj, but neither the XML text nor
+//		the Xerces parser is involved.
+//		The function allocates memory from the provided memory pool, and it is
+//		the responsibility of the caller to deallocate it.
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::SerializeMDObjToBinary(CMemoryPool *mp,
+								  const IMDCacheObject *imd_cache_obj,
+								  ULONG *size)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != imd_cache_obj);
+	GPOS_ASSERT(nullptr != size);
+
+	CDXLBinaryWriter writer(mp);
+	{
+		CXMLSerializer xml_serializer(mp, &writer);
+
+		SerializeHeader(mp, &xml_serializer);
+		xml_serializer.OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
+		GPOS_CHECK_ABORT;
+
+		imd_cache_obj->Serialize(&xml_serializer);
+		GPOS_CHECK_ABORT;
+
+		xml_serializer.CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
+		SerializeFooter(&xml_serializer);
+	}
+	writer.EndDocument();
+
+	*size = writer.Size();
+	BYTE *data = GPOS_NEW_ARRAY(mp, BYTE, *size);
+	clib::Memcpy(data, writer.GetData(), *size);
+
+	return data;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeDXLFileToBinary
+//
+//	@doc:
+//		Encode the given DXL file into a binary DXL file; the two file names
+//		may be the same
+//
+//---------------------------------------------------------------------------
+void
+CDXLUtils::SerializeDXLFileToBinary(CMemoryPool *mp, const CHAR *dxl_filename,
+									const CHAR *binary_filename)
+{
+	CAutoRg<CHAR> dxl_string(Read(mp, dxl_filename));
+
+	ULONG size = 0;
+	CAutoRg<BYTE> data(SerializeDXLToBinary(mp, dxl_string.Rgt(), &size));
+
+	CFileWriter fw;
+	fw.Open(binary_filename, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	fw.Write(data.Rgt(), size);
+	fw.Close();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::GetParseHandlerForDXLString
@@ -774,6 +972,42 @@ CDXLUtils::ParseDXLToIMDIdCacheObj(CMemoryPool *mp,
 	return imd_cached_obj;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ParseDXLBinaryToIMDIdCacheObj
+//
+//	@doc:
+//		Parse a single metadata object given its binary DXL representation.
+// 		Returns NULL if the DXL represents no metadata objects, or the first parsed
+//		object if it does.
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CDXLUtils::ParseDXLBinaryToIMDIdCacheObj(CMemoryPool *mp, const BYTE *data,
+										 ULONG size)
+{
+	GPOS_ASSERT(nullptr != mp);
+
+	// create and install a parse handler for the DXL document
+	CAutoP<CParseHandlerDXL> parse_handler_dxl_array(
+		GetParseHandlerForDXLBinary(mp, data, size));
+
+	// collect metadata objects from dxl parse handler
+	IMDCacheObjectArray *imd_obj_array =
+		parse_handler_dxl_array->GetMdIdCachedObjArray();
+
+	if (0 == imd_obj_array->Size())
+	{
+		// no metadata objects found
+		return nullptr;
+	}
+
+	IMDCacheObject *imd_cached_obj = (*imd_obj_array)[0];
+	imd_cached_obj->AddRef();
+
+	return imd_cached_obj;
+}
+
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -274,8 +274,36 @@ CDXLOperatorFactory::MakeDXLRedistributeMotion(
 			EdxltokenDuplicateSensitive, EdxltokenPhysicalRedistributeMotion);
 	}
 
-	CDXLPhysicalRedistributeMotion *dxl_op =
-		GPOS_NEW(mp) CDXLPhysicalRedistributeMotion(mp, is_duplicate_sensitive);
+	// routing of hot-key rows of a skew-aware motion
+	EdxlSkewMode skew_mode = EdxlskewNone;
+	const XMLCh *skew_mode_xml =
+		attrs.getValue(CDXLTokens::XmlstrToken(EdxltokenSkewMode));
+	if (nullptr != skew_mode_xml)
+	{
+		if (0 == XMLString::compareString(
+					 CDXLTokens::XmlstrToken(EdxltokenSkewModeSpread),
+					 skew_mode_xml))
+		{
+			skew_mode = EdxlskewSpread;
+		}
+		else if (0 == XMLString::compareString(
+						  CDXLTokens::XmlstrToken(EdxltokenSkewModeBroadcast),
+						  skew_mode_xml))
+		{
+			skew_mode = EdxlskewBroadcast;
+		}
+		else
+		{
+			GPOS_RAISE(
+				gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+				CDXLTokens::GetDXLTokenStr(EdxltokenSkewMode)->GetBuffer(),
+				CDXLTokens::GetDXLTokenStr(EdxltokenPhysicalRedistributeMotion)
+					->GetBuffer());
+		}
+	}
+
+	CDXLPhysicalRedistributeMotion *dxl_op = GPOS_NEW(mp)
+		CDXLPhysicalRedistributeMotion(mp, is_duplicate_sensitive, skew_mode);
 	SetSegmentInfo(dxl_memory_manager, dxl_op, attrs,
 				   EdxltokenPhysicalRedistributeMotion);
 
@@ -507,7 +535,13 @@ CDXLOperatorFactory::MakeDXLSort(CDXLMemoryManager *dxl_memory_manager,
 		dxl_memory_manager, attrs, EdxltokenSortDiscardDuplicates,
 		EdxltokenPhysicalSort);
 
-	return GPOS_NEW(mp) CDXLPhysicalSort(mp, discard_duplicates);
+	// number of leading sort columns the input is already sorted on
+	ULONG presorted_cols = ExtractConvertAttrValueToUlong(
+		dxl_memory_manager, attrs, EdxltokenSortPresortedCols,
+		EdxltokenPhysicalSort, true /* is_optional */, 0 /* default_value */);
+
+	return GPOS_NEW(mp)
+		CDXLPhysicalSort(mp, discard_duplicates, presorted_cols);
 }
 
 //---------------------------------------------------------------------------
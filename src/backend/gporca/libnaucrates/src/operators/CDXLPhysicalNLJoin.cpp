@@ -31,7 +31,8 @@ CDXLPhysicalNLJoin::CDXLPhysicalNLJoin(CMemoryPool *mp, EdxlJoinType join_type,
 									   BOOL nest_params_exists)
 	: CDXLPhysicalJoin(mp, join_type),
 	  m_is_index_nlj(is_index_nlj),
-	  m_nest_params_exists(nest_params_exists)
+	  m_nest_params_exists(nest_params_exists),
+	  m_memoize(false)
 {
 	m_nest_params_col_refs = nullptr;
 }
@@ -95,7 +96,11 @@ CDXLPhysicalNLJoin::SerializeToDXL(CXMLSerializer *xml_serializer,
 	xml_serializer->AddAttribute(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNLJIndexOuterRefAsParam),
 		m_nest_params_exists);
-
+	if (m_memoize)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenMemoize), m_memoize);
+	}
 
 	// serialize properties
 	dxlnode->SerializePropertiesToDXL(xml_serializer);
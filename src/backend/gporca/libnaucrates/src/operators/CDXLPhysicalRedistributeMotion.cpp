@@ -27,9 +27,13 @@ using namespace gpdxl;
 //
 //---------------------------------------------------------------------------
 CDXLPhysicalRedistributeMotion::CDXLPhysicalRedistributeMotion(
-	CMemoryPool *mp, BOOL is_duplicate_sensitive)
-	: CDXLPhysicalMotion(mp), m_is_duplicate_sensitive(is_duplicate_sensitive)
+	CMemoryPool *mp, BOOL is_duplicate_sensitive, EdxlSkewMode skew_mode)
+	: CDXLPhysicalMotion(mp),
+	  m_is_duplicate_sensitive(is_duplicate_sensitive),
+	  m_skew_mode(skew_mode)
 {
+	GPOS_ASSERT(EdxlskewSentinel > skew_mode);
+	GPOS_ASSERT_IMP(EdxlskewNone != skew_mode, !is_duplicate_sensitive);
 }
 
 
@@ -87,6 +91,15 @@ CDXLPhysicalRedistributeMotion::SerializeToDXL(CXMLSerializer *xml_serializer,
 			CDXLTokens::GetDXLTokenStr(EdxltokenDuplicateSensitive), true);
 	}
 
+	if (EdxlskewNone != m_skew_mode)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenSkewMode),
+			CDXLTokens::GetDXLTokenStr(EdxlskewSpread == m_skew_mode
+										   ? EdxltokenSkewModeSpread
+										   : EdxltokenSkewModeBroadcast));
+	}
+
 	// serialize properties
 	dxlnode->SerializePropertiesToDXL(xml_serializer);
 
@@ -119,7 +132,10 @@ CDXLPhysicalRedistributeMotion::AssertValid(const CDXLNode *dxlnode,
 	GPOS_ASSERT(m_output_segids_array != nullptr);
 	GPOS_ASSERT(0 < m_output_segids_array->Size());
 
-	GPOS_ASSERT(EdxlrmIndexSentinel == dxlnode->Arity());
+	GPOS_ASSERT_IMP(EdxlskewNone == m_skew_mode,
+					EdxlrmIndexSentinel == dxlnode->Arity());
+	GPOS_ASSERT_IMP(EdxlskewNone != m_skew_mode,
+					EdxlrmIndexSentinel + 1 == dxlnode->Arity());
 
 	CDXLNode *child_dxlnode = (*dxlnode)[EdxlrmIndexChild];
 	CDXLNode *hash_expr_list = (*dxlnode)[EdxlrmIndexHashExprList];
@@ -26,8 +26,11 @@ using namespace gpdxl;
 //		Constructor
 //
 //---------------------------------------------------------------------------
-CDXLPhysicalSort::CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates)
-	: CDXLPhysical(mp), m_discard_duplicates(discard_duplicates)
+CDXLPhysicalSort::CDXLPhysicalSort(CMemoryPool *mp, BOOL discard_duplicates,
+								   ULONG presorted_cols)
+	: CDXLPhysical(mp),
+	  m_discard_duplicates(discard_duplicates),
+	  m_presorted_cols(presorted_cols)
 {
 }
 
@@ -74,6 +77,19 @@ CDXLPhysicalSort::FDiscardDuplicates() const
 	return m_discard_duplicates;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLPhysicalSort::PresortedCols
+//
+//	@doc:
+//		Number of leading sort columns the input is already sorted on
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLPhysicalSort::PresortedCols() const
+{
+	return m_presorted_cols;
+}
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -96,6 +112,13 @@ CDXLPhysicalSort::SerializeToDXL(CXMLSerializer *xml_serializer,
 		CDXLTokens::GetDXLTokenStr(EdxltokenSortDiscardDuplicates),
 		m_discard_duplicates);
 
+	if (0 < m_presorted_cols)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenSortPresortedCols),
+			m_presorted_cols);
+	}
+
 	// serialize properties
 	dxlnode->SerializePropertiesToDXL(xml_serializer);
 
@@ -142,6 +165,9 @@ CDXLPhysicalSort::AssertValid(const CDXLNode *dxlnode,
 	// there must be at least one sorting column
 	GPOS_ASSERT(sort_col_list_dxlnode->Arity() > 0);
 
+	// an incremental sort leaves at least one column to sort on
+	GPOS_ASSERT(m_presorted_cols < sort_col_list_dxlnode->Arity());
+
 	if (validate_children)
 	{
 		sort_col_list_dxlnode->GetOperator()->AssertValid(sort_col_list_dxlnode,
@@ -40,7 +40,8 @@ CDXLScalarSubPlan::CDXLScalarSubPlan(CMemoryPool *mp,
 	  m_dxl_colref_array(dxl_colref_array),
 	  m_dxl_subplan_type(dxl_subplan_type),
 	  m_dxlnode_test_expr(dxlnode_test_expr),
-	  m_outer_param(outer_param)
+	  m_outer_param(outer_param),
+	  m_memoize(false)
 {
 	GPOS_ASSERT(EdxlSubPlanTypeSentinel > dxl_subplan_type);
 	GPOS_ASSERT_IMP(EdxlSubPlanTypeAny == dxl_subplan_type ||
@@ -163,6 +164,11 @@ CDXLScalarSubPlan::SerializeToDXL(CXMLSerializer *xml_serializer,
 	xml_serializer->AddAttribute(
 		CDXLTokens::GetDXLTokenStr(EdxltokenScalarSubPlanType),
 		GetSubplanTypeStr());
+	if (m_memoize)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenMemoize), m_memoize);
+	}
 
 	// serialize test expression
 	xml_serializer->OpenElement(
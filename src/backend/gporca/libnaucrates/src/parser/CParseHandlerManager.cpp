@@ -75,8 +75,11 @@ CParseHandlerManager::ActivateParseHandler(
 	GPOS_ASSERT(nullptr != parse_handler_base);
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	if (nullptr != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(parse_handler_base);
+		m_xml_reader->setErrorHandler(parse_handler_base);
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -103,8 +106,11 @@ CParseHandlerManager::ReplaceHandler(CParseHandlerBase *parse_handler_base,
 	}
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	if (nullptr != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(parse_handler_base);
+		m_xml_reader->setErrorHandler(parse_handler_base);
+	}
 }
 
 
@@ -133,8 +139,11 @@ CParseHandlerManager::DeactivateHandler()
 		m_curr_parse_handler = nullptr;
 	}
 
-	m_xml_reader->setContentHandler(m_curr_parse_handler);
-	m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	if (nullptr != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(m_curr_parse_handler);
+		m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -145,7 +154,7 @@ CParseHandlerManager::DeactivateHandler()
 //		Returns the current handler
 //
 //---------------------------------------------------------------------------
-const CParseHandlerBase *
+CParseHandlerBase *
 CParseHandlerManager::GetCurrentParseHandler()
 {
 	return m_curr_parse_handler;
@@ -68,6 +68,9 @@ CParseHandlerNLJoin::StartElement(const XMLCh *const,  // element_uri,
 	// parse and create Hash join operator
 	m_dxl_op = (CDXLPhysicalNLJoin *) CDXLOperatorFactory::MakeDXLNLJoin(
 		m_parse_handler_mgr->GetDXLMemoryManager(), attrs);
+	m_dxl_op->SetMemoize(CDXLOperatorFactory::ExtractConvertAttrValueToBool(
+		m_parse_handler_mgr->GetDXLMemoryManager(), attrs, EdxltokenMemoize,
+		EdxltokenPhysicalNLJoin, true, false));
 
 	// create and activate the parse handler for the children nodes in reverse
 	// order of their expected appearance
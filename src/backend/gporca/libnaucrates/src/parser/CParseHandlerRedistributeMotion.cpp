@@ -18,6 +18,7 @@
 #include "naucrates/dxl/parser/CParseHandlerProjList.h"
 #include "naucrates/dxl/parser/CParseHandlerProperties.h"
 #include "naucrates/dxl/parser/CParseHandlerScalarOp.h"
+#include "naucrates/dxl/parser/CParseHandlerScalarValuesList.h"
 #include "naucrates/dxl/parser/CParseHandlerSortColList.h"
 #include "naucrates/dxl/parser/CParseHandlerUtils.h"
 
@@ -77,6 +78,16 @@ CParseHandlerRedistributeMotion::StartElement(
 	// create and activate the parse handler for the children nodes in reverse
 	// order of their expected appearance
 
+	// parse handler for the hot keys of a skew-aware motion
+	CParseHandlerBase *hot_keys_parse_handler = nullptr;
+	if (EdxlskewNone != m_dxl_op->GetSkewMode())
+	{
+		hot_keys_parse_handler = CParseHandlerFactory::GetParseHandler(
+			m_mp, CDXLTokens::XmlstrToken(EdxltokenScalarValuesList),
+			m_parse_handler_mgr, this);
+		m_parse_handler_mgr->ActivateParseHandler(hot_keys_parse_handler);
+	}
+
 	// parse handler for child node
 	CParseHandlerBase *child_parse_handler =
 		CParseHandlerFactory::GetParseHandler(
@@ -126,6 +137,10 @@ CParseHandlerRedistributeMotion::StartElement(
 	this->Append(sort_col_list_parse_handler);
 	this->Append(hash_expr_list_parse_handler);
 	this->Append(child_parse_handler);
+	if (nullptr != hot_keys_parse_handler)
+	{
+		this->Append(hot_keys_parse_handler);
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -178,6 +193,11 @@ CParseHandlerRedistributeMotion::EndElement(
 	AddChildFromParseHandler(sort_col_list_parse_handler);
 	AddChildFromParseHandler(hash_expr_list_parse_handler);
 	AddChildFromParseHandler(child_parse_handler);
+	if (EdxlskewNone != m_dxl_op->GetSkewMode())
+	{
+		AddChildFromParseHandler(
+			dynamic_cast<CParseHandlerScalarValuesList *>((*this)[6]));
+	}
 
 	// deactivate handler
 	m_parse_handler_mgr->DeactivateHandler();
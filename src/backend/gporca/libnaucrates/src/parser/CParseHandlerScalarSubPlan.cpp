@@ -39,7 +39,8 @@ CParseHandlerScalarSubPlan::CParseHandlerScalarSubPlan(
 	CParseHandlerBase *parse_handler_root)
 	: CParseHandlerScalarOp(mp, parse_handler_mgr, parse_handler_root),
 	  m_mdid_first_col(nullptr),
-	  m_dxl_subplan_type(EdxlSubPlanTypeSentinel)
+	  m_dxl_subplan_type(EdxlSubPlanTypeSentinel),
+	  m_memoize(false)
 {
 }
 
@@ -132,6 +133,10 @@ CParseHandlerScalarSubPlan::StartElement(const XMLCh *const,  // element_uri,
 		attrs, EdxltokenScalarSubPlanType, EdxltokenScalarSubPlan);
 	m_dxl_subplan_type = GetDXLSubplanType(xmlszSubplanType);
 
+	m_memoize = CDXLOperatorFactory::ExtractConvertAttrValueToBool(
+		m_parse_handler_mgr->GetDXLMemoryManager(), attrs, EdxltokenMemoize,
+		EdxltokenScalarSubPlan, true, false);
+
 	// parse handler for child physical node
 	CParseHandlerBase *child_parse_handler =
 		CParseHandlerFactory::GetParseHandler(
@@ -203,6 +208,7 @@ CParseHandlerScalarSubPlan::EndElement(const XMLCh *const,	// element_uri,
 		(CDXLScalarSubPlan *) CDXLOperatorFactory::MakeDXLSubPlan(
 			m_parse_handler_mgr->GetDXLMemoryManager(), m_mdid_first_col,
 			dxl_colref_array, m_dxl_subplan_type, dxl_subplan_test_expr);
+	dxl_op->SetMemoize(m_memoize);
 
 	m_dxl_node = GPOS_NEW(m_mp) CDXLNode(m_mp, dxl_op);
 
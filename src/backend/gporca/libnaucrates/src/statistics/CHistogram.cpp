@@ -62,7 +62,9 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_bounds(nullptr),
+	  m_bounds_were_built(false)
 {
 	GPOS_ASSERT(nullptr != histogram_buckets);
 }
@@ -78,7 +80,9 @@ CHistogram::CHistogram(CMemoryPool *mp, BOOL is_well_defined)
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_bounds(nullptr),
+	  m_bounds_were_built(false)
 {
 	m_histogram_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 }
@@ -97,7 +101,9 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(is_col_stats_missing)
+	  m_is_col_stats_missing(is_col_stats_missing),
+	  m_bounds(nullptr),
+	  m_bounds_were_built(false)
 {
 	GPOS_ASSERT(m_histogram_buckets);
 	// FIXME: These assertions are sometimes hit and is indicitive of a bug, but
@@ -114,6 +120,19 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 #endif
 }
 
+// flat array of bucket bounds, built on first use
+const CHistogramBounds *
+CHistogram::GetBounds() const
+{
+	if (!m_bounds_were_built)
+	{
+		m_bounds = CHistogramBounds::Create(m_mp, m_histogram_buckets);
+		m_bounds_were_built = true;
+	}
+
+	return m_bounds;
+}
+
 // set histograms null frequency
 void
 CHistogram::SetNullFrequency(CDouble null_freq)
@@ -305,7 +324,17 @@ CHistogram::MakeBucketsWithEqualityFilter(CPoint *point) const
 	const ULONG num_buckets = m_histogram_buckets->Size();
 	ULONG bucket_index = 0;
 
-	for (bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	// use the flat bounds to find the bucket containing the point, if we can;
+	// if no bucket contains the point, the loop below is skipped
+	const CHistogramBounds *bounds = GetBounds();
+	ULONG containing_bucket_index = gpos::ulong_max;
+	if (nullptr != bounds &&
+		bounds->FindBucketContaining(point, &containing_bucket_index))
+	{
+		bucket_index = containing_bucket_index;
+	}
+
+	for (; bucket_index < num_buckets; bucket_index++)
 	{
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 
@@ -1110,13 +1139,25 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 		return MakeNDVBasedJoinHistogramEqualityFilter(histogram);
 	}
 
+	// merge the buckets using the flat bounds if both histograms have
+	// comparable ones, this avoids comparing datums through CPoint
+	const CHistogramBounds *bounds1 = GetBounds();
+	const CHistogramBounds *bounds2 = histogram->GetBounds();
+	const BOOL use_bounds = nullptr != bounds1 && nullptr != bounds2 &&
+							bounds1->IsComparable(bounds2);
+
 	CBucketArray *join_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
 		CBucket *bucket1 = (*m_histogram_buckets)[idx1];
 		CBucket *bucket2 = (*histogram->m_histogram_buckets)[idx2];
 
-		if (bucket1->Intersects(bucket2))
+		const BOOL intersects =
+			use_bounds
+				? CHistogramBounds::Intersects(bounds1, idx1, bounds2, idx2)
+				: bucket1->Intersects(bucket2);
+
+		if (intersects)
 		{
 			CDouble freq_intersect1(0.0);
 			CDouble freq_intersect2(0.0);
@@ -1128,7 +1169,9 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 			hist1_buckets_freq = hist1_buckets_freq + freq_intersect1;
 			hist2_buckets_freq = hist2_buckets_freq + freq_intersect2;
 
-			INT res = CBucket::CompareUpperBounds(bucket1, bucket2);
+			INT res = use_bounds ? CHistogramBounds::CompareUpperBounds(
+									   bounds1, idx1, bounds2, idx2)
+								 : CBucket::CompareUpperBounds(bucket1, bucket2);
 			if (0 == res)
 			{
 				// both ubs are equal
@@ -1145,7 +1188,9 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 				idx2++;
 			}
 		}
-		else if (bucket1->IsBefore(bucket2))
+		else if (use_bounds
+					 ? CHistogramBounds::IsBefore(bounds1, idx1, bounds2, idx2)
+					 : bucket1->IsBefore(bucket2))
 		{
 			// buckets do not intersect there one bucket is before the other
 			idx1++;
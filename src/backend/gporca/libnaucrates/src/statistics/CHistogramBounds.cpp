@@ -0,0 +1,353 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CHistogramBounds.cpp
+//
+//	@doc:
+//		Implementation of the flat array representation of histogram bounds
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CHistogramBounds.h"
+
+#include "naucrates/statistics/CStatistics.h"
+
+using namespace gpnaucrates;
+
+// ctor
+CHistogramBounds::CHistogramBounds(CMemoryPool *mp, ULONG size, BOOL is_lint)
+	: m_size(size),
+	  m_is_lint(is_lint),
+	  m_lower(nullptr),
+	  m_upper(nullptr),
+	  m_is_lower_closed(nullptr),
+	  m_is_upper_closed(nullptr)
+{
+	m_lower = GPOS_NEW_ARRAY(mp, SValue, size);
+	m_upper = GPOS_NEW_ARRAY(mp, SValue, size);
+	m_is_lower_closed = GPOS_NEW_ARRAY(mp, BOOL, size);
+	m_is_upper_closed = GPOS_NEW_ARRAY(mp, BOOL, size);
+}
+
+// dtor
+CHistogramBounds::~CHistogramBounds()
+{
+	GPOS_DELETE_ARRAY(m_lower);
+	GPOS_DELETE_ARRAY(m_upper);
+	GPOS_DELETE_ARRAY(m_is_lower_closed);
+	GPOS_DELETE_ARRAY(m_is_upper_closed);
+}
+
+// map a datum to a value; IDatum compares two datums through their LINT
+// mapping if both have one, and through their double mapping otherwise
+BOOL
+CHistogramBounds::MapDatum(const IDatum *datum, BOOL is_lint, SValue *value)
+{
+	if (datum->IsNull())
+	{
+		return false;
+	}
+
+	if (is_lint)
+	{
+		if (!datum->IsDatumMappableToLINT())
+		{
+			return false;
+		}
+
+		value->m_lint = datum->GetLINTMapping();
+		return true;
+	}
+
+	if (!datum->IsDatumMappableToDouble())
+	{
+		return false;
+	}
+
+	value->m_double = datum->GetDoubleMapping();
+	return true;
+}
+
+// build the bounds of the given buckets
+CHistogramBounds *
+CHistogramBounds::Create(CMemoryPool *mp, const CBucketArray *buckets)
+{
+	GPOS_ASSERT(nullptr != buckets);
+
+	const ULONG size = buckets->Size();
+	if (0 == size)
+	{
+		return nullptr;
+	}
+
+	// use LINT values if all bounds have a LINT mapping; use double values
+	// only if none of them has one, so that any two bounds are compared the
+	// same way as IDatum compares them
+	BOOL all_lint = true;
+	BOOL any_lint = false;
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CBucket *bucket = (*buckets)[ul];
+		const BOOL lower_is_lint =
+			bucket->GetLowerBound()->GetDatum()->IsDatumMappableToLINT();
+		const BOOL upper_is_lint =
+			bucket->GetUpperBound()->GetDatum()->IsDatumMappableToLINT();
+
+		all_lint = all_lint && lower_is_lint && upper_is_lint;
+		any_lint = any_lint || lower_is_lint || upper_is_lint;
+	}
+
+	if (!all_lint && any_lint)
+	{
+		return nullptr;
+	}
+
+	CHistogramBounds *bounds =
+		GPOS_NEW(mp) CHistogramBounds(mp, size, all_lint);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CBucket *bucket = (*buckets)[ul];
+
+		if (!MapDatum(bucket->GetLowerBound()->GetDatum(), all_lint,
+					  &bounds->m_lower[ul]) ||
+			!MapDatum(bucket->GetUpperBound()->GetDatum(), all_lint,
+					  &bounds->m_upper[ul]))
+		{
+			GPOS_DELETE(bounds);
+			return nullptr;
+		}
+
+		bounds->m_is_lower_closed[ul] = bucket->IsLowerClosed();
+		bounds->m_is_upper_closed[ul] = bucket->IsUpperClosed();
+	}
+
+	return bounds;
+}
+
+// three-way comparison of two mapped values, see IDatum::StatsAreEqual()
+// and IDatum::StatsAreLessThan()
+INT
+CHistogramBounds::Compare(const SValue &value1, const SValue &value2) const
+{
+	if (m_is_lint)
+	{
+		if (value1.m_lint == value2.m_lint)
+		{
+			return 0;
+		}
+
+		return (value1.m_lint < value2.m_lint) ? -1 : 1;
+	}
+
+	CDouble diff = value1.m_double - value2.m_double;
+	if (diff.Absolute() <= CStatistics::Epsilon)
+	{
+		return 0;
+	}
+
+	CDouble reverse_diff = value2.m_double - value1.m_double;
+	return (reverse_diff > CStatistics::Epsilon) ? -1 : 1;
+}
+
+// does the bucket contain the value, see CBucket::Contains()
+BOOL
+CHistogramBounds::Contains(ULONG idx, const SValue &value) const
+{
+	const INT lower_cmp = Compare(m_lower[idx], value);
+
+	if (IsSingleton(idx))
+	{
+		return 0 == lower_cmp;
+	}
+
+	if (m_is_lower_closed[idx] && 0 == lower_cmp)
+	{
+		return true;
+	}
+
+	const INT upper_cmp = Compare(m_upper[idx], value);
+	if (m_is_upper_closed[idx] && 0 == upper_cmp)
+	{
+		return true;
+	}
+
+	return 0 > lower_cmp && 0 < upper_cmp;
+}
+
+// compare lower bounds, see CBucket::CompareLowerBounds()
+INT
+CHistogramBounds::CompareLowerBounds(const CHistogramBounds *bounds1,
+									 ULONG idx1,
+									 const CHistogramBounds *bounds2,
+									 ULONG idx2)
+{
+	const INT cmp =
+		bounds1->Compare(bounds1->m_lower[idx1], bounds2->m_lower[idx2]);
+	if (0 != cmp)
+	{
+		return cmp;
+	}
+
+	const BOOL is_closed1 = bounds1->m_is_lower_closed[idx1];
+	if (is_closed1 == bounds2->m_is_lower_closed[idx2])
+	{
+		return 0;
+	}
+
+	return is_closed1 ? -1 : 1;
+}
+
+// compare a lower bound to an upper bound, see
+// CBucket::CompareLowerBoundToUpperBound()
+INT
+CHistogramBounds::CompareLowerBoundToUpperBound(const CHistogramBounds *bounds1,
+												ULONG idx1,
+												const CHistogramBounds *bounds2,
+												ULONG idx2)
+{
+	const INT cmp =
+		bounds1->Compare(bounds1->m_lower[idx1], bounds2->m_upper[idx2]);
+	if (0 != cmp)
+	{
+		return cmp;
+	}
+
+	if (bounds1->m_is_lower_closed[idx1] && bounds2->m_is_upper_closed[idx2])
+	{
+		return 0;
+	}
+
+	return 1;
+}
+
+// compare upper bounds, see CBucket::CompareUpperBounds()
+INT
+CHistogramBounds::CompareUpperBounds(const CHistogramBounds *bounds1,
+									 ULONG idx1,
+									 const CHistogramBounds *bounds2,
+									 ULONG idx2)
+{
+	GPOS_ASSERT(bounds1->IsComparable(bounds2));
+
+	const INT cmp =
+		bounds1->Compare(bounds1->m_upper[idx1], bounds2->m_upper[idx2]);
+	if (0 != cmp)
+	{
+		return cmp;
+	}
+
+	const BOOL is_closed1 = bounds1->m_is_upper_closed[idx1];
+	if (is_closed1 == bounds2->m_is_upper_closed[idx2])
+	{
+		return 0;
+	}
+
+	return is_closed1 ? 1 : -1;
+}
+
+// does the first bucket subsume the second, see CBucket::Subsumes()
+BOOL
+CHistogramBounds::Subsumes(const CHistogramBounds *bounds1, ULONG idx1,
+						   const CHistogramBounds *bounds2, ULONG idx2)
+{
+	const BOOL is_singleton2 = bounds2->IsSingleton(idx2);
+
+	if (bounds1->IsSingleton(idx1) && is_singleton2)
+	{
+		return 0 == bounds1->Compare(bounds1->m_lower[idx1],
+									 bounds2->m_lower[idx2]);
+	}
+
+	if (is_singleton2)
+	{
+		return bounds1->Contains(idx1, bounds2->m_lower[idx2]);
+	}
+
+	return 0 >= CompareLowerBounds(bounds1, idx1, bounds2, idx2) &&
+		   0 <= CompareUpperBounds(bounds1, idx1, bounds2, idx2);
+}
+
+// do two buckets intersect, see CBucket::Intersects()
+BOOL
+CHistogramBounds::Intersects(const CHistogramBounds *bounds1, ULONG idx1,
+							 const CHistogramBounds *bounds2, ULONG idx2)
+{
+	GPOS_ASSERT(bounds1->IsComparable(bounds2));
+
+	const BOOL is_singleton1 = bounds1->IsSingleton(idx1);
+	const BOOL is_singleton2 = bounds2->IsSingleton(idx2);
+
+	if (is_singleton1 && is_singleton2)
+	{
+		return 0 == bounds1->Compare(bounds1->m_lower[idx1],
+									 bounds2->m_lower[idx2]);
+	}
+
+	if (is_singleton1)
+	{
+		return bounds2->Contains(idx2, bounds1->m_lower[idx1]);
+	}
+
+	if (is_singleton2)
+	{
+		return bounds1->Contains(idx1, bounds2->m_lower[idx2]);
+	}
+
+	if (Subsumes(bounds1, idx1, bounds2, idx2) ||
+		Subsumes(bounds2, idx2, bounds1, idx1))
+	{
+		return true;
+	}
+
+	if (0 >= CompareLowerBounds(bounds1, idx1, bounds2, idx2))
+	{
+		// first bucket starts before the second bucket
+		return 0 >= CompareLowerBoundToUpperBound(bounds2, idx2, bounds1, idx1);
+	}
+
+	// first bucket starts before the second bucket ends
+	return 0 >= CompareLowerBoundToUpperBound(bounds1, idx1, bounds2, idx2);
+}
+
+// is the first bucket before the second, see CBucket::IsBefore()
+BOOL
+CHistogramBounds::IsBefore(const CHistogramBounds *bounds1, ULONG idx1,
+						   const CHistogramBounds *bounds2, ULONG idx2)
+{
+	if (Intersects(bounds1, idx1, bounds2, idx2))
+	{
+		return false;
+	}
+
+	return 0 >=
+		   bounds1->Compare(bounds1->m_upper[idx1], bounds2->m_lower[idx2]);
+}
+
+// index of the bucket containing the point, see
+// CHistogram::MakeBucketsWithEqualityFilter()
+BOOL
+CHistogramBounds::FindBucketContaining(const CPoint *point, ULONG *idx) const
+{
+	GPOS_ASSERT(nullptr != idx);
+
+	SValue value;
+	if (!MapDatum(point->GetDatum(), m_is_lint, &value))
+	{
+		return false;
+	}
+
+	*idx = gpos::ulong_max;
+	for (ULONG ul = 0; ul < m_size; ul++)
+	{
+		if (Contains(ul, value))
+		{
+			*idx = ul;
+			break;
+		}
+	}
+
+	return true;
+}
+
+// EOF
@@ -0,0 +1,533 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryReader.cpp
+//
+//	@doc:
+//		Implementation of the decoder of binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+#include "naucrates/dxl/parser/CParseHandlerBase.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/exception.h"
+
+using namespace gpdxl;
+
+// initial number of attribute slots
+#define GPDXL_BINARY_INITIAL_ATTRIBUTES 16
+
+const XMLCh CDXLBinaryAttributes::m_empty[] = {0};
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::CDXLBinaryAttributes
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryAttributes::CDXLBinaryAttributes(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_names(nullptr),
+	  m_values(nullptr),
+	  m_length(0),
+	  m_capacity(GPDXL_BINARY_INITIAL_ATTRIBUTES)
+{
+	m_names = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_capacity);
+	m_values = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_capacity);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::~CDXLBinaryAttributes
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryAttributes::~CDXLBinaryAttributes()
+{
+	GPOS_DELETE_ARRAY(m_names);
+	GPOS_DELETE_ARRAY(m_values);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::Reset
+//
+//	@doc:
+//		Remove all attributes, making room for the given number of them
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryAttributes::Reset(ULONG num_attrs)
+{
+	m_length = 0;
+
+	if (num_attrs <= m_capacity)
+	{
+		return;
+	}
+
+	GPOS_DELETE_ARRAY(m_names);
+	GPOS_DELETE_ARRAY(m_values);
+
+	while (m_capacity < num_attrs)
+	{
+		m_capacity *= 2;
+	}
+	m_names = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_capacity);
+	m_values = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_capacity);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryAttributes::Add
+//
+//	@doc:
+//		Add an attribute
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryAttributes::Add(const XMLCh *name, const XMLCh *value)
+{
+	GPOS_ASSERT(m_length < m_capacity);
+
+	m_names[m_length] = name;
+	m_values[m_length] = value;
+	m_length++;
+}
+
+XMLSize_t
+CDXLBinaryAttributes::getLength() const
+{
+	return m_length;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getURI(const XMLSize_t index) const
+{
+	return index < m_length ? m_empty : nullptr;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getLocalName(const XMLSize_t index) const
+{
+	return getQName(index);
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getQName(const XMLSize_t index) const
+{
+	return index < m_length ? m_names[index] : nullptr;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getType(const XMLSize_t index) const
+{
+	return index < m_length ? XMLUni::fgCDATAString : nullptr;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getValue(const XMLSize_t index) const
+{
+	return index < m_length ? m_values[index] : nullptr;
+}
+
+bool
+CDXLBinaryAttributes::getIndex(const XMLCh *const uri,
+							   const XMLCh *const local_part,
+							   XMLSize_t &index) const
+{
+	if (nullptr != uri && 0 != uri[0])
+	{
+		return false;
+	}
+
+	return getIndex(local_part, index);
+}
+
+int
+CDXLBinaryAttributes::getIndex(const XMLCh *const uri,
+							   const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	return getIndex(uri, local_part, index) ? (int) index : -1;
+}
+
+bool
+CDXLBinaryAttributes::getIndex(const XMLCh *const qname,
+							   XMLSize_t &index) const
+{
+	for (ULONG ul = 0; ul < m_length; ul++)
+	{
+		if (XMLString::equals(m_names[ul], qname))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int
+CDXLBinaryAttributes::getIndex(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	return getIndex(qname, index) ? (int) index : -1;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getType(const XMLCh *const uri,
+							  const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	return getIndex(uri, local_part, index) ? getType(index) : nullptr;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getType(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	return getIndex(qname, index) ? getType(index) : nullptr;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getValue(const XMLCh *const uri,
+							   const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	return getIndex(uri, local_part, index) ? getValue(index) : nullptr;
+}
+
+const XMLCh *
+CDXLBinaryAttributes::getValue(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	return getIndex(qname, index) ? getValue(index) : nullptr;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CDXLBinaryReader
+//
+//	@doc:
+//		Ctor, checks the header of the document
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::CDXLBinaryReader(CMemoryPool *mp, const BYTE *data,
+								   ULONG size)
+	: m_mp(mp),
+	  m_data(data),
+	  m_size(size),
+	  m_pos(GPDXL_BINARY_HEADER_LENGTH),
+	  m_strings(nullptr),
+	  m_open_elements(nullptr),
+	  m_attrs(mp)
+{
+	if (!FBinaryDXL(data, size) ||
+		GPDXL_BINARY_VERSION != data[GPDXL_BINARY_MAGIC_LENGTH])
+	{
+		RaiseMalformed();
+	}
+
+	m_strings = GPOS_NEW(m_mp) XMLChArray(m_mp);
+	m_open_elements = GPOS_NEW(m_mp) XMLChStack(m_mp);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::~CDXLBinaryReader
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::~CDXLBinaryReader()
+{
+	GPOS_DELETE(m_open_elements);
+	CRefCount::SafeRelease(m_strings);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::RaiseMalformed
+//
+//	@doc:
+//		Raise an error for a malformed document
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::RaiseMalformed()
+{
+	GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLBinaryParseError);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadByte
+//
+//	@doc:
+//		Read a byte
+//
+//---------------------------------------------------------------------------
+BYTE
+CDXLBinaryReader::ReadByte()
+{
+	if (m_pos >= m_size)
+	{
+		RaiseMalformed();
+	}
+
+	return m_data[m_pos++];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadVarint
+//
+//	@doc:
+//		Read an unsigned LEB128 varint
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryReader::ReadVarint()
+{
+	ULONG value = 0;
+	for (ULONG shift = 0; shift < 32; shift += 7)
+	{
+		BYTE byte = ReadByte();
+		value |= ((ULONG)(byte & 0x7F)) << shift;
+		if (0 == (byte & 0x80))
+		{
+			return value;
+		}
+	}
+
+	// varint longer than a ULONG
+	RaiseMalformed();
+	return 0;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadString
+//
+//	@doc:
+//		Read a string reference; a new string is decoded from UTF-8 and
+//		added to the dictionary
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::ReadString()
+{
+	const ULONG ref = ReadVarint();
+	if (0 < ref)
+	{
+		if (ref > m_strings->Size())
+		{
+			RaiseMalformed();
+		}
+		return (*m_strings)[ref - 1];
+	}
+
+	const ULONG utf8_length = ReadVarint();
+	if (utf8_length > m_size - m_pos)
+	{
+		RaiseMalformed();
+	}
+	const BYTE *utf8 = m_data + m_pos;
+	m_pos += utf8_length;
+
+	// a UTF-8 string has at most as many UTF-16 code units as bytes
+	XMLCh *str = GPOS_NEW_ARRAY(m_mp, XMLCh, utf8_length + 1);
+	m_strings->Append(str);
+
+	ULONG length = 0;
+	ULONG ul = 0;
+	while (ul < utf8_length)
+	{
+		ULONG code_point = utf8[ul];
+		ULONG num_continuation = 0;
+		if (code_point < 0x80)
+		{
+			num_continuation = 0;
+		}
+		else if (0xC0 == (code_point & 0xE0))
+		{
+			code_point &= 0x1F;
+			num_continuation = 1;
+		}
+		else if (0xE0 == (code_point & 0xF0))
+		{
+			code_point &= 0x0F;
+			num_continuation = 2;
+		}
+		else if (0xF0 == (code_point & 0xF8))
+		{
+			code_point &= 0x07;
+			num_continuation = 3;
+		}
+		else
+		{
+			RaiseMalformed();
+		}
+
+		if (num_continuation >= utf8_length - ul)
+		{
+			RaiseMalformed();
+		}
+		for (ULONG ulCont = 1; ulCont <= num_continuation; ulCont++)
+		{
+			const BYTE byte = utf8[ul + ulCont];
+			if (0x80 != (byte & 0xC0))
+			{
+				RaiseMalformed();
+			}
+			code_point = (code_point << 6) | (byte & 0x3F);
+		}
+		ul += num_continuation + 1;
+
+		if (0x10000 <= code_point)
+		{
+			code_point -= 0x10000;
+			str[length++] = (XMLCh)(0xD800 + (code_point >> 10));
+			str[length++] = (XMLCh)(0xDC00 + (code_point & 0x3FF));
+		}
+		else
+		{
+			str[length++] = (XMLCh) code_point;
+		}
+	}
+	str[length] = 0;
+
+	return str;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::LocalName
+//
+//	@doc:
+//		Local part of a qualified name, that is the part after the namespace
+//		prefix if there is one
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::LocalName(const XMLCh *qname)
+{
+	const int colon = XMLString::indexOf(qname, chColon);
+	if (0 > colon)
+	{
+		return qname;
+	}
+
+	return qname + colon + 1;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Parse
+//
+//	@doc:
+//		Decode the document, passing each of its SAX events to the current
+//		handler of the given parse handler manager, the way the Xerces
+//		reader does for an XML document
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Parse(CParseHandlerManager *parse_handler_mgr)
+{
+	GPOS_ASSERT(nullptr != parse_handler_mgr);
+
+	while (true)
+	{
+		const BYTE record = ReadByte();
+		CParseHandlerBase *parse_handler_base =
+			parse_handler_mgr->GetCurrentParseHandler();
+
+		switch (record)
+		{
+			case EdxlbinStartElement:
+			{
+				const XMLCh *element_uri = ReadString();
+				const XMLCh *element_qname = ReadString();
+				const ULONG num_attrs = ReadVarint();
+
+				// every attribute takes at least two bytes
+				if (num_attrs > m_size - m_pos)
+				{
+					RaiseMalformed();
+				}
+				m_attrs.Reset(num_attrs);
+				for (ULONG ul = 0; ul < num_attrs; ul++)
+				{
+					const XMLCh *name = ReadString();
+					const XMLCh *value = ReadString();
+					m_attrs.Add(name, value);
+				}
+
+				if (nullptr == parse_handler_base)
+				{
+					RaiseMalformed();
+				}
+				m_open_elements->Push(element_uri);
+				m_open_elements->Push(element_qname);
+				parse_handler_base->startElement(element_uri,
+												 LocalName(element_qname),
+												 element_qname, m_attrs);
+				break;
+			}
+
+			case EdxlbinEndElement:
+			{
+				if (m_open_elements->IsEmpty() || nullptr == parse_handler_base)
+				{
+					RaiseMalformed();
+				}
+				const XMLCh *element_qname = m_open_elements->Pop();
+				const XMLCh *element_uri = m_open_elements->Pop();
+				parse_handler_base->endElement(
+					element_uri, LocalName(element_qname), element_qname);
+				break;
+			}
+
+			case EdxlbinEndDocument:
+			{
+				if (!m_open_elements->IsEmpty())
+				{
+					RaiseMalformed();
+				}
+				if (nullptr != parse_handler_base)
+				{
+					parse_handler_base->endDocument();
+				}
+				return;
+			}
+
+			default:
+				RaiseMalformed();
+		}
+	}
+}
+
+// EOF
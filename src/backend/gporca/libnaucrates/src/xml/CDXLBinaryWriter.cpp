@@ -0,0 +1,470 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryWriter.cpp
+//
+//	@doc:
+//		Implementation of the encoder of binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+using namespace gpdxl;
+
+// initial size of the buffer of the encoded document
+#define GPDXL_BINARY_INITIAL_CAPACITY 4096
+
+// number of hash chains of the string dictionary
+#define GPDXL_BINARY_DICTIONARY_CHAINS 1021
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::CDXLBinaryWriter
+//
+//	@doc:
+//		Ctor, writes the header of the document
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::CDXLBinaryWriter(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_data(nullptr),
+	  m_size(0),
+	  m_capacity(0),
+	  m_string_refs(nullptr),
+	  m_pending_element(nullptr)
+{
+	m_string_refs =
+		GPOS_NEW(m_mp) StringToRefMap(m_mp, GPDXL_BINARY_DICTIONARY_CHAINS);
+	m_pending_element =
+		GPOS_NEW(m_mp) CDynamicPtrArray<XMLCh, CleanupDeleteArray<XMLCh>>(m_mp);
+
+	Reserve(GPDXL_BINARY_INITIAL_CAPACITY);
+	clib::Memcpy(m_data, GPDXL_BINARY_MAGIC, GPDXL_BINARY_MAGIC_LENGTH);
+	m_size = GPDXL_BINARY_MAGIC_LENGTH;
+	WriteByte(GPDXL_BINARY_VERSION);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::~CDXLBinaryWriter
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::~CDXLBinaryWriter()
+{
+	m_pending_element->Release();
+	m_string_refs->Release();
+	GPOS_DELETE_ARRAY(m_data);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::HashString
+//
+//	@doc:
+//		Hash function of dictionary strings
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryWriter::HashString(const XMLCh *str)
+{
+	return gpos::HashByteArray((const BYTE *) str,
+							   XMLString::stringLen(str) * sizeof(XMLCh));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::FEqualStrings
+//
+//	@doc:
+//		Equality function of dictionary strings
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLBinaryWriter::FEqualStrings(const XMLCh *str_left, const XMLCh *str_right)
+{
+	return XMLString::equals(str_left, str_right);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::Reserve
+//
+//	@doc:
+//		Make room for the given number of bytes, doubling the buffer as
+//		needed
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::Reserve(ULONG num_bytes)
+{
+	if (m_size + num_bytes <= m_capacity)
+	{
+		return;
+	}
+
+	ULONG capacity =
+		0 < m_capacity ? m_capacity : GPDXL_BINARY_INITIAL_CAPACITY;
+	while (capacity < m_size + num_bytes)
+	{
+		capacity *= 2;
+	}
+
+	BYTE *data = GPOS_NEW_ARRAY(m_mp, BYTE, capacity);
+	if (0 < m_size)
+	{
+		clib::Memcpy(data, m_data, m_size);
+	}
+	GPOS_DELETE_ARRAY(m_data);
+
+	m_data = data;
+	m_capacity = capacity;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::WriteByte
+//
+//	@doc:
+//		Append a byte
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::WriteByte(BYTE value)
+{
+	Reserve(1);
+	m_data[m_size++] = value;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::WriteVarint
+//
+//	@doc:
+//		Append an unsigned LEB128 varint
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::WriteVarint(ULONG value)
+{
+	while (0x80 <= value)
+	{
+		WriteByte((BYTE)(value | 0x80));
+		value >>= 7;
+	}
+	WriteByte((BYTE) value);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::WriteString
+//
+//	@doc:
+//		Append a reference to the given string; a string seen for the first
+//		time is written out in UTF-8 and added to the dictionary
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::WriteString(const XMLCh *str)
+{
+	GPOS_ASSERT(nullptr != str);
+
+	const ULONG *ref = m_string_refs->Find(str);
+	if (nullptr != ref)
+	{
+		WriteVarint(*ref);
+		return;
+	}
+
+	const ULONG length = XMLString::stringLen(str);
+
+	// UTF-16 code units encode into at most 3 bytes of UTF-8 each,
+	// surrogate pairs into 4 bytes
+	BYTE *utf8 = GPOS_NEW_ARRAY(m_mp, BYTE, 3 * length + 1);
+	ULONG utf8_length = 0;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		ULONG code_point = str[ul];
+		if (0xD800 <= code_point && code_point < 0xDC00 && ul + 1 < length &&
+			0xDC00 <= str[ul + 1] && str[ul + 1] < 0xE000)
+		{
+			code_point =
+				0x10000 + ((code_point - 0xD800) << 10) + (str[++ul] - 0xDC00);
+		}
+
+		if (code_point < 0x80)
+		{
+			utf8[utf8_length++] = (BYTE) code_point;
+		}
+		else if (code_point < 0x800)
+		{
+			utf8[utf8_length++] = (BYTE)(0xC0 | (code_point >> 6));
+			utf8[utf8_length++] = (BYTE)(0x80 | (code_point & 0x3F));
+		}
+		else if (code_point < 0x10000)
+		{
+			utf8[utf8_length++] = (BYTE)(0xE0 | (code_point >> 12));
+			utf8[utf8_length++] = (BYTE)(0x80 | ((code_point >> 6) & 0x3F));
+			utf8[utf8_length++] = (BYTE)(0x80 | (code_point & 0x3F));
+		}
+		else
+		{
+			utf8[utf8_length++] = (BYTE)(0xF0 | (code_point >> 18));
+			utf8[utf8_length++] = (BYTE)(0x80 | ((code_point >> 12) & 0x3F));
+			utf8[utf8_length++] = (BYTE)(0x80 | ((code_point >> 6) & 0x3F));
+			utf8[utf8_length++] = (BYTE)(0x80 | (code_point & 0x3F));
+		}
+	}
+
+	WriteVarint(0);
+	WriteVarint(utf8_length);
+	if (0 < utf8_length)
+	{
+		Reserve(utf8_length);
+		clib::Memcpy(m_data + m_size, utf8, utf8_length);
+		m_size += utf8_length;
+	}
+	GPOS_DELETE_ARRAY(utf8);
+
+	// references are 1-based, 0 introduces a new string
+	XMLCh *key = GPOS_NEW_ARRAY(m_mp, XMLCh, length + 1);
+	clib::Memcpy(key, str, (length + 1) * sizeof(XMLCh));
+	const ULONG new_ref = m_string_refs->Size() + 1;
+	m_string_refs->Insert(key, GPOS_NEW(m_mp) ULONG(new_ref));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::WriteStartElement
+//
+//	@doc:
+//		Append the start of an element; the given number of attribute names
+//		and values must be written next
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::WriteStartElement(const XMLCh *uri, const XMLCh *qname,
+									ULONG num_attrs)
+{
+	WriteByte(EdxlbinStartElement);
+	WriteString(uri);
+	WriteString(qname);
+	WriteVarint(num_attrs);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::WritePendingElement
+//
+//	@doc:
+//		Append the start of the element started last, now that all of its
+//		attributes are known
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::WritePendingElement()
+{
+	const ULONG size = m_pending_element->Size();
+	if (0 == size)
+	{
+		return;
+	}
+
+	GPOS_ASSERT(0 == size % 2);
+
+	WriteStartElement((*m_pending_element)[0], (*m_pending_element)[1],
+					  size / 2 - 1);
+	for (ULONG ul = 2; ul < size; ul++)
+	{
+		WriteString((*m_pending_element)[ul]);
+	}
+
+	m_pending_element->Clear();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::CreateXMLChString
+//
+//	@doc:
+//		Copy the given string into a new UTF-16 string, as Xerces would
+//		report it for the same text
+//
+//---------------------------------------------------------------------------
+XMLCh *
+CDXLBinaryWriter::CreateXMLChString(const CWStringBase *str) const
+{
+	GPOS_ASSERT(nullptr != str);
+
+	const ULONG length = str->Length();
+	const WCHAR *wsz = str->GetBuffer();
+
+	// code points beyond the BMP take a surrogate pair
+	XMLCh *xmlch = GPOS_NEW_ARRAY(m_mp, XMLCh, 2 * length + 1);
+	ULONG xmlch_length = 0;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		ULONG code_point = (ULONG) wsz[ul];
+		if (0x10000 <= code_point)
+		{
+			code_point -= 0x10000;
+			xmlch[xmlch_length++] = (XMLCh)(0xD800 + (code_point >> 10));
+			xmlch[xmlch_length++] = (XMLCh)(0xDC00 + (code_point & 0x3FF));
+		}
+		else
+		{
+			xmlch[xmlch_length++] = (XMLCh) code_point;
+		}
+	}
+	xmlch[xmlch_length] = 0;
+
+	return xmlch;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::StartElement
+//
+//	@doc:
+//		Start an element. Its record is written once its attributes are
+//		complete, that is when the next element starts or ends.
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::StartElement(const CWStringBase *uri,
+							   const CWStringBase *qname)
+{
+	WritePendingElement();
+
+	m_pending_element->Append(CreateXMLChString(uri));
+	m_pending_element->Append(CreateXMLChString(qname));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::AddAttribute
+//
+//	@doc:
+//		Add an attribute to the element started last
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::AddAttribute(const CWStringBase *qname,
+							   const CWStringBase *value)
+{
+	GPOS_ASSERT(0 < m_pending_element->Size() &&
+				"Attribute added outside of an element start");
+
+	m_pending_element->Append(CreateXMLChString(qname));
+	m_pending_element->Append(CreateXMLChString(value));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::EndElement
+//
+//	@doc:
+//		Encode the end of the innermost open element
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::EndElement()
+{
+	WritePendingElement();
+	WriteByte(EdxlbinEndElement);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::EndDocument
+//
+//	@doc:
+//		Encode the end of the document
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::EndDocument()
+{
+	WritePendingElement();
+	WriteByte(EdxlbinEndDocument);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::startElement
+//
+//	@doc:
+//		Encode the start of an element and its attributes
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::startElement(const XMLCh *const element_uri,
+							   const XMLCh *const,	// element_local_name,
+							   const XMLCh *const element_qname,
+							   const Attributes &attrs)
+{
+	const ULONG num_attrs = attrs.getLength();
+	WriteStartElement(element_uri, element_qname, num_attrs);
+	for (ULONG ul = 0; ul < num_attrs; ul++)
+	{
+		WriteString(attrs.getQName(ul));
+		WriteString(attrs.getValue(ul));
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::endElement
+//
+//	@doc:
+//		Encode the end of an element
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::endElement(const XMLCh *const,  // element_uri,
+							 const XMLCh *const,  // element_local_name,
+							 const XMLCh *const	  // element_qname
+)
+{
+	EndElement();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::endDocument
+//
+//	@doc:
+//		Encode the end of the document
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::endDocument()
+{
+	EndDocument();
+}
+
+// EOF
@@ -11,15 +11,44 @@
 
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 
+#include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
 #include "naucrates/dxl/xml/dxltokens.h"
 
 using namespace gpdxl;
 
 #define GPDXL_SERIALIZE_CFA_FREQUENCY 30
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXMLSerializer::CXMLSerializer
+//
+//	@doc:
+//		Ctor of a serializer writing binary DXL to the given writer
+//
+//---------------------------------------------------------------------------
+CXMLSerializer::CXMLSerializer(CMemoryPool *mp,
+							   CDXLBinaryWriter *binary_writer)
+	: m_mp(mp),
+	  m_os(nullptr),
+	  m_binary_writer(binary_writer),
+	  m_value_str(nullptr),
+	  m_indentation(false),
+	  m_strstackElems(nullptr),
+	  m_fOpenTag(false),
+	  m_ulLevel(0),
+	  m_iteration_since_last_abortcheck(0)
+{
+	GPOS_ASSERT(nullptr != binary_writer);
+
+	m_strstackElems = GPOS_NEW(m_mp) StrStack(m_mp);
+	m_value_str = GPOS_NEW(m_mp) CWStringDynamic(m_mp);
+	m_os = GPOS_NEW(m_mp) COstreamString(m_value_str);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CXMLSerializer::~CXMLSerializer
@@ -30,6 +59,11 @@ using namespace gpdxl;
 //---------------------------------------------------------------------------
 CXMLSerializer::~CXMLSerializer()
 {
+	if (nullptr != m_binary_writer)
+	{
+		GPOS_DELETE(m_os);
+		GPOS_DELETE(m_value_str);
+	}
 	GPOS_DELETE(m_strstackElems);
 }
 
@@ -45,10 +79,17 @@ void
 CXMLSerializer::StartDocument()
 {
 	GPOS_ASSERT(m_strstackElems->IsEmpty());
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenXMLDocHeader)->GetBuffer();
+
+	// the header carries no information for binary DXL
+	if (nullptr != m_binary_writer)
+	{
+		return;
+	}
+
+	*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenXMLDocHeader)->GetBuffer();
 	if (m_indentation)
 	{
-		m_os << std::endl;
+		*m_os << std::endl;
 	}
 }
 
@@ -77,30 +118,51 @@ CXMLSerializer::OpenElement(const CWStringBase *pstrNamespace,
 	// put element on the stack
 	m_strstackElems->Push(elem_str);
 
+	if (nullptr != m_binary_writer)
+	{
+		// report the element as a namespace-aware XML parser would
+		CWStringDynamic qname(m_mp);
+		CWStringConst str_no_uri(GPOS_WSZ_LIT(""));
+		const CWStringConst *uri = &str_no_uri;
+		if (nullptr != pstrNamespace)
+		{
+			qname.Append(pstrNamespace);
+			qname.Append(CDXLTokens::GetDXLTokenStr(EdxltokenColon));
+			uri = CDXLTokens::GetDXLTokenStr(EdxltokenNamespaceURI);
+		}
+		qname.Append(elem_str);
+
+		m_binary_writer->StartElement(uri, &qname);
+		m_fOpenTag = true;
+		m_ulLevel++;
+
+		return;
+	}
+
 	// write the closing bracket for the previous element if necessary and add indentation
 	if (m_fOpenTag)
 	{
-		m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketCloseTag)
+		*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketCloseTag)
 					->GetBuffer();	// >
 		if (m_indentation)
 		{
-			m_os << std::endl;
+			*m_os << std::endl;
 		}
 	}
 
 	Indent();
 
 	// write element to stream
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketOpenTag)
+	*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketOpenTag)
 				->GetBuffer();	// <
 
 	if (nullptr != pstrNamespace)
 	{
-		m_os << pstrNamespace->GetBuffer()
+		*m_os << pstrNamespace->GetBuffer()
 			 << CDXLTokens::GetDXLTokenStr(EdxltokenColon)
 					->GetBuffer();	// "namespace:"
 	}
-	m_os << elem_str->GetBuffer();
+	*m_os << elem_str->GetBuffer();
 
 	m_fOpenTag = true;
 	m_ulLevel++;
@@ -131,14 +193,19 @@ CXMLSerializer::CloseElement(const CWStringBase *pstrNamespace,
 
 	GPOS_ASSERT(strOpenElem->Equals(elem_str));
 
-	if (m_fOpenTag)
+	if (nullptr != m_binary_writer)
+	{
+		m_binary_writer->EndElement();
+		m_fOpenTag = false;
+	}
+	else if (m_fOpenTag)
 	{
 		// singleton element with no children - close the element with "/>"
-		m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketCloseSingletonTag)
+		*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketCloseSingletonTag)
 					->GetBuffer();	// />
 		if (m_indentation)
 		{
-			m_os << std::endl;
+			*m_os << std::endl;
 		}
 		m_fOpenTag = false;
 	}
@@ -148,20 +215,20 @@ CXMLSerializer::CloseElement(const CWStringBase *pstrNamespace,
 		Indent();
 
 		// write closing tag for element to stream
-		m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketOpenEndTag)
+		*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketOpenEndTag)
 					->GetBuffer();	// </
 		if (nullptr != pstrNamespace)
 		{
-			m_os << pstrNamespace->GetBuffer()
+			*m_os << pstrNamespace->GetBuffer()
 				 << CDXLTokens::GetDXLTokenStr(EdxltokenColon)
 						->GetBuffer();	// "namespace:"
 		}
-		m_os << elem_str->GetBuffer()
+		*m_os << elem_str->GetBuffer()
 			 << CDXLTokens::GetDXLTokenStr(EdxltokenBracketCloseTag)
 					->GetBuffer();	// >
 		if (m_indentation)
 		{
-			m_os << std::endl;
+			*m_os << std::endl;
 		}
 	}
 
@@ -185,12 +252,16 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr,
 	GPOS_ASSERT(nullptr != str_value);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	  // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
-	WriteEscaped(m_os, str_value);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+	IOstream &os = OpenAttribute(pstrAttr);
+	if (nullptr != m_binary_writer)
+	{
+		m_value_str->Append(str_value);
+	}
+	else
+	{
+		WriteEscaped(os, str_value);
+	}
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -208,12 +279,8 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, const CHAR *szValue)
 	GPOS_ASSERT(nullptr != szValue);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // "
-		 << szValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+	OpenAttribute(pstrAttr) << szValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -231,12 +298,8 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, ULONG ulValue)
 	GPOS_ASSERT(nullptr != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << ulValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr) << ulValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -254,12 +317,8 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, ULLONG ullValue)
 	GPOS_ASSERT(nullptr != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << ullValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr) << ullValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -277,12 +336,8 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, INT iValue)
 	GPOS_ASSERT(nullptr != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << iValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr) << iValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -300,12 +355,8 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, LINT value)
 	GPOS_ASSERT(nullptr != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << value
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr) << value;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -323,12 +374,8 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, CDouble value)
 	GPOS_ASSERT(nullptr != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << value
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr) << value;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -357,6 +404,61 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, BOOL fValue)
 	AddAttribute(pstrAttr, str_value);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXMLSerializer::OpenAttribute
+//
+//	@doc:
+//		Start an attribute of the currently open XML tag and return the
+//		stream to write its value to. For binary DXL, the value is
+//		collected in a string until the attribute is closed.
+//
+//---------------------------------------------------------------------------
+IOstream &
+CXMLSerializer::OpenAttribute(const CWStringBase *pstrAttr)
+{
+	if (nullptr != m_binary_writer)
+	{
+		m_value_str->Reset();
+		return *m_os;
+	}
+
+	*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
+		  << pstrAttr->GetBuffer()
+		  << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()		// =
+		  << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();	// "
+
+	return *m_os;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXMLSerializer::CloseAttribute
+//
+//	@doc:
+//		Finish the attribute started last. Namespace declarations are not
+//		reported by a namespace-aware XML parser, so they are left out of
+//		binary DXL.
+//
+//---------------------------------------------------------------------------
+void
+CXMLSerializer::CloseAttribute(const CWStringBase *pstrAttr)
+{
+	if (nullptr == m_binary_writer)
+	{
+		*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+		return;
+	}
+
+	const CWStringConst *xmlns =
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespaceAttr);
+	if (0 != clib::Wcsncmp(pstrAttr->GetBuffer(), xmlns->GetBuffer(),
+						   xmlns->Length()))
+	{
+		m_binary_writer->AddAttribute(pstrAttr, m_value_str);
+	}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CXMLSerializer::Indent
@@ -376,7 +478,7 @@ CXMLSerializer::Indent()
 
 	for (ULONG ul = 0; ul < m_ulLevel; ul++)
 	{
-		m_os << CDXLTokens::GetDXLTokenStr(EdxltokenIndent)->GetBuffer();
+		*m_os << CDXLTokens::GetDXLTokenStr(EdxltokenIndent)->GetBuffer();
 	}
 }
 
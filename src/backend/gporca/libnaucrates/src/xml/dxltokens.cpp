@@ -93,6 +93,9 @@ CDXLTokens::Init(CMemoryPool *mp)
 		 GPOS_WSZ_LIT("PushGroupByBelowSetopThreshold")},
 		{EdxltokenXformBindThreshold, GPOS_WSZ_LIT("XformBindThreshold")},
 		{EdxltokenSkewFactor, GPOS_WSZ_LIT("SkewFactor")},
+		{EdxltokenSearchTimeBudget, GPOS_WSZ_LIT("SearchTimeBudget")},
+		{EdxltokenMemoizeMemoryLimit, GPOS_WSZ_LIT("MemoizeMemoryLimit")},
+		{EdxltokenMemoize, GPOS_WSZ_LIT("Memoize")},
 		{EdxltokenWindowOids, GPOS_WSZ_LIT("WindowOids")},
 		{EdxltokenOidRowNumber, GPOS_WSZ_LIT("RowNumber")},
 		{EdxltokenOidRank, GPOS_WSZ_LIT("Rank")},
@@ -170,6 +173,9 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenOnCommitDrop, GPOS_WSZ_LIT("Drop")},
 
 		{EdxltokenDuplicateSensitive, GPOS_WSZ_LIT("DuplicateSensitive")},
+		{EdxltokenSkewMode, GPOS_WSZ_LIT("SkewMode")},
+		{EdxltokenSkewModeSpread, GPOS_WSZ_LIT("Spread")},
+		{EdxltokenSkewModeBroadcast, GPOS_WSZ_LIT("Broadcast")},
 
 		{EdxltokenSegmentIdCol, GPOS_WSZ_LIT("SegmentIdCol")},
 
@@ -464,6 +470,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenSortOpId, GPOS_WSZ_LIT("SortOperatorMdid")},
 		{EdxltokenSortOpName, GPOS_WSZ_LIT("SortOperatorName")},
 		{EdxltokenSortDiscardDuplicates, GPOS_WSZ_LIT("SortDiscardDuplicates")},
+		{EdxltokenSortPresortedCols, GPOS_WSZ_LIT("SortPresortedColumns")},
 		{EdxltokenSortNullsFirst, GPOS_WSZ_LIT("SortNullsFirst")},
 
 		{EdxltokenMaterializeEager, GPOS_WSZ_LIT("Eager")},
@@ -36,6 +36,10 @@ public:
 	static GPOS_RESULT EresUnittest_SerializeQuery();
 	static GPOS_RESULT EresUnittest_SerializePlan();
 	static GPOS_RESULT EresUnittest_Encoding();
+	static GPOS_RESULT EresUnittest_BinaryPlan();
+	static GPOS_RESULT EresUnittest_BinaryMinidump();
+	static GPOS_RESULT EresUnittest_BinaryMDObj();
+	static GPOS_RESULT EresUnittest_BinaryTruncated();
 
 };	// class CDXLUtilsTest
 }  // namespace gpdxl
@@ -32,6 +32,11 @@ private:
 	// including null fraction and nDistinctRemain
 	static CHistogram *PhistExampleInt4Remain(CMemoryPool *mp);
 
+	// do the flat bounds of the buckets agree with the buckets themselves
+	static BOOL FFlatBoundsMatchBuckets(CMemoryPool *mp,
+										const CBucketArray *buckets,
+										const CPointArray *points);
+
 public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
@@ -51,6 +56,9 @@ public:
 
 	// merge union test with double values differing by less than epsilon
 	static GPOS_RESULT EresUnittest_MergeUnionDoubleLessThanEpsilon();
+
+	// flat array of bucket bounds
+	static GPOS_RESULT EresUnittest_FlatBounds();
 };	// class CHistogramTest
 }  // namespace gpnaucrates
 
@@ -31,6 +31,7 @@ public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_Basics();
+	static GPOS_RESULT EresUnittest_Prefix();
 
 };	// class COrderSpecTest
 }  // namespace gpopt
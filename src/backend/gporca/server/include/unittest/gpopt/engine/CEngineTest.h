@@ -58,6 +58,9 @@ public:
 	// basic unittest
 	static GPOS_RESULT EresUnittest_Basic();
 
+	// test of memo hash values after group merges
+	static GPOS_RESULT EresUnittest_MemoRehash();
+
 	// helper function for optimizing deep join trees
 	static GPOS_RESULT EresOptimize(
 		FnOptimize *pfopt,	 // optimization function
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMinidumpBenchmark.h
+//
+//	@doc:
+//		Benchmark replaying minidumps through the optimizer
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CMinidumpBenchmark_H
+#define GPOPT_CMinidumpBenchmark_H
+
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "gpos/base.h"
+
+// default regression threshold, in percent
+#define GPOPT_BENCHMARK_THRESHOLD 10
+
+// smallest change of optimization time reported as a regression, in ms;
+// keeps timer noise of very short optimizations from being reported
+#define GPOPT_BENCHMARK_MIN_TIME_DELTA_MS 1.0
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMinidumpBenchmark
+//
+//	@doc:
+//		Replays each given minidump through the optimizer a number of times
+//		and writes one CSV line per minidump to the output file, with the
+//		following columns:
+//
+//		minidump		name of the minidump file
+//		iterations		number of optimizations of the minidump
+//		time_min_ms		shortest optimization wall time
+//		time_avg_ms		average optimization wall time
+//		peak_bytes		peak size of the memory pool the optimization
+//						request runs in
+//		jobs			number of jobs completed by the scheduler
+//		groups			number of memo groups
+//		group_exprs		number of memo group expressions
+//		status			"ok", or "error" if optimization raised an error
+//
+//		Optimization time covers CMinidumperUtils::PdxlnExecuteMinidump(),
+//		i.e. setting up the metadata accessor, optimizing the query and
+//		translating the plan into DXL, but not loading the minidump file.
+//
+//		Given the output of an earlier run as a baseline, each line is
+//		extended by the baseline time and peak size, their relative change
+//		in percent, a flag telling if the search (jobs, groups or group
+//		expressions) changed, and a flag telling if the minidump regressed,
+//		i.e. if its time or peak size grew by more than the threshold.
+//
+//---------------------------------------------------------------------------
+class CMinidumpBenchmark
+{
+private:
+	// measurements of a single minidump
+	struct SResult
+	{
+		// number of optimizations
+		ULONG m_ulIterations{0};
+
+		// shortest and average optimization wall time in ms
+		DOUBLE m_dTimeMin{0.0};
+
+		DOUBLE m_dTimeAvg{0.0};
+
+		// peak size of the memory pool of the optimization request
+		ULLONG m_ullPeakBytes{0};
+
+		// search statistics
+		ULLONG m_ullJobs{0};
+
+		ULLONG m_ullGroups{0};
+
+		ULLONG m_ullGroupExprs{0};
+
+		// did optimization raise an error
+		BOOL m_fError{false};
+	};
+
+	// optimize the given minidump the given number of times
+	static void Run(const CHAR *szFileName, ULONG ulIterations,
+					SResult *presult);
+
+	// load the results of an earlier run, return false if the file
+	// can't be read
+	static BOOL FLoadBaseline(const CHAR *szBaselineFile,
+							  std::map<std::string, SResult> *pmapBaseline);
+
+	// write the result of a minidump, compared to its baseline if given;
+	// return true if the minidump regressed
+	static BOOL FWriteResult(std::ofstream &ofs, const CHAR *szFileName,
+							 const SResult &result, const SResult *presultBase,
+							 ULONG ulThreshold);
+
+public:
+	// run the benchmark on the given minidumps, writing results to the
+	// output file; return GPOS_FAILED if any minidump regressed compared to
+	// the baseline, if one is given
+	static GPOS_RESULT EresRun(const CHAR *rgszFileNames[], ULONG ulFiles,
+							   ULONG ulIterations, const CHAR *szOutputFile,
+							   const CHAR *szBaselineFile, ULONG ulThreshold);
+
+};	// class CMinidumpBenchmark
+}  // namespace gpopt
+
+#endif	// !GPOPT_CMinidumpBenchmark_H
+
+// EOF
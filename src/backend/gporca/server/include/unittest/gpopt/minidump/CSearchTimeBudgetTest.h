@@ -0,0 +1,44 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CSearchTimeBudgetTest.h
+//
+//	@doc:
+//		Test for optimizing queries under a search time budget too small
+//		for the search strategy to complete
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CSearchTimeBudgetTest_H
+#define GPOPT_CSearchTimeBudgetTest_H
+
+#include "gpos/base.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CSearchTimeBudgetTest
+//
+//	@doc:
+//		Unittests
+//
+//---------------------------------------------------------------------------
+class CSearchTimeBudgetTest
+{
+private:
+	// counter used to mark last successful test
+	static gpos::ULONG m_ulSearchTimeBudgetTestCounter;
+
+public:
+	// unittests
+	static gpos::GPOS_RESULT EresUnittest();
+
+	static gpos::GPOS_RESULT EresUnittest_RunTests();
+
+};	// class CSearchTimeBudgetTest
+}  // namespace gpopt
+
+#endif	// !GPOPT_CSearchTimeBudgetTest_H
+
+// EOF
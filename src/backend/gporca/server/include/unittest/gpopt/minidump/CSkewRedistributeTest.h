@@ -0,0 +1,58 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CSkewRedistributeTest.h
+//
+//	@doc:
+//		Test for the skew-aware redistribution of hash join inputs
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CSkewRedistributeTest_H
+#define GPOPT_CSkewRedistributeTest_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/dxl/operators/CDXLPhysicalRedistributeMotion.h"
+
+namespace gpopt
+{
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CSkewRedistributeTest
+//
+//	@doc:
+//		Unittests
+//
+//---------------------------------------------------------------------------
+class CSkewRedistributeTest
+{
+private:
+	// counter used to mark last successful test
+	static gpos::ULONG m_ulSkewRedistributeTestCounter;
+
+	// first hash join of a plan, in depth-first order
+	static CDXLNode *PdxlnHashJoin(CDXLNode *dxlnode);
+
+	// routing of the hot keys of a hash join input
+	static EdxlSkewMode EskmInput(CDXLNode *dxlnode);
+
+	// is there a plain redistribution on the path from a node to a join
+	static BOOL FRedistributedAbove(CDXLNode *dxlnode, CDXLNode *pdxlnJoin,
+									BOOL fSeen);
+
+public:
+	// unittests
+	static gpos::GPOS_RESULT EresUnittest();
+
+	static gpos::GPOS_RESULT EresUnittest_RunTests();
+
+};	// class CSkewRedistributeTest
+}  // namespace gpopt
+
+#endif	// !GPOPT_CSkewRedistributeTest_H
+
+// EOF
@@ -31,10 +31,18 @@ private:
 	// counter used to mark last successful test
 	static ULONG m_ulTestCounter;
 
+	// check that each inner join of a join tree has exactly the given
+	// predicates that connect its two children, count the conjuncts
+	static void CheckInnerJoinPreds(CMemoryPool *mp, CExpression *pexpr,
+									CExpressionArray *pdrgpexprPred,
+									ULONG *pulConjuncts);
+
 public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_ExpandMinCard();
+	static GPOS_RESULT EresUnittest_ExpandDPv2();
+	static GPOS_RESULT EresUnittest_ExpandDPv2PrunedStats();
 	static GPOS_RESULT EresUnittest_RunTests();
 
 };	// class CJoinOrderTest
@@ -22,6 +22,7 @@
 #include "gpopt/minidump/CMinidumperUtils.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/xforms/CXformFactory.h"
+#include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/init.h"
 
 // test headers
@@ -83,12 +84,15 @@
 #include "unittest/gpopt/minidump/CICGTest.h"
 #include "unittest/gpopt/minidump/CJoinOrderDPTest.h"
 #include "unittest/gpopt/minidump/CMiniDumperDXLTest.h"
+#include "unittest/gpopt/minidump/CMinidumpBenchmark.h"
 #include "unittest/gpopt/minidump/CMinidumpWithConstExprEvaluatorTest.h"
 #include "unittest/gpopt/minidump/CMissingStatsTest.h"
 #include "unittest/gpopt/minidump/CMultilevelPartitionTest.h"
 #include "unittest/gpopt/minidump/CPhysicalParallelUnionAllTest.h"
 #include "unittest/gpopt/minidump/CPruneColumnsTest.h"
 #include "unittest/gpopt/minidump/CPullUpProjectElementTest.h"
+#include "unittest/gpopt/minidump/CSearchTimeBudgetTest.h"
+#include "unittest/gpopt/minidump/CSkewRedistributeTest.h"
 #include "unittest/gpopt/minidump/CSubqueryTest.h"
 #include "unittest/gpopt/minidump/CTVFTest.h"
 #include "unittest/gpopt/minidump/CWindowTest.h"
@@ -134,7 +138,9 @@ static gpos::CUnittest rgut[] = {
 	GPOS_UNITTEST_STD(CCollapseProjectTest),
 	GPOS_UNITTEST_STD(CPruneColumnsTest),
 	GPOS_UNITTEST_STD(CPhysicalParallelUnionAllTest),
-	GPOS_UNITTEST_STD(CMissingStatsTest), GPOS_UNITTEST_STD(CBitmapTest),
+	GPOS_UNITTEST_STD(CMissingStatsTest),
+	GPOS_UNITTEST_STD(CSearchTimeBudgetTest),
+	GPOS_UNITTEST_STD(CSkewRedistributeTest), GPOS_UNITTEST_STD(CBitmapTest),
 	GPOS_UNITTEST_STD(CCTETest), GPOS_UNITTEST_STD(CExternalTableTest),
 	GPOS_UNITTEST_STD(CEscapeMechanismTest),
 
@@ -261,6 +267,13 @@ PvExec(void *pv)
 	BOOL fPrintDXLPlan = false;
 	ULLONG ullPlanId = 0;
 
+	ULONG ulBenchmarkIterations = 0;
+	const CHAR *szBenchmarkOutput = "gporca_benchmark.csv";
+	const CHAR *szBenchmarkBaseline = nullptr;
+	ULONG ulBenchmarkThreshold = GPOPT_BENCHMARK_THRESHOLD;
+
+	const CHAR *szBinaryOutput = nullptr;
+
 	while (pma->Getopt(&ch))
 	{
 		CHAR *szTestName = nullptr;
@@ -299,6 +312,28 @@ PvExec(void *pv)
 				fPrintDXLPlan = true;
 				break;
 
+			case 'B':
+				szBinaryOutput = optarg;
+				break;
+
+			case 'b':
+				ulBenchmarkIterations =
+					(ULONG) clib::Strtol(optarg, nullptr, 10 /*base*/);
+				break;
+
+			case 'o':
+				szBenchmarkOutput = optarg;
+				break;
+
+			case 'c':
+				szBenchmarkBaseline = optarg;
+				break;
+
+			case 'r':
+				ulBenchmarkThreshold =
+					(ULONG) clib::Strtol(optarg, nullptr, 10 /*base*/);
+				break;
+
 			default:
 				// ignore other parameters
 				break;
@@ -312,7 +347,41 @@ PvExec(void *pv)
 		return nullptr;
 	}
 
-	if (fMinidump)
+	if (0 < ulBenchmarkIterations)
+	{
+		if (fMinidump || fUnittest)
+		{
+			GPOS_TRACE(GPOS_WSZ_LIT(
+				"Cannot specify -b and -d/-U/-u options at the same time"));
+			tests_failed = 1;
+			return nullptr;
+		}
+
+		// initialize DXL support
+		InitDXL();
+
+		CMDCache::Init();
+
+		// minidump files follow the options
+		const ULONG ulFiles = pma->Argc() - optind;
+		GPOS_RESULT eres = CMinidumpBenchmark::EresRun(
+			pma->Argv() + optind, ulFiles, ulBenchmarkIterations,
+			szBenchmarkOutput, szBenchmarkBaseline, ulBenchmarkThreshold);
+		tests_failed = (GPOS_OK == eres) ? 0 : 1;
+
+		CMDCache::Shutdown();
+	}
+	else if (fMinidump && nullptr != szBinaryOutput)
+	{
+		// initialize DXL support
+		InitDXL();
+
+		// convert the minidump to binary DXL instead of running it
+		CAutoMemoryPool amp;
+		CDXLUtils::SerializeDXLFileToBinary(amp.Pmp(), file_name,
+											szBinaryOutput);
+	}
+	else if (fMinidump)
 	{
 		// initialize DXL support
 		InitDXL();
@@ -404,7 +473,7 @@ main(INT iArgs, const CHAR **rgszArgs)
 	GPOS_ASSERT(iArgs >= 0);
 
 	// setup args for unittest params
-	CMainArgs ma(iArgs, rgszArgs, "uU:d:xT:i:p");
+	CMainArgs ma(iArgs, rgszArgs, "uU:d:xT:i:pB:b:o:c:r:");
 
 	// initialize unittest framework
 	CUnittest::Init(rgut, GPOS_ARRAY_SIZE(rgut), ConfigureTests, Cleanup);
@@ -15,6 +15,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRg.h"
 #include "gpos/common/CRandom.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
@@ -23,8 +24,12 @@
 
 #include "naucrates/base/CQueryToDXLResult.h"
 #include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/parser/CParseHandlerDXL.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/dxl/xml/dxlbinary.h"
+#include "naucrates/exception.h"
+#include "naucrates/md/IMDCacheObject.h"
 
 XERCES_CPP_NAMESPACE_USE
 
@@ -34,6 +39,8 @@ using namespace gpdxl;
 static const char *szQueryFile =
 	"../data/dxl/expressiontests/TableScanQuery.xml";
 static const char *szPlanFile = "../data/dxl/expressiontests/TableScanPlan.xml";
+static const char *szMinidumpFile =
+	"../data/dxl/minidump/AddEqualityPredicates.mdp";
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -50,6 +57,12 @@ CDXLUtilsTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_SerializeQuery),
 		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_SerializePlan),
 		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_Encoding),
+		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_BinaryPlan),
+		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_BinaryMinidump),
+		GPOS_UNITTEST_FUNC(CDXLUtilsTest::EresUnittest_BinaryMDObj),
+		GPOS_UNITTEST_FUNC_THROW(CDXLUtilsTest::EresUnittest_BinaryTruncated,
+								 gpdxl::ExmaDXL,
+								 gpdxl::ExmiDXLBinaryParseError),
 	};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -231,4 +244,203 @@ CDXLUtilsTest::EresUnittest_Encoding()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_BinaryPlan
+//
+//	@doc:
+//		Testing that a plan parsed from binary DXL serializes to the same
+//		DXL as the plan parsed from XML
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_BinaryPlan()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, szPlanFile));
+	ULONG size = 0;
+	CAutoRg<BYTE> binary_dxl(
+		CDXLUtils::SerializeDXLToBinary(mp, dxl_string.Rgt(), &size));
+	GPOS_UNITTEST_ASSERT(FBinaryDXL(binary_dxl.Rgt(), size));
+	GPOS_UNITTEST_ASSERT(size < clib::Strlen(dxl_string.Rgt()));
+
+	CAutoP<CParseHandlerDXL> parse_handler_xml(
+		CDXLUtils::GetParseHandlerForDXLString(mp, dxl_string.Rgt(),
+											   nullptr /*xsd_file_path*/));
+	CAutoP<CParseHandlerDXL> parse_handler_binary(
+		CDXLUtils::GetParseHandlerForDXLBinary(mp, binary_dxl.Rgt(), size));
+
+	CWStringDynamic str_xml(mp);
+	COstreamString oss_xml(&str_xml);
+	CDXLUtils::SerializePlan(mp, oss_xml, parse_handler_xml->PdxlnPlan(),
+							 parse_handler_xml->GetPlanId(),
+							 parse_handler_xml->GetPlanSpaceSize(),
+							 true /*serialize_header_footer*/,
+							 true /*indentation*/);
+
+	CWStringDynamic str_binary(mp);
+	COstreamString oss_binary(&str_binary);
+	CDXLUtils::SerializePlan(mp, oss_binary, parse_handler_binary->PdxlnPlan(),
+							 parse_handler_binary->GetPlanId(),
+							 parse_handler_binary->GetPlanSpaceSize(),
+							 true /*serialize_header_footer*/,
+							 true /*indentation*/);
+
+	GPOS_UNITTEST_ASSERT(str_xml.Equals(&str_binary));
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_BinaryMinidump
+//
+//	@doc:
+//		Testing that the query and metadata objects of a minidump parsed
+//		from binary DXL serialize to the same DXL as those parsed from XML
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_BinaryMinidump()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, szMinidumpFile));
+	ULONG size = 0;
+	CAutoRg<BYTE> binary_dxl(
+		CDXLUtils::SerializeDXLToBinary(mp, dxl_string.Rgt(), &size));
+
+	CAutoP<CParseHandlerDXL> parse_handler_xml(
+		CDXLUtils::GetParseHandlerForDXLString(mp, dxl_string.Rgt(),
+											   nullptr /*xsd_file_path*/));
+	CAutoP<CParseHandlerDXL> parse_handler_binary(
+		CDXLUtils::GetParseHandlerForDXLBinary(mp, binary_dxl.Rgt(), size));
+
+	CWStringDynamic str_xml(mp);
+	COstreamString oss_xml(&str_xml);
+	CDXLUtils::SerializeQuery(mp, oss_xml, parse_handler_xml->GetQueryDXLRoot(),
+							  parse_handler_xml->GetOutputColumnsDXLArray(),
+							  parse_handler_xml->GetCTEProducerDXLArray(),
+							  true /*serialize_document_header_footer*/,
+							  true /*indentation*/);
+
+	CWStringDynamic str_binary(mp);
+	COstreamString oss_binary(&str_binary);
+	CDXLUtils::SerializeQuery(
+		mp, oss_binary, parse_handler_binary->GetQueryDXLRoot(),
+		parse_handler_binary->GetOutputColumnsDXLArray(),
+		parse_handler_binary->GetCTEProducerDXLArray(),
+		true /*serialize_document_header_footer*/, true /*indentation*/);
+
+	GPOS_UNITTEST_ASSERT(str_xml.Equals(&str_binary));
+
+	IMDCacheObjectArray *md_objs_xml =
+		parse_handler_xml->GetMdIdCachedObjArray();
+	IMDCacheObjectArray *md_objs_binary =
+		parse_handler_binary->GetMdIdCachedObjArray();
+	GPOS_UNITTEST_ASSERT(0 < md_objs_xml->Size());
+	GPOS_UNITTEST_ASSERT(md_objs_xml->Size() == md_objs_binary->Size());
+
+	for (ULONG ul = 0; ul < md_objs_xml->Size(); ul++)
+	{
+		CAutoP<CWStringDynamic> md_str_xml(CDXLUtils::SerializeMDObj(
+			mp, (*md_objs_xml)[ul], true /*fSerializeHeaders*/,
+			false /*findent*/));
+		CAutoP<CWStringDynamic> md_str_binary(CDXLUtils::SerializeMDObj(
+			mp, (*md_objs_binary)[ul], true /*fSerializeHeaders*/,
+			false /*findent*/));
+
+		GPOS_UNITTEST_ASSERT(md_str_xml->Equals(md_str_binary.Value()));
+	}
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_BinaryMDObj
+//
+//	@doc:
+//		Testing that MD objects encoded into binary DXL directly give the
+//		same document as their XML text encoded through Xerces, and that
+//		the document decodes back to the same object
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_BinaryMDObj()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, szMinidumpFile));
+	CAutoP<CParseHandlerDXL> parse_handler(
+		CDXLUtils::GetParseHandlerForDXLString(mp, dxl_string.Rgt(),
+											   nullptr /*xsd_file_path*/));
+
+	IMDCacheObjectArray *md_objs = parse_handler->GetMdIdCachedObjArray();
+	GPOS_UNITTEST_ASSERT(0 < md_objs->Size());
+
+	for (ULONG ul = 0; ul < md_objs->Size(); ul++)
+	{
+		const IMDCacheObject *md_obj = (*md_objs)[ul];
+
+		CAutoP<CWStringDynamic> md_str(CDXLUtils::SerializeMDObj(
+			mp, md_obj, true /*fSerializeHeaders*/, false /*findent*/));
+		CAutoRg<CHAR> md_dxl(CDXLUtils::CreateMultiByteCharStringFromWCString(
+			mp, md_str->GetBuffer()));
+		ULONG size_xml = 0;
+		CAutoRg<BYTE> binary_dxl_xml(
+			CDXLUtils::SerializeDXLToBinary(mp, md_dxl.Rgt(), &size_xml));
+
+		ULONG size = 0;
+		CAutoRg<BYTE> binary_dxl(
+			CDXLUtils::SerializeMDObjToBinary(mp, md_obj, &size));
+
+		GPOS_UNITTEST_ASSERT(size == size_xml);
+		GPOS_UNITTEST_ASSERT(
+			0 == clib::Memcmp(binary_dxl.Rgt(), binary_dxl_xml.Rgt(), size));
+
+		IMDCacheObject *md_obj_binary =
+			CDXLUtils::ParseDXLBinaryToIMDIdCacheObj(mp, binary_dxl.Rgt(),
+													 size);
+		CAutoP<CWStringDynamic> md_str_binary(CDXLUtils::SerializeMDObj(
+			mp, md_obj_binary, true /*fSerializeHeaders*/, false /*findent*/));
+		md_obj_binary->Release();
+
+		GPOS_UNITTEST_ASSERT(md_str->Equals(md_str_binary.Value()));
+	}
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtilsTest::EresUnittest_BinaryTruncated
+//
+//	@doc:
+//		Parsing a truncated binary DXL document must raise an error
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLUtilsTest::EresUnittest_BinaryTruncated()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, szPlanFile));
+	ULONG size = 0;
+	CAutoRg<BYTE> binary_dxl(
+		CDXLUtils::SerializeDXLToBinary(mp, dxl_string.Rgt(), &size));
+
+	// drop the end of the document; this raises an exception
+	CAutoP<CParseHandlerDXL> parse_handler(
+		CDXLUtils::GetParseHandlerForDXLBinary(mp, binary_dxl.Rgt(),
+											   size - 1));
+
+	return GPOS_FAILED;
+}
+
 // EOF
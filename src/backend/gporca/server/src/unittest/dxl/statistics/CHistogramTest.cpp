@@ -22,6 +22,7 @@
 #include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/statistics/CHistogram.h"
+#include "naucrates/statistics/CHistogramBounds.h"
 #include "naucrates/statistics/CPoint.h"
 
 #include "unittest/base.h"
@@ -42,7 +43,8 @@ CHistogramTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramValid),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_MergeUnion),
 		GPOS_UNITTEST_FUNC(
-			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon)};
+			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon),
+		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_FlatBounds)};
 
 
 	CAutoMemoryPool amp;
@@ -431,4 +433,137 @@ CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon()
 
 	return GPOS_OK;
 }
+
+// do the flat bounds of the buckets agree with the buckets themselves
+BOOL
+CHistogramTest::FFlatBoundsMatchBuckets(CMemoryPool *mp,
+										const CBucketArray *buckets,
+										const CPointArray *points)
+{
+	CAutoP<CHistogramBounds> bounds(CHistogramBounds::Create(mp, buckets));
+	if (nullptr == bounds.Value() || !bounds->IsComparable(bounds.Value()))
+	{
+		return false;
+	}
+
+	const ULONG size = buckets->Size();
+	for (ULONG ul1 = 0; ul1 < size; ul1++)
+	{
+		CBucket *bucket1 = (*buckets)[ul1];
+		for (ULONG ul2 = 0; ul2 < size; ul2++)
+		{
+			CBucket *bucket2 = (*buckets)[ul2];
+
+			if (bucket1->Intersects(bucket2) !=
+					CHistogramBounds::Intersects(bounds.Value(), ul1,
+												 bounds.Value(), ul2) ||
+				bucket1->IsBefore(bucket2) !=
+					CHistogramBounds::IsBefore(bounds.Value(), ul1,
+											   bounds.Value(), ul2) ||
+				CBucket::CompareUpperBounds(bucket1, bucket2) !=
+					CHistogramBounds::CompareUpperBounds(bounds.Value(), ul1,
+														 bounds.Value(), ul2))
+			{
+				return false;
+			}
+		}
+	}
+
+	for (ULONG ul = 0; ul < points->Size(); ul++)
+	{
+		CPoint *point = (*points)[ul];
+
+		ULONG expected_idx = gpos::ulong_max;
+		for (ULONG idx = 0; idx < size; idx++)
+		{
+			if ((*buckets)[idx]->Contains(point))
+			{
+				expected_idx = idx;
+				break;
+			}
+		}
+
+		ULONG idx = 0;
+		if (!bounds->FindBucketContaining(point, &idx) || expected_idx != idx)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// the flat bounds must give the same answers as comparing buckets through
+// their datums, for all combinations of open and closed bounds
+GPOS_RESULT
+CHistogramTest::EresUnittest_FlatBounds()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// integer buckets, mapped to LINT
+	CBucketArray *int_buckets = GPOS_NEW(mp) CBucketArray(mp);
+	CPointArray *int_points = GPOS_NEW(mp) CPointArray(mp);
+	for (INT lower = 0; lower < 3; lower++)
+	{
+		for (INT upper = lower; upper < 3; upper++)
+		{
+			for (ULONG closed = 0; closed < 4; closed++)
+			{
+				BOOL is_lower_closed = (0 != (closed & 1));
+				BOOL is_upper_closed = (0 != (closed & 2));
+				if (lower == upper && !(is_lower_closed && is_upper_closed))
+				{
+					// singleton buckets are closed
+					continue;
+				}
+
+				int_buckets->Append(CCardinalityTestUtils::PbucketInteger(
+					mp, lower, upper, is_lower_closed, is_upper_closed,
+					CDouble(0.1), CDouble(1.0)));
+			}
+		}
+	}
+	for (INT value = -1; value < 4; value++)
+	{
+		int_points->Append(CTestUtils::PpointInt4(mp, value));
+	}
+
+	// double buckets, including bounds that differ by less than epsilon
+	const DOUBLE values[] = {0.0, 1.0, 1.0 + 0.000001, 2.0};
+	const ULONG num_values = GPOS_ARRAY_SIZE(values);
+	CBucketArray *double_buckets = GPOS_NEW(mp) CBucketArray(mp);
+	CPointArray *double_points = GPOS_NEW(mp) CPointArray(mp);
+	for (ULONG lower = 0; lower < num_values; lower++)
+	{
+		for (ULONG upper = lower; upper < num_values; upper++)
+		{
+			CPoint *lower_point = CCardinalityTestUtils::PpointDouble(
+				mp, GPDB_FLOAT8, CDouble(values[lower]));
+			CPoint *upper_point = CCardinalityTestUtils::PpointDouble(
+				mp, GPDB_FLOAT8, CDouble(values[upper]));
+			BOOL is_singleton = lower_point->Equals(upper_point);
+
+			double_buckets->Append(GPOS_NEW(mp) CBucket(
+				lower_point, upper_point, true /*is_lower_closed*/,
+				is_singleton /*is_upper_closed*/, CDouble(0.1), CDouble(1.0)));
+		}
+		double_points->Append(CCardinalityTestUtils::PpointDouble(
+			mp, GPDB_FLOAT8, CDouble(values[lower])));
+	}
+	double_points->Append(
+		CCardinalityTestUtils::PpointDouble(mp, GPDB_FLOAT8, CDouble(1.5)));
+
+	BOOL result = FFlatBoundsMatchBuckets(mp, int_buckets, int_points) &&
+				  FFlatBoundsMatchBuckets(mp, double_buckets, double_points);
+
+	int_buckets->Release();
+	int_points->Release();
+	double_buckets->Release();
+	double_points->Release();
+
+	return result ? GPOS_OK : GPOS_FAILED;
+}
+
 // EOF
@@ -34,7 +34,8 @@ GPOS_RESULT
 COrderSpecTest::EresUnittest()
 {
 	CUnittest rgut[] = {
-		GPOS_UNITTEST_FUNC(COrderSpecTest::EresUnittest_Basics)};
+		GPOS_UNITTEST_FUNC(COrderSpecTest::EresUnittest_Basics),
+		GPOS_UNITTEST_FUNC(COrderSpecTest::EresUnittest_Prefix)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
 }
@@ -133,5 +134,92 @@ COrderSpecTest::EresUnittest_Basics()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COrderSpecTest::EresUnittest_Prefix
+//
+//	@doc:
+//		Tests for the shared prefixes of order specs, as used to place
+//		incremental sorts
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COrderSpecTest::EresUnittest_Prefix()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// Setup an MD cache with a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, nullptr, /* pceeval */
+					 CTestUtils::GetCostModel(mp));
+
+	// get column factory from optimizer context object
+	CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
+
+	CWStringConst strName(GPOS_WSZ_LIT("Test Column"));
+	CName name(&strName);
+
+	const IMDTypeInt4 *pmdtypeint4 =
+		mda.PtMDType<IMDTypeInt4>(CTestUtils::m_sysidDefault);
+
+	CColRef *pcr1 =
+		col_factory->PcrCreate(pmdtypeint4, default_type_modifier, name);
+	CColRef *pcr2 =
+		col_factory->PcrCreate(pmdtypeint4, default_type_modifier, name);
+	CColRef *pcr3 =
+		col_factory->PcrCreate(pmdtypeint4, default_type_modifier, name);
+
+	IMDId *pmdidInt4LT = pmdtypeint4->GetMdidForCmpType(IMDType::EcmptL);
+
+	// (c1, c2, c3)
+	COrderSpec *pos1 = GPOS_NEW(mp) COrderSpec(mp);
+	pmdidInt4LT->AddRef();
+	pmdidInt4LT->AddRef();
+	pmdidInt4LT->AddRef();
+	pos1->Append(pmdidInt4LT, pcr1, COrderSpec::EntLast);
+	pos1->Append(pmdidInt4LT, pcr2, COrderSpec::EntLast);
+	pos1->Append(pmdidInt4LT, pcr3, COrderSpec::EntLast);
+
+	// (c1, c3)
+	COrderSpec *pos2 = GPOS_NEW(mp) COrderSpec(mp);
+	pmdidInt4LT->AddRef();
+	pmdidInt4LT->AddRef();
+	pos2->Append(pmdidInt4LT, pcr1, COrderSpec::EntLast);
+	pos2->Append(pmdidInt4LT, pcr3, COrderSpec::EntLast);
+
+	// (c1 nulls first)
+	COrderSpec *pos3 = GPOS_NEW(mp) COrderSpec(mp);
+	pmdidInt4LT->AddRef();
+	pos3->Append(pmdidInt4LT, pcr1, COrderSpec::EntFirst);
+
+	GPOS_UNITTEST_ASSERT(3 == pos1->UlMatchingPrefix(pos1));
+	GPOS_UNITTEST_ASSERT(1 == pos1->UlMatchingPrefix(pos2));
+	GPOS_UNITTEST_ASSERT(1 == pos2->UlMatchingPrefix(pos1));
+	GPOS_UNITTEST_ASSERT(0 == pos1->UlMatchingPrefix(pos3));
+
+	COrderSpec *posPrefix = pos1->PosPrefix(mp, 2);
+	GPOS_UNITTEST_ASSERT(2 == posPrefix->UlSortColumns());
+	GPOS_UNITTEST_ASSERT(pos1->FSatisfies(posPrefix));
+	GPOS_UNITTEST_ASSERT(!posPrefix->FSatisfies(pos1));
+	GPOS_UNITTEST_ASSERT(2 == posPrefix->UlMatchingPrefix(pos1));
+
+	COrderSpec *posEmpty = pos1->PosPrefix(mp, 0);
+	GPOS_UNITTEST_ASSERT(posEmpty->IsEmpty());
+	GPOS_UNITTEST_ASSERT(0 == posEmpty->UlMatchingPrefix(pos1));
+
+	pos1->Release();
+	pos2->Release();
+	pos3->Release();
+	posPrefix->Release();
+	posEmpty->Release();
+
+	return GPOS_OK;
+}
+
 
 // EOF
@@ -21,6 +21,7 @@
 #include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/search/CGroup.h"
 #include "gpopt/search/CGroupProxy.h"
+#include "gpopt/search/CMemo.h"
 
 #include "unittest/base.h"
 #include "unittest/gpopt/CSubqueryTestUtils.h"
@@ -41,6 +42,7 @@ CEngineTest::EresUnittest()
 {
 	CUnittest rgut[] = {
 		GPOS_UNITTEST_FUNC(EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(EresUnittest_MemoRehash),
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(EresUnittest_BuildMemo),
 		GPOS_UNITTEST_FUNC(EresUnittest_AppendStats),
@@ -117,6 +119,96 @@ CEngineTest::EresUnittest_Basic()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::EresUnittest_MemoRehash
+//
+//	@doc:
+//		Optimize a join and check the memo after its group merges: the
+//		cached hash value of every group expression must be the one
+//		computed from its operator and child groups, and no two group
+//		expressions with the same hash value may be duplicates that the
+//		rehash passes missed
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CEngineTest::EresUnittest_MemoRehash()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, nullptr, /* pceeval */
+					 CTestUtils::GetCostModel(mp));
+
+	CEngine eng(mp);
+
+	// generate n-ary join expression
+	CExpression *pexpr = CTestUtils::PexprLogicalNAryJoin(mp);
+
+	// generate query context
+	CQueryContext *pqc = CTestUtils::PqcGenerate(mp, pexpr);
+
+	// Initialize engine
+	eng.Init(pqc, nullptr /*search_stage_array*/);
+
+	// optimize query
+	eng.Optimize();
+
+	CMemo *pmemo = eng.Pmemo();
+	GPOS_UNITTEST_ASSERT(0 < pmemo->UlRehashPasses());
+
+	// collect the group expressions of all groups that were not merged
+	using GroupExpressionArray =
+		CDynamicPtrArray<CGroupExpression, CleanupNULL>;
+	GroupExpressionArray *pdrgpgexpr = GPOS_NEW(mp) GroupExpressionArray(mp);
+	for (ULONG id = 0; id < pmemo->UlpGroups(); id++)
+	{
+		CGroup *pgroup = pmemo->Pgroup(id);
+		if (nullptr == pgroup || pgroup->FDuplicateGroup())
+		{
+			continue;
+		}
+
+		CGroupProxy gp(pgroup);
+		CGroupExpression *pgexpr = gp.PgexprFirst();
+		while (nullptr != pgexpr)
+		{
+			GPOS_UNITTEST_ASSERT(pgexpr->HashValue() ==
+								 CGroupExpression::HashValue(
+									 pgexpr->Pop(), pgexpr->Pdrgpgroup()));
+			pdrgpgexpr->Append(pgexpr);
+			pgexpr = gp.PgexprNext(pgexpr);
+		}
+	}
+
+	for (ULONG ulFst = 0; ulFst < pdrgpgexpr->Size(); ulFst++)
+	{
+		CGroupExpression *pgexprFst = (*pdrgpgexpr)[ulFst];
+		for (ULONG ulSnd = ulFst + 1; ulSnd < pdrgpgexpr->Size(); ulSnd++)
+		{
+			CGroupExpression *pgexprSnd = (*pdrgpgexpr)[ulSnd];
+			GPOS_UNITTEST_ASSERT(
+				pgexprFst->HashValue() != pgexprSnd->HashValue() ||
+				!pgexprFst->Matches(pgexprSnd));
+		}
+		GPOS_CHECK_ABORT;
+	}
+
+	// clean up
+	pdrgpgexpr->Release();
+	pexpr->Release();
+	GPOS_DELETE(pqc);
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngineTest::EresOptimize
@@ -0,0 +1,335 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMinidumpBenchmark.cpp
+//
+//	@doc:
+//		Benchmark replaying minidumps through the optimizer
+//---------------------------------------------------------------------------
+#include "unittest/gpopt/minidump/CMinidumpBenchmark.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizer.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+
+#include "unittest/gpopt/CTestUtils.h"
+
+using namespace gpopt;
+
+// header of the benchmark output
+static const CHAR *szHeader =
+	"minidump,iterations,time_min_ms,time_avg_ms,peak_bytes,jobs,groups,"
+	"group_exprs,status";
+
+// additional columns of the benchmark output in baseline comparison mode
+static const CHAR *szHeaderBaseline =
+	",base_time_min_ms,time_change_pct,base_peak_bytes,peak_change_pct,"
+	"search_changed,regressed";
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::Run
+//
+//	@doc:
+//		Optimize the given minidump the given number of times; every
+//		optimization runs in a new memory pool, so that the peak size of the
+//		pool reflects a single optimization request
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::Run(const CHAR *szFileName, ULONG ulIterations,
+						SResult *presult)
+{
+	GPOS_ASSERT(0 < ulIterations);
+
+	GPOS_TRY
+	{
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+
+		CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, szFileName);
+		GPOS_CHECK_ABORT;
+
+		COptimizerConfig *optimizer_config = pdxlmd->GetOptimizerConfig();
+		if (nullptr == optimizer_config)
+		{
+			optimizer_config = COptimizerConfig::PoconfDefault(mp);
+		}
+		else
+		{
+			optimizer_config->AddRef();
+		}
+
+		const ULONG ulSegments = CTestUtils::UlSegments(optimizer_config);
+
+		DOUBLE dTimeTotal = 0.0;
+		for (ULONG ul = 0; ul < ulIterations; ul++)
+		{
+			CAutoMemoryPool ampIteration;
+			CMemoryPool *pmpIteration = ampIteration.Pmp();
+
+			SOptimizationStats stats;
+			CWallClock clock;
+			CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+				pmpIteration, pdxlmd, szFileName, ulSegments, 1 /*ulSessionId*/,
+				1 /*ulCmdId*/, optimizer_config, nullptr /*pceeval*/, &stats);
+			const DOUBLE dTime =
+				(DOUBLE) clock.ElapsedUS() / (DOUBLE) GPOS_USEC_IN_MSEC;
+			GPOS_CHECK_ABORT;
+
+			dTimeTotal += dTime;
+			if (0 == ul || dTime < presult->m_dTimeMin)
+			{
+				presult->m_dTimeMin = dTime;
+			}
+			presult->m_ullPeakBytes = std::max(
+				presult->m_ullPeakBytes, pmpIteration->PeakAllocatedSize());
+
+			// the search is deterministic, keep the last iteration's stats
+			presult->m_ullJobs = stats.m_ullJobs;
+			presult->m_ullGroups = stats.m_ullGroups;
+			presult->m_ullGroupExprs = stats.m_ullGroupExprs;
+
+			pdxlnPlan->Release();
+		}
+
+		presult->m_ulIterations = ulIterations;
+		presult->m_dTimeAvg = dTimeTotal / ulIterations;
+
+		optimizer_config->Release();
+		GPOS_DELETE(pdxlmd);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		*presult = SResult();
+		presult->m_fError = true;
+
+		GPOS_RESET_EX;
+	}
+	GPOS_CATCH_END;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::FLoadBaseline
+//
+//	@doc:
+//		Load the results of an earlier run, keyed by minidump name
+//
+//---------------------------------------------------------------------------
+BOOL
+CMinidumpBenchmark::FLoadBaseline(const CHAR *szBaselineFile,
+								  std::map<std::string, SResult> *pmapBaseline)
+{
+	std::ifstream ifs(szBaselineFile);
+	if (!ifs.is_open())
+	{
+		return false;
+	}
+
+	std::string strLine;
+
+	// skip header
+	if (!std::getline(ifs, strLine))
+	{
+		return false;
+	}
+
+	while (std::getline(ifs, strLine))
+	{
+		std::istringstream iss(strLine);
+		std::string strName;
+		std::string strField;
+		SResult result;
+
+		if (!std::getline(iss, strName, ','))
+		{
+			continue;
+		}
+
+		std::getline(iss, strField, ',');
+		result.m_ulIterations =
+			(ULONG) std::strtoul(strField.c_str(), nullptr, 10);
+		std::getline(iss, strField, ',');
+		result.m_dTimeMin = std::strtod(strField.c_str(), nullptr);
+		std::getline(iss, strField, ',');
+		result.m_dTimeAvg = std::strtod(strField.c_str(), nullptr);
+		std::getline(iss, strField, ',');
+		result.m_ullPeakBytes = std::strtoull(strField.c_str(), nullptr, 10);
+		std::getline(iss, strField, ',');
+		result.m_ullJobs = std::strtoull(strField.c_str(), nullptr, 10);
+		std::getline(iss, strField, ',');
+		result.m_ullGroups = std::strtoull(strField.c_str(), nullptr, 10);
+		std::getline(iss, strField, ',');
+		result.m_ullGroupExprs = std::strtoull(strField.c_str(), nullptr, 10);
+		std::getline(iss, strField, ',');
+		result.m_fError = ("ok" != strField);
+
+		(*pmapBaseline)[strName] = result;
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::FWriteResult
+//
+//	@doc:
+//		Write the result of a minidump, compared to its baseline if given;
+//		return true if the minidump regressed
+//
+//---------------------------------------------------------------------------
+BOOL
+CMinidumpBenchmark::FWriteResult(std::ofstream &ofs, const CHAR *szFileName,
+								 const SResult &result,
+								 const SResult *presultBase, ULONG ulThreshold)
+{
+	ofs << szFileName << "," << result.m_ulIterations << ","
+		<< result.m_dTimeMin << "," << result.m_dTimeAvg << ","
+		<< result.m_ullPeakBytes << "," << result.m_ullJobs << ","
+		<< result.m_ullGroups << "," << result.m_ullGroupExprs << ","
+		<< (result.m_fError ? "error" : "ok");
+
+	if (nullptr == presultBase)
+	{
+		ofs << std::endl;
+		return false;
+	}
+
+	// minidumps that failed in either run are only compared by status
+	if (result.m_fError || presultBase->m_fError)
+	{
+		const BOOL fRegressed = result.m_fError && !presultBase->m_fError;
+		ofs << ",,,,,0," << (fRegressed ? 1 : 0) << std::endl;
+		return fRegressed;
+	}
+
+	const DOUBLE dTimeChange =
+		0.0 < presultBase->m_dTimeMin
+			? 100.0 * (result.m_dTimeMin - presultBase->m_dTimeMin) /
+				  presultBase->m_dTimeMin
+			: 0.0;
+	const DOUBLE dPeakChange =
+		0 < presultBase->m_ullPeakBytes
+			? 100.0 *
+				  ((DOUBLE) result.m_ullPeakBytes -
+				   (DOUBLE) presultBase->m_ullPeakBytes) /
+				  (DOUBLE) presultBase->m_ullPeakBytes
+			: 0.0;
+
+	const BOOL fSearchChanged =
+		result.m_ullJobs != presultBase->m_ullJobs ||
+		result.m_ullGroups != presultBase->m_ullGroups ||
+		result.m_ullGroupExprs != presultBase->m_ullGroupExprs;
+
+	const BOOL fTimeRegressed =
+		dTimeChange > ulThreshold &&
+		result.m_dTimeMin - presultBase->m_dTimeMin >
+			GPOPT_BENCHMARK_MIN_TIME_DELTA_MS;
+	const BOOL fRegressed = fTimeRegressed || dPeakChange > ulThreshold;
+
+	ofs << "," << presultBase->m_dTimeMin << "," << dTimeChange << ","
+		<< presultBase->m_ullPeakBytes << "," << dPeakChange << ","
+		<< (fSearchChanged ? 1 : 0) << "," << (fRegressed ? 1 : 0)
+		<< std::endl;
+
+	return fRegressed;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::EresRun
+//
+//	@doc:
+//		Run the benchmark on the given minidumps
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMinidumpBenchmark::EresRun(const CHAR *rgszFileNames[], ULONG ulFiles,
+							ULONG ulIterations, const CHAR *szOutputFile,
+							const CHAR *szBaselineFile, ULONG ulThreshold)
+{
+	GPOS_ASSERT(nullptr != szOutputFile);
+
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	std::map<std::string, SResult> mapBaseline;
+	if (nullptr != szBaselineFile &&
+		!FLoadBaseline(szBaselineFile, &mapBaseline))
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Cannot read benchmark baseline " << szBaselineFile;
+		return GPOS_FAILED;
+	}
+
+	std::ofstream ofs(szOutputFile);
+	if (!ofs.is_open())
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Cannot write benchmark output " << szOutputFile;
+		return GPOS_FAILED;
+	}
+
+	ofs << szHeader << (nullptr != szBaselineFile ? szHeaderBaseline : "")
+		<< std::endl;
+
+	ULONG ulRegressions = 0;
+	ULONG ulErrors = 0;
+	for (ULONG ul = 0; ul < ulFiles; ul++)
+	{
+		SResult result;
+		Run(rgszFileNames[ul], ulIterations, &result);
+
+		const SResult *presultBase = nullptr;
+		if (nullptr != szBaselineFile)
+		{
+			auto it = mapBaseline.find(rgszFileNames[ul]);
+			if (it != mapBaseline.end())
+			{
+				presultBase = &it->second;
+			}
+		}
+
+		if (FWriteResult(ofs, rgszFileNames[ul], result, presultBase,
+						 ulThreshold))
+		{
+			ulRegressions++;
+		}
+
+		if (result.m_fError)
+		{
+			ulErrors++;
+		}
+	}
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Benchmarked " << ulFiles << " minidumps, " << ulErrors
+				<< " failed";
+		if (nullptr != szBaselineFile)
+		{
+			at.Os() << ", " << ulRegressions << " regressed by more than "
+					<< ulThreshold << "%";
+		}
+	}
+
+	return 0 == ulRegressions ? GPOS_OK : GPOS_FAILED;
+}
+
+// EOF
@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CSearchTimeBudgetTest.cpp
+//
+//	@doc:
+//		Test for optimizing queries under a search time budget too small
+//		for the search strategy to complete
+//---------------------------------------------------------------------------
+
+#include "unittest/gpopt/minidump/CSearchTimeBudgetTest.h"
+
+#include "gpos/base.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+#include "gpopt/engine/CCTEConfig.h"
+#include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/engine/CHint.h"
+#include "gpopt/engine/CStatisticsConfig.h"
+#include "gpopt/exception.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizer.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+
+#include "unittest/gpopt/CTestUtils.h"
+
+using namespace gpopt;
+
+ULONG CSearchTimeBudgetTest::m_ulSearchTimeBudgetTestCounter =
+	0;	// start from first test
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchTimeBudgetTest::EresUnittest
+//
+//	@doc:
+//		Unittest for search time budget
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSearchTimeBudgetTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(EresUnittest_RunTests),
+	};
+
+	GPOS_RESULT eres = CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+
+	// reset metadata cache
+	CMDCache::Reset();
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchTimeBudgetTest::EresUnittest_RunTests
+//
+//	@doc:
+//		Optimize join queries with a budget of 1ms; the budget cuts off the
+//		search, which must still produce a plan instead of raising
+//		ExmiNoPlanFound and falling back to the planner
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSearchTimeBudgetTest::EresUnittest_RunTests()
+{
+	const CHAR *rgszFileNames[] = {
+		"../data/dxl/minidump/LargeJoins.mdp",
+		"../data/dxl/minidump/SixWayDPv2.mdp",
+	};
+
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
+	CMemoryPool *mp = amp.Pmp();
+
+	GPOS_RESULT eres = GPOS_OK;
+	const ULONG ulTests = GPOS_ARRAY_SIZE(rgszFileNames);
+	for (ULONG ul = m_ulSearchTimeBudgetTestCounter;
+		 ((ul < ulTests) && (GPOS_OK == eres)); ul++)
+	{
+		ICostModel *pcm = CTestUtils::GetCostModel(mp);
+
+		CHint *phint = GPOS_NEW(mp) CHint(
+			gpos::int_max, /* join_arity_for_associativity_commutativity */
+			gpos::int_max, /* array_expansion_threshold */
+			JOIN_ORDER_DP_THRESHOLD,			 /*ulJoinOrderDPLimit*/
+			BROADCAST_THRESHOLD,				 /*broadcast_threshold*/
+			true,								 /* enforce_constraint_on_dml */
+			PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD, /* push_group_by_below_setop_threshold */
+			XFORM_BIND_THRESHOLD,				 /* xform_bind_threshold */
+			SKEW_FACTOR,						 /* skew_factor */
+			1,									 /* search_time_budget */
+			MEMOIZE_MEMORY_LIMIT				 /* memoize_memory_limit */
+		);
+
+		COptimizerConfig *optimizer_config = GPOS_NEW(mp) COptimizerConfig(
+			CEnumeratorConfig::GetEnumeratorCfg(mp, 0 /*plan_id*/),
+			CStatisticsConfig::PstatsconfDefault(mp),
+			CCTEConfig::PcteconfDefault(mp), pcm, phint,
+			nullptr /* pplanhint */, CWindowOids::GetWindowOids(mp));
+
+		CDXLMinidump *pdxlmd =
+			CMinidumperUtils::PdxlmdLoad(mp, rgszFileNames[ul]);
+
+		SOptimizationStats stats;
+		CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+			mp, pdxlmd, rgszFileNames[ul], GPOPT_TEST_SEGMENTS /*ulSegments*/,
+			1 /*ulSessionId*/, 1 /*ulCmdId*/, optimizer_config,
+			nullptr /*pceeval*/, &stats);
+
+		if (nullptr == pdxlnPlan ||
+			gpos::ulong_max == stats.m_ulCutoffSearchStage)
+		{
+			// for debug traces
+			CAutoTrace at(mp);
+			at.Os() << "Search of " << rgszFileNames[ul]
+					<< (nullptr == pdxlnPlan ? " produced no plan"
+											 : " was not cut off");
+			eres = GPOS_FAILED;
+		}
+
+		GPOS_CHECK_ABORT;
+		CRefCount::SafeRelease(pdxlnPlan);
+		GPOS_DELETE(pdxlmd);
+		optimizer_config->Release();
+
+		m_ulSearchTimeBudgetTestCounter++;
+	}
+
+	if (GPOS_OK == eres)
+	{
+		m_ulSearchTimeBudgetTestCounter = 0;
+	}
+
+	return eres;
+}
+
+// EOF
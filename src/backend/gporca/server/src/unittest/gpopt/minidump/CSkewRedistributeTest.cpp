@@ -0,0 +1,260 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CSkewRedistributeTest.cpp
+//
+//	@doc:
+//		Test for the skew-aware redistribution of hash join inputs
+//---------------------------------------------------------------------------
+
+#include "unittest/gpopt/minidump/CSkewRedistributeTest.h"
+
+#include "gpos/base.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+#include "gpopt/minidump/CDXLMinidump.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/dxl/operators/CDXLPhysicalHashJoin.h"
+
+#include "unittest/gpopt/CTestUtils.h"
+
+using namespace gpopt;
+
+ULONG CSkewRedistributeTest::m_ulSkewRedistributeTestCounter =
+	0;	// start from first test
+
+// a minidump and the routing expected for the hot keys of the inputs of
+// its hash join
+struct SSkewRedistributeTestCase
+{
+	const CHAR *szFileName;
+
+	EdxlSkewMode eskmOuter;
+
+	EdxlSkewMode eskmInner;
+
+	// may the optimizer swap the inputs of the join
+	BOOL fCommutative;
+
+	// does the plan above the join need its output hashed on the key
+	BOOL fColocatedAbove;
+};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSkewRedistributeTest::EresUnittest
+//
+//	@doc:
+//		Unittest for skew-aware redistribution
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSkewRedistributeTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(EresUnittest_RunTests),
+	};
+
+	GPOS_RESULT eres = CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+
+	// reset metadata cache
+	CMDCache::Reset();
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSkewRedistributeTest::PdxlnHashJoin
+//
+//	@doc:
+//		First hash join of a plan, in depth-first order
+//
+//---------------------------------------------------------------------------
+CDXLNode *
+CSkewRedistributeTest::PdxlnHashJoin(CDXLNode *dxlnode)
+{
+	if (EdxlopPhysicalHashJoin == dxlnode->GetOperator()->GetDXLOperator())
+	{
+		return dxlnode;
+	}
+
+	for (ULONG ul = 0; ul < dxlnode->Arity(); ul++)
+	{
+		CDXLNode *pdxlnJoin = PdxlnHashJoin((*dxlnode)[ul]);
+		if (nullptr != pdxlnJoin)
+		{
+			return pdxlnJoin;
+		}
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSkewRedistributeTest::EskmInput
+//
+//	@doc:
+//		Routing of the hot keys of a hash join input; inputs that are not
+//		redistributed have none
+//
+//---------------------------------------------------------------------------
+EdxlSkewMode
+CSkewRedistributeTest::EskmInput(CDXLNode *dxlnode)
+{
+	if (EdxlopPhysicalMotionRedistribute !=
+		dxlnode->GetOperator()->GetDXLOperator())
+	{
+		return EdxlskewNone;
+	}
+
+	return CDXLPhysicalRedistributeMotion::Cast(dxlnode->GetOperator())
+		->GetSkewMode();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSkewRedistributeTest::FRedistributedAbove
+//
+//	@doc:
+//		Is there a redistribute motion without hot keys on the path from the
+//		given node down to the join
+//
+//---------------------------------------------------------------------------
+BOOL
+CSkewRedistributeTest::FRedistributedAbove(CDXLNode *dxlnode,
+										   CDXLNode *pdxlnJoin, BOOL fSeen)
+{
+	if (dxlnode == pdxlnJoin)
+	{
+		return fSeen;
+	}
+
+	fSeen = fSeen || (EdxlopPhysicalMotionRedistribute ==
+						  dxlnode->GetOperator()->GetDXLOperator() &&
+					  EdxlskewNone == EskmInput(dxlnode));
+	for (ULONG ul = 0; ul < dxlnode->Arity(); ul++)
+	{
+		if (FRedistributedAbove((*dxlnode)[ul], pdxlnJoin, fSeen))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSkewRedistributeTest::EresUnittest_RunTests
+//
+//	@doc:
+//		Optimize joins on a key with a heavy hitter in one of the inputs and
+//		check which inputs of the hash join are spread and broadcast.
+//		The skew-aware pair of motions wins on cost for an inner join, and
+//		for a left join whose outer input is skewed; it is never requested
+//		if only the inner input of a left join is skewed. If the plan above
+//		the join needs the join output hashed on the key, the optimizer may
+//		either keep plain motions below the join or redistribute its output
+//		again, but not use the skewed output as it is
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSkewRedistributeTest::EresUnittest_RunTests()
+{
+	SSkewRedistributeTestCase rgtc[] = {
+		{"../data/dxl/minidump/SkewRedistribute-InnerJoin.mdp", EdxlskewSpread,
+		 EdxlskewBroadcast, true, false},
+		{"../data/dxl/minidump/SkewRedistribute-LOJ-OuterSpread.mdp",
+		 EdxlskewSpread, EdxlskewBroadcast, false, false},
+		{"../data/dxl/minidump/SkewRedistribute-LOJ-InnerSkewed.mdp",
+		 EdxlskewNone, EdxlskewNone, false, false},
+		{"../data/dxl/minidump/SkewRedistribute-NoColocation.mdp",
+		 EdxlskewNone, EdxlskewNone, true, true},
+	};
+
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
+	CMemoryPool *mp = amp.Pmp();
+
+	GPOS_RESULT eres = GPOS_OK;
+	const ULONG ulTests = GPOS_ARRAY_SIZE(rgtc);
+	for (ULONG ul = m_ulSkewRedistributeTestCounter;
+		 ((ul < ulTests) && (GPOS_OK == eres)); ul++)
+	{
+		const CHAR *szFileName = rgtc[ul].szFileName;
+		CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, szFileName);
+
+		// the minidump's config requests the skew-aware motions with its
+		// trace flag
+		COptimizerConfig *optimizer_config = pdxlmd->GetOptimizerConfig();
+		CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+			mp, pdxlmd, szFileName,
+			optimizer_config->GetCostModel()->UlHosts() /*ulSegments*/,
+			1 /*ulSessionId*/, 1 /*ulCmdId*/, optimizer_config,
+			nullptr /*pceeval*/);
+
+		CDXLNode *pdxlnJoin =
+			(nullptr == pdxlnPlan) ? nullptr : PdxlnHashJoin(pdxlnPlan);
+		if (nullptr == pdxlnJoin)
+		{
+			// for debug traces
+			CAutoTrace at(mp);
+			at.Os() << "Plan of " << szFileName << " has no hash join";
+			eres = GPOS_FAILED;
+		}
+		else
+		{
+			EdxlSkewMode eskmOuter =
+				EskmInput((*pdxlnJoin)[EdxlhjIndexHashLeft]);
+			EdxlSkewMode eskmInner =
+				EskmInput((*pdxlnJoin)[EdxlhjIndexHashRight]);
+			BOOL fMatch = eskmOuter == rgtc[ul].eskmOuter &&
+						  eskmInner == rgtc[ul].eskmInner;
+			if (!fMatch && rgtc[ul].fCommutative)
+			{
+				fMatch = eskmOuter == rgtc[ul].eskmInner &&
+						 eskmInner == rgtc[ul].eskmOuter;
+			}
+
+			if (!fMatch && rgtc[ul].fColocatedAbove &&
+				EdxlskewNone != eskmOuter && EdxlskewNone != eskmInner)
+			{
+				// a skew-aware join is only fine below a redistribution
+				fMatch = FRedistributedAbove(pdxlnPlan, pdxlnJoin,
+											 false /*fSeen*/);
+			}
+
+			if (!fMatch)
+			{
+				// for debug traces
+				CAutoTrace at(mp);
+				at.Os() << "Hash join inputs of " << szFileName
+						<< " have skew modes " << eskmOuter << " and "
+						<< eskmInner << ", expected " << rgtc[ul].eskmOuter
+						<< " and " << rgtc[ul].eskmInner;
+				eres = GPOS_FAILED;
+			}
+		}
+
+		GPOS_CHECK_ABORT;
+		CRefCount::SafeRelease(pdxlnPlan);
+		GPOS_DELETE(pdxlmd);
+
+		m_ulSkewRedistributeTestCounter++;
+	}
+
+	if (GPOS_OK == eres)
+	{
+		m_ulSkewRedistributeTestCounter = 0;
+	}
+
+	return eres;
+}
+
+// EOF
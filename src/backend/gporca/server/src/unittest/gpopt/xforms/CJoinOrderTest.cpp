@@ -16,10 +16,16 @@
 
 #include "gpopt/base/CQueryContext.h"
 #include "gpopt/base/CUtils.h"
+#include "gpopt/engine/CCTEConfig.h"
+#include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/engine/CHint.h"
+#include "gpopt/engine/CStatisticsConfig.h"
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/xforms/CJoinOrder.h"
+#include "gpopt/xforms/CJoinOrderDPv2.h"
 #include "gpopt/xforms/CJoinOrderMinCard.h"
 
 #include "unittest/base.h"
@@ -44,6 +50,8 @@ GPOS_RESULT
 CJoinOrderTest::EresUnittest()
 {
 	CUnittest rgut[] = {GPOS_UNITTEST_FUNC(EresUnittest_ExpandMinCard),
+						GPOS_UNITTEST_FUNC(EresUnittest_ExpandDPv2),
+						GPOS_UNITTEST_FUNC(EresUnittest_ExpandDPv2PrunedStats),
 						GPOS_UNITTEST_FUNC(EresUnittest_RunTests)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -135,6 +143,275 @@ CJoinOrderTest::EresUnittest_ExpandMinCard()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTest::CheckInnerJoinPreds
+//
+//	@doc:
+//		Check that every inner join of a join tree has exactly those of the
+//		given predicates that connect its two children, and count the
+//		conjuncts
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderTest::CheckInnerJoinPreds(CMemoryPool *mp, CExpression *pexpr,
+									CExpressionArray *pdrgpexprPred,
+									ULONG *pulConjuncts)
+{
+	if (COperator::EopLogicalInnerJoin != pexpr->Pop()->Eopid())
+	{
+		return;
+	}
+
+	CColRefSet *pcrsOuter = (*pexpr)[0]->DeriveOutputColumns();
+	CColRefSet *pcrsInner = (*pexpr)[1]->DeriveOutputColumns();
+
+	// predicates that no lower join can take
+	ULONG ulConnecting = 0;
+	for (ULONG ul = 0; ul < pdrgpexprPred->Size(); ul++)
+	{
+		CColRefSet *pcrsUsed = (*pdrgpexprPred)[ul]->DeriveUsedColumns();
+		if (!pcrsUsed->IsDisjoint(pcrsOuter) &&
+			!pcrsUsed->IsDisjoint(pcrsInner))
+		{
+			ulConnecting++;
+		}
+	}
+
+	ULONG ulConjuncts = 0;
+	CExpressionArray *pdrgpexprConjuncts =
+		CPredicateUtils::PdrgpexprConjuncts(mp, (*pexpr)[2]);
+	for (ULONG ul = 0; ul < pdrgpexprConjuncts->Size(); ul++)
+	{
+		CExpression *pexprConj = (*pdrgpexprConjuncts)[ul];
+		if (CUtils::FScalarConstTrue(pexprConj))
+		{
+			continue;
+		}
+
+		CColRefSet *pcrsUsed = pexprConj->DeriveUsedColumns();
+		GPOS_UNITTEST_ASSERT(!pcrsUsed->IsDisjoint(pcrsOuter));
+		GPOS_UNITTEST_ASSERT(!pcrsUsed->IsDisjoint(pcrsInner));
+		ulConjuncts++;
+	}
+	pdrgpexprConjuncts->Release();
+
+	GPOS_UNITTEST_ASSERT(ulConnecting == ulConjuncts);
+	*pulConjuncts += ulConjuncts;
+
+	CheckInnerJoinPreds(mp, (*pexpr)[0], pdrgpexprPred, pulConjuncts);
+	CheckInnerJoinPreds(mp, (*pexpr)[1], pdrgpexprPred, pulConjuncts);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTest::EresUnittest_ExpandDPv2
+//
+//	@doc:
+//		Expansion of a chain join with DPv2; every join of the alternatives
+//		gets exactly the predicates that connect its two children, so that
+//		no predicate is left over for a select on top
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CJoinOrderTest::EresUnittest_ExpandDPv2()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// array of relation names
+	CWStringConst rgscRel[] = {
+		GPOS_WSZ_LIT("Rel10"), GPOS_WSZ_LIT("Rel3"), GPOS_WSZ_LIT("Rel4"),
+		GPOS_WSZ_LIT("Rel6"),  GPOS_WSZ_LIT("Rel7"), GPOS_WSZ_LIT("Rel8"),
+	};
+
+	// array of relation IDs
+	ULONG rgulRel[] = {
+		GPOPT_TEST_REL_OID10, GPOPT_TEST_REL_OID3, GPOPT_TEST_REL_OID4,
+		GPOPT_TEST_REL_OID6,  GPOPT_TEST_REL_OID7, GPOPT_TEST_REL_OID8,
+	};
+
+	const ULONG ulRels = GPOS_ARRAY_SIZE(rgscRel);
+	GPOS_UNITTEST_ASSERT(GPOS_ARRAY_SIZE(rgulRel) == ulRels);
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	{
+		// install opt context in TLS
+		CAutoOptCtxt aoc(mp, &mda, nullptr, /* pceeval */
+						 CTestUtils::GetCostModel(mp));
+
+		CExpression *pexprNAryJoin = CTestUtils::PexprLogicalNAryJoin(
+			mp, rgscRel, rgulRel, ulRels, false /*fCrossProduct*/);
+
+		// derive stats on input expression
+		CExpressionHandle exprhdl(mp);
+		exprhdl.Attach(pexprNAryJoin);
+		exprhdl.DeriveStats(mp, mp, nullptr /*prprel*/, nullptr /*stats_ctxt*/);
+
+		CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+		for (ULONG ul = 0; ul < ulRels; ul++)
+		{
+			CExpression *pexprChild = (*pexprNAryJoin)[ul];
+			pexprChild->AddRef();
+			pdrgpexpr->Append(pexprChild);
+		}
+		CExpressionArray *pdrgpexprPred =
+			CPredicateUtils::PdrgpexprConjuncts(mp, (*pexprNAryJoin)[ulRels]);
+		const ULONG ulPreds = pdrgpexprPred->Size();
+		GPOS_UNITTEST_ASSERT(ulRels - 1 == ulPreds);
+		pdrgpexprPred->AddRef();
+
+		CJoinOrderDPv2 jodp(mp, pdrgpexpr, pdrgpexprPred,
+							GPOS_NEW(mp) CExpressionArray(mp),
+							nullptr /*childPredIndexes*/,
+							GPOS_NEW(mp) CColRefSet(mp) /*outerRefs*/);
+		jodp.PexprExpand();
+
+		ULONG ulAlternatives = 0;
+		CExpression *pexprResult = nullptr;
+		while (nullptr != (pexprResult = jodp.GetNextOfTopK()))
+		{
+			GPOS_UNITTEST_ASSERT(COperator::EopLogicalInnerJoin ==
+								 pexprResult->Pop()->Eopid());
+
+			ULONG ulConjuncts = 0;
+			CheckInnerJoinPreds(mp, pexprResult, pdrgpexprPred, &ulConjuncts);
+			GPOS_UNITTEST_ASSERT(ulPreds == ulConjuncts);
+
+			ulAlternatives++;
+			pexprResult->Release();
+		}
+		GPOS_UNITTEST_ASSERT(0 < ulAlternatives);
+
+		pexprNAryJoin->Release();
+		pdrgpexprPred->Release();
+	}
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTest::EresUnittest_ExpandDPv2PrunedStats
+//
+//	@doc:
+//		Expansion of a chain join with DPv2 and a DP limit of 2, so that
+//		every level keeps a single group. The first two atoms are not
+//		connected, their cross product is pruned from DP and must be
+//		re-created for the query join order, together with the groups of
+//		the greedy enumerations; those take the stats of the pruned groups
+//		instead of deriving them again
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CJoinOrderTest::EresUnittest_ExpandDPv2PrunedStats()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// array of relation names
+	CWStringConst rgscRel[] = {
+		GPOS_WSZ_LIT("Rel10"), GPOS_WSZ_LIT("Rel3"), GPOS_WSZ_LIT("Rel4"),
+		GPOS_WSZ_LIT("Rel6"),  GPOS_WSZ_LIT("Rel7"), GPOS_WSZ_LIT("Rel8"),
+	};
+
+	// array of relation IDs
+	ULONG rgulRel[] = {
+		GPOPT_TEST_REL_OID10, GPOPT_TEST_REL_OID3, GPOPT_TEST_REL_OID4,
+		GPOPT_TEST_REL_OID6,  GPOPT_TEST_REL_OID7, GPOPT_TEST_REL_OID8,
+	};
+
+	// order of the atoms, the chain is Rel10 - Rel3 - Rel4 - ...
+	ULONG rgulAtom[] = {0, 2, 1, 3, 4, 5};
+
+	const ULONG ulRels = GPOS_ARRAY_SIZE(rgscRel);
+	GPOS_UNITTEST_ASSERT(GPOS_ARRAY_SIZE(rgulRel) == ulRels);
+	GPOS_UNITTEST_ASSERT(GPOS_ARRAY_SIZE(rgulAtom) == ulRels);
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	CHint *phint = GPOS_NEW(mp) CHint(
+		gpos::int_max, /* join_arity_for_associativity_commutativity */
+		gpos::int_max, /* array_expansion_threshold */
+		2,									 /*ulJoinOrderDPLimit*/
+		BROADCAST_THRESHOLD,				 /*broadcast_threshold*/
+		true,								 /* enforce_constraint_on_dml */
+		PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD, /* push_group_by_below_setop_threshold */
+		XFORM_BIND_THRESHOLD,				 /* xform_bind_threshold */
+		SKEW_FACTOR,						 /* skew_factor */
+		SEARCH_TIME_BUDGET,					 /* search_time_budget */
+		MEMOIZE_MEMORY_LIMIT				 /* memoize_memory_limit */
+	);
+
+	COptimizerConfig *optimizer_config = GPOS_NEW(mp) COptimizerConfig(
+		CEnumeratorConfig::GetEnumeratorCfg(mp, 0 /*plan_id*/),
+		CStatisticsConfig::PstatsconfDefault(mp),
+		CCTEConfig::PcteconfDefault(mp), CTestUtils::GetCostModel(mp), phint,
+		nullptr /* pplanhint */, CWindowOids::GetWindowOids(mp));
+
+	{
+		// install opt context in TLS
+		CAutoOptCtxt aoc(mp, &mda, nullptr, /* pceeval */
+						 optimizer_config);
+
+		CExpression *pexprNAryJoin = CTestUtils::PexprLogicalNAryJoin(
+			mp, rgscRel, rgulRel, ulRels, false /*fCrossProduct*/);
+
+		// derive stats on input expression
+		CExpressionHandle exprhdl(mp);
+		exprhdl.Attach(pexprNAryJoin);
+		exprhdl.DeriveStats(mp, mp, nullptr /*prprel*/, nullptr /*stats_ctxt*/);
+
+		CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+		for (ULONG ul = 0; ul < ulRels; ul++)
+		{
+			CExpression *pexprChild = (*pexprNAryJoin)[rgulAtom[ul]];
+			pexprChild->AddRef();
+			pdrgpexpr->Append(pexprChild);
+		}
+		CExpressionArray *pdrgpexprPred =
+			CPredicateUtils::PdrgpexprConjuncts(mp, (*pexprNAryJoin)[ulRels]);
+		const ULONG ulPreds = pdrgpexprPred->Size();
+		pdrgpexprPred->AddRef();
+
+		CJoinOrderDPv2 jodp(mp, pdrgpexpr, pdrgpexprPred,
+							GPOS_NEW(mp) CExpressionArray(mp),
+							nullptr /*childPredIndexes*/,
+							GPOS_NEW(mp) CColRefSet(mp) /*outerRefs*/);
+		jodp.PexprExpand();
+		GPOS_UNITTEST_ASSERT(0 < jodp.NumReusedPrunedStats());
+
+		// the alternatives built on reused stats are still valid join trees
+		ULONG ulAlternatives = 0;
+		CExpression *pexprResult = nullptr;
+		while (nullptr != (pexprResult = jodp.GetNextOfTopK()))
+		{
+			ULONG ulConjuncts = 0;
+			CheckInnerJoinPreds(mp, pexprResult, pdrgpexprPred, &ulConjuncts);
+			GPOS_UNITTEST_ASSERT(ulPreds == ulConjuncts);
+
+			ulAlternatives++;
+			pexprResult->Release();
+		}
+		GPOS_UNITTEST_ASSERT(0 < ulAlternatives);
+
+		pexprNAryJoin->Release();
+		pdrgpexprPred->Release();
+	}
+
+	return GPOS_OK;
+}
+
 //	run all Minidump-based tests with plan matching
 GPOS_RESULT
 CJoinOrderTest::EresUnittest_RunTests()
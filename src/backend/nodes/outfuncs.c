@@ -339,6 +339,9 @@ _outPlannedStmt(StringInfo str, const PlannedStmt *node)
 
 	WRITE_ENUM_FIELD(commandType, CmdType);
 	WRITE_ENUM_FIELD(planGen, PlanGenerator);
+	WRITE_INT_FIELD(optimizerCutoffStage);
+	WRITE_BOOL_FIELD(optimizerFastPath);
+	WRITE_BOOL_FIELD(optimizerPlanCacheHit);
 	WRITE_UINT64_FIELD(queryId);
 	WRITE_BOOL_FIELD(hasReturning);
 	WRITE_BOOL_FIELD(hasModifyingCTE);
@@ -1155,6 +1158,22 @@ _outMaterial(StringInfo str, const Material *node)
 	WRITE_BOOL_FIELD(cdb_shield_child_from_rescans);
 }
 
+static void
+_outMemoize(StringInfo str, const Memoize *node)
+{
+	WRITE_NODE_TYPE("MEMOIZE");
+
+	_outPlanInfo(str, (const Plan *) node);
+
+	WRITE_INT_FIELD(numKeys);
+	WRITE_OID_ARRAY(hashOperators, node->numKeys);
+	WRITE_OID_ARRAY(collations, node->numKeys);
+	WRITE_NODE_FIELD(param_exprs);
+	WRITE_BOOL_FIELD(singlerow);
+	WRITE_UINT_FIELD(est_entries);
+	WRITE_BITMAPSET_FIELD(keyparamids);
+}
+
 static void
 _outShareInputScan(StringInfo str, const ShareInputScan *node)
 {
@@ -1184,6 +1203,21 @@ _outSort(StringInfo str, const Sort *node)
     WRITE_BOOL_ARRAY(nullsFirst, node->numCols);
 }
 
+static void
+_outIncrementalSort(StringInfo str, const IncrementalSort *node)
+{
+	WRITE_NODE_TYPE("INCREMENTALSORT");
+
+	_outPlanInfo(str, (const Plan *) node);
+
+	WRITE_INT_FIELD(sort.numCols);
+	WRITE_ATTRNUMBER_ARRAY(sort.sortColIdx, node->sort.numCols);
+	WRITE_OID_ARRAY(sort.sortOperators, node->sort.numCols);
+	WRITE_OID_ARRAY(sort.collations, node->sort.numCols);
+	WRITE_BOOL_ARRAY(sort.nullsFirst, node->sort.numCols);
+	WRITE_INT_FIELD(nPresortedCols);
+}
+
 static void
 _outUnique(StringInfo str, const Unique *node)
 {
@@ -1355,6 +1389,8 @@ _outMotion(StringInfo str, const Motion *node)
 	WRITE_INT_FIELD(segidColIdx);
 
 	WRITE_INT_FIELD(numHashSegments);
+	WRITE_ENUM_FIELD(skewMode, MotionSkewMode);
+	WRITE_NODE_FIELD(skewHotKeys);
 
 	/* senderSliceInfo is intentionally omitted. It's only used during planning */
 
@@ -5672,12 +5708,18 @@ outNode(StringInfo str, const void *obj)
 			case T_Material:
 				_outMaterial(str, obj);
 				break;
+			case T_Memoize:
+				_outMemoize(str, obj);
+				break;
 			case T_ShareInputScan:
 				_outShareInputScan(str, obj);
 				break;
 			case T_Sort:
 				_outSort(str, obj);
 				break;
+			case T_IncrementalSort:
+				_outIncrementalSort(str, obj);
+				break;
 			case T_Unique:
 				_outUnique(str, obj);
 				break;
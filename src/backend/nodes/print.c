@@ -557,8 +557,12 @@ plannode_type(Plan *p)
 			return "SHAREINPUTSCAN";
 		case T_Material:
 			return "MATERIAL";
+		case T_Memoize:
+			return "MEMOIZE";
 		case T_Sort:
 			return "SORT";
+		case T_IncrementalSort:
+			return "INCREMENTALSORT";
 		case T_Agg:
 			return "AGG";
 		case T_TupleSplit:
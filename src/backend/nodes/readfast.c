@@ -1061,6 +1061,8 @@ _readMotion(void)
 
 	READ_INT_FIELD(segidColIdx);
 	READ_INT_FIELD(numHashSegments);
+	READ_ENUM_FIELD(skewMode, MotionSkewMode);
+	READ_NODE_FIELD(skewHotKeys);
 
 	ReadCommonPlan(&local_node->plan);
 
@@ -1858,12 +1860,18 @@ readNodeBinary(void)
 			case T_Material:
 				return_value = _readMaterial();
 				break;
+			case T_Memoize:
+				return_value = _readMemoize();
+				break;
 			case T_ShareInputScan:
 				return_value = _readShareInputScan();
 				break;
 			case T_Sort:
 				return_value = _readSort();
 				break;
+			case T_IncrementalSort:
+				return_value = _readIncrementalSort();
+				break;
 			case T_Unique:
 				return_value = _readUnique();
 				break;
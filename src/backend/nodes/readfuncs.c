@@ -2409,6 +2409,9 @@ _readPlannedStmt(void)
 
 	READ_ENUM_FIELD(commandType, CmdType);
 	READ_ENUM_FIELD(planGen, PlanGenerator);
+	READ_INT_FIELD(optimizerCutoffStage);
+	READ_BOOL_FIELD(optimizerFastPath);
+	READ_BOOL_FIELD(optimizerPlanCacheHit);
 	READ_UINT64_FIELD(queryId);
 	READ_BOOL_FIELD(hasReturning);
 	READ_BOOL_FIELD(hasModifyingCTE);
@@ -3214,6 +3217,27 @@ _readMaterial(void)
 	READ_DONE();
 }
 
+/*
+ * _readMemoize
+ */
+static Memoize *
+_readMemoize(void)
+{
+	READ_LOCALS(Memoize);
+
+	ReadCommonPlan(&local_node->plan);
+
+	READ_INT_FIELD(numKeys);
+	READ_OID_ARRAY(hashOperators, local_node->numKeys);
+	READ_OID_ARRAY(collations, local_node->numKeys);
+	READ_NODE_FIELD(param_exprs);
+	READ_BOOL_FIELD(singlerow);
+	READ_UINT_FIELD(est_entries);
+	READ_BITMAPSET_FIELD(keyparamids);
+
+	READ_DONE();
+}
+
 /*
  * _readSort
  */
@@ -3233,6 +3257,26 @@ _readSort(void)
 	READ_DONE();
 }
 
+/*
+ * _readIncrementalSort
+ */
+static IncrementalSort *
+_readIncrementalSort(void)
+{
+	READ_LOCALS(IncrementalSort);
+
+	ReadCommonPlan(&local_node->sort.plan);
+
+	READ_INT_FIELD(sort.numCols);
+	READ_ATTRNUMBER_ARRAY(sort.sortColIdx, local_node->sort.numCols);
+	READ_OID_ARRAY(sort.sortOperators, local_node->sort.numCols);
+	READ_OID_ARRAY(sort.collations, local_node->sort.numCols);
+	READ_BOOL_ARRAY(sort.nullsFirst, local_node->sort.numCols);
+	READ_INT_FIELD(nPresortedCols);
+
+	READ_DONE();
+}
+
 /*
  * _readAgg
  */
@@ -4678,8 +4722,12 @@ parseNodeString(void)
 		return_value = _readHashJoin();
 	else if (MATCH("MATERIAL", 8))
 		return_value = _readMaterial();
+	else if (MATCH("MEMOIZE", 7))
+		return_value = _readMemoize();
 	else if (MATCH("SORT", 4))
 		return_value = _readSort();
+	else if (MATCH("INCREMENTALSORT", 15))
+		return_value = _readIncrementalSort();
 	else if (MATCH("AGG", 3))
 		return_value = _readAgg();
 	else if (MATCH("TupleSplit", 10))
@@ -42,10 +42,12 @@
 #include "optimizer/restrictinfo.h"
 #include "optimizer/subselect.h"
 #include "optimizer/tlist.h"
+#include "optimizer/walkers.h"
 #include "parser/parse_clause.h"
 #include "parser/parsetree.h"
 #include "partitioning/partprune.h"
 #include "utils/lsyscache.h"
+#include "utils/typcache.h"
 #include "utils/uri.h"
 
 #include "cdb/cdbhash.h"
@@ -7290,6 +7292,109 @@ make_material(Plan *lefttree)
 	return node;
 }
 
+/*
+ * memoize_unsafe_walker
+ *	  Might rescanning the plan with the same param values return different
+ *	  rows?  It might if it contains volatile functions.  SubPlans are
+ *	  treated the same way, as we don't look into their plans.
+ */
+static bool
+memoize_unsafe_walker(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+
+	if (is_plan_node(node))
+		return plan_tree_walker(node, memoize_unsafe_walker, context, false);
+
+	return contain_volatile_functions(node) || contain_subplans(node);
+}
+
+/*
+ * make_memoize_for_params: stick a Memoize node atop a completed plan that
+ * is rescanned with new values of the PARAM_EXEC params in param_exprs, such
+ * as the inner side of a parameterized nestloop or the plan of a correlated
+ * SubPlan.  'calls' is the expected number of rescans, 0 if unknown.
+ *
+ * Returns NULL if the params can't be hashed, or if the plan isn't known to
+ * return the same rows for the same param values.
+ */
+Memoize *
+make_memoize_for_params(Plan *lefttree, List *param_exprs, double calls)
+{
+	Memoize    *node;
+	Plan	   *plan;
+	int			numKeys = list_length(param_exprs);
+	Oid		   *hashOperators;
+	Oid		   *collations;
+	Bitmapset  *keyparamids = NULL;
+	List	   *tlist = NIL;
+	ListCell   *lc;
+	int			i = 0;
+
+	if (numKeys == 0 || memoize_unsafe_walker((Node *) lefttree, NULL))
+		return NULL;
+
+	hashOperators = (Oid *) palloc(numKeys * sizeof(Oid));
+	collations = (Oid *) palloc(numKeys * sizeof(Oid));
+
+	foreach(lc, param_exprs)
+	{
+		Param	   *param = lfirst_node(Param, lc);
+		TypeCacheEntry *typentry;
+		Oid			left_hashfn;
+		Oid			right_hashfn;
+
+		Assert(param->paramkind == PARAM_EXEC);
+
+		typentry = lookup_type_cache(param->paramtype, TYPECACHE_EQ_OPR);
+		if (!OidIsValid(typentry->eq_opr) ||
+			!get_op_hash_functions(typentry->eq_opr, &left_hashfn, &right_hashfn))
+			return NULL;
+
+		hashOperators[i] = typentry->eq_opr;
+		collations[i] = param->paramcollid;
+		keyparamids = bms_add_member(keyparamids, param->paramid);
+		i++;
+	}
+
+	/* Memoize doesn't project; pass the subplan's columns through */
+	foreach(lc, lefttree->targetlist)
+	{
+		TargetEntry *tle = (TargetEntry *) lfirst(lc);
+		TargetEntry *newtle = flatCopyTargetEntry(tle);
+
+		newtle->expr = (Expr *) makeVarFromTargetEntry(OUTER_VAR, tle);
+		tlist = lappend(tlist, newtle);
+	}
+
+	node = makeNode(Memoize);
+	plan = &node->plan;
+
+	copy_plan_costsize(plan, lefttree);
+	plan->targetlist = tlist;
+	plan->qual = NIL;
+	plan->lefttree = lefttree;
+	plan->righttree = NULL;
+	plan->extParam = bms_copy(lefttree->extParam);
+	plan->allParam = bms_copy(lefttree->allParam);
+
+	node->numKeys = numKeys;
+	node->hashOperators = hashOperators;
+	node->collations = collations;
+	node->param_exprs = param_exprs;
+	node->singlerow = false;
+	node->keyparamids = keyparamids;
+
+	/*
+	 * Only sizes the initial hash table, which grows as needed; 0 leaves it
+	 * to the executor when the number of rescans is unknown.
+	 */
+	node->est_entries = calls > 0 ? (uint32) Min(ceil(calls), 1024.0) : 0;
+
+	return node;
+}
+
 /*
  * materialize_finished_plan: stick a Material node atop a completed plan
  *
@@ -21,6 +21,9 @@
 
 #include "postgres.h"
 
+#include "catalog/gp_distribution_policy.h"
+#include "catalog/pg_class.h"
+#include "catalog/pg_inherits.h"
 #include "cdb/cdbmutate.h"		/* apply_shareinput */
 #include "cdb/cdbplan.h"
 #include "cdb/cdbvars.h"
@@ -47,6 +50,8 @@ static Plan *remove_redundant_results(PlannerInfo *root, Plan *plan);
 static Node *remove_redundant_results_mutator(Node *node, void *);
 static bool can_replace_tlist(Plan *plan);
 static Node *push_down_expr_mutator(Node *node, List *child_tlist);
+static Var *fast_path_column(Node *node);
+static bool fast_path_value(Node *node, ParamListInfo boundParams);
 
 /*
  * Logging of optimization outcome
@@ -281,6 +286,207 @@ optimize_query(Query *parse, int cursorOptions, ParamListInfo boundParams)
 	return result;
 }
 
+/*
+ * orca_fast_path_query
+ *		Is the query trivial enough to be left to the Postgres planner?
+ *
+ * For OLTP-style statements, translating the query to DXL and setting up
+ * the GPORCA search takes far longer than executing the plan.  The queries
+ * accepted here have a single obvious plan, a scan or an insert dispatched
+ * directly to one segment, which the Postgres planner finds in a fraction
+ * of the time:
+ *
+ * - a SELECT from a single hash-distributed table, without aggregation,
+ *   sorting, sublinks or row locking, whose WHERE clause is a conjunction
+ *   of comparisons between columns and constants or parameters, and that
+ *   pins every distribution key column with an equality on a constant;
+ * - a single-row INSERT into a hash-distributed table that assigns a
+ *   constant to every distribution key column.
+ *
+ * A parameter counts as a constant if its value is known, that is when
+ * planning a custom plan for a prepared statement.
+ */
+bool
+orca_fast_path_query(Query *parse, ParamListInfo boundParams)
+{
+	RangeTblEntry *rte;
+	GpPolicy   *policy;
+	bool	   *pinned;
+	ListCell   *lc;
+	int			i;
+
+	if (parse->utilityStmt != NULL ||
+		parse->hasAggs ||
+		parse->hasWindowFuncs ||
+		parse->hasTargetSRFs ||
+		parse->hasSubLinks ||
+		parse->hasDynamicFunctions ||
+		parse->hasFuncsWithExecRestrictions ||
+		parse->hasDistinctOn ||
+		parse->hasRecursive ||
+		parse->hasModifyingCTE ||
+		parse->hasForUpdate ||
+		parse->hasRowSecurity ||
+		parse->cteList != NIL ||
+		parse->onConflict != NULL ||
+		parse->groupClause != NIL ||
+		parse->groupingSets != NIL ||
+		parse->havingQual != NULL ||
+		parse->windowClause != NIL ||
+		parse->distinctClause != NIL ||
+		parse->sortClause != NIL ||
+		parse->scatterClause != NIL ||
+		parse->isTableValueSelect ||
+		parse->limitOffset != NULL ||
+		parse->limitCount != NULL ||
+		parse->rowMarks != NIL ||
+		parse->setOperations != NULL ||
+		parse->withCheckOptions != NIL ||
+		parse->parentStmtType != PARENTSTMTTYPE_NONE ||
+		list_length(parse->rtable) != 1)
+		return false;
+
+	rte = linitial_node(RangeTblEntry, parse->rtable);
+	if (rte->rtekind != RTE_RELATION ||
+		rte->relkind != RELKIND_RELATION ||
+		rte->tablesample != NULL ||
+		(rte->inh && has_subclass(rte->relid)))
+		return false;
+
+	policy = GpPolicyFetch(rte->relid);
+	if (!GpPolicyIsHashPartitioned(policy) || policy->nattrs == 0)
+		return false;
+
+	/* distribution key columns pinned to a single value */
+	pinned = (bool *) palloc0(policy->nattrs * sizeof(bool));
+
+	if (parse->commandType == CMD_SELECT)
+	{
+		List	   *quals;
+
+		if (parse->resultRelation != 0 ||
+			list_length(parse->jointree->fromlist) != 1 ||
+			!IsA(linitial(parse->jointree->fromlist), RangeTblRef))
+			return false;
+
+		quals = make_ands_implicit((Expr *) parse->jointree->quals);
+		foreach(lc, quals)
+		{
+			Node	   *qual = (Node *) lfirst(lc);
+			OpExpr	   *opexpr;
+			Var		   *var;
+			Node	   *other;
+
+			if (IsA(qual, NullTest) &&
+				fast_path_column((Node *) ((NullTest *) qual)->arg) != NULL)
+				continue;
+
+			if (!IsA(qual, OpExpr) || list_length(((OpExpr *) qual)->args) != 2)
+				return false;
+
+			opexpr = (OpExpr *) qual;
+			var = fast_path_column(linitial(opexpr->args));
+			other = lsecond(opexpr->args);
+			if (var == NULL)
+			{
+				var = fast_path_column(lsecond(opexpr->args));
+				other = linitial(opexpr->args);
+			}
+			if (var == NULL || !(IsA(other, Const) || IsA(other, Param)))
+				return false;
+
+			/*
+			 * The operators of a hash opfamily are equalities, so this picks
+			 * out "key = value" comparisons that direct dispatch can use.
+			 */
+			if (!fast_path_value(other, boundParams))
+				continue;
+			for (i = 0; i < policy->nattrs; i++)
+			{
+				if (var->varattno == policy->attrs[i] &&
+					op_in_opfamily(opexpr->opno,
+								   get_opclass_family(policy->opclasses[i])))
+					pinned[i] = true;
+			}
+		}
+	}
+	else if (parse->commandType == CMD_INSERT)
+	{
+		if (parse->resultRelation != 1 ||
+			parse->jointree->fromlist != NIL)
+			return false;
+
+		foreach(lc, parse->targetList)
+		{
+			TargetEntry *tle = lfirst_node(TargetEntry, lc);
+
+			if (tle->resjunk || !fast_path_value((Node *) tle->expr, boundParams))
+				continue;
+			for (i = 0; i < policy->nattrs; i++)
+			{
+				if (tle->resno == policy->attrs[i])
+					pinned[i] = true;
+			}
+		}
+	}
+	else
+		return false;
+
+	for (i = 0; i < policy->nattrs; i++)
+	{
+		if (!pinned[i])
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Return the column of the relation of a fast path query that the
+ * expression refers to, looking through binary-compatible casts, or NULL if
+ * it is not a plain column reference.
+ */
+static Var *
+fast_path_column(Node *node)
+{
+	Var		   *var;
+
+	while (node != NULL && IsA(node, RelabelType))
+		node = (Node *) ((RelabelType *) node)->arg;
+
+	if (node == NULL || !IsA(node, Var))
+		return NULL;
+
+	var = (Var *) node;
+	if (var->varno != 1 || var->varlevelsup != 0 || var->varattno <= 0)
+		return NULL;
+
+	return var;
+}
+
+/*
+ * Does the expression have a single, known value at planning time, so that
+ * the planner can use it to direct dispatch?
+ */
+static bool
+fast_path_value(Node *node, ParamListInfo boundParams)
+{
+	if (IsA(node, Const))
+		return !((Const *) node)->constisnull;
+
+	if (IsA(node, Param))
+	{
+		Param	   *param = (Param *) node;
+
+		return param->paramkind == PARAM_EXTERN &&
+			boundParams != NULL &&
+			param->paramid > 0 &&
+			param->paramid <= boundParams->numParams;
+	}
+
+	return false;
+}
+
 /*
  * ORCA tends to generate gratuitous Result nodes for various reasons. We
  * try to clean it up here, as much as we can, by eliminating the Results
@@ -353,6 +353,8 @@ standard_planner(Query *parse, int cursorOptions, ParamListInfo boundParams)
 	PlannerConfig *config;
 	instr_time		starttime;
 	instr_time		endtime;
+	bool		use_orca;
+	bool		fast_path = false;
 
 	/*
 	 * Use ORCA only if it is enabled and we are in a coordinator QD process.
@@ -367,11 +369,29 @@ standard_planner(Query *parse, int cursorOptions, ParamListInfo boundParams)
 	 *
 	 * PARALLEL RETRIEVE CURSOR is not supported by ORCA yet.
 	 */
-	if (optimizer &&
-		GP_ROLE_DISPATCH == Gp_role &&
-		IS_QUERY_DISPATCHER() &&
-		(cursorOptions & CURSOR_OPT_SKIP_FOREIGN_PARTITIONS) == 0 &&
-		(cursorOptions & CURSOR_OPT_PARALLEL_RETRIEVE) == 0)
+	use_orca = (optimizer &&
+				GP_ROLE_DISPATCH == Gp_role &&
+				IS_QUERY_DISPATCHER() &&
+				(cursorOptions & CURSOR_OPT_SKIP_FOREIGN_PARTITIONS) == 0 &&
+				(cursorOptions & CURSOR_OPT_PARALLEL_RETRIEVE) == 0);
+
+#ifdef USE_ORCA
+	/*
+	 * Point lookups and single-row inserts have only one sensible plan, which
+	 * we find much faster than ORCA can.  Leave them to the Postgres planner.
+	 */
+	if (use_orca && optimizer_enable_fast_path &&
+		orca_fast_path_query(parse, boundParams))
+	{
+		use_orca = false;
+		fast_path = true;
+
+		if (optimizer_log)
+			elog(DEBUG1, "GPORCA fast path: planning query with the Postgres-based planner");
+	}
+#endif
+
+	if (use_orca)
 	{
 		if (gp_log_optimization_time)
 			INSTR_TIME_SET_CURRENT(starttime);
@@ -743,6 +763,7 @@ standard_planner(Query *parse, int cursorOptions, ParamListInfo boundParams)
 	result->oneoffPlan = glob->oneoffPlan;
 	result->dependsOnRole = glob->dependsOnRole;
 	result->parallelModeNeeded = glob->parallelModeNeeded;
+	result->optimizerFastPath = fast_path;
 	result->planTree = top_plan;
 	result->numSlices = glob->numSlices;
 	result->slices = glob->slices;
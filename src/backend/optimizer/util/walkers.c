@@ -360,7 +360,15 @@ plan_tree_walker(Node *node,
 				return true;
 			break;
 
+		case T_Memoize:
+			if (walk_plan_node_fields((Plan *) node, walker, context))
+				return true;
+			if (walker((Node *) ((Memoize *) node)->param_exprs, context))
+				return true;
+			break;
+
 		case T_Sort:
+		case T_IncrementalSort:
 			if (walk_plan_node_fields((Plan *) node, walker, context))
 				return true;
 			/* Other fields are simple counts and lists of indexes and oids. */
@@ -8,13 +8,21 @@
  *
  * gp_opt_version: This function wraps LibraryVersion. 
  *
+ * gp_optimizer_profile: Returns the per-xform and per-job optimization
+ * profile of this session.
+ *
+ * gp_optimizer_profile_reset: Clears the optimization profile of this session.
+ *
  * Copyright(c) 2012 - present, EMC/Greenplum
  */
 
 #include "postgres.h"
 
 #include "funcapi.h"
+#include "miscadmin.h"
+#include "optimizer/orca.h"
 #include "utils/builtins.h"
+#include "utils/tuplestore.h"
 
 extern Datum EnableXform(PG_FUNCTION_ARGS);
 
@@ -60,3 +68,89 @@ gp_opt_version(PG_FUNCTION_ARGS pg_attribute_unused())
 	return CStringGetTextDatum("Server has been compiled without ORCA");
 #endif
 }
+
+/*
+ * Returns the time spent, alternatives generated and memo insertions per
+ * xform, and the time spent per job type, summed up over all queries
+ * optimized by GPORCA in this session since the last call of
+ * gp_optimizer_profile_reset(). Note that this includes the optimization of
+ * the query calling this function.
+ */
+Datum
+gp_optimizer_profile(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	TupleDesc	tupdesc;
+	Tuplestorestate *tupstore;
+	MemoryContext oldcontext;
+#ifdef USE_ORCA
+	List	   *entries;
+	ListCell   *lc;
+#endif
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not allowed in this context")));
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	/* The tupdesc and tuplestore must be created in ecxt_per_query_memory */
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+
+	tupdesc = CreateTupleDescCopy(tupdesc);
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = tupdesc;
+
+	MemoryContextSwitchTo(oldcontext);
+
+#ifdef USE_ORCA
+	entries = GetOptimizerProfile(true /* cumulative */);
+	foreach(lc, entries)
+	{
+		OptimizerProfileEntry *entry = (OptimizerProfileEntry *) lfirst(lc);
+		Datum		values[6];
+		bool		nulls[6];
+		bool		is_xform = strcmp(entry->kind, "xform") == 0;
+
+		MemSet(nulls, 0, sizeof(nulls));
+
+		values[0] = CStringGetTextDatum(entry->kind);
+		values[1] = CStringGetTextDatum(entry->name);
+		values[2] = Int64GetDatum(entry->calls);
+		values[3] = Float8GetDatum(entry->time_ms);
+		values[4] = Int64GetDatum(entry->alternatives);
+		values[5] = Int64GetDatum(entry->memo_inserts);
+
+		/* alternatives and memo insertions only apply to xforms */
+		nulls[4] = !is_xform;
+		nulls[5] = !is_xform;
+
+		tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+	}
+#endif
+
+	return (Datum) 0;
+}
+
+/*
+ * Clears the optimization profile of this session.
+ */
+Datum
+gp_optimizer_profile_reset(PG_FUNCTION_ARGS pg_attribute_unused())
+{
+#ifdef USE_ORCA
+	ResetOptimizerProfile();
+#endif
+
+	PG_RETURN_VOID();
+}
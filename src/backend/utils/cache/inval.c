@@ -123,6 +123,7 @@
 #include "utils/inval.h"
 #include "utils/memdebug.h"
 #include "utils/memutils.h"
+#include "utils/orcamdcache.h"
 #include "utils/rel.h"
 #include "utils/relmapper.h"
 #include "utils/snapmgr.h"
@@ -985,8 +986,13 @@ ProcessCommittedInvalidationMessages(SharedInvalidationMessage *msgs,
 		}
 	}
 
+	/* drop the metadata cached by GPORCA that the messages make stale */
+	OrcaMDCacheInvalidate(msgs, nmsgs);
+
 	SendSharedInvalidMessages(msgs, nmsgs);
 
+	OrcaMDCacheInvalidate(msgs, nmsgs);
+
 	if (RelcacheInitFileInval)
 		RelationCacheInitFilePostInvalidate();
 }
@@ -1038,9 +1044,16 @@ AtEOXact_Inval(bool isCommit)
 		AppendInvalidationMessages(&transInvalInfo->PriorCmdInvalidMsgs,
 								   &transInvalInfo->CurrentCmdInvalidMsgs);
 
+		/* drop the metadata cached by GPORCA that the messages make stale */
+		ProcessInvalidationMessagesMulti(&transInvalInfo->PriorCmdInvalidMsgs,
+										 OrcaMDCacheInvalidate);
+
 		ProcessInvalidationMessagesMulti(&transInvalInfo->PriorCmdInvalidMsgs,
 										 SendSharedInvalidMessages);
 
+		ProcessInvalidationMessagesMulti(&transInvalInfo->PriorCmdInvalidMsgs,
+										 OrcaMDCacheInvalidate);
+
 		if (transInvalInfo->RelcacheInitFileInval)
 			RelationCacheInitFilePostInvalidate();
 	}
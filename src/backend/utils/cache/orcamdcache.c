@@ -0,0 +1,579 @@
+/*-------------------------------------------------------------------------
+ *
+ * orcamdcache.c
+ *	  Shared-memory cache of serialized GPORCA metadata objects.
+ *
+ * Every backend running GPORCA keeps a private metadata cache (CMDCache)
+ * that is filled by translating catalog entries into DXL objects.  A new
+ * backend starts with an empty cache, so with short-lived connections the
+ * same relations, types and statistics are translated over and over.  This
+ * module keeps the binary DXL of translated objects in shared memory, so
+ * that a backend can parse an object that some other backend translated
+ * instead of going through the catalog again.  Values are opaque byte
+ * strings to this module.  Entries are private to the database they were
+ * built in.
+ *
+ * The cache is read-mostly and deliberately simple: values are appended to
+ * a fixed-size data area, and when either the data area or the hash table
+ * runs out of space, the whole cache is emptied.
+ *
+ * Invalidation follows the catalog invalidation messages sent at commit.
+ * Objects describing a relation (the relation itself, its indexes and its
+ * statistics) are stored with the OID of the relation, and are removed
+ * only by invalidations of that relation; column statistics also by
+ * invalidations of their pg_statistic rows.  All other objects, such as
+ * types, operators and functions, are removed by any invalidation of the
+ * catalogs they are built from.  So ANALYZE or ALTER TABLE on one table
+ * leaves the objects of all other tables in the cache.
+ *
+ * An object may be translated from the catalog just before an invalidation
+ * of it is processed, and be inserted just after.  To catch that, every
+ * processed invalidation is counted and logged in a small ring buffer.
+ * Backends read the count, the "generation", before they accept pending
+ * invalidation messages and start reading the catalog, see
+ * OrcaMDCacheGetGeneration().  An insert is rejected if any invalidation
+ * logged since its generation affects it, or if the log has wrapped around
+ * since.  Invalidations are processed both before and after the messages
+ * are sent, so that no backend can pick up an object that was translated
+ * from the catalog as it was before the change, once the messages are out.
+ *
+ * Copyright (c) 2026-Present VMware, Inc. or its affiliates.
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/cache/orcamdcache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "port/atomics.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/orcamdcache.h"
+#include "utils/syscache.h"
+
+/* average size of a serialized object, used to size the hash table */
+#define ORCA_MDCACHE_AVG_ENTRY_SIZE		1024
+
+/* number of invalidations kept in the log */
+#define ORCA_MDCACHE_LOG_SIZE			256
+
+typedef struct OrcaMDCacheKey
+{
+	Oid			dbid;			/* database the object was built in */
+	char		name[ORCA_MDCACHE_KEY_LEN];	/* NUL-padded object key */
+} OrcaMDCacheKey;
+
+typedef struct OrcaMDCacheEntry
+{
+	OrcaMDCacheKey key;			/* hash key, must be first */
+	Oid			relid;			/* relation described, or InvalidOid */
+	uint32		stats_hash[2];	/* STATRELATTINH hashes of column stats */
+	bool		is_col_stats;	/* is stats_hash valid? */
+	Size		offset;			/* offset of the value in the data area */
+	Size		len;			/* length of the value */
+} OrcaMDCacheEntry;
+
+typedef enum OrcaMDCacheInvalKind
+{
+	ORCA_MDCACHE_INVAL_ALL,		/* all objects */
+	ORCA_MDCACHE_INVAL_REL,		/* objects of a relation */
+	ORCA_MDCACHE_INVAL_STATS,	/* statistics of a column */
+	ORCA_MDCACHE_INVAL_OTHER	/* objects not tied to a relation */
+} OrcaMDCacheInvalKind;
+
+typedef struct OrcaMDCacheInval
+{
+	OrcaMDCacheInvalKind kind;
+	Oid			dbid;			/* database, or InvalidOid for all */
+	Oid			relid;			/* for ORCA_MDCACHE_INVAL_REL */
+	uint32		hash;			/* for ORCA_MDCACHE_INVAL_STATS */
+} OrcaMDCacheInval;
+
+typedef struct OrcaMDCacheShared
+{
+	/*
+	 * Number of invalidations processed so far.  Invalidation number i
+	 * (counting from 0) is kept in log[i % ORCA_MDCACHE_LOG_SIZE].  Only
+	 * changed while holding OrcaMDCacheLock exclusively.
+	 */
+	pg_atomic_uint64 generation;
+	OrcaMDCacheInval log[ORCA_MDCACHE_LOG_SIZE];
+
+	/* statistics, see gp_optimizer_mdcache_shared_stats() */
+	pg_atomic_uint64 lookups;
+	pg_atomic_uint64 hits;
+	uint64		inserts;
+	uint64		rejected_inserts;
+	uint64		invalidated_entries;
+	uint64		resets;
+
+	Size		data_size;		/* size of the data area */
+	Size		data_used;		/* bytes of the data area in use */
+	char		data[FLEXIBLE_ARRAY_MEMBER];
+} OrcaMDCacheShared;
+
+static OrcaMDCacheShared *orcaMDCache = NULL;
+static HTAB *orcaMDCacheHash = NULL;
+
+static long
+OrcaMDCacheMaxEntries(void)
+{
+	return Max(((long) optimizer_mdcache_shared_size * 1024L) /
+			   ORCA_MDCACHE_AVG_ENTRY_SIZE, 16);
+}
+
+/*
+ * Report shared memory space needed by OrcaMDCacheShmemInit.
+ */
+Size
+OrcaMDCacheShmemSize(void)
+{
+	Size		size;
+
+	if (optimizer_mdcache_shared_size <= 0)
+		return 0;
+
+	size = offsetof(OrcaMDCacheShared, data);
+	size = add_size(size, mul_size(optimizer_mdcache_shared_size, 1024));
+	size = add_size(size, hash_estimate_size(OrcaMDCacheMaxEntries(),
+											 sizeof(OrcaMDCacheEntry)));
+
+	return size;
+}
+
+/*
+ * Allocate and initialize the shared metadata cache, if it is enabled.
+ */
+void
+OrcaMDCacheShmemInit(void)
+{
+	HASHCTL		info;
+	bool		found;
+	long		max_entries;
+
+	if (optimizer_mdcache_shared_size <= 0)
+		return;
+
+	orcaMDCache = (OrcaMDCacheShared *)
+		ShmemInitStruct("ORCA Metadata Cache",
+						add_size(offsetof(OrcaMDCacheShared, data),
+								 mul_size(optimizer_mdcache_shared_size, 1024)),
+						&found);
+
+	if (!found)
+	{
+		MemSet(orcaMDCache, 0, offsetof(OrcaMDCacheShared, data));
+		pg_atomic_init_u64(&orcaMDCache->generation, 0);
+		pg_atomic_init_u64(&orcaMDCache->lookups, 0);
+		pg_atomic_init_u64(&orcaMDCache->hits, 0);
+		orcaMDCache->data_size = (Size) optimizer_mdcache_shared_size * 1024;
+		orcaMDCache->data_used = 0;
+	}
+
+	MemSet(&info, 0, sizeof(info));
+	info.keysize = sizeof(OrcaMDCacheKey);
+	info.entrysize = sizeof(OrcaMDCacheEntry);
+
+	max_entries = OrcaMDCacheMaxEntries();
+	orcaMDCacheHash = ShmemInitHash("ORCA Metadata Cache Hash",
+									max_entries, max_entries,
+									&info, HASH_ELEM | HASH_BLOBS);
+}
+
+/*
+ * Is the shared metadata cache available in this process?
+ */
+bool
+OrcaMDCacheEnabled(void)
+{
+	return orcaMDCache != NULL;
+}
+
+/*
+ * Fill in the hash key of the given object key in the current database.
+ * Returns false if the object key is too long to be cached.
+ */
+static bool
+OrcaMDCacheMakeKey(OrcaMDCacheKey *key, const char *name)
+{
+	Size		len = strlen(name);
+
+	if (len >= ORCA_MDCACHE_KEY_LEN)
+		return false;
+
+	/* the key is hashed and compared as a whole, padding included */
+	MemSet(key, 0, sizeof(*key));
+	key->dbid = MyDatabaseId;
+	memcpy(key->name, name, len);
+
+	return true;
+}
+
+/*
+ * Return the current generation, then absorb pending invalidation messages.
+ *
+ * Objects translated from the catalog after this call reflect at least all
+ * changes whose invalidations were processed before the returned
+ * generation.
+ */
+uint64
+OrcaMDCacheGetGeneration(void)
+{
+	uint64		generation;
+
+	Assert(OrcaMDCacheEnabled());
+
+	generation = pg_atomic_read_u64(&orcaMDCache->generation);
+	pg_memory_barrier();
+	AcceptInvalidationMessages();
+
+	return generation;
+}
+
+/*
+ * Does the given invalidation affect the given entry?
+ */
+static bool
+OrcaMDCacheInvalMatches(const OrcaMDCacheInval *inval, Oid dbid, Oid relid,
+						bool is_col_stats, const uint32 *stats_hash)
+{
+	if (OidIsValid(inval->dbid) && inval->dbid != dbid)
+		return false;
+
+	switch (inval->kind)
+	{
+		case ORCA_MDCACHE_INVAL_ALL:
+			return true;
+		case ORCA_MDCACHE_INVAL_REL:
+			return relid == inval->relid;
+		case ORCA_MDCACHE_INVAL_STATS:
+			return is_col_stats && (stats_hash[0] == inval->hash ||
+									stats_hash[1] == inval->hash);
+		case ORCA_MDCACHE_INVAL_OTHER:
+			return !OidIsValid(relid);
+	}
+
+	return true;
+}
+
+/*
+ * Translate a catalog invalidation message into an invalidation of cached
+ * objects.  Returns false if no cached object can depend on what the
+ * message invalidates.
+ */
+static bool
+OrcaMDCacheClassifyMessage(const SharedInvalidationMessage *msg,
+						   OrcaMDCacheInval *inval)
+{
+	MemSet(inval, 0, sizeof(*inval));
+
+	if (msg->id >= 0)
+	{
+		inval->dbid = msg->cc.dbId;
+		inval->hash = msg->cc.hashValue;
+
+		switch (msg->cc.id)
+		{
+			case STATRELATTINH:
+				inval->kind = ORCA_MDCACHE_INVAL_STATS;
+				return true;
+
+			/* the catalogs watched by the per-backend metadata cache */
+			case AGGFNOID:
+			case AMOPOPID:
+			case CASTSOURCETARGET:
+			case CONSTROID:
+			case OPEROID:
+			case OPFAMILYOID:
+			case PROCOID:
+			case STATEXTOID:
+			case TYPEOID:
+				inval->kind = ORCA_MDCACHE_INVAL_OTHER;
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
+	switch (msg->id)
+	{
+		case SHAREDINVALCATALOG_ID:
+			inval->kind = ORCA_MDCACHE_INVAL_ALL;
+			inval->dbid = msg->cat.dbId;
+			return true;
+
+		case SHAREDINVALRELCACHE_ID:
+			inval->dbid = msg->rc.dbId;
+			inval->relid = msg->rc.relId;
+			inval->kind = OidIsValid(msg->rc.relId) ?
+				ORCA_MDCACHE_INVAL_REL : ORCA_MDCACHE_INVAL_ALL;
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+/*
+ * Remove the entries affected by the given invalidation.  Caller must hold
+ * OrcaMDCacheLock exclusively.
+ */
+static void
+OrcaMDCacheRemoveMatching(const OrcaMDCacheInval *inval)
+{
+	HASH_SEQ_STATUS status;
+	OrcaMDCacheEntry *entry;
+
+	hash_seq_init(&status, orcaMDCacheHash);
+	while ((entry = (OrcaMDCacheEntry *) hash_seq_search(&status)) != NULL)
+	{
+		if (OrcaMDCacheInvalMatches(inval, entry->key.dbid, entry->relid,
+									entry->is_col_stats, entry->stats_hash))
+		{
+			hash_search(orcaMDCacheHash, &entry->key, HASH_REMOVE, NULL);
+			orcaMDCache->invalidated_entries++;
+		}
+	}
+}
+
+/*
+ * Invalidate the cached objects affected by the given catalog invalidation
+ * messages.
+ *
+ * Called at commit both before and after the messages are sent.
+ */
+void
+OrcaMDCacheInvalidate(const SharedInvalidationMessage *msgs, int n)
+{
+	OrcaMDCacheInval last;
+	bool		have_last = false;
+	int			i;
+
+	if (!OrcaMDCacheEnabled())
+		return;
+
+	LWLockAcquire(OrcaMDCacheLock, LW_EXCLUSIVE);
+
+	for (i = 0; i < n; i++)
+	{
+		OrcaMDCacheInval inval;
+		uint64		generation;
+
+		if (!OrcaMDCacheClassifyMessage(&msgs[i], &inval))
+			continue;
+
+		/* commands often send runs of the same message, log them once */
+		if (have_last && inval.kind == last.kind && inval.dbid == last.dbid &&
+			inval.relid == last.relid && inval.hash == last.hash)
+			continue;
+		last = inval;
+		have_last = true;
+
+		generation = pg_atomic_read_u64(&orcaMDCache->generation);
+		orcaMDCache->log[generation % ORCA_MDCACHE_LOG_SIZE] = inval;
+		pg_write_barrier();
+		pg_atomic_write_u64(&orcaMDCache->generation, generation + 1);
+
+		OrcaMDCacheRemoveMatching(&inval);
+	}
+
+	LWLockRelease(OrcaMDCacheLock);
+}
+
+/*
+ * Look up the value cached under the given key in the current database.
+ *
+ * Returns a palloc'd copy of the value and sets *len to its length, or
+ * returns NULL if there is no such value.
+ */
+char *
+OrcaMDCacheLookup(const char *key, Size *len)
+{
+	OrcaMDCacheKey hkey;
+	OrcaMDCacheEntry *entry;
+	char	   *result = NULL;
+
+	Assert(OrcaMDCacheEnabled());
+
+	if (!OrcaMDCacheMakeKey(&hkey, key))
+		return NULL;
+
+	pg_atomic_fetch_add_u64(&orcaMDCache->lookups, 1);
+
+	LWLockAcquire(OrcaMDCacheLock, LW_SHARED);
+
+	entry = (OrcaMDCacheEntry *) hash_search(orcaMDCacheHash, &hkey,
+											 HASH_FIND, NULL);
+	if (entry != NULL)
+	{
+		result = palloc(entry->len);
+		memcpy(result, orcaMDCache->data + entry->offset, entry->len);
+		*len = entry->len;
+	}
+
+	LWLockRelease(OrcaMDCacheLock);
+
+	if (result != NULL)
+		pg_atomic_fetch_add_u64(&orcaMDCache->hits, 1);
+
+	return result;
+}
+
+/*
+ * Empty the cache.  Caller must hold OrcaMDCacheLock exclusively.
+ */
+static void
+OrcaMDCacheReset(void)
+{
+	HASH_SEQ_STATUS status;
+	OrcaMDCacheEntry *entry;
+
+	hash_seq_init(&status, orcaMDCacheHash);
+	while ((entry = (OrcaMDCacheEntry *) hash_seq_search(&status)) != NULL)
+		hash_search(orcaMDCacheHash, &entry->key, HASH_REMOVE, NULL);
+
+	orcaMDCache->data_used = 0;
+	orcaMDCache->resets++;
+}
+
+/*
+ * Store a value built in the given generation under the given key.
+ *
+ * relid is the relation the object describes, if any, and attnum the
+ * column of column statistics, or InvalidAttrNumber.  Values affected by
+ * an invalidation processed since the given generation, and values that
+ * would take up more than a quarter of the cache, are silently ignored.
+ */
+void
+OrcaMDCacheInsert(const char *key, uint64 generation, Oid relid,
+				  AttrNumber attnum, const char *value, Size len)
+{
+	OrcaMDCacheKey hkey;
+	OrcaMDCacheEntry *entry;
+	uint32		stats_hash[2] = {0, 0};
+	bool		is_col_stats = OidIsValid(relid) &&
+		attnum != InvalidAttrNumber;
+	uint64		current;
+	uint64		g;
+	bool		found;
+
+	Assert(OrcaMDCacheEnabled());
+
+	if (!OrcaMDCacheMakeKey(&hkey, key) ||
+		len > orcaMDCache->data_size / 4)
+		return;
+
+	/* the statistics may be kept with or without inheritance children */
+	if (is_col_stats)
+	{
+		stats_hash[0] = GetSysCacheHashValue3(STATRELATTINH,
+											  ObjectIdGetDatum(relid),
+											  Int16GetDatum(attnum),
+											  BoolGetDatum(false));
+		stats_hash[1] = GetSysCacheHashValue3(STATRELATTINH,
+											  ObjectIdGetDatum(relid),
+											  Int16GetDatum(attnum),
+											  BoolGetDatum(true));
+	}
+
+	LWLockAcquire(OrcaMDCacheLock, LW_EXCLUSIVE);
+
+	current = pg_atomic_read_u64(&orcaMDCache->generation);
+	if (current - generation > ORCA_MDCACHE_LOG_SIZE)
+	{
+		orcaMDCache->rejected_inserts++;
+		LWLockRelease(OrcaMDCacheLock);
+		return;
+	}
+	for (g = generation; g < current; g++)
+	{
+		if (OrcaMDCacheInvalMatches(&orcaMDCache->log[g % ORCA_MDCACHE_LOG_SIZE],
+									MyDatabaseId, relid, is_col_stats,
+									stats_hash))
+		{
+			orcaMDCache->rejected_inserts++;
+			LWLockRelease(OrcaMDCacheLock);
+			return;
+		}
+	}
+
+	if (orcaMDCache->data_used + len > orcaMDCache->data_size)
+		OrcaMDCacheReset();
+
+	entry = (OrcaMDCacheEntry *) hash_search(orcaMDCacheHash, &hkey,
+											 HASH_ENTER_NULL, &found);
+	if (entry == NULL)
+	{
+		OrcaMDCacheReset();
+		entry = (OrcaMDCacheEntry *) hash_search(orcaMDCacheHash, &hkey,
+												 HASH_ENTER, &found);
+	}
+
+	/*
+	 * Space of a replaced value is not reused; it is reclaimed when the
+	 * cache is emptied.
+	 */
+	entry->relid = relid;
+	entry->is_col_stats = is_col_stats;
+	entry->stats_hash[0] = stats_hash[0];
+	entry->stats_hash[1] = stats_hash[1];
+	entry->offset = orcaMDCache->data_used;
+	entry->len = len;
+	memcpy(orcaMDCache->data + entry->offset, value, len);
+	orcaMDCache->data_used += len;
+	orcaMDCache->inserts++;
+
+	LWLockRelease(OrcaMDCacheLock);
+}
+
+/*
+ * gp_optimizer_mdcache_shared_stats
+ *		Report the activity and the fill level of the shared metadata cache
+ *		on this segment.  All counters are zero if the cache is disabled.
+ */
+Datum
+gp_optimizer_mdcache_shared_stats(PG_FUNCTION_ARGS)
+{
+#define GP_OPTIMIZER_MDCACHE_STATS_COLS	8
+	TupleDesc	tupdesc;
+	Datum		values[GP_OPTIMIZER_MDCACHE_STATS_COLS];
+	bool		nulls[GP_OPTIMIZER_MDCACHE_STATS_COLS];
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	MemSet(values, 0, sizeof(values));
+	MemSet(nulls, 0, sizeof(nulls));
+
+	if (OrcaMDCacheEnabled())
+	{
+		LWLockAcquire(OrcaMDCacheLock, LW_SHARED);
+		values[0] = Int64GetDatum(pg_atomic_read_u64(&orcaMDCache->lookups));
+		values[1] = Int64GetDatum(pg_atomic_read_u64(&orcaMDCache->hits));
+		values[2] = Int64GetDatum(orcaMDCache->inserts);
+		values[3] = Int64GetDatum(orcaMDCache->rejected_inserts);
+		values[4] = Int64GetDatum(orcaMDCache->invalidated_entries);
+		values[5] = Int64GetDatum(orcaMDCache->resets);
+		values[6] = Int64GetDatum(hash_get_num_entries(orcaMDCacheHash));
+		values[7] = Int64GetDatum(orcaMDCache->data_used);
+		LWLockRelease(OrcaMDCacheLock);
+	}
+	else
+	{
+		int			i;
+
+		for (i = 0; i < GP_OPTIMIZER_MDCACHE_STATS_COLS; i++)
+			values[i] = Int64GetDatum(0);
+	}
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
@@ -303,7 +303,15 @@ datumstreamwrite_put(
 					 bool null,
 					 void **toFree)
 {
-	return DatumStreamBlockWrite_Put(&acc->blockWrite, d, null, toFree);
+	int			result;
+
+	result = DatumStreamBlockWrite_Put(&acc->blockWrite, d, null, toFree);
+
+	/* Only values that made it into the block count */
+	if (result >= 0 && acc->zonemap_enabled)
+		zonemap_add_value(&acc->zonemap, acc->typeInfo.typid, d, null);
+
+	return result;
 }
 
 int
@@ -529,6 +537,8 @@ create_datumstreamwrite(
 						  maxsz,
 						  attr);
 
+	acc->zonemap_enabled = zonemap_type_supported(attr->atttypid);
+
 	compressionFunctions = NULL;
 	compressionState = NULL;
 	verifyBlockCompressionState = NULL;
@@ -1010,13 +1020,17 @@ datumstreamwrite_block(DatumStreamWrite *acc,
 			/* Never reaches here. */
 	}
 
-	/* Insert an entry to the block directory */
-	AppendOnlyBlockDirectory_InsertEntry(
+	/* Insert an entry to the block directory, with the block's zone map */
+	if (acc->zonemap_enabled)
+		acc->zonemap.flags |= MINIPAGE_ZONEMAP_VALID;
+	AppendOnlyBlockDirectory_InsertEntryWithZoneMap(
 		blockDirectory,
 		columnGroupNo,
 		acc->blockFirstRowNum,
 		AppendOnlyStorageWrite_LogicalBlockStartOffset(&acc->ao_write),
-		itemCount);
+		itemCount,
+		acc->zonemap_enabled ? &acc->zonemap : NULL);
+	MemSet(&acc->zonemap, 0, sizeof(MinipageZoneMap));
 
 	return writesz;
 }
@@ -1299,6 +1313,42 @@ datumstreamread_block_content(DatumStreamRead * acc)
 	datumstreamread_block_get_ready(acc);
 }
 
+void
+datumstreamread_skip_block(DatumStreamRead * acc)
+{
+	Assert(acc);
+
+	AppendOnlyStorageRead_SkipCurrentBlock(&acc->ao_read);
+
+	/*
+	 * Leave no rows of the previous block behind, so that
+	 * datumstreamread_remaining() reports the need for the next block.
+	 */
+	DatumStreamBlockRead_Reset(&acc->blockRead);
+	acc->largeObjectState = DatumStreamLargeObjectState_None;
+}
+
+
+/*
+ * Compute the zone map of the block just read, leaving the block
+ * positioned before its first datum again.
+ */
+static void
+datumstreamread_block_zonemap(DatumStreamRead * acc, MinipageZoneMap *zonemap)
+{
+	Datum		d;
+	bool		null;
+
+	MemSet(zonemap, 0, sizeof(MinipageZoneMap));
+	while (datumstreamread_advance(acc) > 0)
+	{
+		datumstreamread_get(acc, &d, &null);
+		zonemap_add_value(zonemap, acc->typeInfo.typid, d, null);
+	}
+	zonemap->flags |= MINIPAGE_ZONEMAP_VALID;
+
+	datumstreamread_rewind_block(acc);
+}
 
 int
 datumstreamread_block(DatumStreamRead * acc,
@@ -1365,11 +1415,25 @@ datumstreamread_block(DatumStreamRead * acc,
 
 	if (blockDirectory)
 	{
-		AppendOnlyBlockDirectory_InsertEntry(blockDirectory,
-											 colGroupNo,
-											 acc->blockFirstRowNum,
-											 acc->blockFileOffset,
-											 acc->blockRowCount);
+		MinipageZoneMap zonemap;
+		bool		has_zonemap;
+
+		/*
+		 * The scan builds the block directory, e.g. for CREATE INDEX.  Give
+		 * the entry the same zone map datumstreamwrite_block() would have.
+		 */
+		has_zonemap = blockDirectory->hasZoneMaps &&
+			acc->getBlockInfo.execBlockKind == AOCSBK_BLOCK &&
+			zonemap_type_supported(acc->typeInfo.typid);
+		if (has_zonemap)
+			datumstreamread_block_zonemap(acc, &zonemap);
+
+		AppendOnlyBlockDirectory_InsertEntryWithZoneMap(blockDirectory,
+														colGroupNo,
+														acc->blockFirstRowNum,
+														acc->blockFileOffset,
+														acc->blockRowCount,
+														has_zonemap ? &zonemap : NULL);
 	}
 
 	return 0;
@@ -281,9 +281,12 @@ bool		optimizer_control = true;
 bool		optimizer_trace_fallback;
 bool		optimizer_partition_selection_log;
 int			optimizer_minidump;
+bool		optimizer_minidump_binary;
 int			optimizer_cost_model;
 bool		optimizer_metadata_caching;
 int			optimizer_mdcache_size;
+int			optimizer_plan_cache_size;
+int			optimizer_mdcache_shared_size;
 bool		optimizer_use_gpdb_allocators;
 
 /* Optimizer debugging GUCs */
@@ -312,13 +315,17 @@ bool		optimizer_enable_motions;
 bool		optimizer_enable_motion_broadcast;
 bool		optimizer_enable_motion_gather;
 bool		optimizer_enable_motion_redistribute;
+bool		optimizer_enable_skew_redistribute;
 bool		optimizer_enable_sort;
 bool		optimizer_enable_materialize;
+bool		optimizer_enable_memoize;
+bool		optimizer_enable_incremental_sort;
 bool		optimizer_enable_partition_propagation;
 bool		optimizer_enable_partition_selection;
 bool		optimizer_enable_outerjoin_rewrite;
 bool		optimizer_enable_multiple_distinct_aggs;
 bool		optimizer_enable_direct_dispatch;
+bool		optimizer_enable_fast_path;
 bool		optimizer_enable_hashjoin_redistribute_broadcast_children;
 bool		optimizer_enable_broadcast_nestloop_outer_child;
 bool		optimizer_discard_redistribute_hashjoin;
@@ -383,6 +390,7 @@ int			optimizer_cte_inlining_bound;
 int			optimizer_push_group_by_below_setop_threshold;
 int			optimizer_xform_bind_threshold;
 int			optimizer_skew_factor;
+int			optimizer_search_time_budget;
 bool		optimizer_force_multistage_agg;
 bool		optimizer_force_three_stage_scalar_dqa;
 bool		optimizer_force_expanded_distinct_aggs;
@@ -775,6 +783,42 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_enable_runtime_filter", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enable runtime filters pushed down from hash joins into scans."),
+			gettext_noop("If true, a hash join builds a Bloom filter over the hash keys "
+						 "of its inner side, and the scan on its outer side drops the "
+						 "tuples that cannot match.")
+		},
+		&gp_enable_runtime_filter,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"gp_enable_aocs_batch_scan", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enable batch-at-a-time scans of append-optimized column-oriented tables."),
+			gettext_noop("If true, sequential scans on AOCS tables read a batch of rows "
+						 "per column at a time, and evaluate simple comparison quals and "
+						 "count/sum/min/max aggregates directly over the column vectors.")
+		},
+		&gp_enable_aocs_batch_scan,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"gp_enable_aocs_block_skipping", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enable skipping of AOCS varblocks using the zone maps in the block directory."),
+			gettext_noop("If true, scans on append-optimized column-oriented tables with "
+						 "a block directory skip the varblocks whose per-block minimum, "
+						 "maximum and null count rule out every row for the scan's quals.")
+		},
+		&gp_enable_aocs_block_skipping,
+		true,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_enable_agg_distinct", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enable 2-phase aggregation to compute a single distinct-qualified aggregate."),
@@ -1087,6 +1131,46 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_interconnect_batch_io", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Send and receive UDP interconnect packets in batches."),
+			gettext_noop("If true, the UDP interconnect passes the packets a sender "
+						 "releases at once to the kernel with one sendmmsg() call, "
+						 "and receives up to 32 packets per recvmmsg() call. "
+						 "Ignored on platforms without these system calls.")
+		},
+		&gp_interconnect_batch_io,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"gp_motion_columnar_batch", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Send the tuples of Motions in columnar batches."),
+			gettext_noop("If true, a Motion packs the tuples it sends into batches "
+						 "laid out column by column, and the receiver rebuilds "
+						 "the tuples of a batch at once.  Motions with composite, "
+						 "domain, enum or other non-base types send tuples one "
+						 "at a time.")
+		},
+		&gp_motion_columnar_batch,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"gp_motion_compression", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Compress tuples sent through Motions when it pays off."),
+			gettext_noop("If true, a Motion compresses the tuples it sends when the "
+						 "planner estimates it moves wide rows, or when the measured "
+						 "throughput of the interconnect is low, and stops when the "
+						 "tuples do not compress.")
+		},
+		&gp_motion_compression,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_interconnect_log_stats", PGC_USERSET, QUERY_TUNING_OTHER,
 			gettext_noop("Emit statistics from the UDP-IC at the end of every statement."),
@@ -2079,6 +2163,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_minidump_binary", PGC_USERSET, LOGGING_WHEN,
+			gettext_noop("Write optimizer minidumps in binary DXL instead of XML."),
+			gettext_noop("Binary minidumps are smaller and faster to load."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_minidump_binary,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_extract_dxl_stats", PGC_USERSET, LOGGING_WHAT,
 			gettext_noop("Extract plan stats in dxl."),
@@ -2179,6 +2274,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_enable_skew_redistribute", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enable skew-aware Redistribute Motions below hash joins in the optimizer."),
+			gettext_noop("Rows of heavy hitters on one side of the join are spread round-robin "
+						 "and the matching rows of the other side are broadcast."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_skew_redistribute,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"optimizer_enable_sort", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enable plans with Sort operators in the optimizer."),
@@ -2199,6 +2305,28 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_enable_memoize", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enable plans caching the rows of parameterized inner scans and correlated subplans in the optimizer."),
+			gettext_noop("Puts a Memoize node over the inner side of index nested loop joins "
+						 "and over correlated subplans, keyed on the parameter values."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_memoize,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"optimizer_enable_incremental_sort", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enable plans with incremental sort operators in the optimizer."),
+			gettext_noop("Sorts inputs already sorted on a prefix of the required keys "
+						 "one group of that prefix at a time."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_incremental_sort,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"optimizer_enable_partition_propagation", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enable plans with Partition Propagation operators in the optimizer."),
@@ -2239,6 +2367,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_enable_fast_path", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Plan trivial queries with the Postgres-based planner instead of GPORCA."),
+			gettext_noop("Applies to single-row inserts and to selects from a single table "
+						 "that can be dispatched directly to one segment."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_fast_path,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"optimizer_control", PGC_SUSET, DEVELOPER_OPTIONS,
 			gettext_noop("Allow/disallow turning the optimizer on or off."),
@@ -3484,6 +3623,28 @@ struct config_int ConfigureNamesInt_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_motion_compression_min_width", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the estimated row width above which Motions compress tuples."),
+			gettext_noop("Only used when gp_motion_compression is on."),
+			GUC_UNIT_BYTE
+		},
+		&gp_motion_compression_min_width,
+		256, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"gp_motion_compression_throughput_threshold", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the interconnect throughput, in kilobytes per second, below which Motions compress tuples."),
+			gettext_noop("Measured per Motion by the sender. Zero disables the check. "
+						 "Only used when gp_motion_compression is on.")
+		},
+		&gp_motion_compression_throughput_threshold,
+		65536, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_interconnect_queue_depth", PGC_USERSET, GP_ARRAY_TUNING,
 			gettext_noop("Sets the maximum size of the receive queue for each connection in the UDP interconnect"),
@@ -4216,6 +4377,18 @@ struct config_int ConfigureNamesInt_gp[] =
             NULL, NULL, NULL
     },
 
+	{
+		{"optimizer_search_time_budget", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Sets the maximum time GPORCA spends searching for a plan."),
+			gettext_noop("When the budget runs out, GPORCA returns the best plan "
+						 "found so far. Zero means no limit."),
+			GUC_UNIT_MS
+		},
+		&optimizer_search_time_budget,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_join_order_threshold", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Maximum number of join children to use dynamic programming based join ordering algorithm."),
@@ -4259,6 +4432,32 @@ struct config_int ConfigureNamesInt_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_plan_cache_size", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the size of the GPORCA plan cache."),
+			gettext_noop("Plans produced by GPORCA are reused for repeated queries "
+						 "with identical query trees and optimizer settings. "
+						 "Zero disables the cache."),
+			GUC_UNIT_KB
+		},
+		&optimizer_plan_cache_size,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_mdcache_shared_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the size of the GPORCA metadata cache shared by all backends."),
+			gettext_noop("Metadata objects translated by one backend are reused "
+						 "by other backends until the catalog changes. "
+						 "Zero disables the shared cache."),
+			GUC_UNIT_KB
+		},
+		&optimizer_mdcache_shared_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"memory_profiler_dataset_size", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Set the size in GB"),
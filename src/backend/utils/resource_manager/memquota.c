@@ -246,7 +246,9 @@ IsMemoryIntensiveOperator(Node *node, PlannedStmt *stmt)
 	switch(nodeTag(node))
 	{
 		case T_Material:
+		case T_Memoize:
 		case T_Sort:
+		case T_IncrementalSort:
 		case T_ShareInputScan:
 		case T_Hash:
 		case T_BitmapIndexScan:
@@ -36,6 +36,7 @@ struct BulkInsertStateData;
 struct IndexInfo;
 struct SampleScanState;
 struct TBMIterateResult;
+struct TupleBatchData;
 struct VacuumParams;
 struct ValidateIndexState;
 
@@ -277,6 +278,15 @@ typedef struct TableAmRoutine
 									 ScanDirection direction,
 									 TupleTableSlot *slot);
 
+	/*
+	 * GPDB: Return the next batch of rows from a forward scan in column
+	 * vector form, see executor/execBatch.h. Optional; AMs that store data
+	 * column by column can implement it to enable batch-at-a-time execution.
+	 * Returns false at the end of the scan.
+	 */
+	bool		(*scan_getnextbatch) (TableScanDesc scan,
+									  struct TupleBatchData *batch);
+
 
 	/* ------------------------------------------------------------------------
 	 * Parallel table scan related functions.
@@ -1059,6 +1069,24 @@ table_scan_getnextslot(TableScanDesc sscan, ScanDirection direction, TupleTableS
 	return sscan->rs_rd->rd_tableam->scan_getnextslot(sscan, direction, slot);
 }
 
+/*
+ * GPDB: Does the AM of `rel` support fetching rows in batches?
+ */
+static inline bool
+table_scan_supports_batch(Relation rel)
+{
+	return rel->rd_tableam->scan_getnextbatch != NULL;
+}
+
+/*
+ * GPDB: Return the next batch of rows from `scan`, see scan_getnextbatch.
+ */
+static inline bool
+table_scan_getnextbatch(TableScanDesc sscan, struct TupleBatchData *batch)
+{
+	return sscan->rs_rd->rd_tableam->scan_getnextbatch(sscan, batch);
+}
+
 
 /* ----------------------------------------------------------------------------
  * Parallel table scan related functions.
@@ -25,6 +25,15 @@
 #define Anum_pg_aoblkdir_firstrownum   3
 #define Anum_pg_aoblkdir_minipage      4
 
+/*
+ * Block directories of column-oriented tables carry an additional attribute
+ * with the value-range summaries ("zone maps") of the varblocks listed in
+ * the minipage.  Block directories created before it was introduced don't
+ * have it, so check the relation's natts before touching it.
+ */
+#define Natts_pg_aoblkdir_zonemap      5
+#define Anum_pg_aoblkdir_zonemap       5
+
 extern void AlterTableCreateAoBlkdirTable(Oid relOid);
 
 #endif
@@ -42,6 +42,7 @@
  */
 struct DatumStream;
 struct AOCSFileSegInfo;
+struct TupleBatchData;
 
 typedef struct AOCSInsertDescData
 {
@@ -166,6 +167,25 @@ typedef struct AOCSFetchDescData
 
 typedef AOCSFetchDescData *AOCSFetchDesc;
 
+/*
+ * Value range a scan's keys allow for one column, checked against the zone
+ * maps the block directory keeps for that column's varblocks.
+ */
+typedef struct AOCSZoneMapFilter
+{
+	AttrNumber	attno;			/* zero-based column number */
+	bool		needNulls;		/* IS NULL key */
+	bool		needValues;		/* comparison or IS NOT NULL key */
+	int64		lo;				/* inclusive bounds of the wanted values */
+	int64		hi;
+
+	/* Zone maps of the current segment file, ordered by first row number */
+	bool		active;
+	AOBlkDirZoneMapEntry *entries;
+	int			nentries;
+	int			next;
+} AOCSZoneMapFilter;
+
 /*
  * Used for scan of appendoptimized column oriented relations, should be used in
  * the tableam api related code and under it.
@@ -305,6 +325,14 @@ typedef struct AOCSScanDescData
 	 * CO table, starting at a certain logical heap block and ending in another.
 	 */
 	bool 		partialScan;
+
+	/*
+	 * Zone map filters derived from the scan keys. zonemapSkipping is set
+	 * while the current segment file has zone maps for at least one of them.
+	 */
+	AOCSZoneMapFilter *zonemapFilters;
+	int			numZoneMapFilters;
+	bool		zonemapSkipping;
 } AOCSScanDescData;
 
 typedef AOCSScanDescData *AOCSScanDesc;
@@ -427,6 +455,7 @@ extern void aocs_rescan(AOCSScanDesc scan);
 extern void aocs_endscan(AOCSScanDesc scan);
 
 extern bool aocs_getnext(AOCSScanDesc scan, ScanDirection direction, TupleTableSlot *slot);
+extern bool aocs_getnextbatch(AOCSScanDesc scan, struct TupleBatchData *batch);
 extern AOCSInsertDesc aocs_insert_init(Relation rel, int segno, int64 num_rows);
 extern void aocs_insert_values(AOCSInsertDesc idesc, Datum *d, bool *null, AOTupleId *aoTupleId);
 static inline void aocs_insert(AOCSInsertDesc idesc, TupleTableSlot *slot)
@@ -19,6 +19,7 @@
 #include "access/appendonlytid.h"
 #include "access/skey.h"
 #include "catalog/indexing.h"
+#include "catalog/pg_type.h"
 
 extern int gp_blockdirectory_entry_min_range;
 extern int gp_blockdirectory_minipage_size;
@@ -74,6 +75,48 @@ typedef struct Minipage
 	MinipageEntry entry[1];
 } Minipage;
 
+/*
+ * Value-range summary ("zone map") of the varblock described by the
+ * minipage entry at the same position.  Only collected for columns whose
+ * values compare like int64s, see zonemap_type_supported().  An entry
+ * without MINIPAGE_ZONEMAP_VALID describes nothing and never lets a scan
+ * skip its block.
+ */
+#define MINIPAGE_ZONEMAP_VALID		0x01
+#define MINIPAGE_ZONEMAP_HASVALUES	0x02	/* minValue/maxValue are set */
+
+typedef struct MinipageZoneMap
+{
+	int32 flags;
+	int32 nullCount;
+	int64 minValue;
+	int64 maxValue;
+} MinipageZoneMap;
+
+/*
+ * Define a varlena type for the zone maps of a minipage.
+ */
+typedef struct MinipageZoneMaps
+{
+	/* Total length. Must be the first. */
+	int32 _len;
+	uint32 nEntry;
+
+	/* Varlena array */
+	MinipageZoneMap entry[1];
+} MinipageZoneMaps;
+
+/*
+ * A zone map together with the row range of the varblock it summarizes, as
+ * handed out to scans by AppendOnlyBlockDirectory_GetZoneMaps().
+ */
+typedef struct AOBlkDirZoneMapEntry
+{
+	int64 firstRowNum;
+	int64 rowCount;
+	MinipageZoneMap zonemap;
+} AOBlkDirZoneMapEntry;
+
 /*
  * Define the relevant info for a minipage for each
  * column group.
@@ -81,6 +124,7 @@ typedef struct Minipage
 typedef struct MinipagePerColumnGroup
 {
 	Minipage *minipage;
+	MinipageZoneMaps *zonemaps;	/* NULL if the block directory has none */
 	uint32 numMinipageEntries;
 	ItemPointerData tupleTid;
 	/* cached entry number from last call to find_minipage_entry() */
@@ -111,6 +155,7 @@ typedef struct AppendOnlyBlockDirectory
 	CatalogIndexState indinfo;
 	int numColumnGroups;
 	bool isAOCol;
+	bool hasZoneMaps;	/* blkdirRel has the zonemap attribute */
 
 	MemoryContext memoryContext;
 
@@ -268,6 +313,19 @@ AppendOnlyBlockDirectory_InsertEntry(AppendOnlyBlockDirectory *blockDirectory,
 									 int64 firstRowNum,
 									 int64 fileOffset,
 									 int64 rowCount);
+extern bool
+AppendOnlyBlockDirectory_InsertEntryWithZoneMap(AppendOnlyBlockDirectory *blockDirectory,
+												int columnGroupNo,
+												int64 firstRowNum,
+												int64 fileOffset,
+												int64 rowCount,
+												const MinipageZoneMap *zonemap);
+extern AOBlkDirZoneMapEntry *
+AppendOnlyBlockDirectory_GetZoneMaps(Relation aoRel,
+									 Snapshot appendOnlyMetaDataSnapshot,
+									 int segno,
+									 int columnGroupNo,
+									 int *nentries);
 extern void
 AppendOnlyBlockDirectory_DeleteSegmentFile(AppendOnlyBlockDirectory *blockDirectory,
 										   int columnGroupNo,
@@ -338,6 +396,84 @@ minipage_size(uint32 nEntry)
 	return offsetof(Minipage, entry) + sizeof(MinipageEntry) * nEntry;
 }
 
+static inline uint32
+zonemaps_size(uint32 nEntry)
+{
+	return offsetof(MinipageZoneMaps, entry) + sizeof(MinipageZoneMap) * nEntry;
+}
+
+/*
+ * zonemap_type_supported
+ *
+ * Can the values of the given type be summarized in a zone map?  They must
+ * be fixed-width integers, or stored as such, and compare like them.
+ */
+static inline bool
+zonemap_type_supported(Oid typid)
+{
+	switch (typid)
+	{
+		case INT2OID:
+		case INT4OID:
+		case INT8OID:
+		case DATEOID:
+		case TIMESTAMPOID:
+		case TIMESTAMPTZOID:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * zonemap_datum_value
+ *
+ * The int64 a datum of a zonemap_type_supported() type is summarized as.
+ */
+static inline int64
+zonemap_datum_value(Oid typid, Datum d)
+{
+	switch (typid)
+	{
+		case INT2OID:
+			return DatumGetInt16(d);
+		case INT4OID:
+		case DATEOID:
+			return DatumGetInt32(d);
+		default:
+			return DatumGetInt64(d);
+	}
+}
+
+/*
+ * zonemap_add_value
+ *
+ * Account for one value of a varblock in its zone map.
+ */
+static inline void
+zonemap_add_value(MinipageZoneMap *zonemap, Oid typid, Datum d, bool isnull)
+{
+	int64		value;
+
+	if (isnull)
+	{
+		zonemap->nullCount++;
+		return;
+	}
+
+	value = zonemap_datum_value(typid, d);
+	if ((zonemap->flags & MINIPAGE_ZONEMAP_HASVALUES) == 0)
+	{
+		zonemap->flags |= MINIPAGE_ZONEMAP_HASVALUES;
+		zonemap->minValue = value;
+		zonemap->maxValue = value;
+	}
+	else if (value < zonemap->minValue)
+		zonemap->minValue = value;
+	else if (value > zonemap->maxValue)
+		zonemap->maxValue = value;
+}
+
 /*
  * copy_out_minipage
  *
@@ -368,6 +504,44 @@ copy_out_minipage(MinipagePerColumnGroup *minipageInfo,
 	minipageInfo->cached_entry_no = InvalidEntryNum;
 }
 
+/*
+ * copy_out_zonemaps
+ *
+ * Copy out the zone maps of the minipage that copy_out_minipage() has just
+ * copied out.  Zone maps that are missing, or don't line up with the
+ * minipage entries, are treated as describing nothing.
+ */
+static inline void
+copy_out_zonemaps(MinipagePerColumnGroup *minipageInfo,
+				  Datum zonemaps_value,
+				  bool zonemaps_isnull)
+{
+	struct varlena *value;
+	struct varlena *detoast_value;
+
+	if (!zonemaps_isnull)
+	{
+		value = (struct varlena *)
+			DatumGetPointer(zonemaps_value);
+		detoast_value = pg_detoast_datum(value);
+
+		if (VARSIZE(detoast_value) == zonemaps_size(minipageInfo->numMinipageEntries) &&
+			((MinipageZoneMaps *) detoast_value)->nEntry == minipageInfo->numMinipageEntries)
+		{
+			memcpy(minipageInfo->zonemaps, detoast_value, VARSIZE(detoast_value));
+			if (detoast_value != value)
+				pfree(detoast_value);
+			return;
+		}
+
+		if (detoast_value != value)
+			pfree(detoast_value);
+	}
+
+	MemSet(minipageInfo->zonemaps->entry, 0,
+		   minipageInfo->numMinipageEntries * sizeof(MinipageZoneMap));
+}
+
 static inline void
 AOBlkDirScan_Init(AOBlkDirScan blkdirscan,
 				  AppendOnlyBlockDirectory *blkdir)
@@ -26,6 +26,7 @@
 #include "cdb/tupchunk.h"
 #include "cdb/tupchunklist.h"
 #include "cdb/tupleremap.h"
+#include "portability/instr_time.h"
 
 struct CdbProcess;                          /* #include "nodes/execnodes.h" */
 struct ExecSlice;                           /* #include "nodes/execnodes.h" */
@@ -438,6 +439,17 @@ typedef struct MotionNodeEntry
 	bool            moreNetWork;
 	bool            stopped;
 
+	/*
+	 * Send tuples in the columnar batch format.  On the sending side, the
+	 * tuples are collected in a batch per route, indexed by route + 1 with
+	 * the broadcast route at index 0.  A batch is sent once it holds
+	 * batch_max_bytes of tuple data.
+	 */
+	bool            batch_format;
+	struct MotionSendBatch **send_batches;
+	int             num_send_batches;
+	int             batch_max_bytes;
+
 	/*
 	 * PER-MOTION-NODE STATISTICS
 	 */
@@ -457,6 +469,19 @@ typedef struct MotionNodeEntry
 	uint64          stat_tuples_available;  /* Total tuples awaiting receive. */
 	uint64          stat_tuples_available_hwm;              /* High-water-mark of this
 		* value. */
+
+	/*
+	 * Adaptive tuple compression, on the sending side.  While compression is
+	 * off, a sample of the sends is timed to measure the throughput of the
+	 * link; while it is on, the compression ratio is checked over each
+	 * window of sends.
+	 */
+	bool            compress_adaptive;      /* may switch compression on or off */
+	uint64          compress_window_sends;  /* sends in the current window */
+	uint64          compress_window_bytes;  /* bytes sent by the timed sends */
+	instr_time      compress_window_time;   /* time the timed sends took */
+	uint64          compress_window_raw;    /* compression counters at the */
+	uint64          compress_window_wire;   /* start of the window */
 }       MotionNodeEntry;
 
 
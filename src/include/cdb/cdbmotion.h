@@ -52,7 +52,10 @@ extern MotionLayerState *createMotionLayerState(int maxMotNodeID);
 
 /* Initialization of each motion node in execution plan. */
 extern void UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserveOrder,
-								  TupleDesc tupDesc);
+								  TupleDesc tupDesc, bool compress);
+
+/* Bytes that tuple compression saved on the wire for a motion node. */
+extern uint64 GetMotionLayerNodeBytesSaved(MotionLayerState *mlStates, int16 motNodeID);
 
 /* Cleanup of each motion node in execution plan (normal termination). */
 extern void EndMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool flushCommLayer);
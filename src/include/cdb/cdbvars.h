@@ -391,6 +391,35 @@ extern bool gp_interconnect_aggressive_retry; /* fast-track app-level retry */
  */
 extern bool gp_interconnect_full_crc;
 
+/*
+ * Parameter gp_interconnect_batch_io
+ *
+ * Send and receive UDP-packets in batches, with sendmmsg() and recvmmsg(),
+ * where the platform supports them.
+ */
+extern bool gp_interconnect_batch_io;
+
+/*
+ * Parameter gp_motion_columnar_batch
+ *
+ * Send the tuples of a Motion in batches laid out column by column, with a
+ * null bitmap per column, instead of one at a time.  Motions whose tuples
+ * contain types that might need remapping keep the tuple-at-a-time format.
+ */
+extern bool gp_motion_columnar_batch;
+
+/*
+ * Parameter gp_motion_compression
+ *
+ * Compress the tuples sent through a Motion when the planner estimates that
+ * it moves wide rows (at least gp_motion_compression_min_width bytes wide),
+ * or when the sender measures a link throughput below
+ * gp_motion_compression_throughput_threshold kB/s.
+ */
+extern bool gp_motion_compression;
+extern int	gp_motion_compression_min_width;
+extern int	gp_motion_compression_throughput_threshold;
+
 /*
  * Parameter gp_interconnect_log_stats
  *
@@ -548,6 +577,24 @@ extern bool gp_adjust_selectivity_for_outerjoins;
  */
 extern int gp_hashjoin_tuples_per_bucket;
 
+/*
+ * Push a Bloom filter built from the inner side of a hash join down into the
+ * scan on its outer side.
+ */
+extern bool gp_enable_runtime_filter;
+
+/*
+ * Scan AOCS tables a batch of rows at a time, evaluating simple quals and
+ * aggregates over column vectors.
+ */
+extern bool gp_enable_aocs_batch_scan;
+
+/*
+ * Skip the varblocks of AOCS tables whose zone maps, kept in the block
+ * directory, show that they hold no rows satisfying the scan's quals.
+ */
+extern bool gp_enable_aocs_block_skipping;
+
 /*
  * Damping of selectivities of clauses which pertain to the same base
  * relation; compensates for undetected correlation
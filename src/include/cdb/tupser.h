@@ -60,6 +60,24 @@ typedef struct SerTupInfo
 
 	/* true if tupdesc contains record types */
 	bool		has_record_types;
+
+	/*
+	 * Compress tuple bodies before sending them.  Set by the Motion layer on
+	 * the sending side; the receiving side decompresses whatever arrives.
+	 */
+	bool		compress;
+	char	   *compressbuf;	/* scratch space for a compressed body */
+	int			compressbuflen;
+
+	/*
+	 * Bytes of tuple data that compression was applied to, before and after
+	 * compression (tuples that did not shrink count the same on both sides).
+	 */
+	uint64		compress_raw_bytes;
+	uint64		compress_wire_bytes;
+
+	/* Scratch space for a batch in the columnar format */
+	StringInfoData batchbuf;
 }	SerTupInfo;
 
 /*
@@ -89,4 +107,15 @@ extern int SerializeTuple(TupleTableSlot *tuple, SerTupInfo *pSerInfo, struct di
  */
 extern MinimalTuple CvtChunksToTup(TupleChunkList tclist, SerTupInfo *pSerInfo, TupleRemapper *remapper);
 
+/* Can tuples be sent in the columnar batch format? */
+extern bool CandidateForSerializeBatch(SerTupInfo *pSerInfo);
+
+/* Convert a batch of tuples into the columnar format, and into chunks */
+extern int SerializeTupleBatch(SerTupInfo *pSerInfo, MinimalTuple *tuples, int ntuples,
+							   struct directTransportBuffer *b, TupleChunkList tcList,
+							   int16 targetRoute);
+
+/* Convert a sequence of chunks holding a columnar batch into MinimalTuples */
+extern int CvtChunksToTupBatch(TupleChunkList tclist, SerTupInfo *pSerInfo, MinimalTuple **tuples);
+
 #endif   /* TUPSER_H */
@@ -35,6 +35,7 @@ typedef struct ExplainState
 	bool		buffers;		/* print buffer usage */
 	bool		dxl;			/* CDB: print DXL */
 	bool		slicetable;		/* CDB: print slice table */
+	bool		optimizer_profile;	/* CDB: print GPORCA xform and job profile */
 	bool		memory_detail;	/* CDB: print per-node memory usage */
 	bool		timing;			/* print detailed node timing */
 	bool		summary;		/* print total planning and execution timing */
@@ -54,6 +55,7 @@ typedef struct ExplainState
     struct CdbExplain_ShowStatCtx  *showstatctx;    /* EXPLAIN ANALYZE info */
 	ExecSlice  *currentSlice;	/* slice whose nodes we are visiting */
 	bool		subplanDispatchedSeparately;
+	List	   *optimizer_profile_entries;	/* GPORCA profile of the query */
 
 	PlanState  *parentPlanState;
 } ExplainState;
@@ -0,0 +1,125 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.h
+ *	  Batch-at-a-time execution support for column-oriented scans.
+ *
+ * Portions Copyright (c) 2012-Present VMware, Inc. or its affiliates.
+ *
+ *
+ * IDENTIFICATION
+ *	  src/include/executor/execBatch.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXECBATCH_H
+#define EXECBATCH_H
+
+#include "access/attnum.h"
+#include "access/tupdesc.h"
+#include "executor/tuptable.h"
+#include "nodes/pg_list.h"
+#include "storage/itemptr.h"
+
+/* Maximum number of rows a table AM hands out per batch */
+#define TUPLE_BATCH_SIZE	1024
+
+/*
+ * TupleBatch
+ *
+ * A set of rows in column-vector form.  The table AM fills the vectors of the
+ * attributes it projects (values[attno] is NULL for the others) and lists
+ * the rows that are visible in the selection vector; vectorized quals then
+ * narrow the selection vector down in place.  Pass-by-reference datums may
+ * point into the AM's read buffers, so they are only valid until the next
+ * batch is fetched.
+ */
+typedef struct TupleBatchData
+{
+	TupleDesc	tupdesc;		/* descriptor of the scanned relation */
+	int			maxrows;		/* capacity of the vectors */
+	int			nrows;			/* number of rows in the vectors */
+
+	Datum	  **values;			/* per-attribute value vectors */
+	bool	  **isnull;			/* per-attribute null vectors */
+	int			ncols;			/* number of attributes with vectors */
+	AttrNumber *cols;			/* their zero-based numbers */
+	ItemPointerData *tids;		/* tids of the selected rows */
+
+	int			nsel;			/* number of selected rows */
+	int		   *sel;			/* positions of selected rows, ascending */
+	int			next;			/* next entry of sel[] to return as a tuple */
+
+	int64	   *ibuf;			/* scratch vectors for aggregation */
+	float8	   *fbuf;
+
+	MemoryContext mcxt;			/* context holding the vectors */
+} TupleBatchData;
+
+typedef TupleBatchData *TupleBatch;
+
+/*
+ * Value representation a vectorized qual or aggregate works on.  date is
+ * stored as an int32 and compares like one, so it shares BATCH_TYPE_INT4.
+ */
+typedef enum BatchValueType
+{
+	BATCH_TYPE_INT2,
+	BATCH_TYPE_INT4,
+	BATCH_TYPE_INT8,
+	BATCH_TYPE_FLOAT8
+} BatchValueType;
+
+typedef enum BatchQualKind
+{
+	BATCH_QUAL_LT,
+	BATCH_QUAL_LE,
+	BATCH_QUAL_EQ,
+	BATCH_QUAL_NE,
+	BATCH_QUAL_GE,
+	BATCH_QUAL_GT,
+	BATCH_QUAL_ISNULL,
+	BATCH_QUAL_ISNOTNULL
+} BatchQualKind;
+
+/* A "column <op> constant" or "column IS [NOT] NULL" conjunct */
+typedef struct BatchQual
+{
+	BatchQualKind kind;
+	BatchValueType type;
+	AttrNumber	attno;			/* zero-based attribute number */
+	Datum		constval;
+} BatchQual;
+
+/* Transition functions that can be advanced over a whole batch at once */
+typedef enum BatchAggKind
+{
+	BATCH_AGG_NONE,
+	BATCH_AGG_COUNT_STAR,
+	BATCH_AGG_COUNT,
+	BATCH_AGG_SUM,				/* int2/int4 summed into an int8 state */
+	BATCH_AGG_SUM_FLOAT8,
+	BATCH_AGG_MIN,
+	BATCH_AGG_MAX
+} BatchAggKind;
+
+typedef struct BatchAggTrans
+{
+	BatchAggKind kind;
+	BatchValueType type;
+	AttrNumber	attno;			/* zero-based input attribute, if any */
+} BatchAggTrans;
+
+extern TupleBatch ExecBatchCreate(TupleDesc tupdesc, int maxrows);
+extern void ExecBatchEnsureColumn(TupleBatch batch, AttrNumber attno);
+extern bool ExecBatchStoreNext(TupleBatch batch, TupleTableSlot *slot);
+
+extern List *ExecBatchSplitQual(List *qual, Index scanrelid,
+								BatchQual **bquals, int *nbquals);
+extern void ExecBatchQual(TupleBatch batch, BatchQual *bquals, int nbquals);
+
+extern bool ExecBatchAggSupported(Oid transfn_oid, BatchAggTrans *btrans);
+extern void ExecBatchAdvanceAgg(TupleBatch batch, BatchAggTrans *btrans,
+								Datum *transValue, bool *transValueIsNull,
+								bool *noTransValue);
+
+#endif							/* EXECBATCH_H */
@@ -396,6 +396,10 @@ typedef struct HashJoinTableData
     HashJoinState * hjstate; /* reference to the enclosing HashJoinState */
     bool first_pass; /* Is this the first pass (pre-rescan) */
 
+	/* GPDB: Bloom filter over the hash values of the inner tuples, or NULL */
+	struct bloom_filter *bloom;
+	Size		spaceBloom;		/* bytes of spaceAllowed given to the filter */
+
 	/* used for dense allocation of tuples (into linked chunks) */
 	HashMemoryChunk chunks;		/* one list for the whole batch */
 
@@ -32,5 +32,7 @@ extern void ExecHashJoinSaveTuple(PlanState *ps, MinimalTuple tuple, uint32 hash
 								  HashJoinTable hashtable, BufFile **fileptr,
 								  MemoryContext bfCxt);
 extern void ExecSquelchHashJoin(HashJoinState *node);
+extern bool ExecHashJoinRuntimeFilter(RuntimeFilterState *rfstate,
+									  TupleTableSlot *slot);
 
 #endif							/* NODEHASHJOIN_H */
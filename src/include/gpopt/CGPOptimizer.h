@@ -47,6 +47,8 @@ extern "C" {
 extern PlannedStmt *GPOPTOptimizedPlan(Query *query,
 									   bool *had_unexpected_failure);
 extern char *SerializeDXLPlan(Query *query);
+extern List *GetOptimizerProfile(bool cumulative);
+extern void ResetOptimizerProfile();
 extern void InitGPOPT();
 extern void TerminateGPOPT();
 }
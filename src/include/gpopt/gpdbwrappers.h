@@ -148,6 +148,9 @@ Bitmapset *BmsAddMember(Bitmapset *a, int x);
 // create a copy of an object
 void *CopyObject(void *from);
 
+// create a copy of an object in the given memory context
+void *CopyObjectInContext(MemoryContext context, void *from);
+
 // datum size
 Size DatumSize(Datum value, bool type_by_val, int type_len);
 
@@ -615,6 +618,20 @@ FaultInjectorType_e InjectFaultInOptTasks(const char *fault_name);
 // table has been changed?)
 bool MDCacheNeedsReset(void);
 
+// is the metadata cache shared by all backends enabled?
+bool MDSharedCacheEnabled(void);
+
+// current generation of the shared metadata cache
+uint64 MDSharedCacheGetGeneration(void);
+
+// look up a serialized metadata object in the shared metadata cache
+char *MDSharedCacheLookup(const char *key, Size *len);
+
+// store a serialized metadata object in the shared metadata cache, along
+// with the relation and column it describes, if any
+void MDSharedCacheInsert(const char *key, uint64 generation, Oid relid,
+						 AttrNumber attnum, const char *value, Size len);
+
 // returns true if a query cancel is requested in GPDB
 bool IsAbortRequested(void);
 
@@ -638,6 +655,8 @@ void *GPDBMemoryContextAlloc(MemoryContext context, Size size);
 
 MemoryContext GPDBAllocSetContextCreate();
 
+MemoryContext GPDBArenaContextCreate();
+
 void GPDBMemoryContextDelete(MemoryContext context);
 
 List *GetRelChildIndexes(Oid reloid);
@@ -676,6 +695,9 @@ PartitionKey GPDBRelationRetrievePartitionKey(Relation rel);
 
 bool TestexprIsHashable(Node *testexpr, List *param_ids);
 
+// build a Memoize node caching the rows of a plan per param values
+Memoize *MakeMemoizeForParams(Plan *lefttree, List *param_exprs, double calls);
+
 gpos::BOOL WalkQueryTree(Query *query, bool (*walker)(), void *context,
 						 int flags);
 
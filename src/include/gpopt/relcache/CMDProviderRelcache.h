@@ -40,16 +40,27 @@ using namespace gpos;
 //		CMDProviderRelcache
 //
 //	@doc:
-//		Relcache-based provider of metadata objects.
+//		Relcache-based provider of metadata objects. When the metadata
+//		cache shared by all backends is enabled, objects are looked up
+//		there before translating them from the relcache, and translated
+//		objects are added to it.
 //
 //---------------------------------------------------------------------------
 class CMDProviderRelcache : public IMDProvider
 {
+private:
+	// is the shared metadata cache used?
+	BOOL m_use_shared_cache;
+
+	// generation of the shared metadata cache when the provider started
+	// reading the catalog
+	ULLONG m_shared_generation;
+
 public:
 	CMDProviderRelcache(const CMDProviderRelcache &) = delete;
 
 	// ctor/dtor
-	CMDProviderRelcache() = default;
+	CMDProviderRelcache();
 
 	~CMDProviderRelcache() override = default;
 
@@ -189,6 +189,11 @@ public:
 	// translate the join types from its DXL representation to the GPDB one
 	static JoinType GetGPDBJoinTypeFromDXLJoinType(EdxlJoinType join_type);
 
+	// put a Memoize node over a plan rescanned with new values of the given
+	// PARAM_EXEC params
+	Plan *MemoizeRescannedPlan(Plan *plan, List *param_exprs,
+							   DOUBLE num_rescans, BOOL singlerow);
+
 private:
 	// Set the bitmapset of a plan to the list of param_ids defined by the plan
 	static void SetParamIds(Plan *);
@@ -32,6 +32,10 @@ private:
 	struct SArrayAllocHeader
 	{
 		ULONG m_user_size;
+
+		// always zero; this word directly precedes the user memory and
+		// must never look like the tag of a CMemoryPoolArena allocation
+		ULONG m_tag;
 	};
 
 public:
@@ -53,6 +57,13 @@ public:
 
 	// get user requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
+
+	// memory context backing the pool
+	MemoryContext
+	GetMemoryContext() const
+	{
+		return m_cxt;
+	}
 };
 }  // namespace gpos
 
@@ -0,0 +1,49 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolPallocArena.h
+//
+//	@doc:
+//		Bump-pointer memory pool whose slabs come from a PostgreSQL memory
+//		context
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CMemoryPoolPallocArena_H
+#define GPDXL_CMemoryPoolPallocArena_H
+
+#include "gpos/base.h"
+#include "gpos/memory/CMemoryPoolArena.h"
+
+namespace gpos
+{
+// Arena pool that obtains its slabs with palloc, so that the memory used
+// by an optimization is accounted for like any other backend memory.
+class CMemoryPoolPallocArena : public CMemoryPoolArena
+{
+private:
+	MemoryContext m_cxt{nullptr};
+
+protected:
+	// palloc a slab in the pool's context
+	void *AllocSlab(ULLONG size) override;
+
+	// pfree a slab
+	void FreeSlab(void *slab) override;
+
+public:
+	CMemoryPoolPallocArena(const CMemoryPoolPallocArena &) = delete;
+
+	// ctor
+	CMemoryPoolPallocArena();
+
+	// prepare the memory pool to be deleted
+	void TearDown() override;
+};
+}  // namespace gpos
+
+#endif	// !GPDXL_CMemoryPoolPallocArena_H
+
+// EOF
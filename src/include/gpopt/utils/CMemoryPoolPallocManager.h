@@ -7,7 +7,7 @@
 //
 //	@doc:
 //		MemoryPoolManager implementation that creates
-//		CMemoryPoolPalloc memory pools
+//		CMemoryPoolPalloc and CMemoryPoolPallocArena memory pools
 //
 //---------------------------------------------------------------------------
 
@@ -33,6 +33,9 @@ public:
 	// allocate new memorypool
 	CMemoryPool *NewMemoryPool() override;
 
+	// allocate new memorypool for allocation-heavy, short-lived work
+	CMemoryPool *NewArenaMemoryPool() override;
+
 	// free allocation
 	void DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat) override;
 
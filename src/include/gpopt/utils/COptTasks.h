@@ -133,6 +133,10 @@ private:
 		const CDXLNode *dxlnode, bool can_set_tag,
 		DistributionHashOpsKind distribution_hashops);
 
+	// can the plan of the given query be reused from the plan cache
+	static BOOL IsPlanCacheable(const Query *query,
+								const PlannedStmt *plan_stmt);
+
 	// load search strategy from given path
 	static CSearchStageArray *LoadSearchStrategy(CMemoryPool *mp, char *path);
 
@@ -164,6 +168,13 @@ public:
 
 	// enable/disable a given xforms
 	static bool SetXform(char *xform_str, bool should_disable);
+
+	// counters of the optimization profile, of the last optimization
+	// request or of all requests since the last reset
+	static List *GetOptimizerProfile(bool cumulative);
+
+	// clear the optimization profile
+	static void ResetOptimizerProfile();
 };
 
 #endif	// COptTasks_H
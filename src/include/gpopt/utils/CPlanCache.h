@@ -0,0 +1,225 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPlanCache.h
+//
+//	@doc:
+//		Backend-local cache of plans produced by the optimizer, keyed by
+//		the serialized query DXL and the optimizer configuration
+//
+//	@test:
+//
+//
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPlanCache_H
+#define GPOPT_CPlanCache_H
+
+#include "gpos/base.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/memory/CCache.h"
+#include "gpos/memory/CCacheAccessor.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/operators/CDXLNode.h"
+#include "naucrates/md/IMDId.h"
+
+struct PlannedStmt;
+
+namespace gpopt
+{
+class COptimizerConfig;
+}
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCacheKey
+//
+//	@doc:
+//		Key of a cached plan: text describing everything the optimizer
+//		consumed to produce the plan, except for catalog contents which
+//		are covered by invalidating the whole cache
+//
+//---------------------------------------------------------------------------
+class CPlanCacheKey
+{
+private:
+	// key text
+	const CWStringBase *m_str;
+
+	// cached hash value of the key text
+	ULONG m_hash;
+
+public:
+	// ctor
+	explicit CPlanCacheKey(const CWStringBase *str);
+
+	// key text
+	const CWStringBase *
+	Str() const
+	{
+		return m_str;
+	}
+
+	// equality function for using plan keys in a cache
+	static BOOL FEqualPlanKey(CPlanCacheKey *const &pkeyLeft,
+							  CPlanCacheKey *const &pkeyRight);
+
+	// hash function for using plan keys in a cache
+	static ULONG UlHashPlanKey(CPlanCacheKey *const &pkey);
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCacheEntry
+//
+//	@doc:
+//		Value of a cached plan: the translated plan and the columns that
+//		were found to have no statistics while producing it, so that a
+//		cache hit can report them just like an optimization would
+//
+//---------------------------------------------------------------------------
+class CPlanCacheEntry : public CRefCount
+{
+private:
+	// cached plan, allocated in the memory context of the entry pool
+	PlannedStmt *m_plan_stmt;
+
+	// mdids of the columns with missing statistics
+	IMdIdArray *m_missing_col_stats;
+
+public:
+	CPlanCacheEntry(const CPlanCacheEntry &) = delete;
+
+	// ctor
+	CPlanCacheEntry(PlannedStmt *plan_stmt, IMdIdArray *missing_col_stats);
+
+	// dtor
+	~CPlanCacheEntry() override;
+
+	// cached plan; callers must copy it before modifying it
+	PlannedStmt *
+	PplstmtPlan() const
+	{
+		return m_plan_stmt;
+	}
+
+	// mdids of the columns with missing statistics
+	IMdIdArray *
+	PdrgpmdidMissingColStats() const
+	{
+		return m_missing_col_stats;
+	}
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCache
+//
+//	@doc:
+//		Global (per-backend) instance of the plan cache; every cached plan
+//		lives in the memory pool of its cache entry
+//
+//		Constants are part of the query DXL and thus of the key, so queries
+//		that differ only in their literals do not share a plan. The plans
+//		depend on the constants through partition selection, direct
+//		dispatch and cardinality estimates, so sharing them would require
+//		generic plans with parameters in place of the constants.
+//
+//---------------------------------------------------------------------------
+class CPlanCache
+{
+public:
+	using PlanCache = CCache<CPlanCacheEntry *, CPlanCacheKey *>;
+	using PlanCacheAccessor =
+		CCacheAccessor<CPlanCacheEntry *, CPlanCacheKey *>;
+
+private:
+	// pointer to the underlying cache
+	static PlanCache *m_pcache;
+
+	// number of lookups served from the cache
+	static ULLONG m_ullHits;
+
+	// number of lookups that missed the cache
+	static ULLONG m_ullMisses;
+
+	// private ctor
+	CPlanCache() = default;
+
+	// private dtor
+	~CPlanCache() = default;
+
+public:
+	CPlanCache(const CPlanCache &) = delete;
+
+	// initialize underlying cache with the given quota in bytes
+	static void Init(ULLONG ullCacheQuota);
+
+	// has cache been initialized?
+	static BOOL
+	FInitialized()
+	{
+		return (nullptr != m_pcache);
+	}
+
+	// destroy global instance
+	static void Shutdown();
+
+	// drop all cached plans
+	static void Reset();
+
+	// set the maximum size of the cache
+	static void SetCacheQuota(ULLONG ullCacheQuota);
+
+	// build the key text for an optimization request
+	static CWStringDynamic *PstrKey(
+		CMemoryPool *mp, const CDXLNode *query_dxl,
+		const CDXLNodeArray *query_output_dxlnode_array,
+		const CDXLNodeArray *cte_dxlnode_array,
+		const COptimizerConfig *optimizer_config, ULONG num_segments,
+		const CHAR *search_strategy_path);
+
+	// accessor to the underlying cache
+	static PlanCache *
+	Pcache()
+	{
+		return m_pcache;
+	}
+
+	// look up a plan; the entry stays pinned as long as the accessor lives
+	static CPlanCacheEntry *PentryLookup(PlanCacheAccessor *pacc,
+										 const CWStringBase *pstrKey);
+
+	// store a copy of the given plan and missing statistics under the
+	// given key
+	static void Insert(const CWStringBase *pstrKey, PlannedStmt *plan_stmt,
+					   const IMdIdArray *missing_col_stats);
+
+	// number of lookups served from the cache
+	static ULLONG
+	UllHits()
+	{
+		return m_ullHits;
+	}
+
+	// number of lookups that missed the cache
+	static ULLONG
+	UllMisses()
+	{
+		return m_ullMisses;
+	}
+
+};	// class CPlanCache
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPlanCache_H
+
+// EOF
@@ -15,6 +15,7 @@
 
 typedef struct bloom_filter bloom_filter;
 
+extern uint64 bloom_bitset_bytes(int64 total_elems, int bloom_work_mem);
 extern bloom_filter *bloom_create(int64 total_elems, int bloom_work_mem,
 								  uint64 seed);
 extern void bloom_free(bloom_filter *filter);
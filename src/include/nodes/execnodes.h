@@ -18,6 +18,7 @@
 
 #include "access/tupconvert.h"
 #include "executor/instrument.h"
+#include "lib/ilist.h"
 #include "lib/pairingheap.h"
 #include "nodes/params.h"
 #include "nodes/parsenodes.h"
@@ -1474,6 +1475,8 @@ typedef enum
  *		currentRelation    relation being scanned (NULL if none)
  *		currentScanDesc    current scan descriptor for scan (NULL if none)
  *		ScanTupleSlot	   pointer to slot in tuple table holding scan tuple
+ *		runtimeFilter	   GPDB: filter pushed down from a hash join (NULL
+ *						   if none)
  * ----------------
  */
 typedef struct ScanState
@@ -1482,6 +1485,7 @@ typedef struct ScanState
 	Relation	ss_currentRelation;
 	struct TableScanDescData *ss_currentScanDesc;
 	TupleTableSlot *ss_ScanTupleSlot;
+	struct RuntimeFilterState *ss_runtimeFilter;
 } ScanState;
 
 /* ----------------
@@ -1492,6 +1496,11 @@ typedef struct SeqScanState
 {
 	ScanState	ss;				/* its first field is NodeTag */
 	Size		pscan_len;		/* size of parallel heap scan descriptor */
+
+	/* GPDB: batch-at-a-time scan, see execBatch.c */
+	struct TupleBatchData *batch;	/* current batch, NULL if not batching */
+	struct BatchQual *batchquals;	/* quals evaluated over whole batches */
+	int			nbatchquals;
 } SeqScanState;
 
 /* ----------------
@@ -2366,6 +2375,31 @@ typedef struct HashJoinState
 	bool reuse_hashtable; /* Do we need to preserve hash table to support rescan */
 } HashJoinState;
 
+/* ----------------
+ *	 RuntimeFilterState information
+ *
+ *		A runtime filter lets the scan on the outer side of a hash join drop
+ *		the tuples whose hash keys cannot be found in the inner side, before
+ *		they reach the join.  The hash join builds a Bloom filter over the
+ *		hash values of its inner tuples (see MultiExecPrivateHash()), and
+ *		the scan probes it with the hash values of its output tuples.  Until
+ *		the filter is built, or if it turns out to be useless, every tuple
+ *		passes.
+ *
+ *		hjstate			the hash join the filter comes from
+ *		hashkeys		outer hash keys of the join, over the scan's output
+ *		econtext		context for evaluating hashkeys
+ *		nremoved		number of tuples dropped so far
+ * ----------------
+ */
+typedef struct RuntimeFilterState
+{
+	HashJoinState *hjstate;
+	List	   *hashkeys;		/* list of ExprState nodes */
+	ExprContext *econtext;
+	uint64		nremoved;
+} RuntimeFilterState;
+
 
 /* ----------------------------------------------------------------
  *				 Materialization State Information
@@ -2395,6 +2429,63 @@ typedef struct MaterialState
 	bool		cdb_strict;
 } MaterialState;
 
+/* ----------------
+ *	 MemoizeState information
+ *
+ *		memoize nodes are used to cache recent and commonly seen results from
+ *		a parameterized scan.
+ * ----------------
+ */
+struct MemoizeEntry;
+struct MemoizeTuple;
+struct MemoizeKey;
+
+typedef struct MemoizeInstrumentation
+{
+	uint64		cache_hits;		/* number of rescans where we've found the
+								 * scan parameter values to be cached */
+	uint64		cache_misses;	/* number of rescans where we've not found the
+								 * scan parameter values to be cached. */
+	uint64		cache_evictions;	/* number of cache entries removed due to
+									 * the need to free memory */
+	uint64		cache_overflows;	/* number of times we've had to bypass the
+									 * cache when filling it due to not being
+									 * able to free enough space to store the
+									 * current scan's tuples. */
+	uint64		mem_peak;		/* peak memory usage in bytes */
+} MemoizeInstrumentation;
+
+typedef struct MemoizeState
+{
+	ScanState	ss;				/* its first field is NodeTag */
+	int			mstatus;		/* value of ExecMemoize state machine */
+	int			nkeys;			/* number of cache keys */
+	struct memoize_hash *hashtable; /* hash table for cache entries */
+	TupleDesc	hashkeydesc;	/* tuple descriptor for cache keys */
+	TupleTableSlot *tableslot;	/* min tuple slot for existing cache entries */
+	TupleTableSlot *probeslot;	/* virtual slot used for hash lookups */
+	ExprState  *cache_eq_expr;	/* Compare exec params to hash key */
+	ExprState **param_exprs;	/* exprs containing the parameters to this
+								 * node */
+	FmgrInfo   *hashfunctions;	/* lookup data for hash funcs nkeys in size */
+	Oid		   *collations;		/* collation for comparisons nkeys in size */
+	uint64		mem_used;		/* bytes of memory used by cache */
+	uint64		mem_limit;		/* memory limit in bytes for the cache */
+	MemoryContext tableContext; /* memory context to store cache data */
+	dlist_head	lru_list;		/* least recently used entry list */
+	struct MemoizeTuple *last_tuple;	/* Used to point to the last tuple
+										 * returned during a cache hit and the
+										 * tuple we last stored when
+										 * populating the cache. */
+	struct MemoizeEntry *entry; /* the entry that 'last_tuple' belongs to or
+								 * NULL if 'last_tuple' is NULL. */
+	bool		singlerow;		/* true if the cache entry is to be marked as
+								 * complete after caching the first tuple. */
+	MemoizeInstrumentation stats;	/* execution statistics */
+	Bitmapset  *keyparamids;	/* Param->paramids of expressions belonging to
+								 * param_exprs */
+} MemoizeState;
+
 /* ----------------
  *	  ShareInputScanState information
  *
@@ -2455,6 +2546,44 @@ typedef struct SortState
 
 } SortState;
 
+/* ----------------
+ *	 Instrumentation information for IncrementalSort
+ * ----------------
+ */
+typedef struct IncrementalSortInfo
+{
+	int64		batchCount;		/* number of batches sorted */
+	int64		maxBatchTuples; /* rows in the largest batch */
+	int64		diskBatchCount; /* number of batches that spilled to disk */
+	long		maxSpaceUsed;	/* largest space used by a batch, in kB */
+} IncrementalSortInfo;
+
+/* ----------------
+ *	 IncrementalSortState information
+ *
+ *		The input is read in batches made of whole groups of rows sharing
+ *		the presorted columns, each of them sorted on its own.
+ * ----------------
+ */
+typedef struct IncrementalSortState
+{
+	ScanState	ss;				/* its first field is NodeTag */
+	bool		bounded;		/* is the result set bounded? */
+	int64		bound;			/* if bounded, how many tuples are needed */
+	int64		bound_Done;		/* tuples returned so far */
+	bool		outerNodeDone;	/* finished fetching tuples from outer node */
+	bool		batchSorted;	/* is the current batch sorted and being
+								 * returned? */
+	int64		batchTuples;	/* rows in the current batch */
+	ExprState  *presortedEq;	/* compares the presorted columns of the
+								 * inner (pivot) and outer tuples */
+	TupleTableSlot *group_pivot;	/* first tuple of the trailing group of
+									 * the current batch */
+	TupleTableSlot *transfer_tuple; /* first tuple of the next batch */
+	void	   *batchsortstate; /* private state of tuplesort.c */
+	IncrementalSortInfo incsort_info;
+} IncrementalSortState;
+
 /* ---------------------
  *	AggState information
  *
@@ -2559,6 +2688,10 @@ typedef struct AggState
 
 	/* stream entries when out of memory instead of spilling to disk */
 	bool		streaming;
+
+	/* GPDB: plain aggregation over column vectors of a batch mode scan */
+	SeqScanState *batch_input;	/* the scan, or NULL if not batching */
+	struct BatchAggTrans *batch_trans;	/* per-trans batch info */
 } AggState;
 
 typedef struct TupleSplitState
@@ -2804,6 +2937,7 @@ typedef struct HashState
 	bool		hs_keepnull;	/* Keep nulls */
 	bool		hs_quit_if_hashkeys_null;	/* quit building hash table if hashkeys are all null */
 	bool		hs_hashkeys_null;	/* found an instance wherein hashkeys are all null */
+	bool		hs_runtimeFilter;	/* build a runtime filter for the outer side */
 	/* hashkeys is same as parent's hj_InnerHashKeys */
 
 	SharedHashInfo *shared_info;	/* one entry per worker * Greenplum: per QE */
@@ -2955,6 +3089,10 @@ typedef struct MotionState
 	List	   *hashExprs;		/* state struct used for evaluating the hash expressions */
 	struct CdbHash *cdbhash;	/* hash api object */
 	int			numHashSegments;	/* number of segments to use when calculating hash */
+	uint32	   *skewHotHashes;	/* raw cdbhash values of the skew hot keys */
+	int			numSkewHotHashes;
+	int			skewNextRoute;	/* next route for round-robin hot-key rows */
+	uint64		numSkewTuples;	/* hot-key rows spread or broadcast */
 
 	/* For Motion recv */
 	int			routeIdNext;	/* for a sorted motion node, the routeId to get next (same as
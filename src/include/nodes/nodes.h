@@ -95,7 +95,9 @@ typedef enum NodeTag
 	T_MergeJoin,
 	T_HashJoin,
 	T_Material,
+	T_Memoize,
 	T_Sort,
+	T_IncrementalSort,
 	T_Agg,
 	T_TupleSplit,
 	T_WindowAgg,
@@ -169,7 +171,9 @@ typedef enum NodeTag
 	T_MergeJoinState,
 	T_HashJoinState,
 	T_MaterialState,
+	T_MemoizeState,
 	T_SortState,
+	T_IncrementalSortState,
 	T_AggState,
 	T_TupleSplitState,
 	T_WindowAggState,
@@ -78,6 +78,17 @@ typedef struct PlannedStmt
 
 	PlanGenerator	planGen;		/* optimizer generation */
 
+	int			optimizerCutoffStage;	/* GPORCA search stage, counted from 1,
+										 * cut off by the search time budget;
+										 * 0 if the search completed */
+
+	bool		optimizerFastPath;	/* planned by the Postgres planner
+									 * because the query was too simple
+									 * for GPORCA */
+
+	bool		optimizerPlanCacheHit;	/* copied from the GPORCA plan
+										 * cache instead of optimized */
+
 	uint64		queryId;		/* query identifier (copied from Query) */
 
 	bool		hasReturning;	/* is it insert|update|delete RETURNING? */
@@ -1212,6 +1223,33 @@ typedef struct Material
 	bool		cdb_shield_child_from_rescans;
 } Material;
 
+/* ----------------
+ *		memoize node
+ *
+ * Caches the rows its subplan returns for each distinct set of values of
+ * the PARAM_EXEC params in param_exprs, so that rescanning the subplan
+ * with parameter values seen before returns the cached rows instead.
+ * ----------------
+ */
+typedef struct Memoize
+{
+	Plan		plan;
+
+	int			numKeys;		/* size of the two arrays below */
+
+	Oid		   *hashOperators;	/* hash operators for each key */
+	Oid		   *collations;		/* collations for each key */
+	List	   *param_exprs;	/* cache keys in the form of exprs containing
+								 * parameters */
+	bool		singlerow;		/* true if the cache entry should be marked as
+								 * complete after we store the first tuple in
+								 * it. */
+	uint32		est_entries;	/* The maximum number of entries that the
+								 * planner expects will fit in the cache, or 0
+								 * if unknown */
+	Bitmapset  *keyparamids;	/* paramids from param_exprs */
+} Memoize;
+
 /* ----------------
  *		sort node
  * ----------------
@@ -1226,6 +1264,19 @@ typedef struct Sort
 	bool	   *nullsFirst;		/* NULLS FIRST/LAST directions */
 } Sort;
 
+/* ----------------
+ *		incremental sort node
+ *
+ * The input is already sorted on the first nPresortedCols sort columns;
+ * the node only sorts each group of rows sharing their values.
+ * ----------------
+ */
+typedef struct IncrementalSort
+{
+	Sort		sort;
+	int			nPresortedCols; /* number of presorted columns */
+} IncrementalSort;
+
 /* ---------------
  *		aggregate node
  *
@@ -1487,6 +1538,19 @@ typedef enum MotionType
 	MOTIONTYPE_OUTER_QUERY	/* Gather or Broadcast to outer query's slice, don't know which one yet */
 } MotionType;
 
+/*
+ * Hot-key handling of a MOTIONTYPE_HASH Motion.  A skew-aware redistribution
+ * comes in pairs below a join: rows whose distribution key hashes like one
+ * of skewHotKeys are spread round-robin on one side and broadcast on the
+ * other, so each hot pair still meets exactly once.
+ */
+typedef enum MotionSkewMode
+{
+	MOTIONSKEW_NONE,		/* plain hash redistribution */
+	MOTIONSKEW_SPREAD,		/* send hot-key rows round-robin */
+	MOTIONSKEW_BROADCAST	/* send hot-key rows to every segment */
+} MotionSkewMode;
+
 /*
  * Motion Node
  *
@@ -1503,6 +1567,8 @@ typedef struct Motion
 	List		*hashExprs;			/* list of hash expressions */
 	Oid			*hashFuncs;			/* corresponding hash functions */
 	int         numHashSegments;	/* the module number of the hash function */
+	MotionSkewMode skewMode;		/* how to route hot-key rows */
+	List	   *skewHotKeys;		/* list of Const lists, one per hot key */
 
 	/* For Explicit */
 	AttrNumber segidColIdx;			/* index of the segid column in the target list */
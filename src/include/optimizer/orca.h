@@ -22,8 +22,27 @@
 #ifdef USE_ORCA
 
 extern PlannedStmt * optimize_query(Query *parse, int cursorOptions, ParamListInfo boundParams);
+extern bool orca_fast_path_query(Query *parse, ParamListInfo boundParams);
 extern Node *transformGroupedWindows(Node *node, void *context);
 
+/*
+ * One line of the GPORCA optimization profile: the counters of a single
+ * xform or job type, as returned by GetOptimizerProfile().
+ */
+typedef struct OptimizerProfileEntry
+{
+	const char *kind;			/* "xform" or "job" */
+	char	   *name;			/* name of the xform or job type */
+	int64		calls;			/* applications of the xform, executions of
+								 * jobs of this type */
+	double		time_ms;		/* time spent in the xform or job type */
+	int64		alternatives;	/* alternatives produced by the xform */
+	int64		memo_inserts;	/* alternatives that were new to the memo */
+} OptimizerProfileEntry;
+
+extern List *GetOptimizerProfile(bool cumulative);
+extern void ResetOptimizerProfile(void);
+
 // plan_hint_hook generates HintState by parsing a Query.
 typedef void *(*plan_hint_hook_type) ();
 extern PGDLLIMPORT plan_hint_hook_type plan_hint_hook;
@@ -63,6 +63,8 @@ extern ForeignScan *make_foreignscan(List *qptlist, List *qpqual,
 extern Plan *change_plan_targetlist(Plan *subplan, List *tlist,
 									bool tlist_parallel_safe);
 extern Plan *materialize_finished_plan(PlannerInfo *root, Plan *subplan);
+extern Memoize *make_memoize_for_params(Plan *lefttree, List *param_exprs,
+										 double calls);
 extern bool is_projection_capable_path(Path *path);
 extern bool is_projection_capable_plan(Plan *plan);
 
@@ -65,6 +65,14 @@ typedef struct DatumStreamWrite
 
 	DatumStreamBlockWrite blockWrite;
 
+	/*
+	 * Zone map of the block being filled, recorded in the block directory
+	 * when the block is written.  Only kept if the column's type supports
+	 * zone maps.
+	 */
+	bool		zonemap_enabled;
+	MinipageZoneMap zonemap;
+
 	/*
 	 * EOFs of current segment file.
 	 */
@@ -243,6 +251,23 @@ datumstreamread_nth(DatumStreamRead * acc)
 	}
 }
 
+/*
+ * Number of rows left in the current block, i.e. how many more times
+ * datumstreamread_advance() succeeds before the next block must be read.
+ */
+inline static int
+datumstreamread_remaining(DatumStreamRead * acc)
+{
+	/* blockRowCount is reset when the segment file is closed */
+	if (acc->blockRowCount == 0)
+		return 0;
+
+	if (acc->largeObjectState == DatumStreamLargeObjectState_None)
+		return acc->blockRead.logical_row_count - (acc->blockRead.nth + 1);
+	else
+		return (acc->largeObjectState == DatumStreamLargeObjectState_HaveAoContent) ? 1 : 0;
+}
+
 /* ------------------------------------------------------------------------------ */
 
 extern int datumstreamwrite_put(
@@ -324,4 +349,10 @@ extern bool datumstreamread_block_info(DatumStreamRead * acc);
  */
 extern void datumstreamread_block_content(DatumStreamRead * acc);
 
+/*
+ * Skip the CO block whose header datumstreamread_block_info just read,
+ * without reading its content.
+ */
+extern void datumstreamread_skip_block(DatumStreamRead * acc);
+
 #endif   /* DATUMSTREAM_H */
@@ -450,9 +450,12 @@ extern bool	optimizer_log;
 extern int  optimizer_log_failure;
 extern bool	optimizer_trace_fallback;
 extern int optimizer_minidump;
+extern bool optimizer_minidump_binary;
 extern int  optimizer_cost_model;
 extern bool optimizer_metadata_caching;
 extern int	optimizer_mdcache_size;
+extern int	optimizer_plan_cache_size;
+extern int	optimizer_mdcache_shared_size;
 
 /* Optimizer debugging GUCs */
 extern bool optimizer_print_query;
@@ -480,8 +483,11 @@ extern bool optimizer_enable_motions;
 extern bool optimizer_enable_motion_broadcast;
 extern bool optimizer_enable_motion_gather;
 extern bool optimizer_enable_motion_redistribute;
+extern bool optimizer_enable_skew_redistribute;
 extern bool optimizer_enable_sort;
 extern bool optimizer_enable_materialize;
+extern bool optimizer_enable_memoize;
+extern bool optimizer_enable_incremental_sort;
 extern bool optimizer_enable_partition_propagation;
 extern bool optimizer_enable_partition_selection;
 extern bool optimizer_enable_outerjoin_rewrite;
@@ -499,6 +505,7 @@ extern bool optimizer_enable_ctas;
 extern bool optimizer_enable_dml;
 extern bool	optimizer_enable_dml_constraints;
 extern bool optimizer_enable_direct_dispatch;
+extern bool optimizer_enable_fast_path;
 extern bool optimizer_enable_coordinator_only_queries;
 extern bool optimizer_enable_hashjoin;
 extern bool optimizer_enable_dynamictablescan;
@@ -558,6 +565,7 @@ extern int optimizer_cte_inlining_bound;
 extern int optimizer_push_group_by_below_setop_threshold;
 extern int optimizer_xform_bind_threshold;
 extern int optimizer_skew_factor;
+extern int optimizer_search_time_budget;
 extern bool optimizer_force_multistage_agg;
 extern bool optimizer_force_three_stage_scalar_dqa;
 extern bool optimizer_force_expanded_distinct_aggs;
@@ -0,0 +1,33 @@
+/*-------------------------------------------------------------------------
+ *
+ * orcamdcache.h
+ *	  Shared-memory cache of serialized GPORCA metadata objects.
+ *
+ *
+ * Copyright (c) 2026-Present VMware, Inc. or its affiliates.
+ *
+ * src/include/utils/orcamdcache.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef ORCAMDCACHE_H
+#define ORCAMDCACHE_H
+
+#include "storage/sinval.h"
+
+/* maximum length of a cache key, including the terminating NUL */
+#define ORCA_MDCACHE_KEY_LEN	128
+
+extern Size OrcaMDCacheShmemSize(void);
+extern void OrcaMDCacheShmemInit(void);
+
+extern bool OrcaMDCacheEnabled(void);
+extern uint64 OrcaMDCacheGetGeneration(void);
+extern void OrcaMDCacheInvalidate(const SharedInvalidationMessage *msgs,
+								  int n);
+extern char *OrcaMDCacheLookup(const char *key, Size *len);
+extern void OrcaMDCacheInsert(const char *key, uint64 generation,
+							  Oid relid, AttrNumber attnum,
+							  const char *value, Size len);
+
+#endif   /* ORCAMDCACHE_H */
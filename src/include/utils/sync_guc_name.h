@@ -49,8 +49,11 @@
 		"gp_default_storage_options",
 		"gp_detect_data_correctness",
 		"gp_disable_tuple_hints",
+		"gp_enable_aocs_batch_scan",
+		"gp_enable_aocs_block_skipping",
 		"gp_enable_blkdir_sampling",
 		"gp_enable_interconnect_aggressive_retry",
+		"gp_enable_runtime_filter",
 		"gp_enable_segment_copy_checking",
 		"gp_external_enable_filter_pushdown",
 		"gp_hashjoin_tuples_per_bucket",
@@ -58,6 +61,7 @@
 		"gp_indexcheck_insert",
 		"gp_initial_bad_row_limit",
 		"gp_interconnect_address_type",
+		"gp_interconnect_batch_io",
 		"gp_interconnect_cache_future_packets",
 		"gp_interconnect_cursor_ic_table_size",
 		"gp_interconnect_debug_retry_interval",
@@ -84,6 +88,10 @@
 		"gp_log_suboverflow_statement",
 		"gp_max_alloc_size",
 		"gp_max_packet_size",
+		"gp_motion_columnar_batch",
+		"gp_motion_compression",
+		"gp_motion_compression_min_width",
+		"gp_motion_compression_throughput_threshold",
 		"gp_motion_slice_noop",
 		"gp_quicklz_fallback",
 		"gp_resgroup_debug_wait_queue",
@@ -362,17 +362,20 @@
 		"optimizer_enable_dynamicindexonlyscan",
 		"optimizer_enable_dynamicbitmapscan",
 		"optimizer_enable_eageragg",
+		"optimizer_enable_fast_path",
 		"optimizer_enable_orderedagg",
 		"optimizer_enable_gather_on_segment_for_dml",
 		"optimizer_enable_groupagg",
 		"optimizer_enable_hashagg",
 		"optimizer_enable_hashjoin",
 		"optimizer_enable_hashjoin_redistribute_broadcast_children",
+		"optimizer_enable_incremental_sort",
 		"optimizer_enable_indexjoin",
 		"optimizer_enable_indexonlyscan",
 		"optimizer_enable_indexscan",
 		"optimizer_enable_master_only_queries",
 		"optimizer_enable_materialize",
+		"optimizer_enable_memoize",
 		"optimizer_enable_mergejoin",
 		"optimizer_enable_motion_broadcast",
 		"optimizer_enable_motion_gather",
@@ -390,6 +393,7 @@
 		"optimizer_enable_range_predicate_dpe",
 		"optimizer_enable_redistribute_nestloop_loj_inner_child",
 		"optimizer_enable_replicated_table",
+		"optimizer_enable_skew_redistribute",
 		"optimizer_enable_sort",
 		"optimizer_enable_space_pruning",
 		"optimizer_enable_streaming_material",
@@ -412,15 +416,18 @@
 		"optimizer_join_order_threshold",
 		"optimizer_log",
 		"optimizer_log_failure",
+		"optimizer_mdcache_shared_size",
 		"optimizer_mdcache_size",
 		"optimizer_metadata_caching",
 		"optimizer_minidump",
+		"optimizer_minidump_binary",
 		"optimizer_multilevel_partitioning",
 		"optimizer_nestloop_factor",
 		"optimizer_parallel_union",
 		"optimizer_partition_selection_log",
 		"optimizer_penalize_broadcast_threshold",
 		"optimizer_penalize_skew",
+		"optimizer_plan_cache_size",
 		"optimizer_plan_id",
 		"optimizer_print_expression_properties",
 		"optimizer_print_group_properties",
@@ -443,6 +450,7 @@
 		"optimizer_sample_plans",
 		"optimizer_samples_number",
 		"optimizer_search_strategy_path",
+		"optimizer_search_time_budget",
 		"optimizer_segments",
 		"optimizer_skew_factor",
 		"optimizer_sort_factor",
@@ -0,0 +1,83 @@
+-- Test the metadata cache of GPORCA that is shared by all backends: a new
+-- session finds the objects that an earlier session translated, and a
+-- committed catalog change only drops the objects of the relation it changes.
+
+-- start_ignore
+! gpconfig -c optimizer_mdcache_shared_size -v 16384;
+! gpstop -rai;
+-- end_ignore
+
+create table mdc_a (a int, b int) distributed by (a);
+create table mdc_b (a int, b int) distributed by (a);
+insert into mdc_a select i, i % 10 from generate_series(1, 1000) i;
+insert into mdc_b select i, i % 10 from generate_series(1, 1000) i;
+analyze mdc_a;
+analyze mdc_b;
+create table mdc_latency (label text, elapsed_ms float8) distributed randomly;
+
+-- Run EXPLAIN of the given query with GPORCA, and report whether it looked up
+-- objects in the shared cache, and whether all of the lookups hit.  Everything
+-- else runs with the planner, so that only the query uses the cache.  The
+-- optimization time, that is the latency of the first query of a session, is
+-- recorded under the given label.
+create function mdc_probe(label text, query text)
+returns table (looked_up bool, all_hits bool)
+language plpgsql set optimizer = off as
+$$
+declare
+  s0 record; /* in func */
+  s1 record; /* in func */
+  t0 timestamptz; /* in func */
+  t1 timestamptz; /* in func */
+begin
+  select * into s0 from gp_optimizer_mdcache_shared_stats(); /* in func */
+  perform set_config('optimizer', 'on', true); /* in func */
+  t0 := clock_timestamp(); /* in func */
+  execute 'explain ' || query; /* in func */
+  t1 := clock_timestamp(); /* in func */
+  perform set_config('optimizer', 'off', true); /* in func */
+  select * into s1 from gp_optimizer_mdcache_shared_stats(); /* in func */
+  insert into mdc_latency
+    values (label, extract(epoch from t1 - t0) * 1000); /* in func */
+  return query select s1.lookups > s0.lookups,
+    s1.hits - s0.hits = s1.lookups - s0.lookups; /* in func */
+end; /* in func */
+$$;
+
+-- the first session translates the objects from the catalog
+1: select * from mdc_probe('1 cold', 'select count(*) from mdc_a where b = 1');
+1q:
+
+-- a new session finds all of them in the shared cache
+2: select * from mdc_probe('2 warm', 'select count(*) from mdc_a where b = 1');
+2q:
+
+-- ANALYZE of another table leaves them in the cache
+3: analyze mdc_b;
+3q:
+4: select * from mdc_probe('3 after analyze of mdc_b', 'select count(*) from mdc_a where b = 1');
+4q:
+
+-- ALTER TABLE drops the objects of the table
+5: alter table mdc_a add column c int;
+5q:
+6: select * from mdc_probe('4 after alter of mdc_a', 'select count(*) from mdc_a where b = 1');
+6q:
+7: select * from mdc_probe('5 warm again', 'select count(*) from mdc_a where b = 1');
+7q:
+
+select entries > 0 as has_entries, invalidated_entries > 0 as has_invalidated
+  from gp_optimizer_mdcache_shared_stats();
+
+-- first-query latency with a cold and a warm cache; it varies from run to run
+-- start_ignore
+select label, elapsed_ms from mdc_latency order by label;
+-- end_ignore
+
+drop function mdc_probe(text, text);
+drop table mdc_a, mdc_b, mdc_latency;
+
+-- start_ignore
+! gpconfig -r optimizer_mdcache_shared_size;
+! gpstop -rai;
+-- end_ignore
@@ -0,0 +1,6 @@
+--
+-- Every row goes through a Broadcast Motion
+--
+SET gp_interconnect_batch_io = off;
+TRUNCATE ic_replicated;
+INSERT INTO ic_replicated SELECT * FROM ic_source;
@@ -0,0 +1,6 @@
+--
+-- Every row goes through a Redistribute Motion
+--
+SET gp_interconnect_batch_io = on;
+TRUNCATE ic_redistributed;
+INSERT INTO ic_redistributed SELECT * FROM ic_source;
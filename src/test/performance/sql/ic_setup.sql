@@ -0,0 +1,9 @@
+--
+-- Create the tables for the interconnect throughput tests. On a single-host
+-- cluster, all motion traffic goes over the loopback interface.
+--
+CREATE TABLE ic_source (a int, b int, payload text) DISTRIBUTED BY (a);
+INSERT INTO ic_source SELECT i, i % 1000, repeat(md5(i::text), 6) FROM generate_series(1, 5000000) i;
+ANALYZE ic_source;
+CREATE TABLE ic_redistributed (LIKE ic_source) DISTRIBUTED BY (b);
+CREATE TABLE ic_replicated (LIKE ic_source) DISTRIBUTED REPLICATED;
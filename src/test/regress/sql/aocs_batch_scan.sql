@@ -0,0 +1,113 @@
+--
+-- Batch-at-a-time scans of AOCS tables evaluate simple quals and plain
+-- aggregates over column vectors.  Run the same queries in batch mode and
+-- row by row; the results must not differ.
+--
+create table bs_t (a int, i2 int2, i4 int4, i8 int8, f8 float8, d date, t text)
+  with (appendonly=true, orientation=column, blocksize=8192)
+  distributed by (a);
+-- NULLs in every column but a and t, and a NaN in f8 every 101 rows.  With
+-- the small blocksize, the varblocks of the columns end at different rows.
+insert into bs_t
+  select i,
+         case when i % 7 = 0 then null else i % 100 end,
+         case when i % 11 = 0 then null else i * 3 - 7000 end,
+         case when i % 13 = 0 then null else i * 1000000000::int8 end,
+         case when i % 17 = 0 then null
+              when i % 101 = 0 then 'NaN'::float8
+              else i * 0.25::float8 end,
+         case when i % 19 = 0 then null else date '2020-01-01' + i % 400 end,
+         'v' || i % 10
+  from generate_series(1, 5000) i;
+set gp_enable_aocs_batch_scan = on;
+select count(*), count(i2), count(f8), sum(i2), sum(i4), min(i4), max(i4),
+       min(i8), max(i8), min(f8), max(f8), max(d) - date '2020-01-01' as days
+  from bs_t;
+select count(*), sum(f8), min(f8), max(f8) from bs_t where f8 < 'NaN';
+select count(*), min(f8), max(f8) from bs_t where f8 >= 1200;
+select count(*) from bs_t where f8 = 'NaN';
+select count(*), sum(i4) from bs_t where i2 is null;
+select count(*), sum(i4), min(i2), max(i2) from bs_t
+  where i4 is not null and i4 >= 0 and i2 <> 5;
+select count(*), min(a), max(a) from bs_t where d >= '2020-06-01' and d < '2020-07-01';
+select count(*), sum(i2) from bs_t where 10 > i2;
+select count(*), sum(i4) from bs_t where i2 < 50 having count(*) > 100;
+select count(*), sum(i4) from bs_t where i2 < 50 having count(*) > 100000;
+select count(*), sum(i4) from bs_t where t = 'v3' and i8 > 1000000000000;
+select t, count(*), max(f8) from bs_t where i8 > 4000000000000 group by t order by t;
+select a, i2, i4, f8 from bs_t where i2 = 1 and a < 1000 order by a;
+set gp_enable_aocs_batch_scan = off;
+select count(*), count(i2), count(f8), sum(i2), sum(i4), min(i4), max(i4),
+       min(i8), max(i8), min(f8), max(f8), max(d) - date '2020-01-01' as days
+  from bs_t;
+select count(*), sum(f8), min(f8), max(f8) from bs_t where f8 < 'NaN';
+select count(*), min(f8), max(f8) from bs_t where f8 >= 1200;
+select count(*) from bs_t where f8 = 'NaN';
+select count(*), sum(i4) from bs_t where i2 is null;
+select count(*), sum(i4), min(i2), max(i2) from bs_t
+  where i4 is not null and i4 >= 0 and i2 <> 5;
+select count(*), min(a), max(a) from bs_t where d >= '2020-06-01' and d < '2020-07-01';
+select count(*), sum(i2) from bs_t where 10 > i2;
+select count(*), sum(i4) from bs_t where i2 < 50 having count(*) > 100;
+select count(*), sum(i4) from bs_t where i2 < 50 having count(*) > 100000;
+select count(*), sum(i4) from bs_t where t = 'v3' and i8 > 1000000000000;
+select t, count(*), max(f8) from bs_t where i8 > 4000000000000 group by t order by t;
+select a, i2, i4, f8 from bs_t where i2 = 1 and a < 1000 order by a;
+reset gp_enable_aocs_batch_scan;
+-- the rows stored before ADD COLUMN read the columns' missing values
+alter table bs_t add column n int default 42;
+alter table bs_t add column m text;
+insert into bs_t
+  select i,
+         case when i % 7 = 0 then null else i % 100 end,
+         case when i % 11 = 0 then null else i * 3 - 7000 end,
+         case when i % 13 = 0 then null else i * 1000000000::int8 end,
+         case when i % 17 = 0 then null
+              when i % 101 = 0 then 'NaN'::float8
+              else i * 0.25::float8 end,
+         case when i % 19 = 0 then null else date '2020-01-01' + i % 400 end,
+         'v' || i % 10, i, 'x' || i % 3
+  from generate_series(5001, 6000) i;
+set gp_enable_aocs_batch_scan = on;
+select count(*), count(i2), count(f8), sum(i2), sum(i4), min(i4), max(i4),
+       min(i8), max(i8), min(f8), max(f8), max(d) - date '2020-01-01' as days
+  from bs_t;
+select count(*), count(n), sum(n), min(n), max(n), count(m) from bs_t;
+select count(*), sum(i4) from bs_t where n = 42;
+select count(*), sum(n) from bs_t where m is null and i2 > 90;
+set gp_enable_aocs_batch_scan = off;
+select count(*), count(i2), count(f8), sum(i2), sum(i4), min(i4), max(i4),
+       min(i8), max(i8), min(f8), max(f8), max(d) - date '2020-01-01' as days
+  from bs_t;
+select count(*), count(n), sum(n), min(n), max(n), count(m) from bs_t;
+select count(*), sum(i4) from bs_t where n = 42;
+select count(*), sum(n) from bs_t where m is null and i2 > 90;
+reset gp_enable_aocs_batch_scan;
+-- deleted rows, and the old versions of updated ones, are left out through
+-- the visimap
+delete from bs_t where a % 5 = 0;
+update bs_t set i4 = -i4 where a % 10 = 3;
+set gp_enable_aocs_batch_scan = on;
+select count(*), count(i2), count(f8), sum(i2), sum(i4), min(i4), max(i4),
+       min(i8), max(i8), min(f8), max(f8), max(d) - date '2020-01-01' as days
+  from bs_t;
+select count(*), sum(f8), min(f8), max(f8) from bs_t where f8 < 'NaN';
+select count(*), sum(i4), min(i2), max(i2) from bs_t
+  where i4 is not null and i4 >= 0 and i2 <> 5;
+select count(*), sum(i4) from bs_t where i2 < 50 having count(*) > 100;
+select count(*), count(n), sum(n), min(n), max(n), count(m) from bs_t;
+select count(*), sum(i4) from bs_t where n = 42;
+select a, i2, i4, f8 from bs_t where i2 = 1 and a < 1000 order by a;
+set gp_enable_aocs_batch_scan = off;
+select count(*), count(i2), count(f8), sum(i2), sum(i4), min(i4), max(i4),
+       min(i8), max(i8), min(f8), max(f8), max(d) - date '2020-01-01' as days
+  from bs_t;
+select count(*), sum(f8), min(f8), max(f8) from bs_t where f8 < 'NaN';
+select count(*), sum(i4), min(i2), max(i2) from bs_t
+  where i4 is not null and i4 >= 0 and i2 <> 5;
+select count(*), sum(i4) from bs_t where i2 < 50 having count(*) > 100;
+select count(*), count(n), sum(n), min(n), max(n), count(m) from bs_t;
+select count(*), sum(i4) from bs_t where n = 42;
+select a, i2, i4, f8 from bs_t where i2 = 1 and a < 1000 order by a;
+reset gp_enable_aocs_batch_scan;
+drop table bs_t;
@@ -0,0 +1,72 @@
+--
+-- Zone maps in the block directory of AOCS tables let sequential scans skip
+-- varblocks whose value ranges rule out the scan's qual.  Run the same
+-- queries with and without block skipping; the results must not differ.
+--
+create table aocs_zonemap (a int, b int8, c int, d date)
+  with (appendonly=true, orientation=column, blocksize=8192)
+  distributed by (a);
+-- varblocks of a few thousand rows, with b and d ascending and a run of
+-- NULLs in c
+insert into aocs_zonemap
+  select i, i, case when i between 20001 and 30000 then null else i end,
+         date '2000-01-01' + i / 100
+  from generate_series(1, 100000) i;
+-- the block directory, and the zone maps of the existing varblocks, are
+-- built by CREATE INDEX; index a column the queries don't filter on
+create index aocs_zonemap_a_idx on aocs_zonemap (a);
+set gp_enable_aocs_block_skipping = on;
+select count(*), sum(b) from aocs_zonemap where b between 40001 and 40100;
+select count(*), min(b), max(b) from aocs_zonemap where b < 100;
+select count(*), min(b), max(b) from aocs_zonemap where b > 99990;
+select count(*), sum(b) from aocs_zonemap where b = 77777;
+select count(*), sum(b) from aocs_zonemap where b >= 99000 and c <= 99500;
+select count(*), sum(b) from aocs_zonemap where c > 99990::int8;
+select count(*), min(b), max(b) from aocs_zonemap where c is null;
+select count(*), sum(b) from aocs_zonemap where c is not null and b <= 30000;
+select count(*), min(b), max(b) from aocs_zonemap where d >= date '2000-01-01' + 990;
+select count(*), min(b), max(b) from aocs_zonemap where d < '2000-01-02';
+set gp_enable_aocs_block_skipping = off;
+select count(*), sum(b) from aocs_zonemap where b between 40001 and 40100;
+select count(*), min(b), max(b) from aocs_zonemap where b < 100;
+select count(*), min(b), max(b) from aocs_zonemap where b > 99990;
+select count(*), sum(b) from aocs_zonemap where b = 77777;
+select count(*), sum(b) from aocs_zonemap where b >= 99000 and c <= 99500;
+select count(*), sum(b) from aocs_zonemap where c > 99990::int8;
+select count(*), min(b), max(b) from aocs_zonemap where c is null;
+select count(*), sum(b) from aocs_zonemap where c is not null and b <= 30000;
+select count(*), min(b), max(b) from aocs_zonemap where d >= date '2000-01-01' + 990;
+select count(*), min(b), max(b) from aocs_zonemap where d < '2000-01-02';
+-- rows deleted through the visimap stay in their varblocks, and in the
+-- zone maps
+delete from aocs_zonemap where b between 40001 and 40050;
+-- varblocks written after the block directory exists get zone maps too
+insert into aocs_zonemap
+  select i, i, i, date '2000-01-01' + i / 100
+  from generate_series(100001, 110000) i;
+set gp_enable_aocs_block_skipping = on;
+select count(*), sum(b) from aocs_zonemap where b between 40001 and 40100;
+select count(*), min(b), max(b) from aocs_zonemap where b > 99990;
+select count(*), min(b), max(b) from aocs_zonemap where c is null;
+set gp_enable_aocs_block_skipping = off;
+select count(*), sum(b) from aocs_zonemap where b between 40001 and 40100;
+select count(*), min(b), max(b) from aocs_zonemap where b > 99990;
+select count(*), min(b), max(b) from aocs_zonemap where c is null;
+-- the rows of a column added later have no varblocks of their own, until
+-- new rows are inserted
+alter table aocs_zonemap add column e int default 7;
+insert into aocs_zonemap
+  select i, i, i, date '2000-01-01' + i / 100, i
+  from generate_series(110001, 110100) i;
+set gp_enable_aocs_block_skipping = on;
+select count(*), sum(b) from aocs_zonemap where e = 7;
+select count(*), min(b), max(b) from aocs_zonemap where e > 7;
+select count(*), sum(b) from aocs_zonemap where e >= 110050;
+select count(*), sum(b) from aocs_zonemap where e is null;
+set gp_enable_aocs_block_skipping = off;
+select count(*), sum(b) from aocs_zonemap where e = 7;
+select count(*), min(b), max(b) from aocs_zonemap where e > 7;
+select count(*), sum(b) from aocs_zonemap where e >= 110050;
+select count(*), sum(b) from aocs_zonemap where e is null;
+reset gp_enable_aocs_block_skipping;
+drop table aocs_zonemap;
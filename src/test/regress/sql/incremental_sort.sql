@@ -0,0 +1,80 @@
+--
+-- Incremental Sort sorts an input that is already ordered on a prefix of the
+-- sort keys one group of that prefix at a time.  It is only planned by
+-- GPORCA.
+--
+create table incsort_t (a int, b int, c int) distributed by (a);
+-- groups of 30 to 600 rows, the larger ones spanning several batches.  The
+-- even groups are stored in the order of b, the odd ones in reverse order.
+insert into incsort_t
+  select a, b, b % 7 from generate_series(0, 19) a, generate_series(1, 30 * (a + 1)) b
+  where a % 2 = 0 order by a, b;
+insert into incsort_t
+  select a, b, b % 7 from generate_series(0, 19) a, generate_series(1, 30 * (a + 1)) b
+  where a % 2 = 1 order by a, b desc;
+analyze incsort_t;
+-- report whether the plan has an Incremental Sort node, and whether it
+-- showed its presorted key and batch statistics
+create function incsort_plan(query text)
+returns table (incremental_sort bool, presorted_key bool, batches bool)
+language plpgsql as
+$$
+declare
+  ln text;
+begin
+  incremental_sort := false;
+  presorted_key := false;
+  batches := false;
+  for ln in execute
+    'explain (analyze, costs off, timing off, summary off) ' || query
+  loop
+    incremental_sort := incremental_sort or ln ~ 'Incremental Sort';
+    presorted_key := presorted_key or ln ~ 'Presorted Key: a';
+    batches := batches or ln ~ 'Sort batches: \d+';
+  end loop;
+  return next;
+end;
+$$;
+-- count the rows of the query, and those that are not in (a, b) order
+create function incsort_check(query text)
+returns table (total int8, out_of_order int8, sum_s int8)
+language plpgsql as
+$$
+declare
+  r record;
+  prev_a int;
+  prev_b int;
+begin
+  total := 0;
+  out_of_order := 0;
+  sum_s := 0;
+  for r in execute query
+  loop
+    if prev_a is not null and
+       (r.a < prev_a or (r.a = prev_a and r.b <= prev_b)) then
+      out_of_order := out_of_order + 1;
+    end if;
+    prev_a := r.a;
+    prev_b := r.b;
+    total := total + 1;
+    sum_s := sum_s + r.s;
+  end loop;
+  return next;
+end;
+$$;
+set optimizer_enable_incremental_sort = on;
+select * from incsort_plan($$select a, b, sum(c) over (partition by a) s from incsort_t order by a, b$$);
+select * from incsort_check($$select a, b, sum(c) over (partition by a) s from incsort_t order by a, b$$);
+select a, b from (select a, b, sum(c) over (partition by a) s from incsort_t) w order by a, b limit 3;
+-- the sorted batches don't depend on the sort memory
+set statement_mem = '1MB';
+select * from incsort_check($$select a, b, sum(c) over (partition by a) s from incsort_t order by a, b$$);
+reset statement_mem;
+set optimizer_enable_incremental_sort = off;
+select * from incsort_plan($$select a, b, sum(c) over (partition by a) s from incsort_t order by a, b$$);
+select * from incsort_check($$select a, b, sum(c) over (partition by a) s from incsort_t order by a, b$$);
+select a, b from (select a, b, sum(c) over (partition by a) s from incsort_t) w order by a, b limit 3;
+reset optimizer_enable_incremental_sort;
+drop function incsort_plan(text);
+drop function incsort_check(text);
+drop table incsort_t;
@@ -0,0 +1,91 @@
+--
+-- Memoize caches the rows of the inner side of an index nested loop join per
+-- value of the join key.  It is only planned by GPORCA.
+--
+create table mz_outer (k int, k2 int, id int) distributed by (k);
+create table mz_inner (k int, v int, pad text) distributed by (k);
+-- each value of k occurs in ten consecutive outer rows and each value of
+-- k2 in two; k matches a hundred inner rows of 200 bytes
+insert into mz_outer select i / 10, i / 2, i from generate_series(0, 1999) i;
+insert into mz_inner select i % 200, i, repeat('x', 200)
+  from generate_series(0, 19999) i;
+create index mz_inner_k_idx on mz_inner (k);
+analyze mz_outer;
+analyze mz_inner;
+-- report whether the plan has a Memoize node, and whether its cache had any
+-- hits, misses and evictions
+create function memoize_stats(query text)
+returns table (memoize bool, hits bool, misses bool, evictions bool)
+language plpgsql as
+$$
+declare
+  ln text;
+  m text[];
+begin
+  memoize := false;
+  hits := false;
+  misses := false;
+  evictions := false;
+  for ln in execute
+    'explain (analyze, costs off, timing off, summary off) ' || query
+  loop
+    if ln ~ 'Memoize' then
+      memoize := true;
+    end if;
+    m := regexp_match(ln, 'Cache hits: (\d+), misses: (\d+), evictions: (\d+)');
+    if m is not null then
+      hits := hits or m[1]::int8 > 0;
+      misses := misses or m[2]::int8 > 0;
+      evictions := evictions or m[3]::int8 > 0;
+    end if;
+  end loop;
+  return next;
+end;
+$$;
+-- report whether the optimizer plans a Memoize node for a query
+create function memoize_planned(query text) returns bool
+language plpgsql as
+$$
+declare
+  ln text;
+begin
+  for ln in execute 'explain (costs off) ' || query
+  loop
+    if ln ~ 'Memoize' then
+      return true;
+    end if;
+  end loop;
+  return false;
+end;
+$$;
+set optimizer_enable_hashjoin = off;
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+set optimizer_enable_memoize = on;
+select * from memoize_stats($$select count(*), sum(i.v), sum(length(i.pad)) from mz_outer o join mz_inner i on i.k = o.k$$);
+select count(*), sum(i.v), sum(length(i.pad)) from mz_outer o join mz_inner i on i.k = o.k;
+-- the optimizer plans a Memoize node only if enough of the rescans are
+-- expected to hit the cache: not for unique keys, and not for keys whose
+-- rows would mostly not fit in the memory of the cache
+select memoize_planned($$select count(*) from mz_outer o join mz_inner i on i.k = o.k$$);
+select memoize_planned($$select count(*) from mz_outer o join mz_inner i on i.k = o.id$$);
+select memoize_planned($$select count(*) from mz_outer o join mz_inner i on i.k = o.k2$$);
+set statement_mem = '1MB';
+-- too few of the keys of k2 fit in a smaller cache
+select memoize_planned($$select count(*) from mz_outer o join mz_inner i on i.k = o.k2$$);
+-- enough of the keys of k fit, and the cache evicts the least recently used
+-- ones
+select * from memoize_stats($$select count(*), sum(i.v), sum(length(i.pad)) from mz_outer o join mz_inner i on i.k = o.k$$);
+select count(*), sum(i.v), sum(length(i.pad)) from mz_outer o join mz_inner i on i.k = o.k;
+reset statement_mem;
+set optimizer_enable_memoize = off;
+select * from memoize_stats($$select count(*), sum(i.v), sum(length(i.pad)) from mz_outer o join mz_inner i on i.k = o.k$$);
+select count(*), sum(i.v), sum(length(i.pad)) from mz_outer o join mz_inner i on i.k = o.k;
+reset optimizer_enable_memoize;
+reset optimizer_enable_hashjoin;
+reset enable_hashjoin;
+reset enable_mergejoin;
+drop function memoize_stats(text);
+drop function memoize_planned(text);
+drop table mz_outer;
+drop table mz_inner;
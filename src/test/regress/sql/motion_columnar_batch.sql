@@ -0,0 +1,109 @@
+--
+-- Motions that send their tuples in columnar batches, with and without
+-- compression of the batches.  Each set of queries must give the same
+-- results as with tuples sent one at a time.
+--
+create table cb_t (a int, x int, b int, s text, p text, f float8) distributed by (a);
+-- NULLs in s, p and f; values of p from empty to 100kB, the largest ones
+-- compressed in place or stored out of line
+insert into cb_t
+  select a, a, a % 7,
+         case when a % 5 = 0 then null else 's' || a end,
+         case when a % 11 = 0 then null
+              when a % 500 = 1 then repeat('long' || a, 20000)
+              when a % 500 = 2 then h
+              else repeat('p', a % 2000) end,
+         case when a % 13 = 0 then null else a * 0.5 end
+  from generate_series(1, 3000) a,
+       (select string_agg(md5(j::text), '' order by j) h
+        from generate_series(1, 1000) j) s;
+alter table cb_t drop column x;
+analyze cb_t;
+-- the target of a redistributing INSERT, with a dropped column too
+create table cb_r (a int, x int, b int, s text, p text, f float8) distributed by (b);
+alter table cb_r drop column x;
+-- a small table to broadcast
+create table cb_k (b int, label text) distributed by (label);
+insert into cb_k values (1, null), (2, 's'), (3, repeat('k', 5000)), (4, 'kk');
+-- count the rows of a query ordered by a, and those out of order
+create function cb_check_order(query text)
+returns table (total int8, out_of_order int8)
+language plpgsql as
+$$
+declare
+  r record;
+  prev_a int;
+begin
+  total := 0;
+  out_of_order := 0;
+  for r in execute query
+  loop
+    if prev_a is not null and r.a <= prev_a then
+      out_of_order := out_of_order + 1;
+    end if;
+    prev_a := r.a;
+    total := total + 1;
+  end loop;
+  return next;
+end;
+$$;
+set gp_motion_columnar_batch = on;
+set gp_motion_compression = on;
+set gp_motion_compression_min_width = 0;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_t limit 100000) t;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_t order by a limit 100000) t;
+select * from cb_check_order('select a, s, p from cb_t order by a');
+select count(c), sum(length(textin(c))), md5(string_agg(textin(c), ',' order by a))
+  from (select a, textout(s) c from cb_t limit 100000) t;
+select count(*), count(k.label), sum(length(k.label)), sum(length(t.p))
+  from cb_t t join cb_k k on t.b = k.b;
+insert into cb_r select * from cb_t;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_r limit 100000) t;
+truncate cb_r;
+set gp_motion_compression = off;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_t limit 100000) t;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_t order by a limit 100000) t;
+select * from cb_check_order('select a, s, p from cb_t order by a');
+select count(c), sum(length(textin(c))), md5(string_agg(textin(c), ',' order by a))
+  from (select a, textout(s) c from cb_t limit 100000) t;
+select count(*), count(k.label), sum(length(k.label)), sum(length(t.p))
+  from cb_t t join cb_k k on t.b = k.b;
+insert into cb_r select * from cb_t;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_r limit 100000) t;
+truncate cb_r;
+set gp_motion_columnar_batch = off;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_t limit 100000) t;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_t order by a limit 100000) t;
+select * from cb_check_order('select a, s, p from cb_t order by a');
+select count(c), sum(length(textin(c))), md5(string_agg(textin(c), ',' order by a))
+  from (select a, textout(s) c from cb_t limit 100000) t;
+select count(*), count(k.label), sum(length(k.label)), sum(length(t.p))
+  from cb_t t join cb_k k on t.b = k.b;
+insert into cb_r select * from cb_t;
+select count(*), count(s), count(p), sum(length(s)), sum(length(p)), sum(f),
+       md5(string_agg(coalesce(s, '-') || coalesce(p, '-'), ',' order by a))
+  from (select a, s, p, f from cb_r limit 100000) t;
+truncate cb_r;
+reset gp_motion_columnar_batch;
+reset gp_motion_compression;
+reset gp_motion_compression_min_width;
+drop function cb_check_order(text);
+drop table cb_t;
+drop table cb_r;
+drop table cb_k;
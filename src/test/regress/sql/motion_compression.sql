@@ -0,0 +1,49 @@
+--
+-- Motion tuple compression.  Small tuples are compressed into the transport
+-- buffer directly; tuples larger than a chunk are compressed and then split
+-- into a list of chunks.
+--
+create table mc_t (a int, p text) distributed by (a);
+-- keep the wide values uncompressed in storage, so that the Motion sees them
+-- in full
+alter table mc_t alter column p set storage external;
+insert into mc_t select a, repeat('abcd' || a % 10, 200) from generate_series(1, 2000) a;
+insert into mc_t
+  select a, repeat('x', 20000) || h
+  from generate_series(2001, 2005) a,
+       (select string_agg(md5(j::text), '' order by j) h
+        from generate_series(1, 400) j) s;
+analyze mc_t;
+-- report whether any Motion of the plan compressed its tuples
+create function motion_compressed(query text) returns bool
+language plpgsql as
+$$
+declare
+  ln text;
+begin
+  for ln in execute
+    'explain (analyze, costs off, timing off, summary off) ' || query
+  loop
+    if ln ~ 'Compression saved \d+ bytes' then
+      return true;
+    end if;
+  end loop;
+  return false;
+end;
+$$;
+-- the rows are gathered in full on the coordinator, and checksummed there
+set gp_motion_compression = on;
+set gp_motion_compression_min_width = 100;
+select motion_compressed($$select count(*), sum(length(p)), md5(string_agg(p, '' order by a))
+  from (select a, p from mc_t order by a limit 100000) s$$);
+select count(*), sum(length(p)), md5(string_agg(p, '' order by a))
+  from (select a, p from mc_t order by a limit 100000) s;
+set gp_motion_compression = off;
+select motion_compressed($$select count(*), sum(length(p)), md5(string_agg(p, '' order by a))
+  from (select a, p from mc_t order by a limit 100000) s$$);
+select count(*), sum(length(p)), md5(string_agg(p, '' order by a))
+  from (select a, p from mc_t order by a limit 100000) s;
+reset gp_motion_compression;
+reset gp_motion_compression_min_width;
+drop function motion_compressed(text);
+drop table mc_t;
@@ -0,0 +1,54 @@
+--
+-- With optimizer_enable_fast_path, queries that have a single obvious plan,
+-- a point lookup or a single-row insert dispatched directly to one segment,
+-- skip GPORCA and are planned by the Postgres-based planner.  EXPLAIN tells
+-- such plans apart.
+--
+create table fp_t (a int, b int, c int) distributed by (a, b);
+insert into fp_t select i, i % 10, i from generate_series(1, 100) i;
+analyze fp_t;
+-- report the EXPLAIN line naming the optimizer
+create function fp_explain_optimizer(query text) returns setof text
+language plpgsql as
+$$
+declare
+  ln text;
+begin
+  for ln in execute 'explain (costs off) ' || query
+  loop
+    if ln ~ '^\s*Optimizer' then
+      return next btrim(ln);
+    end if;
+  end loop;
+end;
+$$;
+prepare fp_q (int, int) as select * from fp_t where a = $1 and b = $2;
+-- the fast path is off by default
+select * from fp_explain_optimizer('select * from fp_t where a = 1 and b = 2');
+set optimizer_enable_fast_path = on;
+-- trivial queries: every distribution key column is pinned to a value
+select * from fp_explain_optimizer('select * from fp_t where a = 1 and b = 2');
+select * from fp_explain_optimizer('select c from fp_t where b = 2 and a = 1 and c > 0');
+select * from fp_explain_optimizer('insert into fp_t values (2, 2, 2)');
+select * from fp_explain_optimizer('execute fp_q (1, 1)');
+-- queries that are not trivial still go to GPORCA
+select * from fp_explain_optimizer('select * from fp_t where a = 1');
+select * from fp_explain_optimizer('select * from fp_t where a = 1 and b > 2');
+select * from fp_explain_optimizer('select count(*) from fp_t where a = 1 and b = 1');
+select * from fp_explain_optimizer('select * from fp_t where a = 1 and b = 1 order by c');
+select * from fp_explain_optimizer($$select * from fp_t t1 join fp_t t2 using (a, b) where t1.a = 1 and t1.b = 1$$);
+select * from fp_explain_optimizer('insert into fp_t values (1, 1, 1), (2, 2, 2)');
+select * from fp_explain_optimizer('insert into fp_t (a, c) values (1, 1)');
+-- a generic plan does not know the values of the parameters
+set plan_cache_mode = force_generic_plan;
+select * from fp_explain_optimizer('execute fp_q (1, 1)');
+reset plan_cache_mode;
+-- plans of the fast path give the right results
+insert into fp_t values (1, 1, 1000);
+select * from fp_t where a = 1 and b = 1 order by c;
+execute fp_q (11, 1);
+select * from fp_t where a = 1 and b = 2;
+reset optimizer_enable_fast_path;
+deallocate fp_q;
+drop function fp_explain_optimizer(text);
+drop table fp_t;
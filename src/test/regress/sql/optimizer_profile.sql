@@ -0,0 +1,69 @@
+--
+-- GPORCA records the time spent, alternatives produced and memo insertions
+-- per xform, and the time spent per job type.  EXPLAIN (OPTIMIZER_PROFILE)
+-- shows the profile of the explained query, gp_optimizer_profile() the
+-- profile of all queries of the session since gp_optimizer_profile_reset().
+-- Times vary from run to run, so only check which entries show up and how
+-- the counters relate.
+--
+create table op_t1 (a int, b int) distributed by (a);
+create table op_t2 (a int, b int) distributed by (a);
+insert into op_t1 select i, i % 10 from generate_series(1, 100) i;
+insert into op_t2 select i, i % 10 from generate_series(1, 100) i;
+analyze op_t1;
+analyze op_t2;
+-- report the profile lines of the inner join xform and of the
+-- transformation job, without the counters
+create function op_explain_profile(query text) returns setof text
+language plpgsql as
+$$
+declare
+  ln text;
+begin
+  for ln in execute 'explain (costs off, optimizer_profile) ' || query
+  loop
+    if ln ~ '^\s*(Optimizer Profile:|Xform CXformImplementInnerJoin:|Job Transformation:)' then
+      return next regexp_replace(btrim(ln), '=[0-9.]+', '=#', 'g');
+    end if;
+  end loop;
+end;
+$$;
+-- check that the profile of the session adds up the profiles of its
+-- queries: optimizing the same join twice doubles the calls of its xforms
+create function op_check_cumulative() returns bool
+language plpgsql as
+$$
+declare
+  once int8;
+  twice int8;
+begin
+  perform gp_optimizer_profile_reset();
+  perform count(*) from op_t1 join op_t2 on op_t1.b = op_t2.a;
+  once := (select calls from gp_optimizer_profile()
+           where name = 'CXformImplementInnerJoin');
+  perform count(*) from op_t1 join op_t2 on op_t1.b = op_t2.a;
+  twice := (select calls from gp_optimizer_profile()
+            where name = 'CXformImplementInnerJoin');
+  return twice = 2 * once;
+end;
+$$;
+select * from op_explain_profile('select count(*) from op_t1 join op_t2 on op_t1.b = op_t2.a');
+-- the profile of the session starts empty after a reset
+select gp_optimizer_profile_reset();
+select count(*) from gp_optimizer_profile() where name = 'CXformImplementInnerJoin';
+select count(*) from op_t1 join op_t2 on op_t1.b = op_t2.a;
+-- every entry was used, and only xforms produce alternatives, of which
+-- some may already be in the memo
+select kind, bool_and(calls > 0 and time_ms >= 0 and
+                      case when kind = 'xform'
+                           then memo_inserts <= alternatives
+                           else alternatives is null and memo_inserts is null
+                      end) as valid
+  from gp_optimizer_profile() group by kind order by kind;
+select op_check_cumulative();
+select gp_optimizer_profile_reset();
+select count(*) from gp_optimizer_profile() where name = 'CXformImplementInnerJoin';
+drop function op_explain_profile(text);
+drop function op_check_cumulative();
+drop table op_t1;
+drop table op_t2;
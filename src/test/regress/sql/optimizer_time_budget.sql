@@ -0,0 +1,31 @@
+--
+-- optimizer_search_time_budget caps the time of the GPORCA search.  A search
+-- cut off by the budget still returns the best plan found so far, and
+-- EXPLAIN reports the search stage that ran out of time.
+--
+create table tb_t (a int, b int) distributed by (a);
+insert into tb_t select i, i % 10 from generate_series(1, 100) i;
+analyze tb_t;
+-- report the EXPLAIN lines about the optimizer
+create function tb_explain_optimizer(query text) returns setof text
+language plpgsql as
+$$
+declare
+  ln text;
+begin
+  for ln in execute 'explain (costs off) ' || query
+  loop
+    if ln ~ '^\s*Optimizer' then
+      return next btrim(ln);
+    end if;
+  end loop;
+end;
+$$;
+set optimizer_search_time_budget = 1;
+select * from tb_explain_optimizer($$select count(*) from tb_t t1 join tb_t t2 on t1.b = t2.a join tb_t t3 on t2.b = t3.a join tb_t t4 on t3.b = t4.a join tb_t t5 on t4.b = t5.a join tb_t t6 on t5.b = t6.a join tb_t t7 on t6.b = t7.a join tb_t t8 on t7.b = t8.a join tb_t t9 on t8.b = t9.a join tb_t t10 on t9.b = t10.a join tb_t t11 on t10.b = t11.a join tb_t t12 on t11.b = t12.a$$);
+-- the cut-off search still finds a plan with the right result
+select count(*) from tb_t t1 join tb_t t2 on t1.b = t2.a join tb_t t3 on t2.b = t3.a join tb_t t4 on t3.b = t4.a join tb_t t5 on t4.b = t5.a join tb_t t6 on t5.b = t6.a join tb_t t7 on t6.b = t7.a join tb_t t8 on t7.b = t8.a join tb_t t9 on t8.b = t9.a join tb_t t10 on t9.b = t10.a join tb_t t11 on t10.b = t11.a join tb_t t12 on t11.b = t12.a;
+reset optimizer_search_time_budget;
+select * from tb_explain_optimizer($$select count(*) from tb_t t1 join tb_t t2 on t1.b = t2.a join tb_t t3 on t2.b = t3.a join tb_t t4 on t3.b = t4.a join tb_t t5 on t4.b = t5.a join tb_t t6 on t5.b = t6.a join tb_t t7 on t6.b = t7.a join tb_t t8 on t7.b = t8.a join tb_t t9 on t8.b = t9.a join tb_t t10 on t9.b = t10.a join tb_t t11 on t10.b = t11.a join tb_t t12 on t11.b = t12.a$$);
+drop function tb_explain_optimizer(text);
+drop table tb_t;
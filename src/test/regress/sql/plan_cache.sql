@@ -0,0 +1,49 @@
+--
+-- GPORCA plan cache.  A repeated query is served from the cache as long as
+-- the query tree, the optimizer settings and the catalog stay the same.
+--
+create table pc_t (a int, b int) distributed by (a);
+insert into pc_t select a, a % 10 from generate_series(1, 1000) a;
+analyze pc_t;
+-- report whether the plan of the query came from the plan cache
+create function pc_hit(query text) returns bool
+language plpgsql as
+$$
+declare
+  ln text;
+begin
+  for ln in execute 'explain (costs off) ' || query
+  loop
+    if ln ~ 'Optimizer Plan Cache: hit' then
+      return true;
+    end if;
+  end loop;
+  return false;
+end;
+$$;
+set optimizer_plan_cache_size = '1MB';
+-- a miss, then a hit
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+select count(*), sum(a) from pc_t where b = 1;
+select count(*), sum(a) from pc_t where b = 1;
+-- a different optimizer setting is a different key, and the plan of
+-- the previous setting stays cached
+set optimizer_enable_hashagg = off;
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+reset optimizer_enable_hashagg;
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+-- constants are part of the key
+select pc_hit('select count(*), sum(a) from pc_t where b = 2');
+select pc_hit('select count(*), sum(a) from pc_t where b = 2');
+select count(*), sum(a) from pc_t where b = 2;
+-- catalog changes purge the cache
+analyze pc_t;
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+set optimizer_plan_cache_size = 0;
+select pc_hit('select count(*), sum(a) from pc_t where b = 1');
+reset optimizer_plan_cache_size;
+drop function pc_hit(text);
+drop table pc_t;
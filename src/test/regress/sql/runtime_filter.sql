@@ -0,0 +1,48 @@
+--
+-- Runtime filters: a hash join hands a Bloom filter over its inner hash keys
+-- to the scan on its outer side, which drops the rows that can't match.  The
+-- results must be the same as without the filter.
+--
+create table rf_fact (k int, v int) distributed by (k);
+create table rf_dim (k int, name text) distributed by (k);
+insert into rf_fact select i % 1000, i from generate_series(1, 100000) i;
+insert into rf_fact select null, i from generate_series(1, 100) i;
+insert into rf_dim select i, 'dim' || i from generate_series(0, 999, 100) i;
+insert into rf_dim values (null, 'none');
+analyze rf_fact;
+analyze rf_dim;
+set gp_enable_runtime_filter = on;
+select count(*), sum(f.v) from rf_fact f join rf_dim d on f.k = d.k;
+select count(*) from rf_fact f where f.k in (select k from rf_dim);
+select count(*), sum(v) from rf_fact f
+  where exists (select 1 from rf_dim d where d.k = f.k and d.name <> 'dim0');
+select count(*), sum(f.v) from rf_fact f join rf_dim d
+  on f.k = d.k and f.v % 3 = d.k % 3;
+select count(*), count(f.k) from rf_dim d left join rf_fact f on f.k = d.k;
+select d.name, count(*), max(f.v) from rf_fact f join rf_dim d on f.k = d.k
+  group by d.name order by d.name;
+-- with a memory quota too small for the filter, the hash join does without
+set statement_mem = '2MB';
+select count(*), sum(f.v) from rf_fact f join rf_dim d on f.k = d.k;
+select count(*) from rf_fact f where f.k in (select k from rf_dim);
+select count(*), sum(v) from rf_fact f
+  where exists (select 1 from rf_dim d where d.k = f.k and d.name <> 'dim0');
+select count(*), sum(f.v) from rf_fact f join rf_dim d
+  on f.k = d.k and f.v % 3 = d.k % 3;
+select count(*), count(f.k) from rf_dim d left join rf_fact f on f.k = d.k;
+select d.name, count(*), max(f.v) from rf_fact f join rf_dim d on f.k = d.k
+  group by d.name order by d.name;
+reset statement_mem;
+set gp_enable_runtime_filter = off;
+select count(*), sum(f.v) from rf_fact f join rf_dim d on f.k = d.k;
+select count(*) from rf_fact f where f.k in (select k from rf_dim);
+select count(*), sum(v) from rf_fact f
+  where exists (select 1 from rf_dim d where d.k = f.k and d.name <> 'dim0');
+select count(*), sum(f.v) from rf_fact f join rf_dim d
+  on f.k = d.k and f.v % 3 = d.k % 3;
+select count(*), count(f.k) from rf_dim d left join rf_fact f on f.k = d.k;
+select d.name, count(*), max(f.v) from rf_fact f join rf_dim d on f.k = d.k
+  group by d.name order by d.name;
+reset gp_enable_runtime_filter;
+drop table rf_fact;
+drop table rf_dim;